@@ -0,0 +1,304 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchElasticMaterial.hh" // Implementation of class methods
+
+#include "BenchmarkRunner.hh" // USES BenchmarkRunner
+
+#include "materials/data/ElasticPlaneStrainData.hh" // USES ElasticPlaneStrainData
+#include "materials/data/ElasticPlaneStressData.hh" // USES ElasticPlaneStressData
+#include "materials/data/ElasticIsotropic3DData.hh" // USES ElasticIsotropic3DData
+#include "materials/data/MaxwellIsotropic3DElasticData.hh" // USES MaxwellIsotropic3DElasticData
+#include "materials/data/MaxwellIsotropic3DTimeDepData.hh" // USES MaxwellIsotropic3DTimeDepData
+#include "materials/data/MaxwellPlaneStrainElasticData.hh" // USES MaxwellPlaneStrainElasticData
+#include "materials/data/MaxwellPlaneStrainTimeDepData.hh" // USES MaxwellPlaneStrainTimeDepData
+#include "materials/data/GenMaxwellIsotropic3DElasticData.hh" // USES GenMaxwellIsotropic3DElasticData
+#include "materials/data/GenMaxwellIsotropic3DTimeDepData.hh" // USES GenMaxwellIsotropic3DTimeDepData
+#include "materials/data/GenMaxwellPlaneStrainElasticData.hh" // USES GenMaxwellPlaneStrainElasticData
+#include "materials/data/GenMaxwellPlaneStrainTimeDepData.hh" // USES GenMaxwellPlaneStrainTimeDepData
+#include "materials/data/GenMaxwellQpQsIsotropic3DElasticData.hh" // USES GenMaxwellQpQsIsotropic3DElasticData
+#include "materials/data/GenMaxwellQpQsIsotropic3DTimeDepData.hh" // USES GenMaxwellQpQsIsotropic3DTimeDepData
+#include "materials/data/PowerLaw3DElasticData.hh" // USES PowerLaw3DElasticData
+#include "materials/data/PowerLaw3DTimeDepData.hh" // USES PowerLaw3DTimeDepData
+#include "materials/data/PowerLawPlaneStrainElasticData.hh" // USES PowerLawPlaneStrainElasticData
+#include "materials/data/PowerLawPlaneStrainTimeDepData.hh" // USES PowerLawPlaneStrainTimeDepData
+#include "materials/data/DruckerPrager3DElasticData.hh" // USES DruckerPrager3DElasticData
+#include "materials/data/DruckerPrager3DTimeDepData.hh" // USES DruckerPrager3DTimeDepData
+#include "materials/data/DruckerPragerPlaneStrainElasticData.hh" // USES DruckerPragerPlaneStrainElasticData
+#include "materials/data/DruckerPragerPlaneStrainTimeDepData.hh" // USES DruckerPragerPlaneStrainTimeDepData
+
+#include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/ElasticPlaneStress.hh" // USES ElasticPlaneStress
+#include "pylith/materials/ElasticIsotropic3D.hh" // USES ElasticIsotropic3D
+#include "pylith/materials/MaxwellIsotropic3D.hh" // USES MaxwellIsotropic3D
+#include "pylith/materials/MaxwellPlaneStrain.hh" // USES MaxwellPlaneStrain
+#include "pylith/materials/GenMaxwellIsotropic3D.hh" // USES GenMaxwellIsotropic3D
+#include "pylith/materials/GenMaxwellPlaneStrain.hh" // USES GenMaxwellPlaneStrain
+#include "pylith/materials/GenMaxwellQpQsIsotropic3D.hh" // USES GenMaxwellQpQsIsotropic3D
+#include "pylith/materials/PowerLaw3D.hh" // USES PowerLaw3D
+#include "pylith/materials/PowerLawPlaneStrain.hh" // USES PowerLawPlaneStrain
+#include "pylith/materials/DruckerPrager3D.hh" // USES DruckerPrager3D
+#include "pylith/materials/DruckerPragerPlaneStrain.hh" // USES DruckerPragerPlaneStrain
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <cstring> // USES memcpy()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace materials {
+    namespace _BenchElasticMaterial {
+
+      // Time step used with time-dependent test data (matches unit tests).
+      const PylithScalar dtTimeDep = 2.0e+5;
+
+      // Names of kernels.
+      const char* kernelNames[3] = {
+	"calcStress",
+	"calcElasticConsts",
+	"updateStateVars",
+      };
+
+      /** Material specific setup (none by default).
+       *
+       * @param material Elastic material.
+       */
+      void setupMaterial(ElasticMaterial* material) {
+      } // setupMaterial
+
+      /** Allow tensile yield so the test data does not trigger an
+       * exception (matches unit tests).
+       *
+       * @param material Drucker-Prager material.
+       */
+      void setupMaterial(DruckerPrager3D* material) {
+	assert(material);
+	material->allowTensileYield(true);
+      } // setupMaterial
+
+      /** Allow tensile yield so the test data does not trigger an
+       * exception (matches unit tests).
+       *
+       * @param material Drucker-Prager material.
+       */
+      void setupMaterial(DruckerPragerPlaneStrain* material) {
+	assert(material);
+	material->allowTensileYield(true);
+      } // setupMaterial
+
+      /** Add benchmarks of all kernels for a material and test data.
+       *
+       * @param runner Benchmark runner.
+       * @param label Label for material.
+       * @param elastic True if test data is for elastic behavior.
+       */
+      template<typename material_type, typename data_type>
+      void addKernels(pylith::benchmarks::BenchmarkRunner* runner,
+		      const char* label,
+		      const bool elastic) {
+	assert(runner);
+	for (int iKernel=0; iKernel < 3; ++iKernel) {
+	  material_type* material = new material_type();
+	  data_type* data = new data_type();
+
+	  spatialdata::units::Nondimensional normalizer;
+	  normalizer.lengthScale(data->lengthScale);
+	  normalizer.pressureScale(data->pressureScale);
+	  normalizer.timeScale(data->timeScale);
+	  normalizer.densityScale(data->densityScale);
+	  material->normalizer(normalizer);
+	  setupMaterial(material);
+
+	  material->useElasticBehavior(elastic);
+	  if (!elastic)
+	    material->timeStep(dtTimeDep);
+
+	  const std::string name = std::string("materials/") + label + "/" + kernelNames[iKernel] + ((elastic) ? "/elastic" : "/timedep");
+	  runner->add(new BenchElasticMaterial(name.c_str(), material, data, BenchElasticMaterial::KernelEnum(iKernel)));
+	} // for
+      } // addKernels
+
+    } // _BenchElasticMaterial
+  } // materials
+} // pylith
+
+// ----------------------------------------------------------------------
+// Add benchmarks for all elastic materials to runner.
+void
+pylith::materials::BenchElasticMaterial::add(pylith::benchmarks::BenchmarkRunner* runner)
+{ // add
+  using namespace _BenchElasticMaterial;
+
+  addKernels<ElasticPlaneStrain, ElasticPlaneStrainData>(runner, "ElasticPlaneStrain", true);
+  addKernels<ElasticPlaneStress, ElasticPlaneStressData>(runner, "ElasticPlaneStress", true);
+  addKernels<ElasticIsotropic3D, ElasticIsotropic3DData>(runner, "ElasticIsotropic3D", true);
+
+  addKernels<MaxwellIsotropic3D, MaxwellIsotropic3DElasticData>(runner, "MaxwellIsotropic3D", true);
+  addKernels<MaxwellIsotropic3D, MaxwellIsotropic3DTimeDepData>(runner, "MaxwellIsotropic3D", false);
+  addKernels<MaxwellPlaneStrain, MaxwellPlaneStrainElasticData>(runner, "MaxwellPlaneStrain", true);
+  addKernels<MaxwellPlaneStrain, MaxwellPlaneStrainTimeDepData>(runner, "MaxwellPlaneStrain", false);
+
+  addKernels<GenMaxwellIsotropic3D, GenMaxwellIsotropic3DElasticData>(runner, "GenMaxwellIsotropic3D", true);
+  addKernels<GenMaxwellIsotropic3D, GenMaxwellIsotropic3DTimeDepData>(runner, "GenMaxwellIsotropic3D", false);
+  addKernels<GenMaxwellPlaneStrain, GenMaxwellPlaneStrainElasticData>(runner, "GenMaxwellPlaneStrain", true);
+  addKernels<GenMaxwellPlaneStrain, GenMaxwellPlaneStrainTimeDepData>(runner, "GenMaxwellPlaneStrain", false);
+  addKernels<GenMaxwellQpQsIsotropic3D, GenMaxwellQpQsIsotropic3DElasticData>(runner, "GenMaxwellQpQsIsotropic3D", true);
+  addKernels<GenMaxwellQpQsIsotropic3D, GenMaxwellQpQsIsotropic3DTimeDepData>(runner, "GenMaxwellQpQsIsotropic3D", false);
+
+  addKernels<PowerLaw3D, PowerLaw3DElasticData>(runner, "PowerLaw3D", true);
+  addKernels<PowerLaw3D, PowerLaw3DTimeDepData>(runner, "PowerLaw3D", false);
+  addKernels<PowerLawPlaneStrain, PowerLawPlaneStrainElasticData>(runner, "PowerLawPlaneStrain", true);
+  addKernels<PowerLawPlaneStrain, PowerLawPlaneStrainTimeDepData>(runner, "PowerLawPlaneStrain", false);
+
+  addKernels<DruckerPrager3D, DruckerPrager3DElasticData>(runner, "DruckerPrager3D", true);
+  addKernels<DruckerPrager3D, DruckerPrager3DTimeDepData>(runner, "DruckerPrager3D", false);
+  addKernels<DruckerPragerPlaneStrain, DruckerPragerPlaneStrainElasticData>(runner, "DruckerPragerPlaneStrain", true);
+  addKernels<DruckerPragerPlaneStrain, DruckerPragerPlaneStrainTimeDepData>(runner, "DruckerPragerPlaneStrain", false);
+} // add
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::materials::BenchElasticMaterial::BenchElasticMaterial(const char* name,
+							      ElasticMaterial* material,
+							      ElasticMaterialData* data,
+							      const KernelEnum kernel) :
+  Benchmark(name),
+  _material(material),
+  _data(data),
+  _kernel(kernel),
+  _tensorSize(0),
+  _numElasticConsts(0)
+{ // constructor
+  assert(_material);
+  assert(_data);
+
+  switch (_data->dimension)
+    { // switch
+    case 1 :
+      _tensorSize = 1;
+      _numElasticConsts = 1;
+      break;
+    case 2 :
+      _tensorSize = 3;
+      _numElasticConsts = 9;
+      break;
+    case 3 :
+      _tensorSize = 6;
+      _numElasticConsts = 36;
+      break;
+    default :
+      assert(0);
+    } // switch
+
+  const int numLocs = _data->numLocs;
+  const int numProps = _data->numPropsQuadPt;
+  const int numVars = _data->numVarsQuadPt;
+
+  _stress.resize(_tensorSize);
+  _elasticConsts.resize(_numElasticConsts);
+  _stateVars.resize(numLocs*numVars);
+
+  // Inputs common to all kernels: properties, strain, initial stress,
+  // and initial strain.
+  int numScalars = numProps + 3*_tensorSize;
+  switch (_kernel)
+    { // switch
+    case CALC_STRESS :
+      numScalars += numVars + _tensorSize;
+      break;
+    case CALC_ELASTIC_CONSTS :
+      numScalars += numVars + _numElasticConsts;
+      break;
+    case UPDATE_STATE_VARS :
+      numScalars += 2*numVars;
+      break;
+    default :
+      assert(0);
+    } // switch
+  _numPoints = numLocs;
+  _numBytes = size_t(numLocs) * numScalars * sizeof(PylithScalar);
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::materials::BenchElasticMaterial::~BenchElasticMaterial(void)
+{ // destructor
+  delete _material; _material = 0;
+  delete _data; _data = 0;
+} // destructor
+
+// ----------------------------------------------------------------------
+// Execute one pass of the kernel over the data locations.
+void
+pylith::materials::BenchElasticMaterial::run(void)
+{ // run
+  assert(_material);
+  assert(_data);
+
+  const bool computeStateVars = true;
+
+  const int numLocs = _data->numLocs;
+  const int numProps = _data->numPropsQuadPt;
+  const int numVars = _data->numVarsQuadPt;
+  const int tensorSize = _tensorSize;
+
+  switch (_kernel)
+    { // switch
+    case CALC_STRESS :
+      for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+	_material->_calcStress(&_stress[0], _stress.size(),
+			       &_data->properties[iLoc*numProps], numProps,
+			       (numVars > 0) ? &_data->stateVars[iLoc*numVars] : 0, numVars,
+			       &_data->strain[iLoc*tensorSize], tensorSize,
+			       &_data->initialStress[iLoc*tensorSize], tensorSize,
+			       &_data->initialStrain[iLoc*tensorSize], tensorSize,
+			       computeStateVars);
+      } // for
+      break;
+    case CALC_ELASTIC_CONSTS :
+      for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+	_material->_calcElasticConsts(&_elasticConsts[0], _elasticConsts.size(),
+				      &_data->properties[iLoc*numProps], numProps,
+				      (numVars > 0) ? &_data->stateVars[iLoc*numVars] : 0, numVars,
+				      &_data->strain[iLoc*tensorSize], tensorSize,
+				      &_data->initialStress[iLoc*tensorSize], tensorSize,
+				      &_data->initialStrain[iLoc*tensorSize], tensorSize);
+      } // for
+      break;
+    case UPDATE_STATE_VARS :
+      // Restore state variables so every pass starts from the same state.
+      if (numVars > 0)
+	memcpy(&_stateVars[0], _data->stateVars, numLocs*numVars*sizeof(PylithScalar));
+      for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+	_material->_updateStateVars((numVars > 0) ? &_stateVars[iLoc*numVars] : 0, numVars,
+				    &_data->properties[iLoc*numProps], numProps,
+				    &_data->strain[iLoc*tensorSize], tensorSize,
+				    &_data->initialStress[iLoc*tensorSize], tensorSize,
+				    &_data->initialStrain[iLoc*tensorSize], tensorSize);
+      } // for
+      break;
+    default :
+      assert(0);
+    } // switch
+} // run
+
+
+// End of file
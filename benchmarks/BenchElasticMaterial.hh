@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/BenchElasticMaterial.hh
+ *
+ * @brief C++ benchmarks for ElasticMaterial kernels.
+ */
+
+#if !defined(pylith_materials_benchelasticmaterial_hh)
+#define pylith_materials_benchelasticmaterial_hh
+
+#include "Benchmark.hh" // ISA Benchmark
+
+#include "pylith/materials/materialsfwd.hh" // forward declarations
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace materials {
+    class BenchElasticMaterial;
+    class ElasticMaterialData;
+  } // materials
+} // pylith
+
+/** @brief C++ benchmarks for ElasticMaterial kernels.
+ *
+ * Time _calcStress(), _calcElasticConsts(), and _updateStateVars()
+ * over the locations in the unit test data for each elastic
+ * material. Materials with time-dependent behavior are timed with
+ * both the elastic and the time-dependent data.
+ */
+class pylith::materials::BenchElasticMaterial : public pylith::benchmarks::Benchmark
+{ // class BenchElasticMaterial
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum KernelEnum {
+    CALC_STRESS=0, ///< _calcStress().
+    CALC_ELASTIC_CONSTS=1, ///< _calcElasticConsts().
+    UPDATE_STATE_VARS=2, ///< _updateStateVars().
+  }; // KernelEnum
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Add benchmarks for all elastic materials to runner.
+   *
+   * @param runner Benchmark runner.
+   */
+  static
+  void add(pylith::benchmarks::BenchmarkRunner* runner);
+
+  /** Constructor.
+   *
+   * @param name Name of benchmark.
+   * @param material Elastic material (benchmark takes ownership).
+   * @param data Test data for material (benchmark takes ownership).
+   * @param kernel Kernel to time.
+   */
+  BenchElasticMaterial(const char* name,
+		       ElasticMaterial* material,
+		       ElasticMaterialData* data,
+		       const KernelEnum kernel);
+
+  /// Destructor.
+  ~BenchElasticMaterial(void);
+
+  /// Execute one pass of the kernel over the data locations.
+  void run(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  ElasticMaterial* _material; ///< Elastic material.
+  ElasticMaterialData* _data; ///< Test data for material.
+  const KernelEnum _kernel; ///< Kernel to time.
+  int _tensorSize; ///< Size of stress/strain tensor.
+  int _numElasticConsts; ///< Number of elastic constants.
+
+  scalar_array _stress; ///< Buffer for stress tensor.
+  scalar_array _elasticConsts; ///< Buffer for elastic constants.
+  scalar_array _stateVars; ///< Buffer for state variables.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BenchElasticMaterial(const BenchElasticMaterial&); ///< Not implemented
+  const BenchElasticMaterial& operator=(const BenchElasticMaterial&); ///< Not implemented
+
+}; // class BenchElasticMaterial
+
+#endif // pylith_materials_benchelasticmaterial_hh
+
+
+// End of file
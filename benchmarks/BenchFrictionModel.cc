@@ -0,0 +1,151 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchFrictionModel.hh" // Implementation of class methods
+
+#include "BenchmarkRunner.hh" // USES BenchmarkRunner
+
+#include "friction/data/StaticFrictionData.hh" // USES StaticFrictionData
+#include "friction/data/SlipWeakeningData.hh" // USES SlipWeakeningData
+#include "friction/data/SlipWeakeningTimeData.hh" // USES SlipWeakeningTimeData
+#include "friction/data/SlipWeakeningTimeStableData.hh" // USES SlipWeakeningTimeStableData
+#include "friction/data/RateStateAgeingData.hh" // USES RateStateAgeingData
+#include "friction/data/TimeWeakeningData.hh" // USES TimeWeakeningData
+
+#include "pylith/friction/StaticFriction.hh" // USES StaticFriction
+#include "pylith/friction/SlipWeakening.hh" // USES SlipWeakening
+#include "pylith/friction/SlipWeakeningTime.hh" // USES SlipWeakeningTime
+#include "pylith/friction/SlipWeakeningTimeStable.hh" // USES SlipWeakeningTimeStable
+#include "pylith/friction/RateStateAgeing.hh" // USES RateStateAgeing
+#include "pylith/friction/TimeWeakening.hh" // USES TimeWeakening
+
+#include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace friction {
+    namespace _BenchFrictionModel {
+
+      /** Add benchmark for friction model and test data.
+       *
+       * @param runner Benchmark runner.
+       * @param label Label for friction model.
+       */
+      template<typename friction_type, typename data_type>
+      void addModel(pylith::benchmarks::BenchmarkRunner* runner,
+		    const char* label) {
+	assert(runner);
+	friction_type* friction = new friction_type();
+	data_type* data = new data_type();
+
+	spatialdata::units::Nondimensional normalizer;
+	normalizer.lengthScale(data->lengthScale);
+	normalizer.pressureScale(data->pressureScale);
+	normalizer.timeScale(data->timeScale);
+	normalizer.densityScale(data->densityScale);
+	friction->normalizer(normalizer);
+	friction->timeStep(data->dt);
+
+	const std::string name = std::string("friction/") + label + "/calcFriction";
+	runner->add(new BenchFrictionModel(name.c_str(), friction, data));
+      } // addModel
+
+    } // _BenchFrictionModel
+  } // friction
+} // pylith
+
+// ----------------------------------------------------------------------
+// Add benchmarks for all friction models to runner.
+void
+pylith::friction::BenchFrictionModel::add(pylith::benchmarks::BenchmarkRunner* runner)
+{ // add
+  using namespace _BenchFrictionModel;
+
+  addModel<StaticFriction, StaticFrictionData>(runner, "StaticFriction");
+  addModel<SlipWeakening, SlipWeakeningData>(runner, "SlipWeakening");
+  addModel<SlipWeakeningTime, SlipWeakeningTimeData>(runner, "SlipWeakeningTime");
+  addModel<SlipWeakeningTimeStable, SlipWeakeningTimeStableData>(runner, "SlipWeakeningTimeStable");
+  addModel<RateStateAgeing, RateStateAgeingData>(runner, "RateStateAgeing");
+  addModel<TimeWeakening, TimeWeakeningData>(runner, "TimeWeakening");
+} // add
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::friction::BenchFrictionModel::BenchFrictionModel(const char* name,
+							 FrictionModel* friction,
+							 FrictionModelData* data) :
+  Benchmark(name),
+  _friction(friction),
+  _data(data),
+  _frictionSum(0.0)
+{ // constructor
+  assert(_friction);
+  assert(_data);
+
+  // Slip, slip rate, normal traction, properties, state variables,
+  // and friction.
+  const int numScalars = 4 + _data->numPropsVertex + _data->numVarsVertex;
+  _numPoints = _data->numLocs;
+  _numBytes = size_t(_data->numLocs) * numScalars * sizeof(PylithScalar);
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::friction::BenchFrictionModel::~BenchFrictionModel(void)
+{ // destructor
+  delete _friction; _friction = 0;
+  delete _data; _data = 0;
+} // destructor
+
+// ----------------------------------------------------------------------
+// Execute one pass of the kernel over the data locations.
+void
+pylith::friction::BenchFrictionModel::run(void)
+{ // run
+  assert(_friction);
+  assert(_data);
+
+  const int numLocs = _data->numLocs;
+  const int numProps = _data->numPropsVertex;
+  const int numVars = _data->numVarsVertex;
+  const PylithScalar t = 1.5;
+
+  PylithScalar frictionSum = 0.0;
+  for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+    frictionSum +=
+      _friction->_calcFriction(t, _data->slip[iLoc], _data->slipRate[iLoc], _data->normalTraction[iLoc],
+			       &_data->properties[iLoc*numProps], numProps,
+			       (numVars > 0) ? &_data->stateVars[iLoc*numVars] : 0, numVars);
+  } // for
+  _frictionSum = frictionSum;
+} // run
+
+// ----------------------------------------------------------------------
+// Get sum of friction values from the last pass.
+PylithScalar
+pylith::friction::BenchFrictionModel::frictionSum(void) const
+{ // frictionSum
+  return _frictionSum;
+} // frictionSum
+
+
+// End of file
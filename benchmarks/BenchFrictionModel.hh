@@ -0,0 +1,100 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/BenchFrictionModel.hh
+ *
+ * @brief C++ benchmarks for FrictionModel::_calcFriction().
+ */
+
+#if !defined(pylith_friction_benchfrictionmodel_hh)
+#define pylith_friction_benchfrictionmodel_hh
+
+#include "Benchmark.hh" // ISA Benchmark
+
+#include "pylith/friction/frictionfwd.hh" // forward declarations
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace friction {
+    class BenchFrictionModel;
+    class FrictionModelData;
+  } // friction
+} // pylith
+
+/** @brief C++ benchmarks for FrictionModel::_calcFriction().
+ *
+ * Time the computation of friction over the locations in the unit
+ * test data for each friction model.
+ */
+class pylith::friction::BenchFrictionModel : public pylith::benchmarks::Benchmark
+{ // class BenchFrictionModel
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Add benchmarks for all friction models to runner.
+   *
+   * @param runner Benchmark runner.
+   */
+  static
+  void add(pylith::benchmarks::BenchmarkRunner* runner);
+
+  /** Constructor.
+   *
+   * @param name Name of benchmark.
+   * @param friction Friction model (benchmark takes ownership).
+   * @param data Test data for friction model (benchmark takes ownership).
+   */
+  BenchFrictionModel(const char* name,
+		     FrictionModel* friction,
+		     FrictionModelData* data);
+
+  /// Destructor.
+  ~BenchFrictionModel(void);
+
+  /// Execute one pass of the kernel over the data locations.
+  void run(void);
+
+  /** Get sum of friction values from the last pass. Keeps the
+   * compiler from discarding the kernel calls.
+   *
+   * @returns Sum of friction values.
+   */
+  PylithScalar frictionSum(void) const;
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  FrictionModel* _friction; ///< Friction model.
+  FrictionModelData* _data; ///< Test data for friction model.
+  PylithScalar _frictionSum; ///< Sum of friction values from last pass.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BenchFrictionModel(const BenchFrictionModel&); ///< Not implemented
+  const BenchFrictionModel& operator=(const BenchFrictionModel&); ///< Not implemented
+
+}; // class BenchFrictionModel
+
+#endif // pylith_friction_benchfrictionmodel_hh
+
+
+// End of file
@@ -0,0 +1,250 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchIntegratorElasticity.hh" // Implementation of class methods
+
+#include "BenchmarkRunner.hh" // USES BenchmarkRunner
+
+#include "feassemble/data/ElasticityImplicitData2DLinear.hh" // USES ElasticityImplicitData2DLinear
+#include "feassemble/data/ElasticityImplicitData2DQuadratic.hh" // USES ElasticityImplicitData2DQuadratic
+#include "feassemble/data/ElasticityImplicitData3DLinear.hh" // USES ElasticityImplicitData3DLinear
+#include "feassemble/data/ElasticityImplicitData3DQuadratic.hh" // USES ElasticityImplicitData3DQuadratic
+
+#include "pylith/feassemble/ElasticityImplicit.hh" // USES ElasticityImplicit
+#include "pylith/feassemble/Quadrature.hh" // USES Quadrature
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _BenchIntegratorElasticity {
+
+      // Names of kernels.
+      const char* kernelNames[3] = {
+	"elasticityResidual",
+	"elasticityJacobian",
+	"calcTotalStrain",
+      };
+
+      /** Add benchmarks of all kernels for test data.
+       *
+       * @param runner Benchmark runner.
+       * @param label Label for test data.
+       */
+      template<typename data_type>
+      void addKernels(pylith::benchmarks::BenchmarkRunner* runner,
+		      const char* label) {
+	assert(runner);
+	for (int iKernel=0; iKernel < 3; ++iKernel) {
+	  data_type* data = new data_type();
+	  const std::string dimLabel = (3 == data->cellDim) ? "3D" : "2D";
+	  const std::string name = std::string("feassemble/IntegratorElasticity/") + kernelNames[iKernel] + dimLabel + "/" + label;
+	  runner->add(new BenchIntegratorElasticity(name.c_str(), data, BenchIntegratorElasticity::KernelEnum(iKernel)));
+	} // for
+      } // addKernels
+
+    } // _BenchIntegratorElasticity
+  } // feassemble
+} // pylith
+
+// ----------------------------------------------------------------------
+// Add benchmarks for all element kernels to runner.
+void
+pylith::feassemble::BenchIntegratorElasticity::add(pylith::benchmarks::BenchmarkRunner* runner)
+{ // add
+  using namespace _BenchIntegratorElasticity;
+
+  addKernels<ElasticityImplicitData2DLinear>(runner, "Tri3");
+  addKernels<ElasticityImplicitData2DQuadratic>(runner, "Tri6");
+  addKernels<ElasticityImplicitData3DLinear>(runner, "Tet4");
+  addKernels<ElasticityImplicitData3DQuadratic>(runner, "Tet10");
+} // add
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::BenchIntegratorElasticity::BenchIntegratorElasticity(const char* name,
+									 IntegratorData* data,
+									 const KernelEnum kernel) :
+  Benchmark(name),
+  _integrator(0),
+  _data(data),
+  _kernel(kernel),
+  _tensorSize(0),
+  _numElasticConsts(0)
+{ // constructor
+  assert(_data);
+  assert(_data->cellDim == _data->spaceDim);
+
+  switch (_data->spaceDim)
+    { // switch
+    case 2 :
+      _tensorSize = 3;
+      _numElasticConsts = 9;
+      break;
+    case 3 :
+      _tensorSize = 6;
+      _numElasticConsts = 36;
+      break;
+    default :
+      assert(0);
+    } // switch
+
+  const int numQuadPts = _data->numQuadPts;
+  const int numBasis = _data->numBasis;
+  const int spaceDim = _data->spaceDim;
+  const int cellVectorSize = numBasis*spaceDim;
+
+  // Quadrature weights, Jacobian determinants, and basis derivatives.
+  const int numScalarsGeometry = 2*numQuadPts + numQuadPts*numBasis*spaceDim;
+
+  int numScalars = 0;
+  switch (_kernel)
+    { // switch
+    case RESIDUAL :
+      numScalars = numScalarsGeometry + numQuadPts*_tensorSize + 2*cellVectorSize;
+      break;
+    case JACOBIAN :
+      numScalars = numScalarsGeometry + numQuadPts*_numElasticConsts + 2*cellVectorSize*cellVectorSize;
+      break;
+    case TOTAL_STRAIN :
+      numScalars = numQuadPts*numBasis*spaceDim + cellVectorSize + numQuadPts*_tensorSize;
+      break;
+    default :
+      assert(0);
+    } // switch
+  _numPoints = numQuadPts;
+  _numBytes = size_t(numScalars) * sizeof(PylithScalar);
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::BenchIntegratorElasticity::~BenchIntegratorElasticity(void)
+{ // destructor
+  tearDown();
+  delete _data; _data = 0;
+} // destructor
+
+// ----------------------------------------------------------------------
+// Setup integrator, quadrature, and cell geometry.
+void
+pylith::feassemble::BenchIntegratorElasticity::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  assert(_data);
+
+  const int numQuadPts = _data->numQuadPts;
+  const int numBasis = _data->numBasis;
+  const int spaceDim = _data->spaceDim;
+  const int cellDim = _data->cellDim;
+
+  Quadrature quadrature;
+  quadrature.initialize(_data->basis, numQuadPts, numBasis,
+			_data->basisDerivRef, numQuadPts, numBasis, cellDim,
+			_data->quadPts, numQuadPts, cellDim,
+			_data->quadWts, numQuadPts,
+			spaceDim);
+
+  delete _integrator; _integrator = new ElasticityImplicit();
+  _integrator->quadrature(&quadrature);
+  assert(_integrator->_quadrature);
+
+  // Compute geometry for first cell.
+  scalar_array coordsCell(numBasis*spaceDim);
+  _disp.resize(numBasis*spaceDim);
+  for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+    const int v = _data->cells[iBasis];
+    for (int iDim=0; iDim < spaceDim; ++iDim) {
+      coordsCell[iBasis*spaceDim+iDim] = _data->vertices[v*spaceDim+iDim];
+      _disp[iBasis*spaceDim+iDim] = _data->fieldT[v*spaceDim+iDim];
+    } // for
+  } // for
+  _integrator->_quadrature->initializeGeometry();
+  _integrator->_quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), 0);
+
+  _integrator->_initCellVector();
+  _integrator->_initCellMatrix();
+
+  // Use strain from test data as stress. The values do not affect
+  // the cost of the kernels.
+  _strain.resize(numQuadPts*_tensorSize);
+  if (3 == spaceDim) {
+    IntegratorElasticity::_calcTotalStrain3D(&_strain, _integrator->_quadrature->basisDeriv(), &_disp[0], numBasis, spaceDim, numQuadPts);
+  } else {
+    IntegratorElasticity::_calcTotalStrain2D(&_strain, _integrator->_quadrature->basisDeriv(), &_disp[0], numBasis, spaceDim, numQuadPts);
+  } // if/else
+  _stress.resize(numQuadPts*_tensorSize);
+  _stress = _strain;
+  _elasticConsts.resize(numQuadPts*_numElasticConsts);
+  _elasticConsts = 1.0;
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Execute kernel for cell.
+void
+pylith::feassemble::BenchIntegratorElasticity::run(void)
+{ // run
+  assert(_integrator);
+  assert(_data);
+
+  const bool is3D = (3 == _data->spaceDim);
+  switch (_kernel)
+    { // switch
+    case RESIDUAL :
+      if (is3D) {
+	_integrator->_elasticityResidual3D(_stress);
+      } else {
+	_integrator->_elasticityResidual2D(_stress);
+      } // if/else
+      break;
+    case JACOBIAN :
+      if (is3D) {
+	_integrator->_elasticityJacobian3D(_elasticConsts);
+      } else {
+	_integrator->_elasticityJacobian2D(_elasticConsts);
+      } // if/else
+      break;
+    case TOTAL_STRAIN :
+      if (is3D) {
+	IntegratorElasticity::_calcTotalStrain3D(&_strain, _integrator->_quadrature->basisDeriv(), &_disp[0], _data->numBasis, _data->spaceDim, _data->numQuadPts);
+      } else {
+	IntegratorElasticity::_calcTotalStrain2D(&_strain, _integrator->_quadrature->basisDeriv(), &_disp[0], _data->numBasis, _data->spaceDim, _data->numQuadPts);
+      } // if/else
+      break;
+    default :
+      assert(0);
+    } // switch
+} // run
+
+// ----------------------------------------------------------------------
+// Deallocate integrator.
+void
+pylith::feassemble::BenchIntegratorElasticity::tearDown(void)
+{ // tearDown
+  delete _integrator; _integrator = 0;
+} // tearDown
+
+
+// End of file
@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/BenchIntegratorElasticity.hh
+ *
+ * @brief C++ benchmarks for IntegratorElasticity element kernels.
+ */
+
+#if !defined(pylith_feassemble_benchintegratorelasticity_hh)
+#define pylith_feassemble_benchintegratorelasticity_hh
+
+#include "Benchmark.hh" // ISA Benchmark
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace feassemble {
+    class BenchIntegratorElasticity;
+    class IntegratorData;
+  } // feassemble
+} // pylith
+
+/** @brief C++ benchmarks for IntegratorElasticity element kernels.
+ *
+ * Time the integration of the elasticity term in the residual and
+ * Jacobian and the computation of the total strain for the first cell
+ * of the unit test data for ElasticityImplicit. The geometry of the
+ * cell is computed once in setUp(), so only the element kernel is
+ * timed.
+ */
+class pylith::feassemble::BenchIntegratorElasticity : public pylith::benchmarks::Benchmark
+{ // class BenchIntegratorElasticity
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum KernelEnum {
+    RESIDUAL=0, ///< _elasticityResidual2D/3D().
+    JACOBIAN=1, ///< _elasticityJacobian2D/3D().
+    TOTAL_STRAIN=2, ///< _calcTotalStrain2D/3D().
+  }; // KernelEnum
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Add benchmarks for all element kernels to runner.
+   *
+   * @param runner Benchmark runner.
+   */
+  static
+  void add(pylith::benchmarks::BenchmarkRunner* runner);
+
+  /** Constructor.
+   *
+   * @param name Name of benchmark.
+   * @param data Test data for integrator (benchmark takes ownership).
+   * @param kernel Kernel to time.
+   */
+  BenchIntegratorElasticity(const char* name,
+			    IntegratorData* data,
+			    const KernelEnum kernel);
+
+  /// Destructor.
+  ~BenchIntegratorElasticity(void);
+
+  /// Setup integrator, quadrature, and cell geometry.
+  void setUp(void);
+
+  /// Execute kernel for cell.
+  void run(void);
+
+  /// Deallocate integrator.
+  void tearDown(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  IntegratorElasticity* _integrator; ///< Elasticity integrator.
+  IntegratorData* _data; ///< Test data for integrator.
+  const KernelEnum _kernel; ///< Kernel to time.
+  int _tensorSize; ///< Size of stress/strain tensor.
+  int _numElasticConsts; ///< Number of elastic constants.
+
+  scalar_array _disp; ///< Displacement at vertices of cell.
+  scalar_array _strain; ///< Strain at quadrature points.
+  scalar_array _stress; ///< Stress at quadrature points.
+  scalar_array _elasticConsts; ///< Elastic constants at quadrature points.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BenchIntegratorElasticity(const BenchIntegratorElasticity&); ///< Not implemented
+  const BenchIntegratorElasticity& operator=(const BenchIntegratorElasticity&); ///< Not implemented
+
+}; // class BenchIntegratorElasticity
+
+#endif // pylith_feassemble_benchintegratorelasticity_hh
+
+
+// End of file
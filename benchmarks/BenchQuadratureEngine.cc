@@ -0,0 +1,196 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchQuadratureEngine.hh" // Implementation of class methods
+
+#include "BenchmarkRunner.hh" // USES BenchmarkRunner
+
+#include "feassemble/data/QuadratureData1Din2DLinear.hh" // USES QuadratureData1Din2DLinear
+#include "feassemble/data/QuadratureData1Din2DQuadratic.hh" // USES QuadratureData1Din2DQuadratic
+#include "feassemble/data/QuadratureData1Din3DLinear.hh" // USES QuadratureData1Din3DLinear
+#include "feassemble/data/QuadratureData1Din3DQuadratic.hh" // USES QuadratureData1Din3DQuadratic
+#include "feassemble/data/QuadratureData2DLinear.hh" // USES QuadratureData2DLinear
+#include "feassemble/data/QuadratureData2DQuadratic.hh" // USES QuadratureData2DQuadratic
+#include "feassemble/data/QuadratureData2Din3DLinearXYZ.hh" // USES QuadratureData2Din3DLinearXYZ
+#include "feassemble/data/QuadratureData2Din3DQuadratic.hh" // USES QuadratureData2Din3DQuadratic
+#include "feassemble/data/QuadratureData3DLinear.hh" // USES QuadratureData3DLinear
+#include "feassemble/data/QuadratureData3DQuadratic.hh" // USES QuadratureData3DQuadratic
+
+#include "pylith/feassemble/QuadratureRefCell.hh" // USES QuadratureRefCell
+#include "pylith/feassemble/Quadrature1Din2D.hh" // USES Quadrature1Din2D
+#include "pylith/feassemble/Quadrature1Din3D.hh" // USES Quadrature1Din3D
+#include "pylith/feassemble/Quadrature2D.hh" // USES Quadrature2D
+#include "pylith/feassemble/Quadrature2Din3D.hh" // USES Quadrature2Din3D
+#include "pylith/feassemble/Quadrature3D.hh" // USES Quadrature3D
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace feassemble {
+    namespace _BenchQuadratureEngine {
+
+      /** Add benchmark for test data.
+       *
+       * @param runner Benchmark runner.
+       * @param label Label for test data.
+       */
+      template<typename data_type>
+      void addEngine(pylith::benchmarks::BenchmarkRunner* runner,
+		     const char* label) {
+	assert(runner);
+	const std::string name = std::string("feassemble/QuadratureEngine/computeGeometry/") + label;
+	runner->add(new BenchQuadratureEngine(name.c_str(), new data_type()));
+      } // addEngine
+
+    } // _BenchQuadratureEngine
+  } // feassemble
+} // pylith
+
+// ----------------------------------------------------------------------
+// Add benchmarks for all quadrature engines to runner.
+void
+pylith::feassemble::BenchQuadratureEngine::add(pylith::benchmarks::BenchmarkRunner* runner)
+{ // add
+  using namespace _BenchQuadratureEngine;
+
+  addEngine<QuadratureData1Din2DLinear>(runner, "Quadrature1Din2D/Linear");
+  addEngine<QuadratureData1Din2DQuadratic>(runner, "Quadrature1Din2D/Quadratic");
+  addEngine<QuadratureData1Din3DLinear>(runner, "Quadrature1Din3D/Linear");
+  addEngine<QuadratureData1Din3DQuadratic>(runner, "Quadrature1Din3D/Quadratic");
+  addEngine<QuadratureData2DLinear>(runner, "Quadrature2D/Linear");
+  addEngine<QuadratureData2DQuadratic>(runner, "Quadrature2D/Quadratic");
+  addEngine<QuadratureData2Din3DLinearXYZ>(runner, "Quadrature2Din3D/Linear");
+  addEngine<QuadratureData2Din3DQuadratic>(runner, "Quadrature2Din3D/Quadratic");
+  addEngine<QuadratureData3DLinear>(runner, "Quadrature3D/Linear");
+  addEngine<QuadratureData3DQuadratic>(runner, "Quadrature3D/Quadratic");
+} // add
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::feassemble::BenchQuadratureEngine::BenchQuadratureEngine(const char* name,
+								 QuadratureData* data) :
+  Benchmark(name),
+  _data(data),
+  _refCell(0),
+  _engine(0)
+{ // constructor
+  assert(_data);
+  assert(1 == _data->numCells);
+
+  const int numQuadPts = _data->numQuadPts;
+  const int numBasis = _data->numBasis;
+  const int cellDim = _data->cellDim;
+  const int spaceDim = _data->spaceDim;
+
+  // Inputs: vertex coordinates, basis functions, and derivatives of
+  // basis functions in reference cell. Outputs: quadrature points,
+  // Jacobian, inverse of Jacobian, determinant of Jacobian, and
+  // derivatives of basis functions in global coordinates.
+  const int numScalars =
+    numBasis*spaceDim + numQuadPts*numBasis + numQuadPts*numBasis*cellDim +
+    numQuadPts*spaceDim + 2*numQuadPts*cellDim*spaceDim + numQuadPts + numQuadPts*numBasis*spaceDim;
+  _numPoints = numQuadPts;
+  _numBytes = size_t(numScalars) * sizeof(PylithScalar);
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::feassemble::BenchQuadratureEngine::~BenchQuadratureEngine(void)
+{ // destructor
+  tearDown();
+  delete _data; _data = 0;
+} // destructor
+
+// ----------------------------------------------------------------------
+// Setup reference cell and quadrature engine.
+void
+pylith::feassemble::BenchQuadratureEngine::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  assert(_data);
+
+  const int numQuadPts = _data->numQuadPts;
+  const int numBasis = _data->numBasis;
+  const int cellDim = _data->cellDim;
+  const int spaceDim = _data->spaceDim;
+
+  tearDown();
+  _refCell = new QuadratureRefCell();
+  _refCell->minJacobian(1.0e-06);
+  _refCell->initialize(_data->basis, numQuadPts, numBasis,
+		       _data->basisDerivRef, numQuadPts, numBasis, cellDim,
+		       _data->quadPtsRef, numQuadPts, cellDim,
+		       _data->quadWts, numQuadPts,
+		       spaceDim);
+
+  if (2 == spaceDim) {
+    if (2 == cellDim) {
+      _engine = new Quadrature2D(*_refCell);
+    } else {
+      assert(1 == cellDim);
+      _engine = new Quadrature1Din2D(*_refCell);
+    } // if/else
+  } else {
+    assert(3 == spaceDim);
+    if (3 == cellDim) {
+      _engine = new Quadrature3D(*_refCell);
+    } else if (2 == cellDim) {
+      _engine = new Quadrature2Din3D(*_refCell);
+    } else {
+      assert(1 == cellDim);
+      _engine = new Quadrature1Din3D(*_refCell);
+    } // if/else
+  } // if/else
+  _engine->initialize();
+
+  _coordsCell.resize(numBasis*spaceDim);
+  for (int iBasis=0; iBasis < numBasis; ++iBasis) {
+    const int v = _data->cells[iBasis];
+    for (int iDim=0; iDim < spaceDim; ++iDim)
+      _coordsCell[iBasis*spaceDim+iDim] = _data->vertices[v*spaceDim+iDim];
+  } // for
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Compute geometry for cell.
+void
+pylith::feassemble::BenchQuadratureEngine::run(void)
+{ // run
+  assert(_engine);
+  _engine->computeGeometry(&_coordsCell[0], _coordsCell.size(), 0);
+} // run
+
+// ----------------------------------------------------------------------
+// Deallocate reference cell and quadrature engine.
+void
+pylith::feassemble::BenchQuadratureEngine::tearDown(void)
+{ // tearDown
+  delete _engine; _engine = 0;
+  delete _refCell; _refCell = 0;
+} // tearDown
+
+
+// End of file
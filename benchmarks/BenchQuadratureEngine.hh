@@ -0,0 +1,98 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/BenchQuadratureEngine.hh
+ *
+ * @brief C++ benchmarks for QuadratureEngine::computeGeometry().
+ */
+
+#if !defined(pylith_feassemble_benchquadratureengine_hh)
+#define pylith_feassemble_benchquadratureengine_hh
+
+#include "Benchmark.hh" // ISA Benchmark
+
+#include "pylith/feassemble/feassemblefwd.hh" // forward declarations
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace feassemble {
+    class BenchQuadratureEngine;
+    class QuadratureData;
+  } // feassemble
+} // pylith
+
+/** @brief C++ benchmarks for QuadratureEngine::computeGeometry().
+ *
+ * Time the computation of the cell geometry at the quadrature points
+ * for the cell in the unit test data of each quadrature engine.
+ */
+class pylith::feassemble::BenchQuadratureEngine : public pylith::benchmarks::Benchmark
+{ // class BenchQuadratureEngine
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Add benchmarks for all quadrature engines to runner.
+   *
+   * @param runner Benchmark runner.
+   */
+  static
+  void add(pylith::benchmarks::BenchmarkRunner* runner);
+
+  /** Constructor.
+   *
+   * @param name Name of benchmark.
+   * @param data Test data for quadrature (benchmark takes ownership).
+   */
+  BenchQuadratureEngine(const char* name,
+			QuadratureData* data);
+
+  /// Destructor.
+  ~BenchQuadratureEngine(void);
+
+  /// Setup reference cell and quadrature engine.
+  void setUp(void);
+
+  /// Compute geometry for cell.
+  void run(void);
+
+  /// Deallocate reference cell and quadrature engine.
+  void tearDown(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  QuadratureData* _data; ///< Test data for quadrature.
+  QuadratureRefCell* _refCell; ///< Quadrature information for reference cell.
+  QuadratureEngine* _engine; ///< Quadrature engine.
+  scalar_array _coordsCell; ///< Coordinates of cell vertices.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BenchQuadratureEngine(const BenchQuadratureEngine&); ///< Not implemented
+  const BenchQuadratureEngine& operator=(const BenchQuadratureEngine&); ///< Not implemented
+
+}; // class BenchQuadratureEngine
+
+#endif // pylith_feassemble_benchquadratureengine_hh
+
+
+// End of file
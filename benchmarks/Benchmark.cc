@@ -0,0 +1,77 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "Benchmark.hh" // Implementation of class methods
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::benchmarks::Benchmark::Benchmark(const char* name) :
+  _name(name),
+  _numPoints(0),
+  _numBytes(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::benchmarks::Benchmark::~Benchmark(void)
+{ // destructor
+} // destructor
+
+// ----------------------------------------------------------------------
+// Get name of benchmark.
+const char*
+pylith::benchmarks::Benchmark::name(void) const
+{ // name
+  return _name.c_str();
+} // name
+
+// ----------------------------------------------------------------------
+// Get number of points processed in one pass of the kernel.
+int
+pylith::benchmarks::Benchmark::numPoints(void) const
+{ // numPoints
+  return _numPoints;
+} // numPoints
+
+// ----------------------------------------------------------------------
+// Get number of bytes read and written in one pass of the kernel.
+size_t
+pylith::benchmarks::Benchmark::numBytes(void) const
+{ // numBytes
+  return _numBytes;
+} // numBytes
+
+// ----------------------------------------------------------------------
+// Setup benchmark before timing.
+void
+pylith::benchmarks::Benchmark::setUp(void)
+{ // setUp
+} // setUp
+
+// ----------------------------------------------------------------------
+// Cleanup benchmark after timing.
+void
+pylith::benchmarks::Benchmark::tearDown(void)
+{ // tearDown
+} // tearDown
+
+
+// End of file
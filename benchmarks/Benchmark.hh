@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/Benchmark.hh
+ *
+ * @brief C++ abstract base class for kernel microbenchmarks.
+ */
+
+#if !defined(pylith_benchmarks_benchmark_hh)
+#define pylith_benchmarks_benchmark_hh
+
+#include <string> // HASA std::string
+#include <cstddef> // USES size_t
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace benchmarks {
+    class Benchmark;
+    class BenchmarkRunner;
+  } // benchmarks
+} // pylith
+
+/** @brief C++ abstract base class for kernel microbenchmarks.
+ *
+ * A benchmark executes one pass of a kernel over the points
+ * (quadrature points, cells, or fault vertices) of a test
+ * fixture. The runner repeats the pass until the minimum time has
+ * elapsed and reports the time per point. Floating point operations
+ * are taken from the PETSc flop counter, so they match the counts
+ * reported by -log_view; the number of bytes is the minimum traffic
+ * for the inputs and outputs of the kernel for one pass.
+ */
+class pylith::benchmarks::Benchmark
+{ // class Benchmark
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Constructor.
+   *
+   * @param name Name of benchmark.
+   */
+  Benchmark(const char* name);
+
+  /// Destructor.
+  virtual
+  ~Benchmark(void);
+
+  /** Get name of benchmark.
+   *
+   * @returns Name of benchmark.
+   */
+  const char* name(void) const;
+
+  /** Get number of points processed in one pass of the kernel.
+   *
+   * @returns Number of points.
+   */
+  int numPoints(void) const;
+
+  /** Get number of bytes read and written in one pass of the kernel.
+   *
+   * @returns Number of bytes.
+   */
+  size_t numBytes(void) const;
+
+  /// Setup benchmark before timing.
+  virtual
+  void setUp(void);
+
+  /// Execute one pass of the kernel.
+  virtual
+  void run(void) = 0;
+
+  /// Cleanup benchmark after timing.
+  virtual
+  void tearDown(void);
+
+// PROTECTED MEMBERS ////////////////////////////////////////////////////
+protected :
+
+  std::string _name; ///< Name of benchmark.
+  int _numPoints; ///< Number of points in one pass.
+  size_t _numBytes; ///< Number of bytes in one pass.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  Benchmark(const Benchmark&); ///< Not implemented
+  const Benchmark& operator=(const Benchmark&); ///< Not implemented
+
+}; // class Benchmark
+
+#endif // pylith_benchmarks_benchmark_hh
+
+
+// End of file
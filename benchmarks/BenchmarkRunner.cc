@@ -0,0 +1,217 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchmarkRunner.hh" // Implementation of class methods
+
+#include "pylith/utils/types.hh" // USES PylithScalar
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <petsctime.h> // USES PetscTime()
+#include <petsclog.h> // USES PetscGetFlops()
+
+#include <iostream> // USES std::ostream
+#include <iomanip> // USES std::setw()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace benchmarks {
+    namespace _BenchmarkRunner {
+
+      // Maximum number of timed passes of a kernel.
+      const long maxIterations = 1000000000L;
+
+    } // _BenchmarkRunner
+  } // benchmarks
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::benchmarks::BenchmarkRunner::BenchmarkRunner(void) :
+  _minTime(0.1)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::benchmarks::BenchmarkRunner::~BenchmarkRunner(void)
+{ // destructor
+  const size_t numBenchmarks = _benchmarks.size();
+  for (size_t i=0; i < numBenchmarks; ++i) {
+    delete _benchmarks[i]; _benchmarks[i] = 0;
+  } // for
+} // destructor
+
+// ----------------------------------------------------------------------
+// Set minimum time for timing each benchmark.
+void
+pylith::benchmarks::BenchmarkRunner::minTime(const double value)
+{ // minTime
+  _minTime = value;
+} // minTime
+
+// ----------------------------------------------------------------------
+// Only run benchmarks whose name contains a string.
+void
+pylith::benchmarks::BenchmarkRunner::filter(const char* value)
+{ // filter
+  _filter = (value) ? value : "";
+} // filter
+
+// ----------------------------------------------------------------------
+// Add benchmark.
+void
+pylith::benchmarks::BenchmarkRunner::add(Benchmark* benchmark)
+{ // add
+  assert(benchmark);
+  _benchmarks.push_back(benchmark);
+} // add
+
+// ----------------------------------------------------------------------
+// Run benchmarks.
+void
+pylith::benchmarks::BenchmarkRunner::run(void)
+{ // run
+  PYLITH_METHOD_BEGIN;
+
+  _results.clear();
+
+  PetscErrorCode err = 0;
+  const size_t numBenchmarks = _benchmarks.size();
+  for (size_t iBench=0; iBench < numBenchmarks; ++iBench) {
+    Benchmark* benchmark = _benchmarks[iBench];assert(benchmark);
+    const std::string name = benchmark->name();
+    if (_filter.length() > 0 && std::string::npos == name.find(_filter))
+      continue;
+
+    benchmark->setUp();
+    benchmark->run(); // warm up
+
+    long iterations = 1;
+    PetscLogDouble elapsed = 0.0;
+    PetscLogDouble flops = 0.0;
+    while (true) {
+      PetscLogDouble tBegin = 0.0, tEnd = 0.0;
+      PetscLogDouble flopsBegin = 0.0, flopsEnd = 0.0;
+      err = PetscGetFlops(&flopsBegin);PYLITH_CHECK_ERROR(err);
+      err = PetscTime(&tBegin);PYLITH_CHECK_ERROR(err);
+      for (long i=0; i < iterations; ++i)
+	benchmark->run();
+      err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+      err = PetscGetFlops(&flopsEnd);PYLITH_CHECK_ERROR(err);
+      elapsed = tEnd - tBegin;
+      flops = flopsEnd - flopsBegin;
+
+      if (elapsed >= _minTime || iterations >= _BenchmarkRunner::maxIterations)
+	break;
+
+      // Estimate number of passes needed to reach minimum time,
+      // growing by at most a factor of 10 per trial.
+      long iterationsNext = 10*iterations;
+      if (elapsed > 0.0) {
+	const double scale = 1.4 * _minTime / elapsed;
+	if (scale < 10.0)
+	  iterationsNext = long(scale*iterations) + 1;
+      } // if
+      iterations = (iterationsNext < _BenchmarkRunner::maxIterations) ? iterationsNext : _BenchmarkRunner::maxIterations;
+    } // while
+
+    benchmark->tearDown();
+
+    Result result;
+    result.name = name;
+    result.iterations = iterations;
+    result.numPoints = benchmark->numPoints();
+    const double numPointsTotal = double(iterations) * benchmark->numPoints();
+    result.nsPerPoint = (numPointsTotal > 0.0) ? 1.0e+9 * elapsed / numPointsTotal : 0.0;
+    result.flopsPerPoint = (numPointsTotal > 0.0) ? flops / numPointsTotal : 0.0;
+    result.bytesPerPoint = (benchmark->numPoints() > 0) ? double(benchmark->numBytes()) / benchmark->numPoints() : 0.0;
+    _results.push_back(result);
+  } // for
+
+  PYLITH_METHOD_END;
+} // run
+
+// ----------------------------------------------------------------------
+// Get results of benchmarks.
+const std::vector<pylith::benchmarks::BenchmarkRunner::Result>&
+pylith::benchmarks::BenchmarkRunner::results(void) const
+{ // results
+  return _results;
+} // results
+
+// ----------------------------------------------------------------------
+// Write results in JSON format.
+void
+pylith::benchmarks::BenchmarkRunner::writeJSON(std::ostream& sout) const
+{ // writeJSON
+  sout << "{\n"
+       << "  \"context\": {\n"
+       << "    \"scalar_bytes\": " << sizeof(PylithScalar) << ",\n"
+       << "    \"min_time_s\": " << _minTime << "\n"
+       << "  },\n"
+       << "  \"benchmarks\": [";
+
+  const size_t numResults = _results.size();
+  for (size_t i=0; i < numResults; ++i) {
+    const Result& r = _results[i];
+    const double flopsPerByte = (r.bytesPerPoint > 0.0) ? r.flopsPerPoint / r.bytesPerPoint : 0.0;
+    sout << ((i > 0) ? ",\n" : "\n")
+	 << "    {\n"
+	 << "      \"name\": \"" << r.name << "\",\n"
+	 << "      \"iterations\": " << r.iterations << ",\n"
+	 << "      \"points_per_iteration\": " << r.numPoints << ",\n"
+	 << "      \"ns_per_point\": " << r.nsPerPoint << ",\n"
+	 << "      \"flops_per_point\": " << r.flopsPerPoint << ",\n"
+	 << "      \"bytes_per_point\": " << r.bytesPerPoint << ",\n"
+	 << "      \"flops_per_byte\": " << flopsPerByte << "\n"
+	 << "    }";
+  } // for
+  sout << "\n  ]\n"
+       << "}\n";
+} // writeJSON
+
+// ----------------------------------------------------------------------
+// Write results as table.
+void
+pylith::benchmarks::BenchmarkRunner::writeTable(std::ostream& sout) const
+{ // writeTable
+  sout << std::left << std::setw(60) << "Benchmark"
+       << std::right
+       << std::setw(14) << "ns/point"
+       << std::setw(14) << "flops/point"
+       << std::setw(14) << "flops/byte"
+       << "\n";
+
+  const size_t numResults = _results.size();
+  for (size_t i=0; i < numResults; ++i) {
+    const Result& r = _results[i];
+    const double flopsPerByte = (r.bytesPerPoint > 0.0) ? r.flopsPerPoint / r.bytesPerPoint : 0.0;
+    sout << std::left << std::setw(60) << r.name
+	 << std::right
+	 << std::setw(14) << r.nsPerPoint
+	 << std::setw(14) << r.flopsPerPoint
+	 << std::setw(14) << flopsPerByte
+	 << "\n";
+  } // for
+} // writeTable
+
+
+// End of file
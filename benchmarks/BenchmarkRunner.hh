@@ -0,0 +1,122 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file benchmarks/BenchmarkRunner.hh
+ *
+ * @brief C++ object for timing kernel microbenchmarks.
+ */
+
+#if !defined(pylith_benchmarks_benchmarkrunner_hh)
+#define pylith_benchmarks_benchmarkrunner_hh
+
+#include "Benchmark.hh" // USES Benchmark
+
+#include <vector> // HASA std::vector
+#include <string> // HASA std::string
+#include <iosfwd> // USES std::ostream
+
+/** @brief C++ object for timing kernel microbenchmarks.
+ *
+ * Each benchmark is run once to warm up the caches and then timed
+ * over an increasing number of passes until the minimum time has
+ * elapsed. Results are written as JSON with one entry per benchmark.
+ */
+class pylith::benchmarks::BenchmarkRunner
+{ // class BenchmarkRunner
+
+// PUBLIC STRUCTS ///////////////////////////////////////////////////////
+public :
+
+  struct Result {
+    std::string name; ///< Name of benchmark.
+    long iterations; ///< Number of timed passes.
+    int numPoints; ///< Number of points per pass.
+    double nsPerPoint; ///< Wall time per point (ns).
+    double flopsPerPoint; ///< Floating point operations per point.
+    double bytesPerPoint; ///< Bytes read and written per point.
+  }; // Result
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor.
+  BenchmarkRunner(void);
+
+  /// Destructor.
+  ~BenchmarkRunner(void);
+
+  /** Set minimum time for timing each benchmark.
+   *
+   * @param value Minimum time in seconds.
+   */
+  void minTime(const double value);
+
+  /** Only run benchmarks whose name contains a string.
+   *
+   * @param value String to match.
+   */
+  void filter(const char* value);
+
+  /** Add benchmark. The runner takes ownership of the benchmark.
+   *
+   * @param benchmark Benchmark to add.
+   */
+  void add(Benchmark* benchmark);
+
+  /// Run benchmarks.
+  void run(void);
+
+  /** Get results of benchmarks.
+   *
+   * @returns Array of results.
+   */
+  const std::vector<Result>& results(void) const;
+
+  /** Write results in JSON format.
+   *
+   * @param sout Output stream.
+   */
+  void writeJSON(std::ostream& sout) const;
+
+  /** Write results as table.
+   *
+   * @param sout Output stream.
+   */
+  void writeTable(std::ostream& sout) const;
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<Benchmark*> _benchmarks; ///< Benchmarks to run.
+  std::vector<Result> _results; ///< Results of benchmarks.
+  std::string _filter; ///< Only run benchmarks matching filter.
+  double _minTime; ///< Minimum time for timing each benchmark.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  BenchmarkRunner(const BenchmarkRunner&); ///< Not implemented
+  const BenchmarkRunner& operator=(const BenchmarkRunner&); ///< Not implemented
+
+}; // class BenchmarkRunner
+
+#endif // pylith_benchmarks_benchmarkrunner_hh
+
+
+// End of file
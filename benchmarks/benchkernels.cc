@@ -0,0 +1,97 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "BenchmarkRunner.hh" // USES BenchmarkRunner
+#include "BenchElasticMaterial.hh" // USES BenchElasticMaterial
+#include "BenchIntegratorElasticity.hh" // USES BenchIntegratorElasticity
+#include "BenchQuadratureEngine.hh" // USES BenchQuadratureEngine
+#include "BenchFrictionModel.hh" // USES BenchFrictionModel
+
+#include "petsc.h"
+
+#include <iostream> // USES std::cout
+#include <fstream> // USES std::ofstream
+#include <stdexcept> // USES std::exception
+
+// Run kernel microbenchmarks.
+//
+// Options:
+//   -bench_filter <string>  Only run benchmarks whose name contains string.
+//   -bench_min_time <s>     Minimum time for timing each benchmark (default 0.1).
+//   -bench_json <filename>  Write results in JSON format to file (default stdout).
+int
+main(int argc,
+     char* argv[])
+{ // main
+  int status = 0;
+
+  PetscErrorCode err = PetscInitialize(&argc, &argv, NULL, NULL);CHKERRQ(err);
+
+  try {
+    pylith::benchmarks::BenchmarkRunner runner;
+
+    char filter[PETSC_MAX_PATH_LEN];
+    char filename[PETSC_MAX_PATH_LEN];
+    PetscReal minTime = 0.0;
+    PetscBool hasFilter = PETSC_FALSE;
+    PetscBool hasFilename = PETSC_FALSE;
+    PetscBool hasMinTime = PETSC_FALSE;
+    err = PetscOptionsGetString(NULL, NULL, "-bench_filter", filter, sizeof(filter), &hasFilter);CHKERRQ(err);
+    err = PetscOptionsGetString(NULL, NULL, "-bench_json", filename, sizeof(filename), &hasFilename);CHKERRQ(err);
+    err = PetscOptionsGetReal(NULL, NULL, "-bench_min_time", &minTime, &hasMinTime);CHKERRQ(err);
+    if (hasFilter)
+      runner.filter(filter);
+    if (hasMinTime)
+      runner.minTime(minTime);
+
+    pylith::materials::BenchElasticMaterial::add(&runner);
+    pylith::feassemble::BenchIntegratorElasticity::add(&runner);
+    pylith::feassemble::BenchQuadratureEngine::add(&runner);
+    pylith::friction::BenchFrictionModel::add(&runner);
+
+    runner.run();
+
+    if (hasFilename) {
+      std::ofstream fout(filename);
+      if (!fout.is_open()) {
+	std::cerr << "Could not open file '" << filename << "' for writing benchmark results." << std::endl;
+	status = 1;
+      } else {
+	runner.writeJSON(fout);
+      } // if/else
+      runner.writeTable(std::cout);
+    } else {
+      runner.writeJSON(std::cout);
+    } // if/else
+  } catch (const std::exception& e) {
+    std::cerr << "Error running benchmarks: " << e.what() << std::endl;
+    status = 1;
+  } catch (...) {
+    std::cerr << "Unknown error running benchmarks." << std::endl;
+    status = 1;
+  } // try/catch
+
+  err = PetscFinalize();CHKERRQ(err);
+
+  return status;
+} // main
+
+
+// End of file
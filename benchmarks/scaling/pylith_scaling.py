@@ -0,0 +1,747 @@
+#!/usr/bin/env python
+# -*- Python -*-
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+# This script runs strong or weak scaling benchmarks of PyLith on a
+# single machine. For each problem and number of processes it
+# generates a box mesh (hex8 or tet4 cells, optionally with a
+# through-going fault at x=0), writes a parameter file, runs PyLith,
+# and collects the PETSc log stages and events (including the PyLith
+# EventLogger events) and the startup phases into CSV and JSON
+# reports.
+#
+# Problems:
+#   elastic       Quasi-static, linear elastic, one time step.
+#   viscoelastic  Quasi-static, Maxwell viscoelastic, several time steps.
+#   dynamic       Explicit dynamic, linear elastic.
+#   greensfns     Green's functions for slip impulses on the fault.
+#
+# Usage: pylith_scaling.py [--mode=strong|weak] [--cells=N]
+#          [--nprocs=1,2,4] [--problems=elastic,dynamic] [--cell=hex8|tet4]
+#          [--no-fault] [--repeat=N] [--workdir=DIR] [--report=NAME]
+
+import os
+import re
+import sys
+import json
+import math
+import time
+import socket
+import platform
+import subprocess
+
+# ----------------------------------------------------------------------
+# Box mesh
+
+# Hexahedral cell vertices as offsets (i,j,k) in the grid, ordered as
+# in PyLith (counter-clockwise on the bottom and then the top).
+HEX8_CORNERS = [(0, 0, 0), (1, 0, 0), (1, 1, 0), (0, 1, 0),
+                (0, 0, 1), (1, 0, 1), (1, 1, 1), (0, 1, 1)]
+
+# Kuhn subdivision of the hexahedron into 6 tetrahedra sharing the
+# diagonal from corner 0 to corner 6. Every hexahedron uses the same
+# subdivision, so the faces of neighboring cells match.
+TET4_IN_HEX8 = [(0, 1, 2, 6), (0, 2, 3, 6), (0, 3, 7, 6),
+                (0, 7, 4, 6), (0, 4, 5, 6), (0, 5, 1, 6)]
+
+
+class BoxMesh(object):
+    """
+    Structured box mesh written in the PyLith ASCII format.
+
+    The domain is the cube -L/2 <= x,y <= +L/2, -L <= z <= 0 with the
+    same number of cells along each direction.
+    """
+
+    def __init__(self, numCellsTarget, cell="hex8", fault=True, length=100.0e+3):
+        """
+        Constructor.
+
+        @param numCellsTarget Approximate number of cells.
+        @param cell Type of cell ('hex8' or 'tet4').
+        @param fault True if mesh has a fault at x=0.
+        @param length Length of domain in x and y (m).
+        """
+        self.cell = cell
+        self.fault = fault
+        self.length = length
+
+        numHex = numCellsTarget / (6.0 if cell == "tet4" else 1.0)
+        n = max(2, int(round(numHex ** (1.0 / 3.0))))
+        if n % 2:
+            n += 1  # Need vertices at x=0 for the fault.
+        self.nx = n
+        self.ny = n
+        self.nz = n
+        self.dx = length / n
+        return
+
+    def numVertices(self):
+        return (self.nx + 1) * (self.ny + 1) * (self.nz + 1)
+
+    def numCells(self):
+        numHex = self.nx * self.ny * self.nz
+        return 6 * numHex if self.cell == "tet4" else numHex
+
+    def vertexIndex(self, i, j, k):
+        return (k * (self.ny + 1) + j) * (self.nx + 1) + i
+
+    def vertexCoordinates(self, i, j, k):
+        return (-0.5 * self.length + i * self.dx,
+                -0.5 * self.length + j * self.dx,
+                -self.length + k * self.dx)
+
+    def write(self, filename):
+        """
+        Write mesh to file.
+        """
+        nx, ny, nz = self.nx, self.ny, self.nz
+        fout = open(filename, "w")
+        fout.write("// Box mesh generated by pylith_scaling.py.\n")
+        fout.write("mesh = {\n  dimension = 3\n  use-index-zero = true\n")
+
+        fout.write("  vertices = {\n    dimension = 3\n    count = %d\n    coordinates = {\n" % self.numVertices())
+        for k in range(nz + 1):
+            for j in range(ny + 1):
+                for i in range(nx + 1):
+                    x, y, z = self.vertexCoordinates(i, j, k)
+                    fout.write("%d %.6e %.6e %.6e\n" % (self.vertexIndex(i, j, k), x, y, z))
+        fout.write("    }\n  }\n")
+
+        numCorners = 4 if self.cell == "tet4" else 8
+        tets = self._orientedTets()
+        fout.write("  cells = {\n    count = %d\n    num-corners = %d\n    simplices = {\n" % (self.numCells(), numCorners))
+        iCell = 0
+        for k in range(nz):
+            for j in range(ny):
+                for i in range(nx):
+                    corners = [self.vertexIndex(i + di, j + dj, k + dk) for (di, dj, dk) in HEX8_CORNERS]
+                    if self.cell == "tet4":
+                        for tet in tets:
+                            fout.write("%d %s\n" % (iCell, " ".join([str(corners[c]) for c in tet])))
+                            iCell += 1
+                    else:
+                        fout.write("%d %s\n" % (iCell, " ".join([str(c) for c in corners])))
+                        iCell += 1
+        fout.write("    }\n    material-ids = {\n")
+        for iCell in range(self.numCells()):
+            fout.write("%d 1\n" % iCell)
+        fout.write("    }\n  }\n")
+
+        self._writeGroup(fout, "face_xneg", lambda i, j, k: i == 0)
+        self._writeGroup(fout, "face_xpos", lambda i, j, k: i == nx)
+        self._writeGroup(fout, "face_zneg", lambda i, j, k: k == 0)
+        if self.fault:
+            self._writeGroup(fout, "fault", lambda i, j, k: 2 * i == nx)
+        fout.write("}\n")
+        fout.close()
+        return
+
+    def faultVertices(self):
+        """
+        Get coordinates (y,z) of vertices on the fault.
+        """
+        return [self.vertexCoordinates(self.nx // 2, j, k)[1:]
+                for k in range(self.nz + 1) for j in range(self.ny + 1)]
+
+    def _writeGroup(self, fout, name, selector):
+        indices = [self.vertexIndex(i, j, k)
+                   for k in range(self.nz + 1) for j in range(self.ny + 1) for i in range(self.nx + 1)
+                   if selector(i, j, k)]
+        fout.write("  group = {\n    name = %s\n    type = vertices\n    count = %d\n    indices = {\n" % (name, len(indices)))
+        for index in indices:
+            fout.write("%d\n" % index)
+        fout.write("    }\n  }\n")
+        return
+
+    def _orientedTets(self):
+        """
+        Order vertices of tetrahedra so the Jacobian is positive.
+        """
+        tets = []
+        for tet in TET4_IN_HEX8:
+            p = [HEX8_CORNERS[c] for c in tet]
+            a = [p[1][d] - p[0][d] for d in range(3)]
+            b = [p[2][d] - p[0][d] for d in range(3)]
+            c = [p[3][d] - p[0][d] for d in range(3)]
+            det = a[0] * (b[1] * c[2] - b[2] * c[1]) - a[1] * (b[0] * c[2] - b[2] * c[0]) + a[2] * (b[0] * c[1] - b[1] * c[0])
+            tets.append(tet if det > 0 else (tet[0], tet[2], tet[1], tet[3]))
+        return tets
+
+
+# ----------------------------------------------------------------------
+# Parameter files
+
+# Elastic properties (Vp, Vs, density).
+VP = 5773.5
+VS = 3333.3
+DENSITY = 2700.0
+VISCOSITY = 1.0e+18
+
+
+class ProblemWriter(object):
+    """
+    Write the PyLith parameter file for a benchmark problem.
+    """
+
+    PROBLEMS = ["elastic", "viscoelastic", "dynamic", "greensfns"]
+
+    def __init__(self, problem, mesh, numImpulses=16, numSteps=10):
+        """
+        Constructor.
+
+        @param problem Name of problem.
+        @param mesh Box mesh.
+        @param numImpulses Approximate number of impulses for Green's functions.
+        @param numSteps Number of time steps for viscoelastic and dynamic problems.
+        """
+        if not problem in self.PROBLEMS:
+            raise ValueError("Unknown problem '%s'. Known problems: %s." % (problem, ", ".join(self.PROBLEMS)))
+        if problem == "greensfns" and not mesh.fault:
+            raise ValueError("Green's functions problem requires a fault.")
+        self.problem = problem
+        self.mesh = mesh
+        self.numImpulses = numImpulses
+        self.numSteps = numSteps
+        return
+
+    def write(self, filename, meshFilename):
+        """
+        Write parameter file (and spatial databases).
+        """
+        mesh = self.mesh
+        problem = self.problem
+        dirname = os.path.dirname(filename)
+        quadCell = "pylith.feassemble.FIATSimplex" if mesh.cell == "tet4" else "pylith.feassemble.FIATLagrange"
+
+        lines = []
+        lines += ["[pylithapp.mesh_generator]",
+                  "reader = pylith.meshio.MeshIOAscii",
+                  "reader.filename = %s" % meshFilename,
+                  "reader.coordsys.space_dim = 3",
+                  ""]
+        if problem == "greensfns":
+            lines += ["[pylithapp]",
+                      "problem = pylith.problems.GreensFns",
+                      "",
+                      "[pylithapp.problem]",
+                      "fault_id = 100",
+                      ""]
+        lines += ["[pylithapp.problem]",
+                  "dimension = 3",
+                  "materials = [material]",
+                  "bc = [x_neg,x_pos]",
+                  ]
+        if mesh.fault:
+            lines += ["interfaces = [fault]"]
+        if problem == "greensfns":
+            lines += ["interfaces.fault = pylith.faults.FaultCohesiveImpulses"]
+
+        if problem == "dynamic":
+            dt = 0.5 * mesh.dx / VP
+            formulation = "pylith.problems.ExplicitTet4" if mesh.cell == "tet4" else "pylith.problems.Explicit"
+            lines += ["formulation = %s" % formulation,
+                      "formulation.norm_viscosity = 0.1",
+                      "normalizer = spatialdata.units.NondimElasticDynamic",
+                      "normalizer.shear_wave_speed = %g*m/s" % VS,
+                      "normalizer.mass_density = %g*kg/m**3" % DENSITY,
+                      "normalizer.wave_period = %g*s" % (10.0 * dt),
+                      "",
+                      "[pylithapp.problem.formulation.time_step]",
+                      "dt = %g*s" % dt,
+                      "total_time = %g*s" % ((self.numSteps - 1) * dt),
+                      ]
+        elif problem == "viscoelastic":
+            lines += ["normalizer.length_scale = 1.0*km",
+                      "",
+                      "[pylithapp.problem.formulation.time_step]",
+                      "dt = 1.0*year",
+                      "total_time = %g*year" % (self.numSteps - 1),
+                      ]
+        elif problem == "elastic":
+            lines += ["normalizer.length_scale = 1.0*km",
+                      "",
+                      "[pylithapp.problem.formulation.time_step]",
+                      "total_time = 0.0*s",
+                      ]
+        else:
+            lines += ["normalizer.length_scale = 1.0*km"]
+        lines += [""]
+
+        if problem == "viscoelastic":
+            material = "pylith.materials.MaxwellIsotropic3D"
+            values = "[density,vs,vp,viscosity]"
+            data = "[%g*kg/m**3,%g*m/s,%g*m/s,%g*Pa*s]" % (DENSITY, VS, VP, VISCOSITY)
+        else:
+            material = "pylith.materials.ElasticIsotropic3D"
+            values = "[density,vs,vp]"
+            data = "[%g*kg/m**3,%g*m/s,%g*m/s]" % (DENSITY, VS, VP)
+        lines += ["[pylithapp.problem]",
+                  "materials.material = %s" % material,
+                  "",
+                  "[pylithapp.problem.materials.material]",
+                  "label = Box material",
+                  "id = 1",
+                  "db_properties = spatialdata.spatialdb.UniformDB",
+                  "db_properties.label = Properties",
+                  "db_properties.values = %s" % values,
+                  "db_properties.data = %s" % data,
+                  "quadrature.cell = %s" % quadCell,
+                  "quadrature.cell.dimension = 3",
+                  "output.cell_data_fields = []",
+                  "output.cell_info_fields = []",
+                  "",
+                  ]
+
+        # Shear the box with displacements on the +x and -x faces.
+        for name, sign in (("x_pos", -1.0), ("x_neg", +1.0)):
+            lines += ["[pylithapp.problem.bc.%s]" % name,
+                      "bc_dof = [0,1,2]",
+                      "label = face_%s" % name.replace("_", ""),
+                      "db_initial = spatialdata.spatialdb.UniformDB",
+                      "db_initial.label = Dirichlet BC %s" % name,
+                      "db_initial.values = [displacement-x,displacement-y,displacement-z]",
+                      "db_initial.data = [0.0*m,%g*m,0.0*m]" % (0.0 if problem in ("dynamic", "greensfns") else sign),
+                      "",
+                      ]
+
+        if mesh.fault:
+            lines += ["[pylithapp.problem.interfaces.fault]",
+                      "id = 100",
+                      "label = fault",
+                      "quadrature.cell = %s" % quadCell,
+                      "quadrature.cell.dimension = 2",
+                      "output.vertex_info_fields = []",
+                      "output.vertex_data_fields = []",
+                      ]
+            if problem == "greensfns":
+                dbFilename = os.path.join(dirname, "impulse_amplitude.spatialdb")
+                self._writeImpulseAmplitude(dbFilename)
+                lines += ["impulse_dof = [0]",
+                          "db_impulse_amplitude.label = Amplitude of slip impulses",
+                          "db_impulse_amplitude.iohandler.filename = %s" % os.path.basename(dbFilename),
+                          "db_impulse_amplitude.query_type = nearest",
+                          "",
+                          ]
+            else:
+                lines += ["",
+                          "[pylithapp.problem.interfaces.fault.eq_srcs.rupture.slip_function]",
+                          "slip = spatialdata.spatialdb.UniformDB",
+                          "slip.label = Final slip",
+                          "slip.values = [left-lateral-slip,reverse-slip,fault-opening]",
+                          "slip.data = [-1.0*m,0.0*m,0.0*m]",
+                          "slip_time = spatialdata.spatialdb.UniformDB",
+                          "slip_time.label = Slip start time",
+                          "slip_time.values = [slip-time]",
+                          "slip_time.data = [0.0*s]",
+                          "",
+                          ]
+
+        # Only write the solution at the last time step, so output
+        # does not dominate the timing.
+        lines += ["[pylithapp.problem.formulation]",
+                  "output = [domain]",
+                  "",
+                  "[pylithapp.problem.formulation.output.domain]",
+                  "output_freq = skip",
+                  "skip = 1000000",
+                  "vertex_data_fields = [displacement]",
+                  "",
+                  ]
+
+        if problem != "dynamic":
+            lines += ["[pylithapp.petsc]",
+                      "pc_type = gamg",
+                      "ksp_rtol = 1.0e-8",
+                      "ksp_atol = 1.0e-12",
+                      "ksp_max_it = 1000",
+                      "ksp_gmres_restart = 50",
+                      "",
+                      ]
+            if mesh.fault and problem != "greensfns":
+                lines += ["[pylithapp.problem.formulation]",
+                          "split_fields = True",
+                          "matrix_type = aij",
+                          "use_custom_constraint_pc = True",
+                          "",
+                          "[pylithapp.petsc]",
+                          "fs_pc_type = fieldsplit",
+                          "fs_pc_use_amat = true",
+                          "fs_pc_fieldsplit_type = multiplicative",
+                          "fs_fieldsplit_displacement_pc_type = gamg",
+                          "fs_fieldsplit_lagrange_multiplier_pc_type = jacobi",
+                          "fs_fieldsplit_displacement_ksp_type = preonly",
+                          "fs_fieldsplit_lagrange_multiplier_ksp_type = preonly",
+                          "",
+                          ]
+
+        fout = open(filename, "w")
+        fout.write("# Parameter file generated by pylith_scaling.py for the '%s' problem.\n" % problem)
+        fout.write("\n".join(lines))
+        fout.close()
+        return
+
+    def _writeImpulseAmplitude(self, filename):
+        """
+        Write spatial database with unit amplitude in a square patch
+        of fault vertices near the center of the fault and zero
+        elsewhere.
+        """
+        mesh = self.mesh
+        n = max(1, int(round(math.sqrt(self.numImpulses))))
+        halfWidth = 0.5 * n * mesh.dx
+        yCenter = 0.0
+        zCenter = -0.5 * mesh.length
+        points = mesh.faultVertices()
+        fout = open(filename, "w")
+        fout.write("#SPATIAL.ascii 1\n")
+        fout.write("SimpleDB {\n  num-values = 1\n  value-names = slip\n  value-units = m\n")
+        fout.write("  num-locs = %d\n  data-dim = 2\n  space-dim = 3\n" % len(points))
+        fout.write("  cs-data = cartesian {\n    to-meters = 1.0\n    space-dim = 3\n  }\n}\n")
+        for (y, z) in points:
+            inside = abs(y - yCenter) < halfWidth and abs(z - zCenter) < halfWidth
+            fout.write("0.0 %.6e %.6e %.1f\n" % (y, z, 1.0 if inside else 0.0))
+        fout.close()
+        return
+
+
+# ----------------------------------------------------------------------
+# PETSc log
+
+class LogViewParser(object):
+    """
+    Parse stages and events from the ASCII output of PETSc -log_view.
+    """
+
+    # Number of numeric columns after the event name.
+    NUM_EVENT_COLUMNS = 20
+
+    def __init__(self):
+        self.stages = []
+        self.events = []
+        return
+
+    def parse(self, filename):
+        """
+        Parse file with -log_view output.
+        """
+        self.stages = []
+        self.events = []
+        reStage = re.compile(r"^\s*\d+:\s+(.+?):\s+(\S+)\s+(\S+)%\s+(\S+)\s+(\S+)%\s+(\S+)\s+(\S+)%\s+(\S+)\s+(\S+)%\s+(\S+)\s+(\S+)%")
+        reEventStage = re.compile(r"^--- Event Stage \d+: (.+)$")
+
+        inStages = False
+        inEvents = False
+        stage = None
+        for line in open(filename, "r"):
+            line = line.rstrip()
+            if line.startswith("Summary of Stages"):
+                inStages = True
+                continue
+            if inStages:
+                match = reStage.match(line)
+                if match:
+                    self.stages.append({
+                        'name': match.group(1).strip(),
+                        'time': float(match.group(2)),
+                        'time_percent': float(match.group(3)),
+                        'flop': float(match.group(4)),
+                        'messages': float(match.group(6)),
+                        'message_length': float(match.group(8)),
+                        'reductions': float(match.group(10)),
+                    })
+                elif self.stages and not line.strip().startswith("Avg"):
+                    inStages = False
+                continue
+            match = reEventStage.match(line)
+            if match:
+                inEvents = True
+                stage = match.group(1).strip()
+                continue
+            if inEvents:
+                if line.startswith("Memory usage") or line.startswith("Object Type") or line.startswith("----"):
+                    inEvents = False
+                    continue
+                tokens = line.split()
+                if len(tokens) <= self.NUM_EVENT_COLUMNS:
+                    continue
+                values = tokens[-self.NUM_EVENT_COLUMNS:]
+                try:
+                    values = [float(v) for v in values]
+                except ValueError:
+                    continue
+                self.events.append({
+                    'stage': stage,
+                    'name': " ".join(tokens[:-self.NUM_EVENT_COLUMNS]),
+                    'count': values[0],
+                    'count_ratio': values[1],
+                    'time': values[2],
+                    'time_ratio': values[3],
+                    'flop': values[4],
+                    'flop_ratio': values[5],
+                    'messages': values[6],
+                    'message_length': values[7],
+                    'reductions': values[8],
+                    'mflops': values[19],
+                })
+        return
+
+
+# ----------------------------------------------------------------------
+class ScalingApp(object):
+    """
+    Application for running strong and weak scaling benchmarks.
+    """
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self):
+        """
+        Constructor.
+        """
+        self.mode = "strong"
+        self.numCells = 100000
+        self.nprocs = [1, 2, 4]
+        self.problems = ["elastic"]
+        self.cell = "hex8"
+        self.fault = True
+        self.repeat = 1
+        self.numImpulses = 16
+        self.numSteps = 10
+        self.workdir = "scaling"
+        self.report = "scaling"
+        self.pylith = "pylith"
+        self.launcher = "mpirun -np ${nodes}"
+        self.dryRun = False
+        return
+
+    def main(self):
+        """
+        Main entry point for application.
+        """
+        if not os.path.isdir(self.workdir):
+            os.makedirs(self.workdir)
+
+        runs = []
+        for problem in self.problems:
+            for nprocs in self.nprocs:
+                numCells = self.numCells * (nprocs if self.mode == "weak" else 1)
+                mesh = BoxMesh(numCells, self.cell, self.fault)
+                rundir = os.path.join(self.workdir, "%s_%s_p%d" % (problem, self.mode, nprocs))
+                if not os.path.isdir(rundir):
+                    os.makedirs(rundir)
+                mesh.write(os.path.join(rundir, "box.mesh"))
+                ProblemWriter(problem, mesh, self.numImpulses, self.numSteps).write(os.path.join(rundir, "box.cfg"), "box.mesh")
+
+                best = None
+                for iRepeat in range(self.repeat):
+                    run = self._run(rundir, nprocs)
+                    if best is None or (run['returncode'] == 0 and (best['returncode'] != 0 or run['wall_time'] < best['wall_time'])):
+                        best = run
+                best.update({
+                    'problem': problem,
+                    'mode': self.mode,
+                    'nprocs': nprocs,
+                    'cell': self.cell,
+                    'fault': self.fault,
+                    'num_cells': mesh.numCells(),
+                    'num_vertices': mesh.numVertices(),
+                    'repeat': self.repeat,
+                })
+                runs.append(best)
+                if not self.dryRun:
+                    print("%-14s nprocs=%-4d cells=%-10d wall time=%.3f s%s" % (problem, nprocs, mesh.numCells(), best['wall_time'], "" if best['returncode'] == 0 else " (FAILED)"))
+
+        self._writeJSON(runs)
+        self._writeCSV(runs)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _run(self, rundir, nprocs):
+        """
+        Run PyLith in directory and collect logs.
+        """
+        cmd = [self.pylith, "box.cfg",
+               "--nodes=%d" % nprocs,
+               "--launcher.command=%s" % self.launcher,
+               "--petsc.log_view=:log_view.txt",
+               "--perf_logger.startup_report=startup.json",
+               ]
+        run = {'command': " ".join(cmd),
+               'returncode': 0,
+               'wall_time': 0.0,
+               'stages': [],
+               'events': [],
+               'startup': None,
+               }
+        if self.dryRun:
+            print("cd %s && %s" % (rundir, run['command']))
+            return run
+
+        logView = os.path.join(rundir, "log_view.txt")
+        if os.path.exists(logView):
+            os.remove(logView)
+        fout = open(os.path.join(rundir, "pylith.log"), "w")
+        tBegin = time.time()
+        run['returncode'] = subprocess.call(cmd, cwd=rundir, stdout=fout, stderr=subprocess.STDOUT)
+        run['wall_time'] = time.time() - tBegin
+        fout.close()
+
+        if os.path.exists(logView):
+            parser = LogViewParser()
+            parser.parse(logView)
+            run['stages'] = parser.stages
+            run['events'] = parser.events
+        startup = os.path.join(rundir, "startup.json")
+        if os.path.exists(startup):
+            run['startup'] = json.load(open(startup, "r"))
+        return run
+
+    def _efficiency(self, runs):
+        """
+        Compute parallel efficiency of each stage relative to the run
+        with the fewest processes for the same problem.
+        """
+        efficiency = []
+        for problem in self.problems:
+            problemRuns = [run for run in runs if run['problem'] == problem and run['returncode'] == 0]
+            if not problemRuns:
+                continue
+            base = min(problemRuns, key=lambda run: run['nprocs'])
+            baseTimes = dict([(stage['name'], stage['time']) for stage in base['stages']])
+            baseTimes['Wall'] = base['wall_time']
+            for run in problemRuns:
+                times = dict([(stage['name'], stage['time']) for stage in run['stages']])
+                times['Wall'] = run['wall_time']
+                for name, t in times.items():
+                    if not name in baseTimes or t <= 0.0:
+                        continue
+                    t0 = baseTimes[name]
+                    if self.mode == "weak":
+                        value = t0 / t
+                    else:
+                        value = (t0 * base['nprocs']) / (t * run['nprocs'])
+                    efficiency.append({'problem': problem, 'nprocs': run['nprocs'], 'stage': name, 'time': t, 'efficiency': value})
+        return efficiency
+
+    def _writeJSON(self, runs):
+        """
+        Write scaling report in JSON format.
+        """
+        report = {
+            'context': {
+                'date': time.strftime("%Y-%m-%dT%H:%M:%S"),
+                'host': socket.gethostname(),
+                'platform': platform.platform(),
+                'command': " ".join(sys.argv),
+                'mode': self.mode,
+                'cell': self.cell,
+                'fault': self.fault,
+                },
+            'runs': runs,
+            'efficiency': self._efficiency(runs),
+            }
+        fout = open(self.report + ".json", "w")
+        json.dump(report, fout, indent=2, sort_keys=True)
+        fout.close()
+        return
+
+    def _writeCSV(self, runs):
+        """
+        Write scaling report in CSV format with one row per stage,
+        event, and startup phase of each run.
+        """
+        import csv
+        fout = open(self.report + ".csv", "w")
+        writer = csv.writer(fout)
+        writer.writerow(["problem", "mode", "cell", "fault", "nprocs", "num_cells", "num_vertices", "kind", "stage", "name",
+                         "count", "time", "time_ratio", "flop", "messages", "message_length", "reductions", "memory"])
+        for run in runs:
+            prefix = [run['problem'], run['mode'], run['cell'], int(run['fault']), run['nprocs'], run['num_cells'], run['num_vertices']]
+            writer.writerow(prefix + ["run", "", "Wall", 1, run['wall_time'], 1.0, "", "", "", "", ""])
+            for stage in run['stages']:
+                writer.writerow(prefix + ["stage", stage['name'], stage['name'], 1, stage['time'], "", stage['flop'], stage['messages'], stage['message_length'], stage['reductions'], ""])
+            for event in run['events']:
+                writer.writerow(prefix + ["event", event['stage'], event['name'], event['count'], event['time'], event['time_ratio'], event['flop'], event['messages'], event['message_length'], event['reductions'], ""])
+            if run['startup']:
+                for phase in run['startup'].get('phases', []):
+                    wallTime = phase['wall_time']
+                    timeRatio = wallTime['max'] / wallTime['min'] if wallTime['min'] > 0.0 else ""
+                    writer.writerow(prefix + ["phase", "", phase['name'], phase['count'], wallTime['max'], timeRatio,
+                                              "", "", "", "", phase['memory_peak']['max']])
+        fout.close()
+        return
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+
+    description = "Run strong or weak scaling benchmarks of PyLith on a single machine."
+
+    import argparse
+    parser = argparse.ArgumentParser(description=description)
+    parser.add_argument("--mode", action="store", dest="mode", default="strong", choices=("strong", "weak"),
+                        help="Strong (fixed total cells) or weak (fixed cells per process) scaling.")
+    parser.add_argument("--cells", action="store", dest="numCells", type=int, default=100000,
+                        help="Number of cells (strong) or number of cells per process (weak).")
+    parser.add_argument("--nprocs", action="store", dest="nprocs", default="1,2,4",
+                        help="Comma separated list of numbers of processes.")
+    parser.add_argument("--problems", action="store", dest="problems", default="elastic",
+                        help="Comma separated list of problems (%s)." % ", ".join(ProblemWriter.PROBLEMS))
+    parser.add_argument("--cell", action="store", dest="cell", default="hex8", choices=("hex8", "tet4"),
+                        help="Type of cell.")
+    parser.add_argument("--no-fault", action="store_false", dest="fault",
+                        help="Do not include a fault in the mesh.")
+    parser.add_argument("--repeat", action="store", dest="repeat", type=int, default=1,
+                        help="Number of times to run each case (fastest run is reported).")
+    parser.add_argument("--impulses", action="store", dest="numImpulses", type=int, default=16,
+                        help="Approximate number of impulses for Green's functions.")
+    parser.add_argument("--steps", action="store", dest="numSteps", type=int, default=10,
+                        help="Number of time steps for the viscoelastic and dynamic problems.")
+    parser.add_argument("--workdir", action="store", dest="workdir", default="scaling",
+                        help="Directory for meshes, parameter files, and logs.")
+    parser.add_argument("--report", action="store", dest="report", default="scaling",
+                        help="Base name of CSV and JSON reports.")
+    parser.add_argument("--pylith", action="store", dest="pylith", default="pylith",
+                        help="PyLith executable.")
+    parser.add_argument("--launcher", action="store", dest="launcher", default="mpirun -np ${nodes}",
+                        help="MPI launcher command.")
+    parser.add_argument("--dry-run", action="store_true", dest="dryRun",
+                        help="Generate meshes and parameter files and print commands without running PyLith.")
+    args = parser.parse_args()
+
+    app = ScalingApp()
+    app.mode = args.mode
+    app.numCells = args.numCells
+    app.nprocs = [int(n) for n in args.nprocs.split(",")]
+    app.problems = args.problems.split(",")
+    app.cell = args.cell
+    app.fault = args.fault
+    app.repeat = max(1, args.repeat)
+    app.numImpulses = args.numImpulses
+    app.numSteps = max(2, args.numSteps)
+    app.workdir = args.workdir
+    app.report = args.report
+    app.pylith = args.pylith
+    app.launcher = args.launcher
+    app.dryRun = args.dryRun
+    app.main()
+
+
+# End of file
@@ -33,6 +33,7 @@
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -42,8 +43,6 @@
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::bc::AbsorbingDampers::AbsorbingDampers(void) :
@@ -240,11 +239,10 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
 
   const int setupEvent = _logger->eventId("AdIR setup");
   const int computeEvent = _logger->eventId("AdIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("AdIR geometry");
   const int restrictEvent = _logger->eventId("AdIR restrict");
   const int updateEvent = _logger->eventId("AdIR update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -285,22 +283,16 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
   const PetscInt cEnd = cellsStratum.end();
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   for (PetscInt c = cStart; c < cEnd; ++c) {
     // Get geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(restrictEvent);
 
     // Reset element vector to zero
     _resetCellVector();
@@ -311,10 +303,7 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(restrictEvent);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -338,21 +327,15 @@ pylith::bc::AbsorbingDampers::integrateResidual(const topology::Field& residual,
 
     _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis*(1+numBasis*(3*spaceDim))));
+  // Coordinates, velocity, and damping constants are read; residual is updated.
+  utils::EventLogger::logBytes(computeEvent, (cEnd-cStart)*_valueBytes(2*numBasis*spaceDim + numQuadPts*spaceDim, numBasis*spaceDim));
   _logger->eventEnd(computeEvent);
-#endif
 
   PYLITH_METHOD_END;
 } // integrateResidual
@@ -374,11 +357,10 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
 
   const int setupEvent = _logger->eventId("AdIR setup");
   const int computeEvent = _logger->eventId("AdIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("AdIR geometry");
   const int restrictEvent = _logger->eventId("AdIR restrict");
   const int updateEvent = _logger->eventId("AdIR update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -418,22 +400,16 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   for (PetscInt c=cStart; c < cEnd; ++c) {
     // Get geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(restrictEvent);
 
     // Reset element vector to zero
     _resetCellVector();
@@ -444,10 +420,7 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(restrictEvent);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -472,21 +445,15 @@ pylith::bc::AbsorbingDampers::integrateResidualLumped(const topology::Field& res
 
     _residualVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(1+numBasis+numBasis*(1+spaceDim*3)));
+  // Coordinates, velocity, and damping constants are read; residual is updated.
+  utils::EventLogger::logBytes(computeEvent, (cEnd-cStart)*_valueBytes(2*numBasis*spaceDim + numQuadPts*spaceDim, numBasis*spaceDim));
   _logger->eventEnd(computeEvent);
-#endif
 
   PYLITH_METHOD_END;
 } // integrateResidualLumped
@@ -508,11 +475,10 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
 
   const int setupEvent = _logger->eventId("AdIJ setup");
   const int computeEvent = _logger->eventId("AdIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("AdIJ geometry");
   const int restrictEvent = _logger->eventId("AdIJ restrict");
   const int updateEvent = _logger->eventId("AdIJ update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -553,31 +519,22 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(restrictEvent);
 
     // Get damping constants
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(restrictEvent);
 
     // Reset element vector to zero
     _resetCellMatrix();
@@ -602,24 +559,18 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Jacobian* jacobian,
         } // for
       } // for
     } // for
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(3+numBasis*(1+numBasis*(1+2*spaceDim))));
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
     
     // Assemble cell contribution into PETSc Matrix
     _jacobianMatVisitor->setClosure(&_cellMatrix[0], _cellMatrix.size(), c, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(3+numBasis*(1+numBasis*(1+2*spaceDim))));
+  // Coordinates and damping constants are read; Jacobian matrix is updated.
+  utils::EventLogger::logBytes(computeEvent, (cEnd-cStart)*_valueBytes(numBasis*spaceDim + numQuadPts*spaceDim, numBasis*spaceDim*numBasis*spaceDim));
   _logger->eventEnd(computeEvent);
-#endif
 
   _needNewJacobian = false;
 
@@ -643,11 +594,10 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
 
   const int setupEvent = _logger->eventId("AdIJ setup");
   const int computeEvent = _logger->eventId("AdIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("AdIJ geometry");
   const int restrictEvent = _logger->eventId("AdIJ restrict");
   const int updateEvent = _logger->eventId("AdIJ update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -686,31 +636,22 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   for(PetscInt c = cStart; c < cEnd; ++c) {
     // Compute geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, c);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), c);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(restrictEvent);
 
     // Get damping constants
     const PetscInt doff = dampingConstsVisitor.sectionOffset(c);
     assert(numQuadPts*spaceDim == dampingConstsVisitor.sectionDof(c));
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(restrictEvent);
 
     // Reset element vector to zero
     _resetCellVector();
@@ -737,26 +678,61 @@ pylith::bc::AbsorbingDampers::integrateJacobian(topology::Field* jacobian,
 
     _jacobianVecVisitor->setClosure(&_cellVector[0], _cellVector.size(), c, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(4+numBasis+numBasis*(1+spaceDim*2)));
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.begin(updateEvent);
+    sampler.end(updateEvent);
   } // for
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops((cEnd-cStart)*numQuadPts*(4+numBasis+numBasis*(1+spaceDim*2)));
+  // Coordinates and damping constants are read; lumped Jacobian is updated.
+  utils::EventLogger::logBytes(computeEvent, (cEnd-cStart)*_valueBytes(numBasis*spaceDim + numQuadPts*spaceDim, numBasis*spaceDim));
   _logger->eventEnd(computeEvent);
-#endif
 
   _needNewJacobian = false;
 
   PYLITH_METHOD_END;
 } // integrateJacobian
 
+// ----------------------------------------------------------------------
+// Restrict time-step levels of points for local time stepping.
+void
+pylith::bc::AbsorbingDampers::restrictTimeStepLevels(int_array* pointLevels,
+						     const topology::Mesh& mesh) const
+{ // restrictTimeStepLevels
+  PYLITH_METHOD_BEGIN;
+
+  assert(pointLevels);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscErrorCode err = 0;
+  PetscDMLabel label = NULL;
+  PetscIS pointIS = NULL;
+  err = DMGetLabel(dmMesh, _label.c_str(), &label);PYLITH_CHECK_ERROR(err);
+  if (label) {
+    err = DMLabelGetStratumIS(label, 1, &pointIS);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (pointIS) {
+    PetscInt numPoints = 0;
+    const PetscInt* points = NULL;
+    err = ISGetLocalSize(pointIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p = 0; p < numPoints; ++p) {
+      const PetscInt point = points[p];
+      if (point >= vStart && point < vEnd) {
+	assert(point < PetscInt(pointLevels->size()));
+	(*pointLevels)[point] = 0;
+      } // if
+    } // for
+    err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // restrictTimeStepLevels
+
 // ----------------------------------------------------------------------
 // Verify configuration is acceptable.
 void
@@ -134,6 +134,17 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Restrict time-step levels of points for local time stepping.
+   *
+   * The damping term in the lumped Jacobian scales with 1/dt rather
+   * than 1/dt**2, so vertices on the boundary are kept in level 0.
+   *
+   * @param pointLevels Time-step level of each point, indexed by point.
+   * @param mesh Finite-element mesh.
+   */
+  void restrictTimeStepLevels(int_array* pointLevels,
+			      const topology::Mesh& mesh) const;
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
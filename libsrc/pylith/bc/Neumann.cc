@@ -30,6 +30,8 @@
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -76,6 +78,8 @@ pylith::bc::Neumann::initialize(const topology::Mesh& mesh,
 { // initialize
   PYLITH_METHOD_BEGIN;
 
+  _initializeLogger();
+
   _queryDatabases();
   _paramsLocalToGlobal(upDir);
 
@@ -99,6 +103,12 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
   assert(_quadrature);
   assert(_boundaryMesh);
   assert(_parameters);
+  assert(_logger);
+
+  const int setupEvent = _logger->eventId("NeIR setup");
+  const int computeEvent = _logger->eventId("NeIR compute");
+
+  _logger->eventBegin(setupEvent);
 
   // Get cell geometry information that doesn't depend on cell
   const int numQuadPts = _quadrature->numQuadPts();
@@ -131,6 +141,9 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmSubMesh);
 
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(computeEvent);
+
   // Loop over faces and integrate contribution from each face
   for(PetscInt c = cStart; c < cEnd; ++c) {
     coordsVisitor.getClosure(&coordsCell, c);
@@ -165,6 +178,10 @@ pylith::bc::Neumann::integrateResidual(const topology::Field& residual,
     PetscLogFlops(numQuadPts*(1+numBasis*(1+numBasis*(1+2*spaceDim))));
   } // for
 
+  // Coordinates and tractions are read; residual is updated.
+  utils::EventLogger::logBytes(computeEvent, (cEnd-cStart)*_valueBytes(numBasis*spaceDim + numQuadPts*spaceDim, numBasis*spaceDim));
+  _logger->eventEnd(computeEvent);
+
   PYLITH_METHOD_END;
 } // integrateResidual
 
@@ -719,5 +736,22 @@ pylith::bc::Neumann::_calculateValue(const PylithScalar t)
   PYLITH_METHOD_END;
 }  // _calculateValue
 
+// ----------------------------------------------------------------------
+// Initialize logger.
+void
+pylith::bc::Neumann::_initializeLogger(void)
+{ // _initializeLogger
+  PYLITH_METHOD_BEGIN;
+
+  delete _logger; _logger = new utils::EventLogger;assert(_logger);
+  _logger->className("Neumann");
+  _logger->initialize();
+
+  _logger->registerEvent("NeIR setup");
+  _logger->registerEvent("NeIR compute");
+
+  PYLITH_METHOD_END;
+} // _initializeLogger
+
 
 // End of file 
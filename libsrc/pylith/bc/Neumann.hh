@@ -68,6 +68,20 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Check whether contributions to the residual depend on the
+   * solution.
+   *
+   * @returns False (tractions depend only on time).
+   */
+  bool residualDependsOnSoln(void) const;
+
+  /** Check whether contributions to the residual that do not depend
+   * on the solution change with time.
+   *
+   * @returns True if tractions have a rate or change in value, false otherwise.
+   */
+  bool residualConstDependsOnTime(void) const;
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
@@ -128,6 +142,12 @@ protected :
    */
   void _calculateValue(const PylithScalar t);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /// Initialize logger.
+  void _initializeLogger(void);
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -65,6 +65,20 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Check whether contributions to the residual depend on the
+   * solution.
+   *
+   * @returns False (point forces depend only on time).
+   */
+  bool residualDependsOnSoln(void) const;
+
+  /** Check whether contributions to the residual that do not depend
+   * on the solution change with time.
+   *
+   * @returns True if point forces have a rate or change in value, false otherwise.
+   */
+  bool residualConstDependsOnTime(void) const;
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
@@ -161,9 +161,9 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
       throw std::logic_error("Support for UCD fault files no longer implemented."); 
     } // if/else
 
-    // Check consistency of mesh.
-    topology::MeshOps::checkTopology(*mesh);
-    topology::MeshOps::checkTopology(faultMesh);
+    // Check consistency of mesh at the level requested for the mesh.
+    topology::MeshOps::checkTopology(*mesh, mesh->topologyCheck());
+    topology::MeshOps::checkTopology(faultMesh, mesh->topologyCheck());
 
   } catch (const std::exception& err) {
     std::ostringstream msg;
@@ -39,6 +39,7 @@
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 #include "pylith/utils/constdefs.h" // USES PYLITH_MAXFLOAT
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 
@@ -56,8 +57,6 @@
 
 #include <iostream> // TEMPORARY
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
@@ -66,6 +65,9 @@ pylith::faults::FaultCohesiveDyn::FaultCohesiveDyn(void) :
     _friction(0),
     _jacobian(0),
     _ksp(0),
+    _numSensitivitySolves(0),
+    _numSensitivityIterations(0),
+    _numFrictionSearchIterations(0),
     _openFreeSurf(true)
 { // constructor
 } // constructor
@@ -134,6 +136,30 @@ pylith::faults::FaultCohesiveDyn::openFreeSurf(const bool value)
     _openFreeSurf = value;
 } // openFreeSurf
 
+// ----------------------------------------------------------------------
+// Get number of sensitivity solves.
+int
+pylith::faults::FaultCohesiveDyn::numSensitivitySolves(void) const
+{ // numSensitivitySolves
+    return _numSensitivitySolves;
+} // numSensitivitySolves
+
+// ----------------------------------------------------------------------
+// Get number of linear solver iterations in sensitivity solves.
+int
+pylith::faults::FaultCohesiveDyn::numSensitivityIterations(void) const
+{ // numSensitivityIterations
+    return _numSensitivityIterations;
+} // numSensitivityIterations
+
+// ----------------------------------------------------------------------
+// Get number of iterations in search for friction update.
+int
+pylith::faults::FaultCohesiveDyn::numFrictionSearchIterations(void) const
+{ // numFrictionSearchIterations
+    return _numFrictionSearchIterations;
+} // numFrictionSearchIterations
+
 // ----------------------------------------------------------------------
 // Initialize fault. Determine orientation and setup boundary
 void
@@ -199,11 +225,9 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
 
     const int setupEvent = _logger->eventId("FaIR setup");
     const int computeEvent = _logger->eventId("FaIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaIR geometry");
     const int restrictEvent = _logger->eventId("FaIR restrict");
     const int updateEvent = _logger->eventId("FaIR update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -246,9 +270,7 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
     const PetscScalar* orientationArray = orientationVisitor.localArray();
 
     _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     // Loop over fault vertices
     PetscErrorCode err = 0;
@@ -270,9 +292,7 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         if (goff < 0)
             continue;
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Get prescribed traction perturbation at fault vertex.
         if (_tractPerturbation) {
@@ -313,10 +333,7 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
         const PetscInt diloff = dispTIncrVisitor.sectionOffset(e_lagrange);
         assert(spaceDim == dispTIncrVisitor.sectionDof(e_lagrange));
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
-#endif
+        sampler.end(restrictEvent);
 
         // Compute slip (in fault coordinates system) from displacements.
         PylithScalar slipNormal = 0.0;
@@ -327,10 +344,7 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
             tractionNormal += orientationArray[ooff+indexN*spaceDim+d] * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.begin(updateEvent);
         if (slipNormal < _zeroTolerance || !_openFreeSurf) {
             // if no opening or flag indicates to still impose initial tractions when fault is open.
             // Assemble contributions into field
@@ -357,16 +371,17 @@ pylith::faults::FaultCohesiveDyn::integrateResidual(const topology::Field& resid
             } // if
         } // if/else
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
     } // for
     PetscLogFlops(numVertices*spaceDim*8);
+    // Traction perturbation, orientation, area, and disp(t) and
+    // dispIncr(t->t+dt) at three points are read; residual at two
+    // points is updated.
+    const int numPerturbValues = _tractPerturbation ? spaceDim : 0;
+    utils::EventLogger::logBytes(computeEvent, numVertices*_valueBytes(numPerturbValues + spaceDim*spaceDim + 1 + 6*spaceDim, 2*spaceDim));
     delete tractionsVisitor; tractionsVisitor = 0;
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     PYLITH_METHOD_END;
 } // integrateResidual
@@ -766,6 +781,7 @@ pylith::faults::FaultCohesiveDyn::constrainSolnSpace(topology::SolutionFields* c
         if (residualM < residualTol || residualR < residualTol)
             // if residual is very small, we prefer the full step
             break;
+        ++_numFrictionSearchIterations;
 
 #if 0 // DEBUGGING
         const int rank = _faultMesh->sieveMesh()->commRank();
@@ -1059,11 +1075,9 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
     const int setupEvent = _logger->eventId("FaAS setup");
     const int computeEvent = _logger->eventId("FaAS compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaAS geometry");
     const int restrictEvent = _logger->eventId("FaAS restrict");
     const int updateEvent = _logger->eventId("FaAS update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -1134,9 +1148,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
 
     _logger->eventEnd(setupEvent);
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
@@ -1151,9 +1163,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
             continue;
         } // if
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Get residual at cohesive cell's vertices.
         const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
@@ -1194,10 +1204,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
         const PetscInt ooff = orientationVisitor.sectionOffset(v_fault);
         assert(spaceDim*spaceDim == orientationVisitor.sectionDof(v_fault));
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
-#endif
+        sampler.end(restrictEvent);
 
         // Adjust solution as in prescribed rupture, updating the Lagrange
         // multipliers and the corresponding displacment increments.
@@ -1290,10 +1297,7 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
             lagrangeTIncrVertex[iDim] += dLagrangeTpdtVertex[iDim];
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.begin(updateEvent);
 
         // Compute contribution to adjusting solution only if Lagrange
         // constraint is local (the adjustment is assembled across processors).
@@ -1325,17 +1329,13 @@ pylith::faults::FaultCohesiveDyn::adjustSolnLumped(topology::SolutionFields* con
             dispTIncrArray[diloff+d] = lagrangeTIncrVertex[d];
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
     } // for
     PetscLogFlops(numVertices*spaceDim*(17 + // adjust solve
                                         9 + // updates
                                         spaceDim*9));
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
 #if 0 // DEBUGGING
       //dLagrangeTpdtSection->view("AFTER dLagrange");
@@ -1937,6 +1937,10 @@ pylith::faults::FaultCohesiveDyn::_sensitivitySolve(void)
     const PetscVec residualVec = residual.globalVector();
     const PetscVec solutionVec = solution.globalVector();
     err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+    PetscInt numIterations = 0;
+    err = KSPGetIterationNumber(_ksp, &numIterations); PYLITH_CHECK_ERROR(err);
+    ++_numSensitivitySolves;
+    _numSensitivityIterations += numIterations;
 
     // Update section view of field.
     solution.scatterGlobalToLocal();
@@ -148,6 +148,28 @@ public :
   const topology::Field& vertexField(const char* name,
 				     const topology::SolutionFields* fields =0);
 
+  /** Get number of sensitivity solves used to enforce the friction
+   * criterion since the fault was initialized.
+   *
+   * @returns Number of sensitivity solves.
+   */
+  int numSensitivitySolves(void) const;
+
+  /** Get number of linear solver iterations in sensitivity solves
+   * since the fault was initialized.
+   *
+   * @returns Number of iterations.
+   */
+  int numSensitivityIterations(void) const;
+
+  /** Get number of iterations of the search for the update of the
+   * Lagrange multipliers satisfying the friction criterion since the
+   * fault was initialized.
+   *
+   * @returns Number of iterations.
+   */
+  int numFrictionSearchIterations(void) const;
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -292,6 +314,9 @@ private :
   topology::Jacobian* _jacobian;
 
   PetscKSP _ksp; ///< PETSc KSP linear solver for sensitivity problem.
+  int _numSensitivitySolves; ///< Number of sensitivity solves.
+  int _numSensitivityIterations; ///< Number of iterations in sensitivity solves.
+  int _numFrictionSearchIterations; ///< Number of iterations in friction search.
 
   /// Flag to control whether to continue to impose initial tractions
   /// on the fault surface when it opens. If it is a frictional
@@ -47,8 +47,6 @@
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveImpulses::FaultCohesiveImpulses(void) :
@@ -172,6 +170,24 @@ pylith::faults::FaultCohesiveImpulses::integrateResidual(const topology::Field&
   const int setupEvent = _logger->eventId("FaIR setup");
   _logger->eventBegin(setupEvent);
 
+  updateImpulse(t);
+
+  _logger->eventEnd(setupEvent);
+
+  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Set relative displacement to impulse corresponding to time.
+void
+pylith::faults::FaultCohesiveImpulses::updateImpulse(const PylithScalar t)
+{ // updateImpulse
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
   topology::Field& dispRel = _fields->get("relative disp");
   dispRel.zeroAll();
   // Set impulse corresponding to current time.
@@ -182,12 +198,8 @@ pylith::faults::FaultCohesiveImpulses::integrateResidual(const topology::Field&
   const topology::Field& orientation = _fields->get("orientation");
   FaultCohesiveLagrange::faultToGlobal(&dispRel, orientation);
 
-  _logger->eventEnd(setupEvent);
-
-  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
-
   PYLITH_METHOD_END;
-} // integrateResidual
+} // updateImpulse
 
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
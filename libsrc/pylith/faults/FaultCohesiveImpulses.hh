@@ -110,6 +110,16 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Set relative displacement to the impulse corresponding to the
+   * given time without integrating the residual.
+   *
+   * Used when the responses to a block of impulses are solved
+   * together, so that output of slip matches the impulse.
+   *
+   * @param t Current time (impulse index).
+   */
+  void updateImpulse(const PylithScalar t);
+
   /** Get vertex field associated with integrator.
    *
    * @param name Name of cell field.
@@ -28,6 +28,7 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
@@ -45,8 +46,6 @@
 #include <sstream> // USES std::ostringstream
 #include <stdexcept> // USES std::runtime_error
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveKin::FaultCohesiveKin(void)
@@ -131,6 +130,104 @@ pylith::faults::FaultCohesiveKin::integrateResidual(const topology::Field& resid
   assert(_fields);
   assert(_logger);
 
+  // Prescribed slip is integrated separately if splitting residual.
+  if (!_splitResidual) {
+    _calcSlip(t);
+  } // if
+
+  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
+
+
+  PYLITH_METHOD_END;
+} // integrateResidual
+
+// ----------------------------------------------------------------------
+// Set flag for splitting the residual.
+void
+pylith::faults::FaultCohesiveKin::splitResidual(const bool flag)
+{ // splitResidual
+  _splitResidual = flag;
+} // splitResidual
+
+// ----------------------------------------------------------------------
+// Integrate contribution of prescribed slip to residual term.
+void
+pylith::faults::FaultCohesiveKin::integrateResidualConst(const topology::Field& residual,
+							 const PylithScalar t,
+							 topology::SolutionFields* const fields)
+{ // integrateResidualConst
+  PYLITH_METHOD_BEGIN;
+
+  assert(fields);
+  assert(_fields);
+  assert(_logger);
+
+  _calcSlip(t);
+
+  const int computeEvent = _logger->eventId("FaIR compute");
+  _logger->eventBegin(computeEvent);
+
+  const int spaceDim = _quadrature->spaceDim();
+
+  // DOF L: \int_S_f \tensor{N}_p^T \tensor{R} \cdot \vec{d} dS
+  PetscSection residualGlobalSection = residual.globalSection();assert(residualGlobalSection);
+  topology::VecVisitorMesh residualVisitor(residual);
+  PetscScalar* residualArray = residualVisitor.localArray();
+
+  topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
+  const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+  topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+  const PetscScalar* areaArray = areaVisitor.localArray();
+
+  const int numVertices = _cohesiveVertices.size();
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+    const int v_fault = _cohesiveVertices[iVertex].fault;
+
+    if (e_lagrange < 0) { // Skip clamped edges.
+      continue;
+    } // if
+
+    // Compute contribution only if Lagrange constraint is local.
+    PetscInt goff = 0;
+    PetscErrorCode err = PetscSectionGetOffset(residualGlobalSection, e_lagrange, &goff);PYLITH_CHECK_ERROR(err);
+    if (goff < 0)
+      continue;
+
+    const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+    assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+
+    const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+    assert(1 == areaVisitor.sectionDof(v_fault));
+    const PylithScalar areaValue = areaArray[aoff];
+
+    const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
+    assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
+
+    for (int d=0; d < spaceDim; ++d) {
+      residualArray[rloff+d] += areaValue * dispRelArray[droff+d];
+    } // for
+  } // for
+  PetscLogFlops(numVertices*spaceDim*2);
+  // Relative disp and area are read; residual at Lagrange vertex is updated.
+  utils::EventLogger::logBytes(computeEvent, numVertices*_valueBytes(spaceDim + 1, spaceDim));
+
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateResidualConst
+
+// ----------------------------------------------------------------------
+// Compute relative displacement field from slip at time t.
+void
+pylith::faults::FaultCohesiveKin::_calcSlip(const PylithScalar t)
+{ // _calcSlip
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+  assert(_logger);
+
   const int setupEvent = _logger->eventId("FaIR setup");
   _logger->eventBegin(setupEvent);
 
@@ -152,11 +249,8 @@ pylith::faults::FaultCohesiveKin::integrateResidual(const topology::Field& resid
 
   _logger->eventEnd(setupEvent);
 
-  FaultCohesiveLagrange::integrateResidual(residual, t, fields);
-
-
   PYLITH_METHOD_END;
-} // integrateResidual
+} // _calcSlip
 
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
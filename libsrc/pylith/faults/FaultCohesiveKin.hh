@@ -86,6 +86,25 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Set flag for splitting the residual. If true,
+   * integrateResidual() omits the contribution of the prescribed
+   * slip.
+   *
+   * @param flag True if splitting residual, false otherwise.
+   */
+  void splitResidual(const bool flag);
+
+  /** Integrate contributions to residual term (r) for operator that
+   * do not depend on the solution (prescribed slip).
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateResidualConst(const topology::Field& residual,
+			      const PylithScalar t,
+			      topology::SolutionFields* const fields);
+
   /** Get vertex field associated with integrator.
    *
    * @param name Name of cell field.
@@ -95,6 +114,16 @@ public :
   const topology::Field& vertexField(const char* name,
 				     const topology::SolutionFields* fields =0);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Compute relative displacement field from slip of earthquake
+   * sources at time t.
+   *
+   * @param t Current time.
+   */
+  void _calcSlip(const PylithScalar t);
+
   // PRIVATE TYPEDEFS ///////////////////////////////////////////////////
 private :
 
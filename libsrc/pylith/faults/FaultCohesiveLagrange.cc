@@ -36,6 +36,7 @@
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
@@ -52,8 +53,6 @@
 
 #include <iostream>
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
@@ -102,7 +101,7 @@ pylith::faults::FaultCohesiveLagrange::initialize(const topology::Mesh& mesh,
     delete _faultMesh; _faultMesh = new topology::Mesh(isSubMesh); assert(_faultMesh);
     CohesiveTopology::createFaultParallel(_faultMesh, mesh, id(), label(), _useLagrangeConstraints); // :TODO: Obsolete?
 
-    topology::MeshOps::checkTopology(*_faultMesh);
+    topology::MeshOps::checkTopology(*_faultMesh, mesh.topologyCheck());
 
     // Optimize coordinate retrieval in closure
     PetscDM faultDMMesh = _faultMesh->dmMesh(); assert(faultDMMesh);
@@ -225,11 +224,9 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
 
     const int setupEvent = _logger->eventId("FaIR setup");
     const int computeEvent = _logger->eventId("FaIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaIR geometry");
     const int restrictEvent = _logger->eventId("FaIR restrict");
     const int updateEvent = _logger->eventId("FaIR update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -263,9 +260,11 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
     PetscDM dmMesh = fields->mesh().dmMesh(); assert(dmMesh);
 
     _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
+
+    // Relative displacement is integrated separately (see
+    // integrateResidualConst()) if splitting residual.
+    const PylithScalar dispRelScale = _splitResidual ? 0.0 : 1.0;
 
     // Loop over fault vertices
     const int numVertices = _cohesiveVertices.size();
@@ -285,9 +284,7 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
         if (goff < 0)
             continue;
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Get relative dislplacement at fault vertex.
         const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
@@ -328,27 +325,24 @@ pylith::faults::FaultCohesiveLagrange::integrateResidual(const topology::Field&
         const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
         assert(spaceDim == residualVisitor.sectionDof(e_lagrange));
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.end(restrictEvent);
+        sampler.begin(updateEvent);
 
         for(PetscInt d = 0; d < spaceDim; ++d) {
             const PylithScalar residualN = areaValue * (dispTArray[dtloff+d] + dispTIncrArray[diloff+d]);
             residualArray[rnoff+d] += +residualN;
             residualArray[rpoff+d] += -residualN;
-            residualArray[rloff+d] += -areaValue * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d] - dispRelArray[droff+d]);
+            residualArray[rloff+d] += -areaValue * (dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d] - dispRelScale*dispRelArray[droff+d]);
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
     } // for
     PetscLogFlops(numVertices*spaceDim*10);
+    // disp(t) and dispIncr(t->t+dt) at three points, relative disp, and
+    // area are read; residual at three points is updated.
+    utils::EventLogger::logBytes(computeEvent, numVertices*_valueBytes(7*spaceDim + 1, 3*spaceDim));
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     PYLITH_METHOD_END;
 } // integrateResidual
@@ -369,11 +363,9 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
 
     const int setupEvent = _logger->eventId("FaIJ setup");
     const int computeEvent = _logger->eventId("FaIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaIJ geometry");
     const int restrictEvent = _logger->eventId("FaIJ restrict");
     const int updateEvent = _logger->eventId("FaIJ update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -408,9 +400,7 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
     const PetscMat jacobianMatrix = jacobian->matrix(); assert(jacobianMatrix);
 
     _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
@@ -438,9 +428,7 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
         err = PetscSectionGetOffset(solnGlobalSection, v_positive, &gpoff); PYLITH_CHECK_ERROR(err);
         gpoff = gpoff < 0 ? -(gpoff+1) : gpoff;
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Get area associated with fault vertex.
         const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
@@ -454,10 +442,8 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
         err = PetscSectionGetConstraintDof(solnSection, v_negative, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
         err = PetscSectionGetConstraintDof(solnSection, v_positive, &cdof); PYLITH_CHECK_ERROR(err); assert(0 == cdof);
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.end(restrictEvent);
+        sampler.begin(updateEvent);
 
         // Set diagonal entries of Jacobian at positive vertex to area
         // associated with vertex.
@@ -497,16 +483,15 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Jacobian* jac
                            indicesL.size(), &indicesL[0],
                            &jacobianVertex[0], ADD_VALUES); PYLITH_CHECK_ERROR(err);
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
 
     } // for
     PetscLogFlops(numVertices*spaceDim*2);
+    // Area is read; four blocks of Jacobian matrix (and the diagonal
+    // block at the Lagrange vertex) are updated.
+    utils::EventLogger::logBytes(computeEvent, numVertices*_valueBytes(1, 5*spaceDim*spaceDim));
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     _needNewJacobian = false;
 
@@ -529,11 +514,8 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
 
     const int setupEvent = _logger->eventId("FaIJ setup");
     const int computeEvent = _logger->eventId("FaIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaIJ geometry");
-    const int restrictEvent = _logger->eventId("FaIJ restrict");
     const int updateEvent = _logger->eventId("FaIJ update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -550,9 +532,7 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
     PetscScalar* jacobianArray = jacobianVisitor.localArray();
 
     _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
@@ -569,9 +549,7 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
         if (goff < 0)
             continue;
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.begin(updateEvent);
         const PetscInt off = jacobianVisitor.sectionOffset(e_lagrange);
         assert(spaceDim == jacobianVisitor.sectionDof(e_lagrange));
 
@@ -579,15 +557,13 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
             jacobianArray[off+d] = 1.0;
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
     } // for
     PetscLogFlops(0);
+    // Lumped Jacobian at Lagrange vertex is updated.
+    utils::EventLogger::logBytes(computeEvent, numVertices*_valueBytes(0, spaceDim));
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     _needNewJacobian = false;
 
@@ -628,10 +604,9 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 
     const int setupEvent = _logger->eventId("FaPr setup");
     const int computeEvent = _logger->eventId("FaPr compute");
-#if defined(DETAILED_EVENT_LOGGING)
     const int restrictEvent = _logger->eventId("FaPr restrict");
     const int updateEvent = _logger->eventId("FaPr update");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -663,9 +638,7 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
     PetscErrorCode err = DMGetDefaultGlobalSection(lagrangeDM, &lagrangeGlobalSection); PYLITH_CHECK_ERROR(err);
 
     _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     PetscMat jacobianNP;
     std::map<int, int> indicesMatToSubmat;
@@ -689,9 +662,7 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
             continue;
         } // if
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Get area associated with fault vertex.
         const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
@@ -711,10 +682,7 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
                            indicesP.size(), &indicesP[0], indicesP.size(), &indicesP[0],
                            &jacobianVertexP[0]); PYLITH_CHECK_ERROR(err);
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
-#endif
+        sampler.end(restrictEvent);
 
         // Compute inverse of Jacobian diagonals
         for (int iDim=0; iDim < spaceDim; ++iDim) {
@@ -732,10 +700,7 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
         } // for
 
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
-        _logger->eventBegin(updateEvent);
-#endif
+        sampler.begin(updateEvent);
 
         // Set diagonal entries in preconditioned matrix.
         PetscInt poff = 0;
@@ -753,16 +718,12 @@ pylith::faults::FaultCohesiveLagrange::calcPreconditioner(PetscMat* const precon
 #endif
 
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(updateEvent);
-#endif
+        sampler.end(updateEvent);
     } // for
     err = MatDestroy(&jacobianNP); PYLITH_CHECK_ERROR(err);
     PetscLogFlops(numVertices*spaceDim*6);
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     PYLITH_METHOD_END;
 } // calcPreconditioner
@@ -801,10 +762,8 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
 
     const int setupEvent = _logger->eventId("FaAS setup");
     const int computeEvent = _logger->eventId("FaAS compute");
-#if defined(DETAILED_EVENT_LOGGING)
-    const int geometryEvent = _logger->eventId("FaAS geometry");
     const int restrictEvent = _logger->eventId("FaAS restrict");
-#endif
+    utils::EventSampler sampler;
 
     _logger->eventBegin(setupEvent);
 
@@ -835,9 +794,7 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
 
     _logger->eventEnd(setupEvent);
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventBegin(computeEvent);
-#endif
 
     PetscErrorCode err = 0;
     const int numVertices = _cohesiveVertices.size();
@@ -866,9 +823,7 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
             continue;
         } // if
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventBegin(restrictEvent);
-#endif
+        sampler.begin(restrictEvent);
 
         // Residual at Lagrange vertex.
         const PetscInt rloff = residualVisitor.sectionOffset(e_lagrange);
@@ -902,10 +857,7 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
         const PetscInt daloff = dispTIncrAdjVisitor.sectionOffset(e_lagrange);
         assert(spaceDim == dispTIncrAdjVisitor.sectionDof(e_lagrange));
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(restrictEvent);
-        _logger->eventBegin(computeEvent);
-#endif
+        sampler.end(restrictEvent);
 
         const PetscScalar areaVertex = areaArray[aoff];
         for(PetscInt d = 0; d < spaceDim; ++d) {
@@ -921,15 +873,9 @@ pylith::faults::FaultCohesiveLagrange::adjustSolnLumped(topology::SolutionFields
             dispTIncrAdjArray[dapoff+d] += -areaVertex / jacobianArray[jpoff+d] * dispTIncrAdjArray[dtloff+d];
         } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-        _logger->eventEnd(computeEvent);
-#endif
-
     } // for
 
-#if !defined(DETAILED_EVENT_LOGGING)
     _logger->eventEnd(computeEvent);
-#endif
 
     PYLITH_METHOD_END;
 } // adjustSolnLumped
@@ -33,6 +33,7 @@
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
@@ -48,8 +49,6 @@
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 // Constructor
 pylith::feassemble::ElasticityExplicit::ElasticityExplicit(void) :
@@ -147,13 +146,12 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
 
   const int setupEvent = _logger->eventId("ElIR setup");
   const int computeEvent = _logger->eventId("ElIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("ElIR geometry");
   const int restrictEvent = _logger->eventId("ElIR restrict");
   const int stateVarsEvent = _logger->eventId("ElIR stateVars");
   const int stressEvent = _logger->eventId("ElIR stress");
   const int updateEvent = _logger->eventId("ElIR update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -204,8 +202,9 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = NULL;
+  PetscInt numCells = 0;
+  _residualCells(&cells, &numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -233,39 +232,32 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
   const PylithScalar lengthScale = _normalizer->lengthScale();
   const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
 
-  const PylithScalar dt = _dt;assert(dt > 0);
+  // Numerical damping uses the time step of the level being advanced.
+  const PylithScalar dt = _residualTimeStep();assert(dt > 0);
   const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
 
   // Get parameters used in integration.
   scalar_array valuesIJ(numBasis);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, cell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(stateVarsEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(stateVarsEvent);
 
     // Get state variables for cell.
     _material->retrievePropsAndVars(cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(stateVarsEvent);
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.end(stateVarsEvent);
+    sampler.begin(restrictEvent);
 
     // Reset element vector to zero
     _resetCellVector();
@@ -275,10 +267,7 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
     velVisitor.getClosure(&velCell, cell);
     dispVisitor.getClosure(&dispCell, cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(restrictEvent);
 
     // Get cell geometry information that depends on cell
     const scalar_array& basis = _quadrature->basis();
@@ -342,41 +331,28 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
       dispAdjCell[i] = dispCell[i] + viscosity * velCell[i];
     } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(4+numBasis*3));
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(stressEvent);
-#endif
+    sampler.begin(stressEvent);
 
     // Compute B(transpose) * sigma, first computing strains
     calcTotalStrainFn(&strainCell, basisDeriv, &dispAdjCell[0], numBasis, spaceDim, numQuadPts);
     const scalar_array& stressCell = _material->calcStress(strainCell, false);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(stressEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(stressEvent);
 
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
 
     // Assemble cell contribution into field
     residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops(numCells*numQuadPts*(4+numBasis*3));
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(3, 1, false));
   _logger->eventEnd(computeEvent);
-#endif
 
   PYLITH_METHOD_END;
 } // integrateResidualLumped
@@ -411,12 +387,10 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
 
   const int setupEvent = _logger->eventId("ElIJ setup");
   const int computeEvent = _logger->eventId("ElIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("ElIJ geometry");
-  const int restrictEvent = _logger->eventId("ElIJ restrict");
   const int stateVarsEvent = _logger->eventId("ElIJ stateVars");
   const int updateEvent = _logger->eventId("ElIJ update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -455,32 +429,23 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
 
     // Compute geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, cell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(stateVarsEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(stateVarsEvent);
 
     // Get state variables for cell.
     _material->retrievePropsAndVars(cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(stateVarsEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(stateVarsEvent);
 
     // Reset element matrix to zero
     _resetCellVector();
@@ -512,25 +477,18 @@ pylith::feassemble::ElasticityExplicit::integrateJacobian(topology::Field* jacob
       } // for
     } // for
     
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(4 + numBasis*3) + numBasis*spaceDim);
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
     
     // Assemble cell contribution into lumped matrix.
     jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops(numCells*(numQuadPts*(4 + numBasis*3) + numBasis*spaceDim));
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(0, 1, false));
   _logger->eventEnd(computeEvent);
-#endif
 
   _needNewJacobian = false;
   _material->resetNeedNewJacobian();
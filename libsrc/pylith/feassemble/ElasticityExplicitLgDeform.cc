@@ -192,8 +192,9 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = NULL;
+  PetscInt numCells = 0;
+  _residualCells(&cells, &numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -221,7 +222,8 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   const PylithScalar lengthScale = _normalizer->lengthScale();
   const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
 
-  const PylithScalar dt = _dt;assert(dt > 0);
+  // Numerical damping uses the time step of the level being advanced.
+  const PylithScalar dt = _residualTimeStep();assert(dt > 0);
   const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
 
   // Get parameters used in integration.
@@ -324,6 +326,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateResidual(const topology
   } // for
   _material->destroyPropsAndVarsVisitors();
 
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(3, 1, false));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
@@ -438,12 +441,6 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
       } // for
     } // for
     
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(numQuadPts*(4 + numBasis*3) + numBasis*spaceDim);
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
-    
     // Assemble cell contribution into lumped matrix.
     jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
   } // for
@@ -452,6 +449,7 @@ pylith::feassemble::ElasticityExplicitLgDeform::integrateJacobian(topology::Fiel
   _needNewJacobian = false;
   _material->resetNeedNewJacobian();
 
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(0, 1, false));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
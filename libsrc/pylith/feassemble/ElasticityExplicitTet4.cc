@@ -32,6 +32,7 @@
 
 #include "pylith/utils/array.hh" // USES scalar_array
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
@@ -47,8 +48,6 @@
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
 
-//#define DETAILED_EVENT_LOGGING
-
 // ----------------------------------------------------------------------
 const int pylith::feassemble::ElasticityExplicitTet4::_spaceDim = 3;
 const int pylith::feassemble::ElasticityExplicitTet4::_cellDim = 3;
@@ -148,13 +147,12 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
 
   const int setupEvent = _logger->eventId("ElIR setup");
   const int computeEvent = _logger->eventId("ElIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("ElIR geometry");
   const int restrictEvent = _logger->eventId("ElIR restrict");
   const int stateVarsEvent = _logger->eventId("ElIR stateVars");
   const int stressEvent = _logger->eventId("ElIR stress");
   const int updateEvent = _logger->eventId("ElIR update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -192,8 +190,9 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
   // Get cell information
   PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
   assert(_materialIS);
-  const PetscInt* cells = _materialIS->points();
-  const PetscInt numCells = _materialIS->size();
+  const PetscInt* cells = NULL;
+  PetscInt numCells = 0;
+  _residualCells(&cells, &numCells);
 
   // Setup field visitors.
   scalar_array accCell(numBasis*spaceDim);
@@ -221,42 +220,35 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
   const PylithScalar lengthScale = _normalizer->lengthScale();
   const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
 
-  const PylithScalar dt = _dt;assert(dt > 0);
+  // Numerical damping uses the time step of the level being advanced.
+  const PylithScalar dt = _residualTimeStep();assert(dt > 0);
   const PylithScalar viscosity = dt*_normViscosity;assert(_normViscosity >= 0.0);
 
   // Get parameters used in integration.
   scalar_array valuesIJ(numBasis);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
 
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(restrictEvent);
-#endif
+    sampler.begin(restrictEvent);
 
     // Restrict input fields to cell
     accVisitor.getClosure(&accCell, cell);
     velVisitor.getClosure(&velCell, cell);
     dispVisitor.getClosure(&dispCell, cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(restrictEvent);
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.end(restrictEvent);
+    sampler.begin(geometryEvent);
 
     // Compute geometry information for current cell
     coordsVisitor.getClosure(&coordsCell, cell);
     const PylithScalar volume = _volume(coordsCell);assert(volume > 0.0);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(stateVarsEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(stateVarsEvent);
 
     // Get state variables for cell.
     _material->retrievePropsAndVars(cell);
@@ -264,10 +256,7 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
     // Get density at quadrature points for this cell
     const scalar_array& density = _material->calcDensity();
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(stateVarsEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(stateVarsEvent);
 
     // Reset element vector to zero
     _resetCellVector();
@@ -307,11 +296,7 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
       _cellVector[i] -= wtVertex * accCell[i];
     } // for
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(2 + numBasis*spaceDim*2);
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(stressEvent);
-#endif
+    sampler.begin(stressEvent);
 
     // Numerical damping. Compute displacements adjusted by velocity
     // times normalized viscosity.
@@ -381,11 +366,7 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
 
     const scalar_array& stressCell = _material->calcStress(strainCell, false);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(196);
-    _logger->eventEnd(stressEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(stressEvent);
 
     assert(_cellVector.size() == 12);
     assert(stressCell.size() == 6);
@@ -402,25 +383,18 @@ pylith::feassemble::ElasticityExplicitTet4::integrateResidual(const topology::Fi
     _cellVector[10] -= (d4*stressCell[4]+b4*stressCell[3]+c4*stressCell[1]) * volume;
     _cellVector[11] -= (b4*stressCell[5]+c4*stressCell[4]+d4*stressCell[2]) * volume;
 
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(84);
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
 
     // Assemble cell contribution into field
     residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops(numCells*(2 + numBasis*spaceDim*2 + 196+84));
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(3, 1, false));
   _logger->eventEnd(computeEvent);
-#endif
 
   PYLITH_METHOD_END;
 } // integrateResidual
@@ -455,12 +429,10 @@ pylith::feassemble::ElasticityExplicitTet4::integrateJacobian(topology::Field* j
 
   const int setupEvent = _logger->eventId("ElIJ setup");
   const int computeEvent = _logger->eventId("ElIJ compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("ElIJ geometry");
-  const int restrictEvent = _logger->eventId("ElIJ restrict");
   const int stateVarsEvent = _logger->eventId("ElIJ stateVars");
   const int updateEvent = _logger->eventId("ElIJ update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -498,55 +470,39 @@ pylith::feassemble::ElasticityExplicitTet4::integrateJacobian(topology::Field* j
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
   _logger->eventEnd(setupEvent);
-#if !defined(DETAILED_EVENT_LOGGING)
   _logger->eventBegin(computeEvent);
-#endif
   // Loop over cells
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventBegin(geometryEvent);
-#endif
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, cell);
     const PylithScalar volume = _volume(coordsCell);assert(volume > 0.0);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(geometryEvent);
-    _logger->eventBegin(stateVarsEvent);
-#endif
+    sampler.end(geometryEvent);
+    sampler.begin(stateVarsEvent);
 
     // Get state variables for cell.
     _material->retrievePropsAndVars(cell);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(stateVarsEvent);
-    _logger->eventBegin(computeEvent);
-#endif
+    sampler.end(stateVarsEvent);
 
     // Compute Jacobian for inertial terms
     const scalar_array& density = _material->calcDensity();
     _cellVector = density[0] * volume / (4.0 * dt2);
     
-#if defined(DETAILED_EVENT_LOGGING)
-    PetscLogFlops(3);
-    _logger->eventEnd(computeEvent);
-    _logger->eventBegin(updateEvent);
-#endif
+    sampler.begin(updateEvent);
     
     // Assemble cell contribution into lumped matrix.
     jacobianVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
 
-#if defined(DETAILED_EVENT_LOGGING)
-    _logger->eventEnd(updateEvent);
-#endif
+    sampler.end(updateEvent);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
-#if !defined(DETAILED_EVENT_LOGGING)
   PetscLogFlops(numCells*3);
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(0, 1, false));
   _logger->eventEnd(computeEvent);
-#endif
 
   _needNewJacobian = false;
   _material->resetNeedNewJacobian();
@@ -33,6 +33,7 @@
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
 #include "pylith/utils/lapack.h" // USES LAPACKdgesvd
 
@@ -122,13 +123,12 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 
   const int setupEvent = _logger->eventId("ElIR setup");
   const int computeEvent = _logger->eventId("ElIR compute");
-#if defined(DETAILED_EVENT_LOGGING)
   const int geometryEvent = _logger->eventId("ElIR geometry");
   const int restrictEvent = _logger->eventId("ElIR restrict");
   const int stateVarsEvent = _logger->eventId("ElIR stateVars");
   const int stressEvent = _logger->eventId("ElIR stress");
   const int updateEvent = _logger->eventId("ElIR update");
-#endif
+  utils::EventSampler sampler;
 
   _logger->eventBegin(setupEvent);
 
@@ -189,9 +189,7 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
 
   _material->createPropsAndVarsVisitors();
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
-  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
+  const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
 
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(computeEvent);
@@ -200,63 +198,45 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
   for(PetscInt c = 0; c < numCells; ++c) {
     const PetscInt cell = cells[c];
     // Compute geometry information for current cell
+    sampler.begin(geometryEvent);
     coordsVisitor.getClosure(&coordsCell, cell);
     _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+    sampler.end(geometryEvent);
 
     // Get state variables for cell.
+    sampler.begin(stateVarsEvent);
     _material->retrievePropsAndVars(cell);
+    sampler.end(stateVarsEvent);
 
     // Reset element vector to zero
     _resetCellVector();
 
     // Restrict input fields to cell
+    sampler.begin(restrictEvent);
     dispVisitor.getClosure(&dispCell, cell);
     dispIncrVisitor.getClosure(&dispIncrCell, cell);
+    sampler.end(restrictEvent);
 
     // Get cell geometry information that depends on cell
-    const scalar_array& basis = _quadrature->basis();
     const scalar_array& basisDeriv = _quadrature->basisDeriv();
-    const scalar_array& jacobianDet = _quadrature->jacobianDet();
-    const scalar_array& quadPtsNondim = _quadrature->quadPts();
 
     // Compute current estimate of displacement at time t+dt using solution increment.
     for(PetscInt i = 0, dispSize = dispCell.size(); i < dispSize; ++i) {
       dispTpdtCell[i] = dispCell[i] + dispIncrCell[i];
     } // for
 
-    // Compute body force vector if gravity is being used.
-    if (_gravityField) {
-      const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
-
-      // Get density at quadrature points for this cell
-      const scalar_array& density = _material->calcDensity();
-
-      quadPtsGlobal = quadPtsNondim;
-      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
-      // Compute action for element body forces
-      spatialdata::spatialdb::SpatialDB* db = _gravityField;
-      for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
-        const int err = db->query(&gravVec[0], gravVec.size(), &quadPtsGlobal[0], spaceDim, cs);
-        if (err) {
-	  throw std::runtime_error("Unable to get gravity vector for point.");
-	} // if
-        _normalizer->nondimensionalize(&gravVec[0], gravVec.size(), gravityScale);
-        const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
-        for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
-          const PylithScalar valI = wt * basis[iQ + iBasis];
-          for (int iDim = 0; iDim < spaceDim; ++iDim) {
-            _cellVector[iBasis * spaceDim + iDim] += valI * gravVec[iDim];
-          } // for
-        } // for
-      } // for
-      PetscLogFlops(numQuadPts * (2 + numBasis * (1 + 2 * spaceDim)));
+    // Compute body force vector if gravity is being used (and it is
+    // not integrated separately).
+    if (_gravityField && !_splitResidual) {
+      _calcGravityCell(&gravVec, &quadPtsGlobal, cs);
     } // if
 
     // residualSection->view("After gravity contribution");
     // Compute B(transpose) * sigma, first computing strains
+    sampler.begin(stressEvent);
     calcTotalStrainFn(&strainCell, basisDeriv, &dispTpdtCell[0], numBasis, spaceDim, numQuadPts);
     const scalar_array& stressCell = _material->calcStress(strainCell, true);
+    sampler.end(stressEvent);
 
     CALL_MEMBER_FN(*this, elasticityResidualFn)(stressCell);
 
@@ -267,15 +247,153 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     } // for
 #endif
     // Assemble cell contribution into field
+    sampler.begin(updateEvent);
     residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+    sampler.end(updateEvent);
   } // for
   _material->destroyPropsAndVarsVisitors();
 
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(2, 1, false));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
 } // integrateResidual
 
+// ----------------------------------------------------------------------
+// Set flag for splitting the residual.
+void
+pylith::feassemble::ElasticityImplicit::splitResidual(const bool flag)
+{ // splitResidual
+  _splitResidual = flag;
+} // splitResidual
+
+// ----------------------------------------------------------------------
+// Check whether contributions to the residual that do not depend on
+// the solution change with time.
+bool
+pylith::feassemble::ElasticityImplicit::residualConstDependsOnTime(void) const
+{ // residualConstDependsOnTime
+  return false;
+} // residualConstDependsOnTime
+
+// ----------------------------------------------------------------------
+// Integrate body forces from gravity.
+void
+pylith::feassemble::ElasticityImplicit::integrateResidualConst(const topology::Field& residual,
+							       const PylithScalar t,
+							       topology::SolutionFields* const fields)
+{ // integrateResidualConst
+  PYLITH_METHOD_BEGIN;
+
+  assert(_quadrature);
+  assert(_material);
+  assert(_logger);
+  assert(fields);
+
+  if (!_gravityField)
+    PYLITH_METHOD_END;
+
+  const int computeEvent = _logger->eventId("ElIR compute");
+  _logger->eventBegin(computeEvent);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+
+  // Allocate vectors for cell values.
+  scalar_array gravVec(spaceDim);
+  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
+
+  // Get cell information
+  PetscDM dmMesh = fields->mesh().dmMesh();assert(dmMesh);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  topology::VecVisitorMesh residualVisitor(residual, "displacement");
+  residualVisitor.optimizeClosure();
+
+  scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+
+  const spatialdata::geocoords::CoordSys* cs = fields->mesh().coordsys();assert(cs);
+
+  _material->createPropsAndVarsVisitors();
+
+  // Loop over cells
+  for(PetscInt c = 0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    // Compute geometry information for current cell
+    coordsVisitor.getClosure(&coordsCell, cell);
+    _quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+    // Get density for cell.
+    _material->retrievePropsAndVars(cell);
+
+    _resetCellVector();
+    _calcGravityCell(&gravVec, &quadPtsGlobal, cs);
+
+    // Assemble cell contribution into field
+    residualVisitor.setClosure(&_cellVector[0], _cellVector.size(), cell, ADD_VALUES);
+  } // for
+  _material->destroyPropsAndVarsVisitors();
+
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(0, 1, false));
+  _logger->eventEnd(computeEvent);
+
+  PYLITH_METHOD_END;
+} // integrateResidualConst
+
+// ----------------------------------------------------------------------
+// Add body force from gravity in current cell to cell vector.
+void
+pylith::feassemble::ElasticityImplicit::_calcGravityCell(scalar_array* gravVec,
+							 scalar_array* quadPtsGlobal,
+							 const spatialdata::geocoords::CoordSys* cs)
+{ // _calcGravityCell
+  assert(gravVec);
+  assert(quadPtsGlobal);
+  assert(cs);
+  assert(_gravityField);
+  assert(_quadrature);
+  assert(_material);
+  assert(_normalizer);
+
+  const int numQuadPts = _quadrature->numQuadPts();
+  const scalar_array& quadWts = _quadrature->quadWts();
+  const int numBasis = _quadrature->numBasis();
+  const int spaceDim = _quadrature->spaceDim();
+  const scalar_array& basis = _quadrature->basis();
+  const scalar_array& jacobianDet = _quadrature->jacobianDet();
+
+  const PylithScalar lengthScale = _normalizer->lengthScale();
+  const PylithScalar gravityScale = _normalizer->pressureScale() / (_normalizer->lengthScale() * _normalizer->densityScale());
+
+  // Get density at quadrature points for this cell
+  const scalar_array& density = _material->calcDensity();
+
+  *quadPtsGlobal = _quadrature->quadPts();
+  _normalizer->dimensionalize(&(*quadPtsGlobal)[0], quadPtsGlobal->size(), lengthScale);
+
+  // Compute action for element body forces
+  spatialdata::spatialdb::SpatialDB* db = _gravityField;
+  for (int iQuad = 0; iQuad < numQuadPts; ++iQuad) {
+    const int err = db->query(&(*gravVec)[0], gravVec->size(), &(*quadPtsGlobal)[0], spaceDim, cs);
+    if (err) {
+      throw std::runtime_error("Unable to get gravity vector for point.");
+    } // if
+    _normalizer->nondimensionalize(&(*gravVec)[0], gravVec->size(), gravityScale);
+    const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad] * density[iQuad];
+    for (int iBasis = 0, iQ = iQuad * numBasis; iBasis < numBasis; ++iBasis) {
+      const PylithScalar valI = wt * basis[iQ + iBasis];
+      for (int iDim = 0; iDim < spaceDim; ++iDim) {
+	_cellVector[iBasis * spaceDim + iDim] += valI * (*gravVec)[iDim];
+      } // for
+    } // for
+  } // for
+  PetscLogFlops(numQuadPts * (2 + numBasis * (1 + 2 * spaceDim)));
+} // _calcGravityCell
+
 // ----------------------------------------------------------------------
 // Compute stiffness matrix.
 void
@@ -445,6 +563,7 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
   _needNewJacobian = false;
   _material->resetNeedNewJacobian();
 
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(2, 0, true));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
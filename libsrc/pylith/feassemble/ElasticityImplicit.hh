@@ -106,6 +106,31 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Set flag for splitting the residual. If true,
+   * integrateResidual() omits the body forces from gravity.
+   *
+   * @param flag True if splitting residual, false otherwise.
+   */
+  void splitResidual(const bool flag);
+
+  /** Check whether contributions to the residual that do not depend
+   * on the solution change with time.
+   *
+   * @returns False (gravity does not change with time).
+   */
+  bool residualConstDependsOnTime(void) const;
+
+  /** Integrate contributions to residual term (r) for operator that
+   * do not depend on the solution (body forces from gravity).
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  void integrateResidualConst(const topology::Field& residual,
+			      const PylithScalar t,
+			      topology::SolutionFields* const fields);
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
@@ -117,6 +142,21 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
   
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Add body force from gravity in current cell to cell vector. The
+   * cell geometry and material properties must already be set for
+   * the cell.
+   *
+   * @param gravVec Array for gravity vector.
+   * @param quadPtsGlobal Array for dimensioned coordinates of quadrature points.
+   * @param cs Coordinate system of mesh.
+   */
+  void _calcGravityCell(scalar_array* gravVec,
+			scalar_array* quadPtsGlobal,
+			const spatialdata::geocoords::CoordSys* cs);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -265,6 +265,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateResidual(const topology
   } // for
   _material->destroyPropsAndVarsVisitors();
   
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(2, 1, false));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
@@ -447,6 +448,7 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   _needNewJacobian = false;
   _material->resetNeedNewJacobian();
 
+  utils::EventLogger::logBytes(computeEvent, numCells*_cellBytes(2, 0, true));
   _logger->eventEnd(computeEvent);
 
   PYLITH_METHOD_END;
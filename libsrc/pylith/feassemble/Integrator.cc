@@ -40,7 +40,9 @@ pylith::feassemble::Integrator::Integrator(void) :
   _gravityField(0),
   _logger(0),
   _needNewJacobian(true),
-  _isJacobianSymmetric(true)
+  _isJacobianSymmetric(true),
+  _splitResidual(false),
+  _needNewResidualConst(true)
 { // constructor
 } // constructor
 
@@ -114,6 +116,41 @@ pylith::feassemble::Integrator::stableTimeStep(const topology::Mesh& mesh)
   return pylith::PYLITH_MAXSCALAR;
 } // stableTimeStep
 
+// ----------------------------------------------------------------------
+// Get stable time step of each cell for explicit time integration.
+void
+pylith::feassemble::Integrator::stableTimeStepCells(scalar_array* dtCells,
+						    const topology::Mesh& mesh)
+{ // stableTimeStepCells
+  // Assume any time step will work.
+} // stableTimeStepCells
+
+// ----------------------------------------------------------------------
+// Restrict time-step levels of points for local time stepping.
+void
+pylith::feassemble::Integrator::restrictTimeStepLevels(int_array* pointLevels,
+						       const topology::Mesh& mesh) const
+{ // restrictTimeStepLevels
+  // Any level will work.
+} // restrictTimeStepLevels
+
+// ----------------------------------------------------------------------
+// Setup time-step levels for local time stepping.
+void
+pylith::feassemble::Integrator::timeStepLevels(const int_array& vertexLevels,
+					       const topology::Mesh& mesh)
+{ // timeStepLevels
+  // Levels are not used.
+} // timeStepLevels
+
+// ----------------------------------------------------------------------
+// Set active time-step level for local time stepping.
+void
+pylith::feassemble::Integrator::activeTimeStepLevel(const int level)
+{ // activeTimeStepLevel
+  // Integrate over all cells.
+} // activeTimeStepLevel
+
 // ----------------------------------------------------------------------
 // Initialize vector containing result of integration action for cell.
 void
@@ -182,5 +219,18 @@ pylith::feassemble::Integrator::_lumpCellMatrix(void)
   PetscLogFlops(numBasis*numBasis*spaceDim);
 } // _lumpCellMatrix
 
+// ----------------------------------------------------------------------
+// Get number of bytes moved between fields (or matrices) and local arrays.
+double
+pylith::feassemble::Integrator::_valueBytes(const double numValuesRead,
+					    const double numValuesUpdated)
+{ // _valueBytes
+  const double scalarBytes = sizeof(PetscScalar);
+  const double indexBytes = sizeof(PetscInt);
+
+  return numValuesRead * (scalarBytes + indexBytes) +
+    numValuesUpdated * (2.0*scalarBytes + indexBytes);
+} // _valueBytes
+
 
 // End of file 
@@ -107,6 +107,53 @@ public :
   virtual
   PylithScalar stableTimeStep(const topology::Mesh& mesh);
 
+  /** Get stable time step of each cell for explicit time integration
+   * (used in local time stepping).
+   *
+   * Values are only lowered. Default is to leave values unchanged.
+   *
+   * @param dtCells Stable time step of each cell, indexed by (cell - cStart).
+   * @param mesh Finite-element mesh.
+   */
+  virtual
+  void stableTimeStepCells(scalar_array* dtCells,
+			   const topology::Mesh& mesh);
+
+  /** Restrict time-step levels of points for local time stepping.
+   *
+   * Integrators with contributions to the lumped Jacobian that do not
+   * scale with 1/dt**2 set the level of their vertices to 0. Levels
+   * are only lowered. Default is to leave levels unchanged.
+   *
+   * @param pointLevels Time-step level of each point, indexed by point.
+   * @param mesh Finite-element mesh.
+   */
+  virtual
+  void restrictTimeStepLevels(int_array* pointLevels,
+			      const topology::Mesh& mesh) const;
+
+  /** Setup time-step levels for local time stepping.
+   *
+   * Default is to ignore the levels.
+   *
+   * @param vertexLevels Time-step level of each vertex, indexed by (vertex - vStart).
+   * @param mesh Finite-element mesh.
+   */
+  virtual
+  void timeStepLevels(const int_array& vertexLevels,
+		      const topology::Mesh& mesh);
+
+  /** Set active time-step level for local time stepping.
+   *
+   * Integrators may skip cells without vertices in the active level
+   * when integrating the residual. Default is to integrate over all
+   * cells.
+   *
+   * @param level Active level (-1 for all cells).
+   */
+  virtual
+  void activeTimeStepLevel(const int level);
+
   /** Check whether Jacobian needs to be recomputed.
    *
    * @returns True if Jacobian needs to be recomputed, false otherwise.
@@ -114,6 +161,15 @@ public :
   virtual
   bool needNewJacobian(void) const;
 
+  /** Get estimate of the relative change in stiffness since the
+   * Jacobian was last formed.
+   *
+   * @returns Relative change, or a negative value if the integrator
+   * does not provide an estimate.
+   */
+  virtual
+  PylithScalar stiffnessChange(void) const;
+
   /** Check whether integrator generates a symmetric Jacobian.
    *
    * @returns True if integrator generates symmetric Jacobian.
@@ -121,6 +177,45 @@ public :
   virtual
   bool isJacobianSymmetric(void) const;
 
+  /** Check whether contributions to the residual depend on the
+   * solution. Contributions that do not depend on the solution are
+   * constant over the nonlinear iterations in a time step.
+   *
+   * @returns True if residual depends on solution, false otherwise.
+   */
+  virtual
+  bool residualDependsOnSoln(void) const;
+
+  /** Check whether contributions to the residual that do not depend
+   * on the solution change with time.
+   *
+   * @returns True if contributions change with time, false otherwise.
+   */
+  virtual
+  bool residualConstDependsOnTime(void) const;
+
+  /** Check whether contributions to the residual that do not depend
+   * on the solution need to be recomputed, because of changes other
+   * than time (for example, in state variables).
+   *
+   * @returns True if contributions need to be recomputed, false otherwise.
+   */
+  bool needNewResidualConst(void) const;
+
+  /// Reset flag indicating contributions to the residual that do not
+  /// depend on the solution need to be recomputed.
+  void resetNeedNewResidualConst(void);
+
+  /** Set flag for splitting the residual. If true and the integrator
+   * supports it, integrateResidual() omits contributions that do not
+   * depend on the solution; they are computed by
+   * integrateResidualConst() instead.
+   *
+   * @param flag True if splitting residual, false otherwise.
+   */
+  virtual
+  void splitResidual(const bool flag);
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -157,6 +252,21 @@ public :
        const PylithScalar t,
        topology::SolutionFields* const fields);
 
+  /** Integrate contributions to residual term (r) for operator that
+   * do not depend on the solution.
+   *
+   * The default implementation integrates the entire residual if it
+   * does not depend on the solution and does nothing otherwise.
+   *
+   * @param residual Field containing values for residual
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void integrateResidualConst(const topology::Field& residual,
+			      const PylithScalar t,
+			      topology::SolutionFields* const fields);
+
   /** Integrate contributions to Jacobian matrix (A) associated with
    * operator.
    *
@@ -259,6 +369,20 @@ protected :
   /// equivalent forces for rigid body motion.
   void _lumpCellMatrix(void);
 
+  /** Get number of bytes moved between fields (or matrices) and local
+   * arrays.
+   *
+   * Each value read costs its value and index. Each value updated
+   * costs reading and writing its value and reading its index.
+   *
+   * @param numValuesRead Number of values read.
+   * @param numValuesUpdated Number of values added to fields or matrices.
+   * @returns Number of bytes.
+   */
+  static
+  double _valueBytes(const double numValuesRead,
+		     const double numValuesUpdated);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
@@ -285,6 +409,14 @@ protected :
   /// Default is false;
   bool _isJacobianSymmetric;
 
+  /// True if integrateResidual() omits contributions that do not
+  /// depend on the solution. Default is false.
+  bool _splitResidual;
+
+  /// True if we need to recompute contributions to residual that do
+  /// not depend on the solution. Default is true.
+  bool _needNewResidualConst;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
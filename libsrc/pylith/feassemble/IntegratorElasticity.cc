@@ -49,6 +49,7 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
+    _activeLevel(-1),
     _outputFields(0)
 { // constructor
 } // constructor
@@ -72,6 +73,8 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
     delete _outputFields; _outputFields = 0;
+    _levelCells.clear();
+    _activeLevel = -1;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -100,6 +103,16 @@ pylith::feassemble::IntegratorElasticity::needNewJacobian(void)
     PYLITH_METHOD_RETURN(_needNewJacobian);
 } // needNewJacobian
 
+// ----------------------------------------------------------------------
+// Get estimate of relative change in stiffness since Jacobian was
+// last formed.
+PylithScalar
+pylith::feassemble::IntegratorElasticity::stiffnessChange(void) const
+{ // stiffnessChange
+    assert(_material);
+    return _material->stiffnessChange();
+} // stiffnessChange
+
 // ----------------------------------------------------------------------
 // Initialize integrator.
 void
@@ -111,6 +124,8 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     assert(_material);
 
     _initializeLogger();
+    const int geometryEvent = _logger->eventId("ElIn geometry");
+    const int materialEvent = _logger->eventId("ElIn material");
 
     // Setup index set for material.
     PetscDM dmMesh = mesh.dmMesh(); assert(dmMesh);
@@ -120,13 +135,17 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
     } // if
 
     // Compute geometry for quadrature operations.
+    _logger->eventBegin(geometryEvent);
     _quadrature->initializeGeometry();
+    _logger->eventEnd(geometryEvent);
 
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
 
-    // Initialize material.
+    // Initialize material (includes queries of spatial databases).
+    _logger->eventBegin(materialEvent);
     _material->initialize(mesh, _quadrature);
+    _logger->eventEnd(materialEvent);
     _isJacobianSymmetric = _material->isJacobianSymmetric();
 
     // Allocate vectors and matrices for cell values.
@@ -392,6 +411,120 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
     PYLITH_METHOD_RETURN(buffer);
 } // cellField
 
+// ----------------------------------------------------------------------
+// Free output (buffer) fields after writing cell fields.
+void
+pylith::feassemble::IntegratorElasticity::releaseOutputFields(void)
+{ // releaseOutputFields
+    PYLITH_METHOD_BEGIN;
+
+    delete _outputFields; _outputFields = 0;
+
+    PYLITH_METHOD_END;
+} // releaseOutputFields
+
+// ----------------------------------------------------------------------
+// Get stable time step of each cell for explicit time integration.
+void
+pylith::feassemble::IntegratorElasticity::stableTimeStepCells(scalar_array* dtCells,
+                                                              const topology::Mesh& mesh)
+{ // stableTimeStepCells
+    PYLITH_METHOD_BEGIN;
+
+    assert(dtCells);
+    assert(_material);
+    assert(_materialIS);
+
+    topology::Field dtField(mesh);
+    _material->stableTimeStepExplicit(mesh, _quadrature, &dtField);
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+
+    topology::VecVisitorMesh dtVisitor(dtField);
+    const PetscScalar* dtArray = dtVisitor.localArray();
+
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    for (PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+        const PetscInt off = dtVisitor.sectionOffset(cell);
+        const PetscInt dof = dtVisitor.sectionDof(cell);
+        assert(cell - cStart < PetscInt(dtCells->size()));
+        PylithScalar& dtCell = (*dtCells)[cell-cStart];
+        for (PetscInt d = 0; d < dof; ++d) {
+            if (dtArray[off+d] < dtCell) {
+                dtCell = dtArray[off+d];
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // stableTimeStepCells
+
+// ----------------------------------------------------------------------
+// Setup time-step levels for local time stepping.
+void
+pylith::feassemble::IntegratorElasticity::timeStepLevels(const int_array& vertexLevels,
+                                                         const topology::Mesh& mesh)
+{ // timeStepLevels
+    PYLITH_METHOD_BEGIN;
+
+    assert(_materialIS);
+
+    _levelCells.clear();
+    _activeLevel = -1;
+
+    const int numLevels = vertexLevels.size() > 0 ? vertexLevels.max()+1 : 0;
+    assert(numLevels > 0);
+
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+
+    // A cell contributes to the residual of a level if any of its
+    // vertices are in that level.
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    _levelCells.resize(numLevels);
+    std::vector<bool> hasLevel(numLevels);
+    PetscErrorCode err = 0;
+    for (PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+        std::fill(hasLevel.begin(), hasLevel.end(), false);
+        PetscInt closureSize = 0;
+        PetscInt* closure = NULL;
+        err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < closureSize*2; i += 2) {
+            const PetscInt point = closure[i];
+            if (point >= vStart && point < vEnd) {
+                const int level = vertexLevels[point-vStart];
+                assert(level >= 0 && level < numLevels);
+                hasLevel[level] = true;
+            } // if
+        } // for
+        err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+        for (int level = 0; level < numLevels; ++level) {
+            if (hasLevel[level]) {
+                _levelCells[level].push_back(cell);
+            } // if
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // timeStepLevels
+
+// ----------------------------------------------------------------------
+// Set active time-step level for local time stepping.
+void
+pylith::feassemble::IntegratorElasticity::activeTimeStepLevel(const int level)
+{ // activeTimeStepLevel
+    assert(level < int(_levelCells.size()));
+    _activeLevel = level;
+} // activeTimeStepLevel
+
 // ----------------------------------------------------------------------
 // Get output fields.
 const pylith::topology::Fields*
@@ -400,6 +533,34 @@ pylith::feassemble::IntegratorElasticity::outputFields(void) const
     return _outputFields;
 } // outputFields
 
+// ----------------------------------------------------------------------
+// Get cells over which to integrate the residual.
+void
+pylith::feassemble::IntegratorElasticity::_residualCells(const PetscInt** cells,
+                                                         PetscInt* numCells) const
+{ // _residualCells
+    assert(cells);
+    assert(numCells);
+    assert(_materialIS);
+
+    if (_activeLevel >= 0 && _activeLevel < int(_levelCells.size())) {
+        const std::vector<PetscInt>& levelCells = _levelCells[_activeLevel];
+        *numCells = levelCells.size();
+        *cells = (*numCells > 0) ? &levelCells[0] : NULL;
+    } else {
+        *cells = _materialIS->points();
+        *numCells = _materialIS->size();
+    } // if/else
+} // _residualCells
+
+// ----------------------------------------------------------------------
+// Get time step of the active time-step level.
+PylithScalar
+pylith::feassemble::IntegratorElasticity::_residualTimeStep(void) const
+{ // _residualTimeStep
+    return (_activeLevel > 0) ? _dt * PylithScalar(1 << _activeLevel) : _dt;
+} // _residualTimeStep
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -411,6 +572,9 @@ pylith::feassemble::IntegratorElasticity::_initializeLogger(void)
     assert(_logger);
     _logger->className("ElasticityIntegrator");
     _logger->initialize();
+    _logger->registerEvent("ElIn geometry");
+    _logger->registerEvent("ElIn material");
+
     _logger->registerEvent("ElIR setup");
     _logger->registerEvent("ElIR geometry");
     _logger->registerEvent("ElIR compute");
@@ -429,6 +593,30 @@ pylith::feassemble::IntegratorElasticity::_initializeLogger(void)
     PYLITH_METHOD_END;
 } // initializeLogger
 
+// ----------------------------------------------------------------------
+// Get number of bytes moved between the fields and the cell arrays for a cell.
+double
+pylith::feassemble::IntegratorElasticity::_cellBytes(const int numFieldsRestricted,
+                                                     const int numFieldsUpdated,
+                                                     const bool updateMatrix) const
+{ // _cellBytes
+    assert(_quadrature);
+    assert(_material);
+
+    const double closureSize = _quadrature->numBasis() * _quadrature->spaceDim();
+
+    // Coordinates and restricted fields are read.
+    const double numValuesRead = (1 + numFieldsRestricted) * closureSize;
+
+    // Updated fields and matrix are read and written.
+    double numValuesUpdated = numFieldsUpdated * closureSize;
+    if (updateMatrix) {
+        numValuesUpdated += closureSize * closureSize;
+    } // if
+
+    return _valueBytes(numValuesRead, numValuesUpdated) + _material->retrievedBytes();
+} // _cellBytes
+
 // ----------------------------------------------------------------------
 // Allocate buffer for tensor field at quadrature points.
 void
@@ -859,6 +1047,7 @@ pylith::feassemble::IntegratorElasticity::_calcTotalStrain2D(scalar_array* strai
             (*strain)[iQuad*strainSize+2] += 0.5 * (basisDeriv[iQ+iBasis*dim+1] * disp[iBasis*dim  ] +
                                                     basisDeriv[iQ+iBasis*dim  ] * disp[iBasis*dim+1]);
         }                             // for
+    PetscLogFlops(numQuadPts*numBasis*9);
 } // calcTotalStrain2D
 
 // ----------------------------------------------------------------------
@@ -891,6 +1080,7 @@ pylith::feassemble::IntegratorElasticity::_calcTotalStrain3D(scalar_array* strai
             (*strain)[iQuad*strainSize+5] += 0.5 * (basisDeriv[iQ+iBasis*dim+2] * disp[iBasis*dim  ] +
                                                     basisDeriv[iQ+iBasis*dim  ] * disp[iBasis*dim+2]);
         }                             // for
+    PetscLogFlops(numQuadPts*numBasis*21);
 } // calcTotalStrain3D
 
 
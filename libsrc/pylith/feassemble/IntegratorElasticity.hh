@@ -43,6 +43,7 @@
 class pylith::feassemble::IntegratorElasticity : public Integrator
 { // IntegratorElasticity
   friend class TestIntegratorElasticity; // unit testing
+  friend class BenchIntegratorElasticity; // benchmarks
 
 // PUBLIC TYPEDEFS //////////////////////////////////////////////////////
 public :
@@ -82,6 +83,14 @@ public :
   virtual
   bool needNewJacobian(void);
 
+  /** Get estimate of the relative change in stiffness of the material
+   * since the Jacobian was last formed.
+   *
+   * @returns Relative change, or a negative value if the material
+   * does not provide an estimate.
+   */
+  PylithScalar stiffnessChange(void) const;
+
   /** Initialize integrator.
    *
    * @param mesh Finite-element mesh.
@@ -105,6 +114,29 @@ public :
   virtual
   void verifyConfiguration(const topology::Mesh& mesh) const;
 
+  /** Get stable time step of each cell for explicit time integration
+   * (used in local time stepping).
+   *
+   * @param dtCells Stable time step of each cell, indexed by (cell - cStart).
+   * @param mesh Finite-element mesh.
+   */
+  void stableTimeStepCells(scalar_array* dtCells,
+			   const topology::Mesh& mesh);
+
+  /** Setup time-step levels for local time stepping.
+   *
+   * @param vertexLevels Time-step level of each vertex, indexed by (vertex - vStart).
+   * @param mesh Finite-element mesh.
+   */
+  void timeStepLevels(const int_array& vertexLevels,
+		      const topology::Mesh& mesh);
+
+  /** Set active time-step level for local time stepping.
+   *
+   * @param level Active level (-1 for all cells).
+   */
+  void activeTimeStepLevel(const int level);
+
   /** Get output fields.
    *
    * @returns Output (buffer) fields.
@@ -122,12 +154,36 @@ public :
 				   const topology::Mesh& mesh,
 				   topology::SolutionFields* const fields =0);
 
+  /** Free output (buffer) fields after writing cell fields. The
+   * buffers are recreated by cellField() when needed.
+   */
+  void releaseOutputFields(void);
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Get number of bytes moved between the fields and the cell arrays
+   * for a cell in a loop over cells.
+   *
+   * We count the values and closure indices of the coordinates and
+   * vertex fields, reading and writing the values of the field (or
+   * matrix) updated with the cell vector (or matrix), and the
+   * physical properties and state variables of the material. Reads of
+   * the matrix column indices are included for matrix updates.
+   *
+   * @param numFieldsRestricted Number of vertex fields restricted to
+   *   the cell (not including the coordinates).
+   * @param numFieldsUpdated Number of vertex fields updated with a cell vector.
+   * @param updateMatrix True if matrix is updated with cell matrix.
+   * @returns Number of bytes.
+   */
+  double _cellBytes(const int numFieldsRestricted,
+		    const int numFieldsUpdated,
+		    const bool updateMatrix) const;
+
   /** Allocate buffer for tensor field at quadrature points.
    *
    * @param mesh Finite-element mesh.
@@ -207,6 +263,21 @@ protected :
 			  const int spaceDim,
 			  const int numQuadPts);
 
+  /** Get cells over which to integrate the residual. This is a subset
+   * of the material cells when a time-step level is active.
+   *
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void _residualCells(const PetscInt** cells,
+		      PetscInt* numCells) const;
+
+  /** Get time step of the active time-step level, dt*2**level.
+   *
+   * @returns Time step of active level (dt if no level is active).
+   */
+  PylithScalar _residualTimeStep(void) const;
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
@@ -214,6 +285,9 @@ protected :
   materials::ElasticMaterial* _material; ///< Material associated with integrator.
 
   topology::StratumIS* _materialIS; ///< Index set for material cells.
+
+  std::vector<std::vector<PetscInt> > _levelCells; ///< Material cells with vertices in each time-step level.
+  int _activeLevel; ///< Active time-step level (-1 for all cells).
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
@@ -47,6 +47,7 @@
 class pylith::friction::FrictionModel
 { // class FrictionModel
   friend class TestFrictionModel; // unit testing
+  friend class BenchFrictionModel; // benchmarks
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
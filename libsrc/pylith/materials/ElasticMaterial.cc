@@ -34,6 +34,7 @@
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <algorithm> // USES std::lower_bound()
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
@@ -49,6 +50,11 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
+  _dtStableImplicitMin(pylith::PYLITH_MAXSCALAR),
+  _dtStableExplicitMin(pylith::PYLITH_MAXSCALAR),
+  _dtStableTolerance(0.0),
+  _dtStableImplicitRescan(false),
+  _dtStableExplicitRescan(false),
   _numQuadPts(0),
   _numElasticConsts(numElasticConsts),
   _propertiesVisitor(0),
@@ -80,6 +86,10 @@ pylith::materials::ElasticMaterial::deallocate(void)
   delete _stressVisitor; _stressVisitor = 0;
   delete _strainVisitor; _strainVisitor = 0;
 
+  _dtStableImplicitCells.resize(0);
+  _dtStableExplicitCells.resize(0);
+  _minCellWidthCells.resize(0);
+
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
 
@@ -120,8 +130,12 @@ pylith::materials::ElasticMaterial::createPropsAndVarsVisitors(void)
   assert(_properties);
   assert(_stateVars);
 
-  delete _propertiesVisitor; _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
-  _propertiesVisitor->optimizeClosure();
+  // Properties stored in single precision are retrieved using the section.
+  delete _propertiesVisitor; _propertiesVisitor = 0;
+  if (!_singlePrecisionProps) {
+    _propertiesVisitor = new pylith::topology::VecVisitorMesh(*_properties);assert(_propertiesVisitor);
+    _propertiesVisitor->optimizeClosure();
+  } // if
   if (hasStateVars()) {
     delete _stateVarsVisitor; _stateVarsVisitor = new pylith::topology::VecVisitorMesh(*_stateVars);assert(_stateVarsVisitor);
     _stateVarsVisitor->optimizeClosure();
@@ -172,13 +186,22 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
   assert(_propertiesCell.size() == size_t(propertiesSize));
   assert(_stateVarsCell.size() == size_t(stateVarsSize));
 
-  assert(_propertiesVisitor);
-  PetscScalar* propertiesArray = _propertiesVisitor->localArray();
-  const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
-  assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
-  } // for
+  if (!_singlePrecisionProps) {
+    assert(_propertiesVisitor);
+    PetscScalar* propertiesArray = _propertiesVisitor->localArray();
+    const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
+    assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
+    for(PetscInt d = 0; d < propertiesSize; ++d) {
+      _propertiesCell[d] = propertiesArray[poff+d];
+    } // for
+  } else {
+    PetscInt poff = 0;
+    PetscErrorCode err = PetscSectionGetOffset(_properties->localSection(), cell, &poff);PYLITH_CHECK_ERROR(err);
+    assert(size_t(poff+propertiesSize) <= _propertiesSingle.size());
+    for(PetscInt d = 0; d < propertiesSize; ++d) {
+      _propertiesCell[d] = _propertiesSingle[poff+d];
+    } // for
+  } // if/else
 
   if (hasStateVars()) {
     assert(_stateVarsVisitor);
@@ -220,6 +243,30 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
   PYLITH_METHOD_END;
 } // retrievePropsAndVars
 
+// ----------------------------------------------------------------------
+// Get number of bytes read by retrievePropsAndVars() for a cell.
+size_t
+pylith::materials::ElasticMaterial::retrievedBytes(void) const
+{ // retrievedBytes
+  size_t bytes = _propertiesCell.size()*(_singlePrecisionProps ? sizeof(float) : sizeof(PetscScalar));
+  size_t numValues = 0;
+  if (hasStateVars()) {
+    numValues += _stateVarsCell.size();
+  } // if
+  if (_initialFields) {
+    if (_initialFields->hasField("initial stress")) {
+      numValues += _initialStressCell.size();
+    } // if
+    if (_initialFields->hasField("initial strain")) {
+      numValues += _initialStrainCell.size();
+    } // if
+  } // if
+
+  bytes += numValues*sizeof(PetscScalar);
+
+  return bytes;
+} // retrievedBytes
+
 // ----------------------------------------------------------------------
 // Compute stress tensor for cell at quadrature points.
 const pylith::scalar_array&
@@ -314,6 +361,35 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
     stateVarsArray[soff+d] = _stateVarsCell[d];
   } // for
 
+  // Update cached stable time steps using the properties and state
+  // variables that are already in the cell arrays.
+  const bool hasImplicit = _dtStableImplicitCells.size() > 0;
+  const bool hasExplicit = _dtStableExplicitCells.size() > 0;
+  if (hasImplicit || hasExplicit) {
+    const PetscInt iCell = _materialCellIndex(cell);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      if (hasImplicit) {
+	const PylithScalar dt =
+	  _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt);
+	_updateStableTimeStep(&_dtStableImplicitCells[iCell*numQuadPts+iQuad],
+			      &_dtStableImplicitMin, &_dtStableImplicitRescan, dt);
+      } // if
+      if (hasExplicit) {
+	const PylithScalar dt =
+	  _stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt,
+				  _minCellWidthCells[iCell]);
+	_updateStableTimeStep(&_dtStableExplicitCells[iCell*numQuadPts+iQuad],
+			      &_dtStableExplicitMin, &_dtStableExplicitRescan, dt);
+      } // if
+    } // for
+  } // if
+
   PYLITH_METHOD_END;
 } // updateStateVars
 
@@ -339,10 +415,33 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
   assert(_materialIS);
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
+
+  // Compute stable time step for all cells the first time. Afterwards
+  // the cached values are updated along with the state variables.
+  if (_dtStableImplicitCells.size() != size_t(numCells*numQuadPts)) {
+    _dtStableImplicitCells.resize(numCells*numQuadPts);
+    createPropsAndVarsVisitors();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+
+      retrievePropsAndVars(cell);
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+	_dtStableImplicitCells[c*numQuadPts+iQuad] =
+	  _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt);
+      } // for
+    } // for
+    destroyPropsAndVarsVisitors();
+    _dtStableImplicitRescan = true;
+  } // if
+  if (_dtStableImplicitRescan) {
+    _dtStableImplicitMin = (numCells > 0) ? _dtStableImplicitCells.min() : pylith::PYLITH_MAXSCALAR;
+    _dtStableImplicitRescan = false;
+  } // if
  
   // Setup field if necessary.
-  topology::VecVisitorMesh* fieldVisitor = NULL;
-  PetscScalar* fieldArray = NULL;
   if (field) {
     const int fiberDim = 1*numQuadPts;
     bool useCurrentField = false;
@@ -369,42 +468,19 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
     assert(_normalizer);
     field->scale(_normalizer->timeScale());
     field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
-    fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
-    fieldArray = fieldVisitor->localArray();
-  } // if
-  createPropsAndVarsVisitors();
-
-  PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    retrievePropsAndVars(cell);
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-        _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-                                numPropsQuadPt,
-                                &_stateVarsCell[iQuad*numVarsQuadPt],
-                                numVarsQuadPt);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
-      } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-	fieldArray[off+iQuad] = dtStableCell[iQuad];
+	fieldArray[off+iQuad] = _dtStableImplicitCells[c*numQuadPts+iQuad];
       } // for
-    } // if
-  } // for
-  destroyPropsAndVarsVisitors();
-  delete fieldVisitor; fieldVisitor = 0;
+    } // for
+  } // if
 
-  assert(dtStable > 0.0);
+  assert(_dtStableImplicitMin > 0.0);
 
-  PYLITH_METHOD_RETURN(dtStable);
+  PYLITH_METHOD_RETURN(_dtStableImplicitMin);
 } // stableTimeStepImplicit
 
 // ----------------------------------------------------------------------
@@ -413,7 +489,7 @@ PylithScalar
 pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh& mesh,
 							   feassemble::Quadrature* quadrature,
 							   topology::Field* field)
-{ // stableTimeStepImplicit
+{ // stableTimeStepExplicit
   PYLITH_METHOD_BEGIN;
 
   assert(quadrature);
@@ -433,9 +509,48 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
   const PetscInt* cells = _materialIS->points();
   const PetscInt numCells = _materialIS->size();
 
+  // Compute stable time step and minimum cell width for all cells the
+  // first time. Afterwards the cached values are updated along with
+  // the state variables.
+  if (_dtStableExplicitCells.size() != size_t(numCells*numQuadPts)) {
+    _dtStableExplicitCells.resize(numCells*numQuadPts);
+    _minCellWidthCells.resize(numCells);
+    createPropsAndVarsVisitors();
+
+    const int spaceDim = quadrature->spaceDim();
+    const int numBasis = quadrature->numBasis();
+
+    scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+
+      retrievePropsAndVars(cell);
+
+      coordsVisitor.getClosure(&coordsCell, cell);
+      const PylithScalar minCellWidth = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
+      assert(minCellWidth > 0.0);
+      _minCellWidthCells[c] = minCellWidth;
+
+      for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+	_dtStableExplicitCells[c*numQuadPts+iQuad] =
+	  _stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				  numPropsQuadPt,
+				  &_stateVarsCell[iQuad*numVarsQuadPt],
+				  numVarsQuadPt,
+				  minCellWidth);
+      } // for
+    } // for
+    destroyPropsAndVarsVisitors();
+    _dtStableExplicitRescan = true;
+  } // if
+  if (_dtStableExplicitRescan) {
+    _dtStableExplicitMin = (numCells > 0) ? _dtStableExplicitCells.min() : pylith::PYLITH_MAXSCALAR;
+    _dtStableExplicitRescan = false;
+  } // if
+
   // Setup field if necessary.
-  topology::VecVisitorMesh* fieldVisitor = NULL;
-  PetscScalar *fieldArray = NULL;
   if (field) {
     const int fiberDim = 1*numQuadPts;
     bool useCurrentField = false;
@@ -459,55 +574,20 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
     assert(_normalizer);
     field->scale(_normalizer->timeScale());
     field->vectorFieldType(topology::FieldBase::MULTI_SCALAR);
-    fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
-    fieldArray = fieldVisitor->localArray();
-  } // if
-  createPropsAndVarsVisitors();
-
-  const int spaceDim = quadrature->spaceDim();
-  const int numBasis = quadrature->numBasis();
-
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
-
-  PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    retrievePropsAndVars(cell);
-
-    coordsVisitor.getClosure(&coordsCell, cell);
-    const PylithScalar minCellWidth = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
-    assert(minCellWidth > 0.0);
-
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-	_stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-				numPropsQuadPt,
-				&_stateVarsCell[iQuad*numVarsQuadPt],
-				numVarsQuadPt,
-				minCellWidth);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
-      } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
-      assert(numQuadPts == fieldVisitor->sectionDof(cell));
+    topology::VecVisitorMesh fieldVisitor(*field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor.sectionOffset(cells[c]);
+      assert(numQuadPts == fieldVisitor.sectionDof(cells[c]));
       for (PetscInt d = 0; d < numQuadPts; ++d) {
-        fieldArray[off+d] = dtStableCell[d];
+        fieldArray[off+d] = _dtStableExplicitCells[c*numQuadPts+d];
       } // for
-    } // if
-  } // for
-  destroyPropsAndVarsVisitors();
-  delete fieldVisitor; fieldVisitor = 0;
+    } // for
+  } // if
 
-  assert(dtStable > 0.0);
+  assert(_dtStableExplicitMin > 0.0);
 
-  PYLITH_METHOD_RETURN(dtStable);
+  PYLITH_METHOD_RETURN(_dtStableExplicitMin);
 } // stableTimeStepExplicit
 
 // ----------------------------------------------------------------------
@@ -572,6 +652,46 @@ pylith::materials::ElasticMaterial::_stableTimeStepImplicitMax(const topology::M
   PYLITH_METHOD_RETURN(dtStable);
 } // _stableTimeStepImplicitMax
 
+// ----------------------------------------------------------------------
+// Get index of cell in cells associated with material.
+PetscInt
+pylith::materials::ElasticMaterial::_materialCellIndex(const PetscInt cell) const
+{ // _materialCellIndex
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  // Points in the stratum index set are sorted.
+  const PetscInt* iter = std::lower_bound(cells, cells+numCells, cell);
+  assert(iter != cells+numCells && *iter == cell);
+
+  return iter - cells;
+} // _materialCellIndex
+
+// ----------------------------------------------------------------------
+// Update cached stable time step at a quadrature point.
+void
+pylith::materials::ElasticMaterial::_updateStableTimeStep(PylithScalar* dtCached,
+							  PylithScalar* dtMin,
+							  bool* needRescan,
+							  const PylithScalar dt) const
+{ // _updateStableTimeStep
+  assert(dtCached);
+  assert(dtMin);
+  assert(needRescan);
+
+  const PylithScalar dtPrev = *dtCached;
+  if (dt < dtPrev || dt > dtPrev*(1.0+_dtStableTolerance)) {
+    *dtCached = dt;
+    if (dt < *dtMin) {
+      *dtMin = dt;
+    } else if (dtPrev <= *dtMin) {
+      // Value that was the minimum increased.
+      *needRescan = true;
+    } // if/else
+  } // if
+} // _updateStableTimeStep
+
 // ----------------------------------------------------------------------
 // Allocate cell arrays.
 void
@@ -35,6 +35,7 @@
 class pylith::materials::ElasticMaterial : public Material
 { // class ElasticMaterial
   friend class TestElasticMaterial; ///< unit testing
+  friend class BenchElasticMaterial; ///< benchmarks
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
@@ -93,6 +94,14 @@ public :
    */
   void retrievePropsAndVars(const int cell);
 
+  /** Get number of bytes read from the fields for physical properties,
+   * state variables, and initial stress/strain by
+   * retrievePropsAndVars() for a cell.
+   *
+   * @returns Number of bytes.
+   */
+  size_t retrievedBytes(void) const;
+
   /** Compute density for cell at quadrature points.
    *
    * @pre Must call retrievePropsAndVars for cell before calling
@@ -176,6 +185,17 @@ public :
    */
   bool hasStateVars(void) const;
 
+  /** Set relative tolerance for updating cached stable time steps.
+   *
+   * The stable time step at each quadrature point is computed once
+   * and then updated when the state variables are updated. A cached
+   * value is always updated when the stable time step decreases, but
+   * only updated when it increases by more than the tolerance.
+   *
+   * @param value Relative tolerance.
+   */
+  void stableTimeStepTolerance(const PylithScalar value);
+
   /** Get stable time step for implicit time integration.
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
@@ -457,6 +477,25 @@ private :
   void _initializeInitialStrain(const topology::Mesh& mesh,
 				feassemble::Quadrature* quadrature);
 
+  /** Get index of cell in cells associated with material.
+   *
+   * @param cell Finite-element cell.
+   * @returns Index of cell in material index set.
+   */
+  PetscInt _materialCellIndex(const PetscInt cell) const;
+
+  /** Update cached stable time step at a quadrature point.
+   *
+   * @param dtCached Cached stable time step.
+   * @param dtMin Minimum of cached stable time steps.
+   * @param needRescan Set to true if minimum must be recomputed.
+   * @param dt Current stable time step.
+   */
+  void _updateStableTimeStep(PylithScalar* dtCached,
+			     PylithScalar* dtMin,
+			     bool* needRescan,
+			     const PylithScalar dt) const;
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -518,6 +557,31 @@ private :
    */
   scalar_array _elasticConstsCell;
 
+  /** Cached stable time step for implicit time integration at
+   * quadrature points of material cells.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableImplicitCells;
+
+  /** Cached stable time step for explicit time integration at
+   * quadrature points of material cells.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableExplicitCells;
+
+  /// Minimum width of material cells (for explicit stable time step).
+  scalar_array _minCellWidthCells;
+
+  PylithScalar _dtStableImplicitMin; ///< Minimum of cached implicit stable time steps.
+  PylithScalar _dtStableExplicitMin; ///< Minimum of cached explicit stable time steps.
+  PylithScalar _dtStableTolerance; ///< Relative tolerance for updating cached stable time steps.
+  bool _dtStableImplicitRescan; ///< True if minimum of cached implicit values is out of date.
+  bool _dtStableExplicitRescan; ///< True if minimum of cached explicit values is out of date.
+
   int _numQuadPts; ///< Number of quadrature points
   const int _numElasticConsts; ///< Number of elastic constants.
 
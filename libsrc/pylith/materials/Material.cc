@@ -51,7 +51,10 @@ pylith::materials::Material::Material(const int dimension,
   _dimension(dimension),
   _tensorSize(tensorSize),
   _needNewJacobian(false),
+  _stiffnessChange(-1.0),
+  _stiffnessChangeStep(0.0),
   _isJacobianSymmetric(true),
+  _singlePrecisionProps(false),
   _dbProperties(0),
   _dbInitialState(0),
   _id(0),
@@ -87,6 +90,7 @@ pylith::materials::Material::deallocate(void)
   delete _materialIS; _materialIS = 0;
   delete _properties; _properties = 0;
   delete _stateVars; _stateVars = 0;
+  _propertiesSingle.resize(0);
 
   _dbProperties = 0; // :TODO: Use shared pointer.
   _dbInitialState = 0; // :TODO: Use shared pointer.
@@ -259,6 +263,21 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   } // for
   delete stateVarsVisitor; stateVarsVisitor = 0;
 
+  // Keep only the layout of the properties field if the properties
+  // are stored in single precision.
+  if (_singlePrecisionProps) {
+    PetscInt storageSize = 0;
+    PetscErrorCode err = PetscSectionGetStorageSize(propertiesVisitor.localSection(), &storageSize);PYLITH_CHECK_ERROR(err);
+    _propertiesSingle.resize(storageSize);
+    for (PetscInt i=0; i < storageSize; ++i) {
+      _propertiesSingle[i] = float(propertiesArray[i]);
+    } // for
+    propertiesVisitor.clear();
+    _properties->clear();
+  } else {
+    _propertiesSingle.resize(0);
+  } // if/else
+
   // Close databases
   _dbProperties->close();
   if (_dbInitialState)
@@ -347,14 +366,17 @@ pylith::materials::Material::getField(topology::Field *field,
     for (int i=0; i < propertyIndex; ++i)
       propOffset += _metadata.getProperty(i).fiberDim;
     const int fiberDim = _metadata.getProperty(propertyIndex).fiberDim;
-    topology::VecVisitorMesh propertiesVisitor(*_properties);
-    PetscScalar* propertiesArray = propertiesVisitor.localArray();
+    // Properties stored in single precision do not have a vector.
+    topology::VecVisitorMesh* propertiesVisitor = (!_singlePrecisionProps) ? new topology::VecVisitorMesh(*_properties) : 0;
+    const PetscScalar* propertiesArray = (propertiesVisitor) ? propertiesVisitor->localArray() : NULL;
+    PetscSection propertiesSection = _properties->localSection();assert(propertiesSection);
+    PetscErrorCode err;
 
     // Get properties section
     PetscInt totalPropsFiberDimLocal = 0;
     PetscInt totalPropsFiberDim = 0;
     if (numCells > 0) {
-      totalPropsFiberDimLocal = propertiesVisitor.sectionDof(cells[0]);
+      err = PetscSectionGetDof(propertiesSection, cells[0], &totalPropsFiberDimLocal);PYLITH_CHECK_ERROR(err);
     } // if
     MPI_Allreduce((void *) &totalPropsFiberDimLocal, (void *) &totalPropsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
     assert(totalPropsFiberDim > 0);
@@ -371,7 +393,7 @@ pylith::materials::Material::getField(topology::Field *field,
       PetscInt totalFiberDimCurrent = 0;
       if (numCells > 0) {
 	PetscSection fieldSection = field->localSection();
-	PetscErrorCode err = PetscSectionGetDof(fieldSection, cells[0], &totalFiberDimCurrentLocal);PYLITH_CHECK_ERROR(err);
+	err = PetscSectionGetDof(fieldSection, cells[0], &totalFiberDimCurrentLocal);PYLITH_CHECK_ERROR(err);
       } // if
       MPI_Allreduce((void *) &totalFiberDimCurrentLocal, (void *) &totalFiberDimCurrent, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
       assert(totalFiberDimCurrent > 0);
@@ -394,16 +416,23 @@ pylith::materials::Material::getField(topology::Field *field,
     for(PetscInt c = 0; c < numCells; ++c) {
       const PetscInt cell = cells[c];
 
-      const PetscInt poff = propertiesVisitor.sectionOffset(cell);
+      PetscInt poff = 0;
+      err = PetscSectionGetOffset(propertiesSection, cell, &poff);PYLITH_CHECK_ERROR(err);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-        for (int i=0; i < numPropsQuadPt; ++i)
-          propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+	if (propertiesArray) {
+	  for (int i=0; i < numPropsQuadPt; ++i)
+	    propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+	} else {
+	  for (int i=0; i < numPropsQuadPt; ++i)
+	    propertiesCell[i] = _propertiesSingle[iQuad*numPropsQuadPt + poff+i];
+	} // if/else
         _dimProperties(&propertiesCell[0], numPropsQuadPt);
         for (int i=0; i < fiberDim; ++i)
           fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
       } // for
     } // for
+    delete propertiesVisitor; propertiesVisitor = 0;
   } else { // field is a state variable
     assert(stateVarIndex >= 0);
     
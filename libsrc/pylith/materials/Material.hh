@@ -124,6 +124,31 @@ public :
    */
   void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
 
+  /** Set whether physical properties are stored in single precision.
+   *
+   * Properties are converted to double precision when they are
+   * retrieved for a cell. State variables are always stored in double
+   * precision.
+   *
+   * @pre Must be called before initialize().
+   *
+   * @param flag True to store properties in single precision.
+   */
+  void singlePrecisionProperties(const bool flag);
+
+  /** Check whether physical properties are stored in single precision.
+   *
+   * @returns True if properties are stored in single precision.
+   */
+  bool singlePrecisionProperties(void) const;
+
+  /** Get memory used to store physical properties in single
+   * precision. The properties field holds only the layout in this case.
+   *
+   * @returns Number of bytes (0 if properties are in double precision).
+   */
+  size_t propertiesSingleBytes(void) const;
+
   /** Set scales used to nondimensionalize physical properties.
    *
    * @param dim Nondimensionalizer
@@ -166,6 +191,14 @@ public :
   /// current state.
   void resetNeedNewJacobian(void);
 
+  /** Get estimate of the relative change in the tangent stiffness of
+   * the material since the Jacobian was last formed.
+   *
+   * @returns Maximum relative change over quadrature points, or a
+   * negative value if the material does not provide an estimate.
+   */
+  PylithScalar stiffnessChange(void) const;
+
   /** Set whether elastic or inelastic constitutive relations are used.
    *
    * @param flag True to use elastic, false to use inelastic.
@@ -198,7 +231,9 @@ public :
   void getField(topology::Field *field,
 		const char* name) const;
 
-  /** Get the field with all properties.
+  /** Get the field with all properties. If the properties are stored
+   * in single precision, the field only holds the layout of the
+   * properties.
    *
    * @returns Properties field.
    */
@@ -213,6 +248,18 @@ public :
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Record estimate of the relative change in stiffness at a point
+   * for the current update of the state variables.
+   *
+   * @param change Relative change in stiffness.
+   */
+  void _recordStiffnessChange(const PylithScalar change);
+
+  /** Add the largest change recorded for the last update of the state
+   * variables to the change since the Jacobian was last formed.
+   */
+  void _accumulateStiffnessChange(void);
+
   /// These methods should be implemented by every constitutive model.
 
   /** Compute properties from values in spatial database.
@@ -280,6 +327,9 @@ protected :
   /// Field containing the state variables for the material.
   topology::Field *_stateVars;
 
+  /// Physical properties in single precision (uses layout of _properties).
+  float_array _propertiesSingle;
+
   spatialdata::units::Nondimensional* _normalizer; ///< Nondimensionalizer
   
   topology::StratumIS* _materialIS; ///< Index set for material cells.
@@ -289,7 +339,10 @@ protected :
   const int _dimension; ///< Spatial dimension associated with material.
   const int _tensorSize; ///< Tensor size for material.
   bool _needNewJacobian; ///< True if need to reform Jacobian, false otherwise.
+  PylithScalar _stiffnessChange; ///< Relative change in stiffness since Jacobian was formed (negative if unknown).
+  PylithScalar _stiffnessChangeStep; ///< Largest relative change in stiffness in last update of state variables.
   bool _isJacobianSymmetric; ///< True if Jacobian is symmetric;
+  bool _singlePrecisionProps; ///< True if properties are stored in single precision.
 
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
@@ -169,6 +169,7 @@ pylith::materials::PowerLaw3D::PowerLaw3D(void) :
   _updateStateVarsFn(0)
 { // constructor
   useElasticBehavior(false);
+  _stiffnessChange = 0.0;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -1195,6 +1196,10 @@ pylith::materials::PowerLaw3D::_updateStateVarsElastic(
   } // for
 
   _needNewJacobian = true;
+
+  // Switching from the elastic to the viscoelastic tangent changes the
+  // stiffness completely.
+  _recordStiffnessChange(1.0);
 } // _updateStateVarsElastic
 
 // ----------------------------------------------------------------------
@@ -1369,6 +1374,14 @@ pylith::materials::PowerLaw3D::_updateStateVarsViscoelastic(
   } // for
 
   _needNewJacobian = true;
+
+  // Tangent stiffness scales with the effective stress to the power
+  // (n-1), so estimate its relative change from the change in
+  // effective stress.
+  const PylithScalar stiffnessChange = (effStressT > 0.0) ?
+    (powerLawExp - 1.0) * fabs(effStressTpdt - effStressT) / effStressT :
+    ((effStressTpdt > 0.0) ? 1.0 : 0.0);
+  _recordStiffnessChange(stiffnessChange);
   PetscLogFlops(14 + _tensorSize * 15);
 
 } // _updateStateVarsViscoelastic
@@ -171,6 +171,7 @@ pylith::materials::PowerLawPlaneStrain::PowerLawPlaneStrain(void) :
   _updateStateVarsFn(0)
 { // constructor
   useElasticBehavior(false);
+  _stiffnessChange = 0.0;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -1110,6 +1111,10 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsElastic(
   stateVars[s_stress4 + 3] = stress[2];
 
   _needNewJacobian = true;
+
+  // Switching from the elastic to the viscoelastic tangent changes the
+  // stiffness completely.
+  _recordStiffnessChange(1.0);
 } // _updateStateVarsElastic
 
 // ----------------------------------------------------------------------
@@ -1276,6 +1281,14 @@ pylith::materials::PowerLawPlaneStrain::_updateStateVarsViscoelastic(
   } // for
 
   _needNewJacobian = true;
+
+  // Tangent stiffness scales with the effective stress to the power
+  // (n-1), so estimate its relative change from the change in
+  // effective stress.
+  const PylithScalar stiffnessChange = (effStressT > 0.0) ?
+    (powerLawExp - 1.0) * fabs(effStressTpdt - effStressT) / effStressT :
+    ((effStressTpdt > 0.0) ? 1.0 : 0.0);
+  _recordStiffnessChange(stiffnessChange);
   PetscLogFlops(14 + tensorSizePS * 15);
 
 } // _updateStateVarsViscoelastic
@@ -242,6 +242,15 @@ pylith::meshio::DataWriterVTK::closeTimeStep(void)
   // Destroy the viewer (which also writes the file).
   err = PetscViewerDestroy(&_viewer);PYLITH_CHECK_ERROR(err);
 
+  // Viewer no longer holds the cached fields, so free them until the
+  // next time step.
+  if (_vertexFieldCache) {
+    _vertexFieldCache->deallocate();
+  } // if
+  if (_cellFieldCache) {
+    _cellFieldCache->deallocate();
+  } // if
+
   // Remove label
   if (_isOpenTimeStep) {
     assert(_dm);
@@ -38,7 +38,8 @@
 pylith::meshio::MeshIO::MeshIO(void) :
   _mesh(0),
   _debug(false),
-  _interpolate(false)
+  _interpolate(false),
+  _checkTopology(topology::MeshOps::CHECK_FULL)
 { // constructor
 } // constructor
 
@@ -79,7 +80,7 @@ pylith::meshio::MeshIO::read(topology::Mesh* mesh)
   _read();
 
   // Check mesh consistency
-  topology::MeshOps::checkTopology(*_mesh);
+  topology::MeshOps::checkTopology(*_mesh, _checkTopology);
   // Respond to PETSc diagnostic output
   PetscErrorCode err = DMViewFromOptions(_mesh->dmMesh(), NULL, "-pylith_dm_view");PYLITH_CHECK_ERROR(err);
 
@@ -29,6 +29,7 @@
 #include "meshiofwd.hh" // forward declarations
 
 #include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "pylith/topology/MeshOps.hh" // USES MeshOps::TopologyCheckEnum
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 #include "pylith/utils/arrayfwd.hh" // USES scalar_array, int_array, string_vector
 
@@ -85,6 +86,21 @@ public :
    */
   bool interpolate(void) const;
 
+  /** Set level of topology verification after reading mesh.
+   *
+   * Use CHECK_SAMPLED or CHECK_OFF when the mesh will be checked
+   * after it is distributed.
+   *
+   * @param level Level of topology verification.
+   */
+  void checkTopology(const topology::MeshOps::TopologyCheckEnum level);
+
+  /** Get level of topology verification after reading mesh.
+   *
+   * @returns Level of topology verification.
+   */
+  topology::MeshOps::TopologyCheckEnum checkTopology(void) const;
+
   /** Read mesh from file.
    *
    * @param mesh PyLith finite-element mesh.
@@ -199,6 +215,7 @@ protected :
 
   bool _debug; ///< True to turn of mesh debugging output.
   bool _interpolate; ///< True if building intermediate topology elements.
+  topology::MeshOps::TopologyCheckEnum _checkTopology; ///< Level of topology verification.
 
 }; // MeshIO
 
@@ -183,6 +183,12 @@ pylith::meshio::OutputManager::closeTimeStep(void)
   assert(_writer);
   _writer->closeTimeStep();
 
+  // Free buffers between time steps. They are recreated with the
+  // layout of the fields written at the next time step.
+  if (_fields) {
+    _fields->deallocate();
+  } // if
+
   PYLITH_METHOD_END;
 } // closeTimeStep
 
@@ -20,15 +20,28 @@
 
 #include "Explicit.hh" // implementation of class methods
 
+#include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::min(), std::max()
+#include <cmath> // USES floor(), log()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 // ----------------------------------------------------------------------
 // Constructor
-pylith::problems::Explicit::Explicit(void)
+pylith::problems::Explicit::Explicit(void) :
+  _numLevels(0),
+  _activeLevel(-1)
 { // constructor
 } // constructor
 
@@ -38,6 +51,132 @@ pylith::problems::Explicit::~Explicit(void)
 { // destructor
 } // destructor
 
+// ----------------------------------------------------------------------
+// Solve the system with a lumped Jacobian and update the rate fields.
+void
+pylith::problems::Explicit::solveLumped(topology::Field* solution,
+					const topology::Field& jacobian,
+					const topology::Field& residual)
+{ // solveLumped
+  PYLITH_METHOD_BEGIN;
+
+  assert(solution);
+  assert(_fields);
+
+  // dispIncr(t+dt) = residual / jacobian
+  //
+  // The rate fields are updated in the same pass (see calcRateFields()),
+  // so the displacement increment is only read once.
+  //
+  // The lumped Jacobian is formed with the level 0 time step, so with
+  // local time stepping the increment is scaled by (dtLevel/dt)**2.
+  // Only vertices in the active level are updated.
+
+  scalar_array dtLevels;
+  _levelTimeSteps(&dtLevels);
+  const PylithScalar dt = _dt;
+
+  const spatialdata::geocoords::CoordSys* cs = solution->mesh().coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  // All of the fields have the layout of the solution field, so we
+  // operate on the local arrays directly. With local time stepping,
+  // the offset of each vertex in the active level is looked up once.
+  topology::VecVisitorMesh solutionVisitor(*solution);
+  PetscScalar* solutionArray = solutionVisitor.localArray();
+
+  topology::VecVisitorMesh jacobianVisitor(jacobian);
+  const PetscScalar* jacobianArray = jacobianVisitor.localArray();
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();
+
+  topology::Field& dispT = _fields->get("disp(t)");
+  topology::VecVisitorMesh dispTVisitor(dispT);
+  const PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  topology::Field& dispTmdt = _fields->get("disp(t-dt)");
+  topology::VecVisitorMesh dispTmdtVisitor(dispTmdt);
+  const PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
+
+  topology::Field& velocity = _fields->get("velocity(t)");
+  topology::VecVisitorMesh velVisitor(velocity);
+  PetscScalar* velArray = velVisitor.localArray();
+
+  topology::Field& acceleration = _fields->get("acceleration(t)");
+  topology::VecVisitorMesh accVisitor(acceleration);
+  PetscScalar* accArray = accVisitor.localArray();
+
+  PetscErrorCode err;
+  PetscInt numValues = 0;
+  err = VecGetLocalSize(solutionVisitor.localVec(), &numValues);PYLITH_CHECK_ERROR(err);
+  const PetscVec vectors[6] = {
+    jacobianVisitor.localVec(),
+    residualVisitor.localVec(),
+    dispTVisitor.localVec(),
+    dispTmdtVisitor.localVec(),
+    velVisitor.localVec(),
+    accVisitor.localVec(),
+  };
+  for (int iVec=0; iVec < 6; ++iVec) {
+    PetscInt size = 0;
+    err = VecGetLocalSize(vectors[iVec], &size);PYLITH_CHECK_ERROR(err);
+    if (size != numValues) {
+      throw std::logic_error("Fields in explicit time stepping must have the layout of the solution field.");
+    } // if
+  } // for
+
+  PetscInt numUpdated = 0;
+  const bool useLevels = _activeLevel >= 0;
+  if (!useLevels) {
+    const PylithScalar dtV = dtLevels[0];
+    const PylithScalar dt2 = dtV*dtV;
+    const PylithScalar twodt = 2.0*dtV;
+    const PylithScalar scale = (dtV / dt) * (dtV / dt);
+
+    for (PetscInt i=0; i < numValues; ++i) {
+      assert(jacobianArray[i] != 0.0);
+      const PylithScalar dispIncrValue = scale * residualArray[i] / jacobianArray[i];
+      solutionArray[i] = dispIncrValue;
+      velArray[i] = (dispIncrValue + dispTArray[i] - dispTmdtArray[i]) / twodt;
+      accArray[i] = (dispIncrValue - dispTArray[i] + dispTmdtArray[i]) / dt2;
+    } // for
+    numUpdated = numValues / spaceDim;
+  } else {
+    // Get mesh vertices.
+    PetscDM dmMesh = solution->mesh().dmMesh();assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    assert(_vertexLevels.size() == size_t(vEnd - vStart));
+
+    const PylithScalar dtV = dtLevels[_activeLevel];
+    const PylithScalar dt2 = dtV*dtV;
+    const PylithScalar twodt = 2.0*dtV;
+    const PylithScalar scale = (dtV / dt) * (dtV / dt);
+
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      if (_vertexLevels[v-vStart] != _activeLevel) {
+	continue;
+      } // if
+      const PetscInt off = solutionVisitor.sectionOffset(v);
+      assert(spaceDim == solutionVisitor.sectionDof(v));
+      for (PetscInt i = off; i < off+spaceDim; ++i) {
+	assert(jacobianArray[i] != 0.0);
+	const PylithScalar dispIncrValue = scale * residualArray[i] / jacobianArray[i];
+	solutionArray[i] = dispIncrValue;
+	velArray[i] = (dispIncrValue + dispTArray[i] - dispTmdtArray[i]) / twodt;
+	accArray[i] = (dispIncrValue - dispTArray[i] + dispTmdtArray[i]) / dt2;
+      } // for
+      ++numUpdated;
+    } // for
+  } // if/else
+
+  PetscLogFlops(numUpdated * 8*spaceDim);
+
+  PYLITH_METHOD_END;
+} // solveLumped
+
 // ----------------------------------------------------------------------
 // Compute velocity and acceleration at time t.
 void
@@ -52,10 +191,16 @@ pylith::problems::Explicit::calcRateFields(void)
   //
   // acc(t) = (disp(t+dt) - 2*disp(t) + disp(t-dt)) / (dt*dt)
   //        = (dispIncr(t+dt) - disp(t) + disp(t-dt)) / (dt*dt)
+  //
+  // With local time stepping, dt is the time step of the vertex's
+  // level. While a level is being advanced, only vertices in that level
+  // and finer levels are updated. Their displacement increments were
+  // reset when the substep began. Vertices in coarser levels either
+  // were updated when their level was solved or keep their velocity
+  // when they are interpolated (see beginLevelStep()).
 
-  const PylithScalar dt = _dt;
-  const PylithScalar dt2 = dt*dt;
-  const PylithScalar twodt = 2.0*dt;
+  scalar_array dtLevels;
+  _levelTimeSteps(&dtLevels);
 
   topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
   const spatialdata::geocoords::CoordSys* cs = dispIncr.mesh().coordsys();assert(cs);
@@ -87,7 +232,19 @@ pylith::problems::Explicit::calcRateFields(void)
   const PetscInt vStart = verticesStratum.begin();
   const PetscInt vEnd = verticesStratum.end();
 
+  const bool useLevels = _numLevels > 0;
+  assert(!useLevels || _vertexLevels.size() == size_t(vEnd - vStart));
+
+  PetscInt numUpdated = 0;
   for(PetscInt v = vStart; v < vEnd; ++v) {
+    const int vLevel = useLevels ? _vertexLevels[v-vStart] : 0;
+    if (_activeLevel >= 0 && vLevel > _activeLevel) {
+      continue;
+    } // if
+    const PylithScalar dt = dtLevels[vLevel];
+    const PylithScalar dt2 = dt*dt;
+    const PylithScalar twodt = 2.0*dt;
+
     const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
     assert(spaceDim == dispIncrVisitor.sectionDof(v));
 
@@ -109,12 +266,507 @@ pylith::problems::Explicit::calcRateFields(void)
       velArray[voff+i] = (dispIncrArray[dioff+i] + dispTArray[dtoff+i] - dispTmdtArray[dmoff+i]) / twodt;
       accArray[aoff+i] = (dispIncrArray[dioff+i] - dispTArray[dtoff+i] + dispTmdtArray[dmoff+i]) / dt2;
     } // for
+    ++numUpdated;
   } // for
 
-  PetscLogFlops((vEnd - vStart) * 6*spaceDim);
+  PetscLogFlops(numUpdated * 6*spaceDim);
 
   PYLITH_METHOD_END;
 } // calcRateFields
 
+// ----------------------------------------------------------------------
+// Update rate fields for an adjustment to the displacement increment.
+void
+pylith::problems::Explicit::adjustRateFields(const topology::Field& adjust)
+{ // adjustRateFields
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  // The rate fields are linear in the displacement increment, so only
+  // the contribution of the adjustment needs to be added:
+  //
+  // vel(t) += adjust / (2*dt)
+  // acc(t) += adjust / (dt*dt)
+
+  scalar_array dtLevels;
+  _levelTimeSteps(&dtLevels);
+
+  const spatialdata::geocoords::CoordSys* cs = adjust.mesh().coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  // Get sections.
+  topology::VecVisitorMesh adjustVisitor(adjust);
+  const PetscScalar* adjustArray = adjustVisitor.localArray();
+
+  topology::Field& velocity = _fields->get("velocity(t)");
+  topology::VecVisitorMesh velVisitor(velocity);
+  PetscScalar* velArray = velVisitor.localArray();
+
+  topology::Field& acceleration = _fields->get("acceleration(t)");
+  topology::VecVisitorMesh accVisitor(acceleration);
+  PetscScalar* accArray = accVisitor.localArray();
+
+  // Get mesh vertices.
+  PetscDM dmMesh = adjust.mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  const bool useLevels = _numLevels > 0;
+  assert(!useLevels || _vertexLevels.size() == size_t(vEnd - vStart));
+
+  PetscInt numAdjusted = 0;
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt adjoff = adjustVisitor.sectionOffset(v);
+    assert(spaceDim == adjustVisitor.sectionDof(v));
+
+    bool isAdjusted = false;
+    for (PetscInt i = 0; i < spaceDim; ++i) {
+      if (adjustArray[adjoff+i] != 0.0) {
+	isAdjusted = true;
+	break;
+      } // if
+    } // for
+    if (!isAdjusted) {
+      continue;
+    } // if
+
+    const PylithScalar dt = dtLevels[useLevels ? _vertexLevels[v-vStart] : 0];
+    const PylithScalar dt2 = dt*dt;
+    const PylithScalar twodt = 2.0*dt;
+
+    const PetscInt voff = velVisitor.sectionOffset(v);
+    assert(spaceDim == velVisitor.sectionDof(v));
+
+    const PetscInt aoff = accVisitor.sectionOffset(v);
+    assert(spaceDim == accVisitor.sectionDof(v));
+
+    for (PetscInt i = 0; i < spaceDim; ++i) {
+      velArray[voff+i] += adjustArray[adjoff+i] / twodt;
+      accArray[aoff+i] += adjustArray[adjoff+i] / dt2;
+    } // for
+    ++numAdjusted;
+  } // for
+
+  PetscLogFlops(numAdjusted * 4*spaceDim);
+
+  PYLITH_METHOD_END;
+} // adjustRateFields
+
+// ----------------------------------------------------------------------
+// Adjust solution from solver with lumped Jacobian to match Lagrange
+// multiplier constraints.
+void
+pylith::problems::Explicit::adjustSolnLumped(void)
+{ // adjustSolnLumped
+  PYLITH_METHOD_BEGIN;
+
+  // Vertices of cohesive cells are always in level 0.
+  if (_activeLevel <= 0) {
+    Formulation::adjustSolnLumped();
+  } // if
+
+  PYLITH_METHOD_END;
+} // adjustSolnLumped
+
+// ----------------------------------------------------------------------
+// Advance displacement fields from time t to time t+dt.
+void
+pylith::problems::Explicit::rotateDisplacement(const int level)
+{ // rotateDisplacement
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  topology::Field& dispT = _fields->get("disp(t)");
+  topology::Field& dispTmdt = _fields->get("disp(t-dt)");
+
+  if (level < 0) {
+    // disp(t-dt) <- disp(t) without copying; disp(t) now holds the
+    // stale values of disp(t-dt), which are overwritten below.
+    dispTmdt.swapValues(dispT);
+
+    // disp(t) <- disp(t-dt) + dispIncr, dispIncr <- 0
+    PetscVec dispIncrVec = dispIncr.localVector();assert(dispIncrVec);
+    PetscVec dispTVec = dispT.localVector();assert(dispTVec);
+    PetscVec dispTmdtVec = dispTmdt.localVector();assert(dispTmdtVec);
+
+    PetscInt size = 0;
+    PetscErrorCode err = VecGetLocalSize(dispIncrVec, &size);PYLITH_CHECK_ERROR(err);
+#if !defined(NDEBUG)
+    PetscInt dispTSize = 0;
+    err = VecGetLocalSize(dispTVec, &dispTSize);PYLITH_CHECK_ERROR(err);
+    assert(size == dispTSize);
+#endif
+
+    PetscScalar* dispIncrArray = NULL;
+    PetscScalar* dispTArray = NULL;
+    const PetscScalar* dispTmdtArray = NULL;
+    err = VecGetArray(dispIncrVec, &dispIncrArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArray(dispTVec, &dispTArray);PYLITH_CHECK_ERROR(err);
+    err = VecGetArrayRead(dispTmdtVec, &dispTmdtArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < size; ++i) {
+      dispTArray[i] = dispTmdtArray[i] + dispIncrArray[i];
+      dispIncrArray[i] = 0.0;
+    } // for
+    err = VecRestoreArrayRead(dispTmdtVec, &dispTmdtArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArray(dispTVec, &dispTArray);PYLITH_CHECK_ERROR(err);
+    err = VecRestoreArray(dispIncrVec, &dispIncrArray);PYLITH_CHECK_ERROR(err);
+
+    PetscLogFlops(size);
+  } else {
+    // Update only vertices in level.
+    assert(level < _numLevels);
+
+    topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+    PetscScalar* dispIncrArray = dispIncrVisitor.localArray();
+
+    topology::VecVisitorMesh dispTVisitor(dispT);
+    PetscScalar* dispTArray = dispTVisitor.localArray();
+
+    topology::VecVisitorMesh dispTmdtVisitor(dispTmdt);
+    PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
+
+    PetscDM dmMesh = dispIncr.mesh().dmMesh();assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    assert(_vertexLevels.size() == size_t(vEnd - vStart));
+
+    PetscInt numUpdated = 0;
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      if (_vertexLevels[v-vStart] != level) {
+	continue;
+      } // if
+      const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
+      const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+      const PetscInt dmoff = dispTmdtVisitor.sectionOffset(v);
+      const PetscInt dof = dispIncrVisitor.sectionDof(v);
+      assert(dof == dispTVisitor.sectionDof(v));
+      assert(dof == dispTmdtVisitor.sectionDof(v));
+      for (PetscInt i = 0; i < dof; ++i) {
+	dispTmdtArray[dmoff+i] = dispTArray[dtoff+i];
+	dispTArray[dtoff+i] += dispIncrArray[dioff+i];
+	dispIncrArray[dioff+i] = 0.0;
+      } // for
+      numUpdated += dof;
+    } // for
+
+    PetscLogFlops(numUpdated);
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // rotateDisplacement
+
+// ----------------------------------------------------------------------
+// Setup time-step levels for local time stepping.
+int
+pylith::problems::Explicit::setupTimeStepLevels(topology::SolutionFields* fields,
+						const PylithScalar dt,
+						const int maxLevels)
+{ // setupTimeStepLevels
+  PYLITH_METHOD_BEGIN;
+
+  assert(fields);
+  assert(dt > 0.0);
+
+  if (maxLevels < 1) {
+    std::ostringstream msg;
+    msg << "Maximum number of time-step levels (" << maxLevels << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const topology::Mesh& mesh = fields->mesh();
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  PetscErrorCode err = 0;
+  PetscInt cMax = -1;
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax < 0) {
+    cMax = cEnd;
+  } // if
+
+  // Stable time step of each cell.
+  scalar_array dtCells(pylith::PYLITH_MAXSCALAR, cEnd-cStart);
+  const size_t numIntegrators = _integrators.size();
+  for (size_t i = 0; i < numIntegrators; ++i) {
+    _integrators[i]->stableTimeStepCells(&dtCells, mesh);
+  } // for
+
+  // Vertices take the smallest level of the cells containing them.
+  // Cohesive cells are in level 0 so the fault is advanced with the
+  // smallest time step.
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  assert(0 == pStart);
+  int_array pointLevels(maxLevels-1, pEnd);
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    int level = 0;
+    if (c < cMax) {
+      const PylithScalar dtCell = dtCells[c-cStart];
+      if (dtCell >= pylith::PYLITH_MAXSCALAR) {
+	level = maxLevels-1;
+      } else {
+	level = std::max(0, std::min(maxLevels-1, int(floor(log(dtCell/dt) / log(2.0)))));
+      } // if/else
+    } // if
+    PetscInt closureSize = 0;
+    PetscInt* closure = NULL;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < closureSize*2; i += 2) {
+      const PetscInt point = closure[i];
+      if (point >= vStart && point < vEnd && level < pointLevels[point]) {
+	pointLevels[point] = level;
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Vertices with constrained DOF are in level 0 so the constraints
+  // are applied with the smallest time step.
+  PetscSection solnSection = fields->solution().localSection();assert(solnSection);
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    PetscInt cdof = 0;
+    err = PetscSectionGetConstraintDof(solnSection, v, &cdof);PYLITH_CHECK_ERROR(err);
+    if (cdof > 0) {
+      pointLevels[v] = 0;
+    } // if
+  } // for
+
+  // Integrators with contributions to the lumped Jacobian that do not
+  // scale with 1/dt**2 (e.g., absorbing dampers) keep their vertices
+  // in level 0.
+  for (size_t i = 0; i < numIntegrators; ++i) {
+    _integrators[i]->restrictTimeStepLevels(&pointLevels, mesh);
+  } // for
+
+  // Make levels of shared vertices consistent across processes.
+  PetscSF sf = NULL;
+  err = DMGetPointSF(dmMesh, &sf);PYLITH_CHECK_ERROR(err);
+  int_array rootLevels(pointLevels);
+  err = PetscSFReduceBegin(sf, MPIU_INT, &pointLevels[0], &rootLevels[0], MPI_MIN);PYLITH_CHECK_ERROR(err);
+  err = PetscSFReduceEnd(sf, MPIU_INT, &pointLevels[0], &rootLevels[0], MPI_MIN);PYLITH_CHECK_ERROR(err);
+  pointLevels = rootLevels;
+  err = PetscSFBcastBegin(sf, MPIU_INT, &rootLevels[0], &pointLevels[0]);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBcastEnd(sf, MPIU_INT, &rootLevels[0], &pointLevels[0]);PYLITH_CHECK_ERROR(err);
+
+  // Ghost vertices are not counted in the level sizes.
+  std::vector<bool> isGhost(pEnd, false);
+  PetscInt numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i = 0; i < numLeaves; ++i) {
+    isGhost[leaves ? leaves[i] : i] = true;
+  } // for
+
+  _vertexLevels.resize(vEnd-vStart);
+  int maxLevelLocal = 0;
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    _vertexLevels[v-vStart] = pointLevels[v];
+    maxLevelLocal = std::max(maxLevelLocal, int(pointLevels[v]));
+  } // for
+  int maxLevel = 0;
+  err = MPI_Allreduce(&maxLevelLocal, &maxLevel, 1, MPI_INT, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+  _numLevels = maxLevel + 1;
+
+  _levelNumVertices.resize(_numLevels);
+  _levelNumVertices = 0;
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    if (!isGhost[v]) {
+      ++_levelNumVertices[_vertexLevels[v-vStart]];
+    } // if
+  } // for
+
+  for (size_t i = 0; i < numIntegrators; ++i) {
+    _integrators[i]->timeStepLevels(_vertexLevels, mesh);
+  } // for
+
+  PYLITH_METHOD_RETURN(_numLevels);
+} // setupTimeStepLevels
+
+// ----------------------------------------------------------------------
+// Get number of time-step levels.
+int
+pylith::problems::Explicit::numTimeStepLevels(void) const
+{ // numTimeStepLevels
+  return _numLevels;
+} // numTimeStepLevels
+
+// ----------------------------------------------------------------------
+// Get number of local vertices in a time-step level.
+int
+pylith::problems::Explicit::numVerticesInLevel(const int level) const
+{ // numVerticesInLevel
+  return (level >= 0 && level < _numLevels) ? _levelNumVertices[level] : 0;
+} // numVerticesInLevel
+
+// ----------------------------------------------------------------------
+// Prepare for advancing vertices in a time-step level.
+void
+pylith::problems::Explicit::beginLevelStep(const int level,
+					   const int substep)
+{ // beginLevelStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+  assert(level >= 0 && level < _numLevels);
+  assert(substep >= 0);
+
+  _activeLevel = level;
+  const size_t numIntegrators = _integrators.size();
+  for (size_t i = 0; i < numIntegrators; ++i) {
+    _integrators[i]->activeTimeStepLevel(level);
+  } // for
+
+  // Vertices in coarser levels started their time step at substep
+  // s0 = substep - substep % 2**level. Interpolate their displacement
+  // to the current time,
+  //
+  // disp(t) <- disp(t) + theta*dispIncr, dispIncr <- (1-theta)*dispIncr,
+  //
+  // with theta = (substep - s0) / 2**level. This leaves the velocity
+  // unchanged.
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+  PetscScalar* dispIncrArray = dispIncrVisitor.localArray();
+
+  topology::Field& dispT = _fields->get("disp(t)");
+  topology::VecVisitorMesh dispTVisitor(dispT);
+  PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  PetscDM dmMesh = dispIncr.mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  assert(_vertexLevels.size() == size_t(vEnd - vStart));
+
+  _shiftVertices.clear();
+  _shiftDispT.clear();
+  _shiftDispIncr.clear();
+  for (PetscInt v = vStart; v < vEnd; ++v) {
+    const int vLevel = _vertexLevels[v-vStart];
+    if (vLevel <= level) {
+      continue;
+    } // if
+    const int numSubsteps = 1 << vLevel;
+    const int offset = substep % numSubsteps;
+    if (!offset) {
+      continue;
+    } // if
+    const PylithScalar theta = PylithScalar(offset) / PylithScalar(numSubsteps);
+
+    const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
+    const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+    const PetscInt dof = dispIncrVisitor.sectionDof(v);
+    assert(dof == dispTVisitor.sectionDof(v));
+    _shiftVertices.push_back(v);
+    for (PetscInt i = 0; i < dof; ++i) {
+      _shiftDispT.push_back(dispTArray[dtoff+i]);
+      _shiftDispIncr.push_back(dispIncrArray[dioff+i]);
+      const PylithScalar shift = theta * dispIncrArray[dioff+i];
+      dispTArray[dtoff+i] += shift;
+      dispIncrArray[dioff+i] -= shift;
+    } // for
+  } // for
+  PetscLogFlops(_shiftDispT.size() * 3);
+
+  PYLITH_METHOD_END;
+} // beginLevelStep
+
+// ----------------------------------------------------------------------
+// Restore displacements and integrators after advancing a time-step level.
+void
+pylith::problems::Explicit::endLevelStep(void)
+{ // endLevelStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  scalar_array dtLevels;
+  _levelTimeSteps(&dtLevels);
+
+  // Restore the interpolated vertices and their rate fields.
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+  PetscScalar* dispIncrArray = dispIncrVisitor.localArray();
+
+  topology::Field& dispT = _fields->get("disp(t)");
+  topology::VecVisitorMesh dispTVisitor(dispT);
+  PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  topology::Field& dispTmdt = _fields->get("disp(t-dt)");
+  topology::VecVisitorMesh dispTmdtVisitor(dispTmdt);
+  const PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
+
+  topology::Field& velocity = _fields->get("velocity(t)");
+  topology::VecVisitorMesh velVisitor(velocity);
+  PetscScalar* velArray = velVisitor.localArray();
+
+  topology::Field& acceleration = _fields->get("acceleration(t)");
+  topology::VecVisitorMesh accVisitor(acceleration);
+  PetscScalar* accArray = accVisitor.localArray();
+
+  PetscDM dmMesh = dispIncr.mesh().dmMesh();assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+
+  const size_t numShifted = _shiftVertices.size();
+  for (size_t iV = 0, index = 0; iV < numShifted; ++iV) {
+    const PetscInt v = _shiftVertices[iV];
+    const PylithScalar dt = dtLevels[_vertexLevels[v-vStart]];
+    const PylithScalar dt2 = dt*dt;
+    const PylithScalar twodt = 2.0*dt;
+
+    const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
+    const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+    const PetscInt dmoff = dispTmdtVisitor.sectionOffset(v);
+    const PetscInt voff = velVisitor.sectionOffset(v);
+    const PetscInt aoff = accVisitor.sectionOffset(v);
+    const PetscInt dof = dispIncrVisitor.sectionDof(v);
+    for (PetscInt i = 0; i < dof; ++i, ++index) {
+      assert(index < _shiftDispT.size());
+      dispTArray[dtoff+i] = _shiftDispT[index];
+      dispIncrArray[dioff+i] = _shiftDispIncr[index];
+      velArray[voff+i] = (dispIncrArray[dioff+i] + dispTArray[dtoff+i] - dispTmdtArray[dmoff+i]) / twodt;
+      accArray[aoff+i] = (dispIncrArray[dioff+i] - dispTArray[dtoff+i] + dispTmdtArray[dmoff+i]) / dt2;
+    } // for
+  } // for
+  PetscLogFlops(_shiftDispT.size() * 6);
+
+  _shiftVertices.clear();
+  _shiftDispT.clear();
+  _shiftDispIncr.clear();
+
+  _activeLevel = -1;
+  const size_t numIntegrators = _integrators.size();
+  for (size_t i = 0; i < numIntegrators; ++i) {
+    _integrators[i]->activeTimeStepLevel(-1);
+  } // for
+
+  PYLITH_METHOD_END;
+} // endLevelStep
+
+// ----------------------------------------------------------------------
+// Get time step of each time-step level.
+void
+pylith::problems::Explicit::_levelTimeSteps(scalar_array* dtLevels) const
+{ // _levelTimeSteps
+  assert(dtLevels);
+
+  const int numLevels = std::max(1, _numLevels);
+  dtLevels->resize(numLevels);
+  for (int level = 0; level < numLevels; ++level) {
+    (*dtLevels)[level] = _dt * PylithScalar(1 << level);
+  } // for
+} // _levelTimeSteps
+
 
 // End of file
@@ -32,6 +32,14 @@
 /** @brief Object for explicit time integration.
  *
  * Explicit time stepping associated with dynamic problems.
+ *
+ * With local time stepping, vertices are assigned to power-of-two
+ * time-step levels, dt*2^level, and each level is advanced with its
+ * own time step. Within a step of the coarsest level, the levels are
+ * advanced in substeps of the finest time step from the coarsest to
+ * the finest level; displacements of vertices in coarser levels that
+ * are in the middle of their time step are interpolated linearly in
+ * time when integrating the residual for finer levels.
  */
 
 class pylith::problems::Explicit : public Formulation
@@ -47,9 +55,117 @@ public :
   /// Destructor
   ~Explicit(void);
 
+  /** Solve the system with a lumped Jacobian and update the rate
+   * fields in a single pass over the vertices.
+   *
+   * @param solution Solution field (displacement increment).
+   * @param jacobian Lumped Jacobian of the system.
+   * @param residual Residual field.
+   */
+  void solveLumped(topology::Field* solution,
+		   const topology::Field& jacobian,
+		   const topology::Field& residual);
+
   /// Compute rate fields (velocity and/or acceleration) at time t.
   void calcRateFields(void);
 
+  /** Update rate fields (velocity and/or acceleration) at time t for
+   * an adjustment that has been added to the displacement increment.
+   *
+   * @param adjust Adjustment added to the displacement increment.
+   */
+  void adjustRateFields(const topology::Field& adjust);
+
+  /** Adjust solution from solver with lumped Jacobian to match Lagrange
+   *  multiplier constraints and update the rate fields accordingly.
+   *
+   * With local time stepping, cohesive cells are in level 0, so the
+   * adjustment is only done when advancing level 0.
+   */
+  void adjustSolnLumped(void);
+
+  /** Advance displacement fields from time t to time t+dt.
+   *
+   * For all vertices, disp(t-dt) takes over the values of disp(t) by
+   * exchanging vectors, disp(t) is set to disp(t) +
+   * dispIncr(t->t+dt), and the displacement increment is zeroed. For
+   * a single time-step level, the same update is done only for the
+   * vertices in that level.
+   *
+   * @param level Time-step level (-1 for all vertices).
+   */
+  void rotateDisplacement(const int level =-1);
+
+  /** Setup time-step levels for local time stepping.
+   *
+   * Cells are assigned to levels using their stable time step,
+   * level = floor(log2(dtStable/dt)). Vertices take the smallest
+   * level of the cells containing them. Vertices of cohesive cells,
+   * vertices with constrained DOF, and vertices restricted by
+   * integrators (e.g., absorbing dampers) are always in level 0.
+   *
+   * @param fields Solution fields.
+   * @param dt Time step for level 0 (nondimensional).
+   * @param maxLevels Maximum number of levels.
+   * @returns Number of levels (same on all processes).
+   */
+  int setupTimeStepLevels(topology::SolutionFields* fields,
+			  const PylithScalar dt,
+			  const int maxLevels);
+
+  /** Get number of time-step levels.
+   *
+   * @returns Number of levels (0 if not using local time stepping).
+   */
+  int numTimeStepLevels(void) const;
+
+  /** Get number of local vertices (excluding ghost vertices) in a
+   * time-step level.
+   *
+   * @param level Time-step level.
+   * @returns Number of vertices.
+   */
+  int numVerticesInLevel(const int level) const;
+
+  /** Prepare for advancing vertices in a time-step level.
+   *
+   * Displacements of vertices in coarser levels that are in the
+   * middle of their time step are interpolated to the current time
+   * and integrators are restricted to cells with vertices in the
+   * level.
+   *
+   * @param level Time-step level.
+   * @param substep Index of current substep (in units of the level 0
+   * time step) within the time step of the coarsest level.
+   */
+  void beginLevelStep(const int level,
+		      const int substep);
+
+  /// Restore displacements and integrators after advancing a time-step level.
+  void endLevelStep(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get time step of each time-step level.
+   *
+   * @param dtLevels Time step of each level (one level if not using
+   * local time stepping).
+   */
+  void _levelTimeSteps(scalar_array* dtLevels) const;
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  int_array _vertexLevels; ///< Time-step level of each vertex, indexed by (vertex - vStart).
+  int_array _levelNumVertices; ///< Number of local vertices in each level.
+  int _numLevels; ///< Number of time-step levels (0 if not using local time stepping).
+  int _activeLevel; ///< Level being advanced (-1 for all levels).
+
+  std::vector<PetscInt> _shiftVertices; ///< Vertices interpolated to current time.
+  std::vector<PylithScalar> _shiftDispT; ///< Original values of disp(t) at interpolated vertices.
+  std::vector<PylithScalar> _shiftDispIncr; ///< Original values of dispIncr at interpolated vertices.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
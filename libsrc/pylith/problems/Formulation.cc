@@ -26,9 +26,18 @@
 #include "pylith/feassemble/Integrator.hh" // USES Integrator
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "petsctime.h" // USES PetscTime()
+
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::max()
+#include <stdexcept> // USES std::out_of_range
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -40,7 +49,10 @@ pylith::problems::Formulation::Formulation(void) :
   _jacobianLumped(0),
   _fields(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _cacheResidual(false),
+  _residualCacheCurrent(false),
+  _solnAdjusted(false)
 { // constructor
 } // constructor
 
@@ -107,6 +119,29 @@ pylith::problems::Formulation::useCustomConstraintPC(void) const
   return _useCustomConstraintPC;
 } // useCustomConstraintPC
 
+// ----------------------------------------------------------------------
+// Set flag for caching contributions to the residual that do not
+// depend on the solution.
+void
+pylith::problems::Formulation::cacheResidual(const bool flag)
+{ // cacheResidual
+  _cacheResidual = flag;
+  _residualCacheCurrent = false;
+
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->splitResidual(flag);
+  } // for
+} // cacheResidual
+
+// ----------------------------------------------------------------------
+// Check whether constraining the solution space changed the solution.
+bool
+pylith::problems::Formulation::solnAdjusted(void) const
+{ // solnAdjusted
+  return _solnAdjusted;
+} // solnAdjusted
+
 // ----------------------------------------------------------------------
 // Return the fields
 const pylith::topology::SolutionFields&
@@ -132,8 +167,12 @@ pylith::problems::Formulation::integrators(feassemble::Integrator* integratorArr
   assert( (!integratorArray && 0 == numIntegrators) ||
 	  (integratorArray && 0 < numIntegrators) );
   _integrators.resize(numIntegrators);
-  for (int i=0; i < numIntegrators; ++i)
+  _integratorTime.assign(numIntegrators, 0.0);
+  for (int i=0; i < numIntegrators; ++i) {
     _integrators[i] = integratorArray[i];
+    _integrators[i]->splitResidual(_cacheResidual);
+  } // for
+  _residualCacheCurrent = false;
 } // integrators
   
 // ----------------------------------------------------------------------
@@ -164,6 +203,9 @@ pylith::problems::Formulation::updateSettings(topology::Jacobian* jacobian,
 
   _jacobian = jacobian;
   _fields = fields;
+  if (t != _t) {
+    _residualConstTimeChanged();
+  } // if
   _t = t;
   _dt = dt;
 } // updateSettings
@@ -183,10 +225,27 @@ pylith::problems::Formulation::updateSettings(topology::Field* jacobian,
 
   _jacobianLumped = jacobian;
   _fields = fields;
+  if (t != _t) {
+    _residualConstTimeChanged();
+  } // if
   _t = t;
   _dt = dt;
 } // updateSettings
 
+// ----------------------------------------------------------------------
+// Invalidate cached contributions to the residual that depend on time.
+void
+pylith::problems::Formulation::_residualConstTimeChanged(void)
+{ // _residualConstTimeChanged
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    if (_integrators[i]->residualConstDependsOnTime()) {
+      _residualCacheCurrent = false;
+      break;
+    } // if
+  } // for
+} // _residualConstTimeChanged
+
 // ----------------------------------------------------------------------
 // Reform system residual.
 void
@@ -206,16 +265,52 @@ pylith::problems::Formulation::reformResidual(const PetscVec* tmpResidualVec,
   // Update rate fields (must be consistent with current solution).
   calcRateFields();  
 
-  // Set residual to zero.
   topology::Field& residual = _fields->get("residual");
-  residual.zeroAll();
-
-  // Add in contributions that require assembly.
   const int numIntegrators = _integrators.size();
   assert(numIntegrators > 0); // must have at least 1 integrator
+
+  if (_cacheResidual) {
+    // Start from contributions that do not depend on the solution,
+    // integrating them only when they change.
+    if (!_fields->hasField("residual cache")) {
+      _fields->add("residual cache", "residual_cache");
+      topology::Field& cache = _fields->get("residual cache");
+      cache.cloneSection(residual);
+      _residualCacheCurrent = false;
+    } // if
+    for (int i=0; i < numIntegrators; ++i) {
+      if (_integrators[i]->needNewResidualConst()) {
+	_residualCacheCurrent = false;
+      } // if
+    } // for
+    topology::Field& cache = _fields->get("residual cache");
+    if (!_residualCacheCurrent) {
+      cache.zeroAll();
+      for (int i=0; i < numIntegrators; ++i) {
+	PetscLogDouble tBegin;
+	PetscTime(&tBegin);
+	_integrators[i]->timeStep(_dt);
+	_integrators[i]->integrateResidualConst(cache, _t, _fields);
+	_integrators[i]->resetNeedNewResidualConst();
+	_addIntegratorTime(i, tBegin);
+      } // for
+      _residualCacheCurrent = true;
+    } // if
+    PetscErrorCode err = VecCopy(cache.localVector(), residual.localVector());PYLITH_CHECK_ERROR(err);
+  } else {
+    // Set residual to zero.
+    residual.zeroAll();
+  } // if/else
+
+  // Add in contributions that require assembly.
   for (int i=0; i < numIntegrators; ++i) {
+    PetscLogDouble tBegin;
+    PetscTime(&tBegin);
     _integrators[i]->timeStep(_dt);
-    _integrators[i]->integrateResidual(residual, _t, _fields);
+    if (!_cacheResidual || _integrators[i]->residualDependsOnSoln()) {
+      _integrators[i]->integrateResidual(residual, _t, _fields);
+    } // if
+    _addIntegratorTime(i, tBegin);
   } // for
 
   // Assemble residual.
@@ -256,7 +351,10 @@ pylith::problems::Formulation::reformJacobian(const PetscVec* tmpSolutionVec)
   // Add in contributions that require assembly.
   const int numIntegrators = _integrators.size();
   for (int i=0; i < numIntegrators; ++i) {
+    PetscLogDouble tBegin;
+    PetscTime(&tBegin);
     _integrators[i]->integrateJacobian(_jacobian, _t, _fields);
+    _addIntegratorTime(i, tBegin);
   } // for
   
   // Assemble jacobian.
@@ -280,6 +378,47 @@ pylith::problems::Formulation::reformJacobian(const PetscVec* tmpSolutionVec)
   PYLITH_METHOD_END;
 } // reformJacobian
 
+// ----------------------------------------------------------------------
+// Get estimate of maximum relative change in stiffness since Jacobian
+// was last formed.
+PylithScalar
+pylith::problems::Formulation::stiffnessChange(void) const
+{ // stiffnessChange
+  PylithScalar change = -1.0;
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    change = std::max(change, _integrators[i]->stiffnessChange());
+  } // for
+
+  return change;
+} // stiffnessChange
+
+// ----------------------------------------------------------------------
+// Get cumulative wall time spent in integrator on this process.
+double
+pylith::problems::Formulation::integratorTime(const int index) const
+{ // integratorTime
+  if (index < 0 || index >= int(_integratorTime.size())) {
+    throw std::out_of_range("Index of integrator out of range.");
+  } // if
+
+  return _integratorTime[index];
+} // integratorTime
+
+// ----------------------------------------------------------------------
+// Add time since beginning of integrator operation to cumulative time
+// of integrator.
+void
+pylith::problems::Formulation::_addIntegratorTime(const int index,
+						  const double tBegin)
+{ // _addIntegratorTime
+  assert(0 <= index && index < int(_integratorTime.size()));
+
+  PetscLogDouble tEnd;
+  PetscTime(&tEnd);
+  _integratorTime[index] += tEnd - tBegin;
+} // _addIntegratorTime
+
 // ----------------------------------------------------------------------
 // Reform system Jacobian.
 void
@@ -296,7 +435,10 @@ pylith::problems::Formulation::reformJacobianLumped(void)
   // Add in contributions that require assembly.
   const int numIntegrators = _integrators.size();
   for (int i=0; i < numIntegrators; ++i) {
+    PetscLogDouble tBegin;
+    PetscTime(&tBegin);
     _integrators[i]->integrateJacobian(_jacobianLumped, _t, _fields);
+    _addIntegratorTime(i, tBegin);
   } // for
   
   // Assemble jacbian.
@@ -333,13 +475,21 @@ pylith::problems::Formulation::constrainSolnSpace(const PetscVec* tmpSolutionVec
   const int numIntegrators = _integrators.size();
   assert(numIntegrators > 0); // must have at least 1 bulk integrator
   for (int i=0; i < numIntegrators; ++i) {
+    PetscLogDouble tBegin;
+    PetscTime(&tBegin);
     _integrators[i]->timeStep(_dt);
     _integrators[i]->constrainSolnSpace(_fields, _t, *_jacobian);
+    _addIntegratorTime(i, tBegin);
   } // for
 
   adjust.complete();
   solution += adjust;  
 
+  // Record whether the constraints changed the solution.
+  PylithScalar adjustNorm = 0.0;
+  PetscErrorCode err = VecNorm(adjust.globalVector(), NORM_INFINITY, &adjustNorm);PYLITH_CHECK_ERROR(err);
+  _solnAdjusted = adjustNorm > 0.0;
+
   // Update PETScVec of solution for changes to Lagrange multipliers.
   if (tmpSolutionVec) {
     solution.scatterLocalToGlobal(*tmpSolutionVec);
@@ -348,6 +498,73 @@ pylith::problems::Formulation::constrainSolnSpace(const PetscVec* tmpSolutionVec
   PYLITH_METHOD_END;
 } // constrainSolnSpace
 
+// ----------------------------------------------------------------------
+// Solve the system with a lumped Jacobian and update the rate fields.
+void
+pylith::problems::Formulation::solveLumped(topology::Field* solution,
+					   const topology::Field& jacobian,
+					   const topology::Field& residual)
+{ // solveLumped
+  PYLITH_METHOD_BEGIN;
+
+  assert(solution);
+
+  // solution = residual / jacobian
+
+  const spatialdata::geocoords::CoordSys* cs = solution->mesh().coordsys();assert(cs);
+  const int spaceDim = cs->spaceDim();
+
+  // Get mesh vertices.
+  PetscDM dmMesh = solution->mesh().dmMesh(); assert(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  // Get sections.
+  topology::VecVisitorMesh solutionVisitor(*solution);
+  PetscScalar* solutionArray = solutionVisitor.localArray();
+
+  topology::VecVisitorMesh jacobianVisitor(jacobian);
+  const PetscScalar* jacobianArray = jacobianVisitor.localArray();
+
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();
+
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PetscInt joff = jacobianVisitor.sectionOffset(v);
+    assert(spaceDim == jacobianVisitor.sectionDof(v));
+
+    const PetscInt roff = residualVisitor.sectionOffset(v);
+    assert(spaceDim == residualVisitor.sectionDof(v));
+
+    const PetscInt soff = solutionVisitor.sectionOffset(v);
+    assert(spaceDim == solutionVisitor.sectionDof(v));
+
+    for (int i=0; i < spaceDim; ++i) {
+      assert(jacobianArray[joff+i] != 0.0);
+      solutionArray[soff+i] = residualArray[roff+i] / jacobianArray[joff+i];
+    } // for
+  } // for
+  PetscLogFlops((vEnd - vStart) * spaceDim);
+
+  // Update rate fields to be consistent with current solution.
+  calcRateFields();
+
+  PYLITH_METHOD_END;
+} // solveLumped
+
+// ----------------------------------------------------------------------
+// Update rate fields for an adjustment to the solution.
+void
+pylith::problems::Formulation::adjustRateFields(const topology::Field& adjust)
+{ // adjustRateFields
+  PYLITH_METHOD_BEGIN;
+
+  calcRateFields();
+
+  PYLITH_METHOD_END;
+} // adjustRateFields
+
 // ----------------------------------------------------------------------
 // Adjust solution from solver with lumped Jacobian to match Lagrange
 //  multiplier constraints.
@@ -368,12 +585,18 @@ pylith::problems::Formulation::adjustSolnLumped(void)
 
   const int numIntegrators = _integrators.size();
   for (int i=0; i < numIntegrators; ++i) {
+    PetscLogDouble tBegin;
+    PetscTime(&tBegin);
     _integrators[i]->adjustSolnLumped(_fields, _t, *_jacobianLumped);
+    _addIntegratorTime(i, tBegin);
   } // for
 
   adjust.complete();
   solution += adjust;
 
+  // Update rate fields to be consistent with adjusted solution.
+  adjustRateFields(adjust);
+
   PYLITH_METHOD_END;
 } // adjustSolnLumped
 
@@ -79,6 +79,25 @@ public :
    */
   bool useCustomConstraintPC(void) const;
 
+  /** Set flag for caching contributions to the residual that do not
+   * depend on the solution.
+   *
+   * The cached contributions are reused in all residual evaluations
+   * until the time changes and an integrator reports that its
+   * contributions depend on time, or an integrator signals that its
+   * contributions need to be recomputed.
+   *
+   * @param flag True if caching contributions, false otherwise.
+   */
+  void cacheResidual(const bool flag);
+
+  /** Check whether constraining the solution space in the last call
+   * to constrainSolnSpace() changed the solution.
+   *
+   * @returns True if solution was adjusted, false otherwise.
+   */
+  bool solnAdjusted(void) const;
+
   /** Get solution fields.
    *
    * @returns solution fields.
@@ -149,27 +168,82 @@ public :
    */
   void reformJacobianLumped(void);
 
+  /** Get estimate of the maximum relative change in stiffness over
+   * the integrators on this process since the Jacobian was last
+   * formed.
+   *
+   * @returns Relative change, or a negative value if no integrator
+   * provides an estimate.
+   */
+  PylithScalar stiffnessChange(void) const;
+
+  /** Get cumulative wall time spent in integrator on this process
+   * while reforming the residual and Jacobian and constraining the
+   * solution.
+   *
+   * @param index Index of integrator.
+   * @returns Time in seconds.
+   */
+  double integratorTime(const int index) const;
+
   /** Constrain solution space.
    *
    * @param tmpSolutionVec Temporary PETSc vector for solution.
    */
   void constrainSolnSpace(const PetscVec* tmpSolutionVec);
 
+  /** Solve the system with a lumped Jacobian, solution = residual /
+   * jacobian, and update the rate fields to be consistent with the
+   * solution.
+   *
+   * @param solution Solution field.
+   * @param jacobian Lumped Jacobian of the system.
+   * @param residual Residual field.
+   */
+  virtual
+  void solveLumped(topology::Field* solution,
+		   const topology::Field& jacobian,
+		   const topology::Field& residual);
+
   /** Adjust solution from solver with lumped Jacobian to match Lagrange
-   *  multiplier constraints.
+   *  multiplier constraints and update the rate fields accordingly.
    */
+  virtual
   void adjustSolnLumped(void);
 
   /// Compute rate fields (velocity and/or acceleration) at time t.
   virtual
   void calcRateFields(void) = 0;
 
+  /** Update rate fields (velocity and/or acceleration) at time t for
+   * an adjustment that has been added to the solution.
+   *
+   * @param adjust Adjustment added to the solution.
+   */
+  virtual
+  void adjustRateFields(const topology::Field& adjust);
+
   /// Write state of system
   void printState(PetscVec* solutionVec,
 		  PetscVec* residualVec,
 		  PetscVec* solution0Vec,
 		  PetscVec* searchDirVec);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Invalidate cached contributions to the residual that depend on time.
+  void _residualConstTimeChanged(void);
+
+  /** Add time since beginning of integrator operation to cumulative
+   * time of integrator.
+   *
+   * @param index Index of integrator.
+   * @param tBegin Time at beginning of operation.
+   */
+  void _addIntegratorTime(const int index,
+			  const double tBegin);
+
 // PROTECTED MEMBERS ////////////////////////////////////////////////////
 protected :
 
@@ -181,11 +255,15 @@ protected :
   topology::SolutionFields* _fields; ///< Handle to solution fields for system.
 
   std::vector<feassemble::Integrator*> _integrators; ///< Array of integrators.
+  std::vector<double> _integratorTime; ///< Cumulative time in each integrator.
 
   bool _isJacobianSymmetric; ///< Is system Jacobian symmetric?
   bool _splitFields; ///< True if splitting fields.
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
+  bool _cacheResidual; ///< True if caching solution independent contributions to residual.
+  bool _residualCacheCurrent; ///< True if cached contributions are current.
+  bool _solnAdjusted; ///< True if last constraint of solution space changed solution.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -73,7 +73,8 @@ pylith::problems::Solver::Solver(void) :
     _logger(0),
     _jacobianPC(0),
     _jacobianPCFault(0),
-    _skipNullSpaceCreation(false)
+    _skipNullSpaceCreation(false),
+    _cacheResidual(false)
 { // constructor
 } // constructor
 
@@ -119,6 +120,19 @@ pylith::problems::Solver::skipNullSpaceCreation(const bool value)
 } // skipNullSpaceCreation
 
 
+// ----------------------------------------------------------------------
+// Set flag for caching contributions to residual.
+void
+pylith::problems::Solver::cacheResidual(const bool value)
+{ // cacheResidual
+    PYLITH_METHOD_BEGIN;
+
+    _cacheResidual = value;
+
+    PYLITH_METHOD_END;
+} // cacheResidual
+
+
 // ----------------------------------------------------------------------
 // Initialize solver.
 void
@@ -130,6 +144,7 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
 
     assert(formulation);
     _formulation = formulation;
+    _formulation->cacheResidual(_cacheResidual);
 
     // Make global preconditioner matrix
     PetscMat jacobianMat = jacobian.matrix();
@@ -163,7 +178,8 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
 // ----------------------------------------------------------------------
 // Create null space.
 void
-pylith::problems::Solver::_createNullSpace(const topology::SolutionFields& fields)
+pylith::problems::Solver::_createNullSpace(const topology::SolutionFields& fields,
+                                           const topology::Jacobian& jacobian)
 { // _createNullSpace
     PYLITH_METHOD_BEGIN;
 
@@ -201,6 +217,10 @@ pylith::problems::Solver::_createNullSpace(const topology::SolutionFields& field
             throw std::runtime_error(msg.str());
         } // if
 
+        // Rigid body modes are set only at vertices, which hold the
+        // displacement DOF. The Lagrange multiplier DOF live on the
+        // hybrid edges of the cohesive cells, so they are left zero.
+
         for(int i = 0; i < m; ++i) {
             err = VecDuplicate(solutionGlobalVec, &mode[i]); PYLITH_CHECK_ERROR(err);
             // This is necessary to avoid circular references when we compose this MatNullSpace with a field in the DM
@@ -276,6 +296,13 @@ pylith::problems::Solver::_createNullSpace(const topology::SolutionFields& field
     } // if
     err = DMGetField(dmMesh, 0, &field); PYLITH_CHECK_ERROR(err);
     err = PetscObjectCompose(field, "nearnullspace", (PetscObject) nullsp); PYLITH_CHECK_ERROR(err);
+
+    // Attach near null space to the Jacobian for algebraic multigrid
+    // without split fields. The modes are zero on the Lagrange
+    // multiplier DOF (see above).
+    if (nullsp) {
+        err = MatSetNearNullSpace(jacobian.matrix(), nullsp); PYLITH_CHECK_ERROR(err);
+    } // if
     err = MatNullSpaceDestroy(&nullsp); PYLITH_CHECK_ERROR(err);
 
     PYLITH_METHOD_END;
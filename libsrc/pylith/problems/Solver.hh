@@ -73,6 +73,12 @@ public :
    */
   void skipNullSpaceCreation(const bool value);
 
+  /** Set flag for caching contributions to the residual that do not
+   * depend on the solution.
+   *
+   * @param[in] value True to cache contributions.
+   */
+  void cacheResidual(const bool value);
 
   /** Initialize solver.
    *
@@ -89,10 +95,16 @@ public :
 protected :
 
   /** Create rigid body null space.
+   *
+   * The null space is used as the near null space for algebraic
+   * multigrid of the displacement field (split fields) and of the
+   * Jacobian (no split fields).
    *
    * @param fields Solution fields.
+   * @param jacobian System Jacobian matrix.
    */
-  void _createNullSpace(const topology::SolutionFields& fields);
+  void _createNullSpace(const topology::SolutionFields& fields,
+			const topology::Jacobian& jacobian);
 
   /** Setup preconditioner for preconditioning using split fields.
    *
@@ -122,6 +134,7 @@ protected :
   PetscMat _jacobianPCFault; ///< Preconditioning matrix for Lagrange constraints.
   FaultPreconCtx _ctx; ///< Context for preconditioning matrix for Lagrange constraints.
   bool _skipNullSpaceCreation; ///< Skip creating the null space (useful for very small problems with no null space).
+  bool _cacheResidual; ///< Cache contributions to residual that do not depend on the solution.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
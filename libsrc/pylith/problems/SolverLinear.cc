@@ -30,13 +30,34 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 
 #include <petscksp.h> // USES PetscKSP
+#include <petscpc.h> // USES PCFactorGetMatrix()
+#include <petsctime.h> // USES PetscTime()
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+#include <algorithm> // USES std::rotate(), std::max(), std::swap()
+#include <cmath> // USES log()
+#include <cassert> // USES assert()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error, std::logic_error
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverLinear::SolverLinear(void) :
-  _ksp(0)
+  _ksp(0),
+  _guessWork(0),
+  _initialGuess(GUESS_ZERO),
+  _historySize(0),
+  _numIterations(0),
+  _numIterationsSaved(0.0),
+  _residualNorm(0.0),
+  _convergedReason(0),
+  _kspFactor(0),
+  _factorMaxMemory(0.0),
+  _factorMemory(0.0),
+  _factorTime(0.0),
+  _numFactorizations(0),
+  _useFactorization(false)
 { // constructor
 } // constructor
 
@@ -57,6 +78,9 @@ pylith::problems::SolverLinear::deallocate(void)
   Solver::deallocate();
 
   PetscErrorCode err = KSPDestroy(&_ksp);PYLITH_CHECK_ERROR(err);
+  err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+  _destroyHistory();
+  clearBlock();
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -80,6 +104,11 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
   err = KSPCreate(fields.mesh().comm(), &_ksp);PYLITH_CHECK_ERROR(err);
   err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
   err = KSPSetFromOptions(_ksp);PYLITH_CHECK_ERROR(err);
+  err = KSPSetResidualHistory(_ksp, NULL, PETSC_DECIDE, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+  _destroyHistory();
+  clearBlock();
+  err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+  _numFactorizations = 0;
 
   if (formulation->splitFields()) {
     PetscPC pc = 0;
@@ -88,7 +117,7 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
   } // if
 
   if (!_skipNullSpaceCreation) {
-    _createNullSpace(fields);
+    _createNullSpace(fields, jacobian);
   } // if
   
   PYLITH_METHOD_END;
@@ -120,18 +149,75 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
 
   PetscErrorCode err = 0;
   const PetscMat jacobianMat = jacobian->matrix();
-  err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+  const bool jacobianChanged = jacobian->valuesChanged();
+  PetscKSP ksp = _setOperators(jacobianMat, jacobianChanged);
   jacobian->resetValuesChanged();
 
   const PetscVec residualVec = residual.globalVector();
   const PetscVec solutionVec = solution->globalVector();
 
+  // Form initial guess and compute reduction in residual from guess
+  // (not needed with factorization).
+  const bool useGuess = GUESS_ZERO != _initialGuess && _historySolns.size() > 0 && ksp == _ksp;
+  PetscReal guessReduction = 1.0;
+  if (useGuess) {
+    _formInitialGuess(solutionVec, residualVec, jacobianMat, jacobianChanged);
+
+    PetscReal rhsNorm = 0.0;
+    PetscReal guessNorm = 0.0;
+    err = VecNorm(residualVec, NORM_2, &rhsNorm);PYLITH_CHECK_ERROR(err);
+    err = MatMult(jacobianMat, solutionVec, _guessWork);PYLITH_CHECK_ERROR(err);
+    err = VecAYPX(_guessWork, -1.0, residualVec);PYLITH_CHECK_ERROR(err);
+    err = VecNorm(_guessWork, NORM_2, &guessNorm);PYLITH_CHECK_ERROR(err);
+    if (guessNorm > 0.0 && rhsNorm > 0.0) {
+      guessReduction = guessNorm / rhsNorm;
+    } // if
+  } // if
+  err = KSPSetInitialGuessNonzero(ksp, useGuess ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
   _logger->eventEnd(setupEvent);
   _logger->eventBegin(solveEvent);
 
-  err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+  err = KSPSolve(ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+  if (ksp == _kspFactor && !_factorSucceeded()) {
+    // Fall back to iterative solver if factorization failed.
+    ksp = _setOperators(jacobianMat, jacobianChanged);
+    err = KSPSolve(ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+  } // if
 
   _logger->eventEnd(solveEvent);
+  _logger->eventBegin(setupEvent);
+
+  PetscInt numIterations = 0;
+  err = KSPGetIterationNumber(ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+  _numIterations = numIterations;
+  PetscReal residualNorm = 0.0;
+  err = KSPGetResidualNorm(ksp, &residualNorm);PYLITH_CHECK_ERROR(err);
+  _residualNorm = residualNorm;
+  KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+  err = KSPGetConvergedReason(ksp, &reason);PYLITH_CHECK_ERROR(err);
+  _convergedReason = reason;
+
+  // Estimate iterations saved using the average reduction in the
+  // residual per iteration.
+  _numIterationsSaved = 0.0;
+  if (useGuess && numIterations > 0 && guessReduction < 1.0) {
+    PetscReal* history = NULL;
+    PetscInt historySize = 0;
+    err = KSPGetResidualHistory(ksp, &history, &historySize);PYLITH_CHECK_ERROR(err);
+    if (historySize > numIterations && history[0] > 0.0 && history[numIterations] > 0.0) {
+      const PylithScalar logRate = log(history[numIterations] / history[0]) / numIterations;
+      if (logRate < 0.0) {
+	_numIterationsSaved = log(guessReduction) / logRate;
+      } // if
+    } // if
+  } // if
+
+  if (GUESS_ZERO != _initialGuess && ksp == _ksp) {
+    _updateHistory(solutionVec, residualVec);
+  } // if
+
+  _logger->eventEnd(setupEvent);
   _logger->eventBegin(scatterEvent);
 
   // Update section view of field.
@@ -145,6 +231,670 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
   PYLITH_METHOD_END;
 } // solve
 
+// ----------------------------------------------------------------------
+// Set method for forming initial guess from previous solutions.
+void
+pylith::problems::SolverLinear::initialGuess(const InitialGuessEnum value,
+					     const int historySize)
+{ // initialGuess
+  PYLITH_METHOD_BEGIN;
+
+  if (GUESS_ZERO != value && historySize < 1) {
+    std::ostringstream msg;
+    msg << "Number of previous solutions for initial guess (" << historySize << ") must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _initialGuess = value;
+  _historySize = (GUESS_ZERO != value) ? historySize : 0;
+  _destroyHistory();
+
+  PYLITH_METHOD_END;
+} // initialGuess
+
+// ----------------------------------------------------------------------
+// Get number of iterations in last solve.
+int
+pylith::problems::SolverLinear::numIterations(void) const
+{ // numIterations
+  return _numIterations;
+} // numIterations
+
+// ----------------------------------------------------------------------
+// Get estimate of number of iterations saved in last solve.
+PylithScalar
+pylith::problems::SolverLinear::numIterationsSaved(void) const
+{ // numIterationsSaved
+  return _numIterationsSaved;
+} // numIterationsSaved
+
+// ----------------------------------------------------------------------
+// Get norm of residual at end of last solve.
+PylithScalar
+pylith::problems::SolverLinear::residualNorm(void) const
+{ // residualNorm
+  return _residualNorm;
+} // residualNorm
+
+// ----------------------------------------------------------------------
+// Get PETSc reason the last solve converged or diverged.
+int
+pylith::problems::SolverLinear::convergedReason(void) const
+{ // convergedReason
+  return _convergedReason;
+} // convergedReason
+
+// ----------------------------------------------------------------------
+// Add right-hand side to block of systems.
+void
+pylith::problems::SolverLinear::addBlockRHS(const topology::Field& residual)
+{ // addBlockRHS
+  PYLITH_METHOD_BEGIN;
+
+  const int scatterEvent = _logger->eventId("SoLi scatter");
+  _logger->eventBegin(scatterEvent);
+
+  // Update PetscVector view of field.
+  residual.scatterLocalToGlobal();
+
+  const PetscVec residualVec = residual.globalVector();
+  PetscVec rhsVec = NULL;
+  PetscErrorCode err = VecDuplicate(residualVec, &rhsVec);PYLITH_CHECK_ERROR(err);
+  err = VecCopy(residualVec, rhsVec);PYLITH_CHECK_ERROR(err);
+  _blockRhs.push_back(rhsVec);
+
+  _logger->eventEnd(scatterEvent);
+
+  PYLITH_METHOD_END;
+} // addBlockRHS
+
+// ----------------------------------------------------------------------
+// Get number of right-hand sides in block.
+int
+pylith::problems::SolverLinear::blockSize(void) const
+{ // blockSize
+  return _blockRhs.size();
+} // blockSize
+
+// ----------------------------------------------------------------------
+// Solve the system for all right-hand sides in block.
+void
+pylith::problems::SolverLinear::solveBlock(topology::Jacobian* jacobian)
+{ // solveBlock
+  PYLITH_METHOD_BEGIN;
+
+  assert(jacobian);
+  assert(_blockSolns.size() <= _blockRhs.size());
+
+  const int setupEvent = _logger->eventId("SoLi setup");
+  const int solveEvent = _logger->eventId("SoLi solve block");
+  _logger->eventBegin(setupEvent);
+
+  PetscErrorCode err = 0;
+  const size_t numRhs = _blockRhs.size();
+  for (size_t i = _blockSolns.size(); i < numRhs; ++i) {
+    PetscVec solnVec = NULL;
+    err = VecDuplicate(_blockRhs[i], &solnVec);PYLITH_CHECK_ERROR(err);
+    _blockSolns.push_back(solnVec);
+  } // for
+  
+  const PetscMat jacobianMat = jacobian->matrix();
+  const bool jacobianChanged = jacobian->valuesChanged();
+  PetscKSP ksp = _setOperators(jacobianMat, jacobianChanged);
+  jacobian->resetValuesChanged();
+  err = KSPSetInitialGuessNonzero(ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+  err = KSPSetUp(ksp);PYLITH_CHECK_ERROR(err);
+
+  _logger->eventEnd(setupEvent);
+  _logger->eventBegin(solveEvent);
+
+  _numIterations = 0;
+  _numIterationsSaved = 0.0;
+  const bool solved = _solveBlockFactored(ksp);
+  for (size_t i = 0; !solved && i < numRhs; ++i) {
+    err = KSPSolve(ksp, _blockRhs[i], _blockSolns[i]); PYLITH_CHECK_ERROR(err);
+    if (ksp == _kspFactor && !_factorSucceeded()) {
+      // Fall back to iterative solver if factorization failed.
+      ksp = _setOperators(jacobianMat, jacobianChanged);
+      err = KSPSolve(ksp, _blockRhs[i], _blockSolns[i]); PYLITH_CHECK_ERROR(err);
+    } // if
+    PetscInt numIterations = 0;
+    err = KSPGetIterationNumber(ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+    _numIterations += numIterations;
+  } // for
+
+  _logger->eventEnd(solveEvent);
+
+  PYLITH_METHOD_END;
+} // solveBlock
+
+// ----------------------------------------------------------------------
+// Get solution for right-hand side in block.
+void
+pylith::problems::SolverLinear::blockSolution(topology::Field* solution,
+					      const int index)
+{ // blockSolution
+  PYLITH_METHOD_BEGIN;
+
+  assert(solution);
+  assert(_formulation);
+
+  if (index < 0 || size_t(index) >= _blockSolns.size()) {
+    std::ostringstream msg;
+    msg << "Index (" << index << ") of solution in block out of range [0, " << _blockSolns.size() << ").";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  const int scatterEvent = _logger->eventId("SoLi scatter");
+  _logger->eventBegin(scatterEvent);
+
+  PetscErrorCode err = VecCopy(_blockSolns[index], solution->globalVector());PYLITH_CHECK_ERROR(err);
+
+  // Update section view of field.
+  solution->scatterGlobalToLocal();
+
+  _logger->eventEnd(scatterEvent);
+
+  // Update rate fields to be consistent with current solution.
+  _formulation->calcRateFields();
+
+  PYLITH_METHOD_END;
+} // blockSolution
+
+// ----------------------------------------------------------------------
+// Remove all right-hand sides and solutions from block.
+void
+pylith::problems::SolverLinear::clearBlock(void)
+{ // clearBlock
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  for (size_t i = 0; i < _blockRhs.size(); ++i) {
+    err = VecDestroy(&_blockRhs[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  for (size_t i = 0; i < _blockSolns.size(); ++i) {
+    err = VecDestroy(&_blockSolns[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _blockRhs.clear();
+  _blockSolns.clear();
+
+  PYLITH_METHOD_END;
+} // clearBlock
+
+// ----------------------------------------------------------------------
+// Set whether to factor Jacobian once and reuse the factorization.
+void
+pylith::problems::SolverLinear::useFactorization(const bool value,
+						 const PylithScalar maxMemory)
+{ // useFactorization
+  PYLITH_METHOD_BEGIN;
+
+  if (maxMemory < 0.0) {
+    std::ostringstream msg;
+    msg << "Maximum memory for factorization (" << maxMemory << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _useFactorization = value;
+  _factorMaxMemory = maxMemory;
+  PetscErrorCode err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+  _numFactorizations = 0;
+
+  PYLITH_METHOD_END;
+} // useFactorization
+
+// ----------------------------------------------------------------------
+// Is Jacobian factorization used in solves?
+bool
+pylith::problems::SolverLinear::usingFactorization(void) const
+{ // usingFactorization
+  return _useFactorization;
+} // usingFactorization
+
+// ----------------------------------------------------------------------
+// Get number of factorizations of the Jacobian.
+int
+pylith::problems::SolverLinear::numFactorizations(void) const
+{ // numFactorizations
+  return _numFactorizations;
+} // numFactorizations
+
+// ----------------------------------------------------------------------
+// Get memory used by last factorization.
+PylithScalar
+pylith::problems::SolverLinear::factorMemory(void) const
+{ // factorMemory
+  return _factorMemory;
+} // factorMemory
+
+// ----------------------------------------------------------------------
+// Get time for last factorization.
+PylithScalar
+pylith::problems::SolverLinear::factorTime(void) const
+{ // factorTime
+  return _factorTime;
+} // factorTime
+
+// ----------------------------------------------------------------------
+// Form initial guess from previous solutions.
+void
+pylith::problems::SolverLinear::_formInitialGuess(PetscVec solutionVec,
+						  PetscVec rhsVec,
+						  PetscMat jacobianMat,
+						  const bool jacobianChanged)
+{ // _formInitialGuess
+  PYLITH_METHOD_BEGIN;
+
+  assert(solutionVec);
+  assert(rhsVec);
+  assert(jacobianMat);
+
+  const int numPrev = _historySolns.size();
+  assert(numPrev > 0);
+  assert(_historyRhs.size() == size_t(numPrev));
+
+  PetscErrorCode err = 0;
+  std::vector<PetscScalar> coefs(numPrev, 0.0);
+  switch (_initialGuess) {
+  case GUESS_EXTRAPOLATE : {
+    // Polynomial extrapolation through previous solutions,
+    // x = sum_j (-1)**(j+1) * binomial(n, j) * x_{-j}.
+    PetscScalar binomial = 1.0;
+    for (int j = 1; j <= numPrev; ++j) {
+      binomial *= PetscScalar(numPrev - j + 1) / PetscScalar(j);
+      coefs[j-1] = (j % 2) ? binomial : -binomial;
+    } // for
+    break;
+  } // GUESS_EXTRAPOLATE
+  case GUESS_PROJECT : {
+    // Right-hand sides of previous solutions are out of date if the
+    // matrix changed.
+    if (jacobianChanged) {
+      for (int i = 0; i < numPrev; ++i) {
+	err = MatMult(jacobianMat, _historySolns[i], _historyRhs[i]);PYLITH_CHECK_ERROR(err);
+      } // for
+    } // if
+
+    // Least squares fit of right-hand side with previous right-hand
+    // sides: (B^T B) c = B^T b.
+    std::vector<PetscScalar> gram(numPrev*numPrev);
+    std::vector<PetscScalar> proj(numPrev);
+    err = VecMDot(rhsVec, numPrev, &_historyRhs[0], &proj[0]);PYLITH_CHECK_ERROR(err);
+    for (int i = 0; i < numPrev; ++i) {
+      err = VecMDot(_historyRhs[i], numPrev, &_historyRhs[0], &gram[i*numPrev]);PYLITH_CHECK_ERROR(err);
+    } // for
+
+    // Solve with symmetric Gaussian elimination using the largest
+    // remaining diagonal entry as the pivot. The Gram matrix is
+    // positive semidefinite, so the remaining diagonal entries are the
+    // squared norms of the right-hand sides after removing the
+    // components along the pivots already chosen. Stop when these are
+    // (nearly) zero; the remaining directions are linearly dependent
+    // and their coefficients are zero.
+    PetscReal maxDiag = 0.0;
+    for (int i = 0; i < numPrev; ++i) {
+      maxDiag = std::max(maxDiag, PetscAbsScalar(gram[i*numPrev+i]));
+    } // for
+    const PetscReal pivotTolerance = 1.0e-12 * maxDiag;
+    std::vector<int> order(numPrev);
+    for (int i = 0; i < numPrev; ++i) {
+      order[i] = i;
+    } // for
+    int rank = 0;
+    for (int k = 0; k < numPrev; ++k) {
+      int iPivot = k;
+      for (int i = k+1; i < numPrev; ++i) {
+	if (PetscAbsScalar(gram[i*numPrev+i]) > PetscAbsScalar(gram[iPivot*numPrev+iPivot])) {
+	  iPivot = i;
+	} // if
+      } // for
+      if (PetscAbsScalar(gram[iPivot*numPrev+iPivot]) <= pivotTolerance) {
+	break;
+      } // if
+      if (iPivot != k) {
+	for (int j = 0; j < numPrev; ++j) {
+	  std::swap(gram[k*numPrev+j], gram[iPivot*numPrev+j]);
+	} // for
+	for (int i = 0; i < numPrev; ++i) {
+	  std::swap(gram[i*numPrev+k], gram[i*numPrev+iPivot]);
+	} // for
+	std::swap(proj[k], proj[iPivot]);
+	std::swap(order[k], order[iPivot]);
+      } // if
+      for (int i = k+1; i < numPrev; ++i) {
+	const PetscScalar factor = gram[i*numPrev+k] / gram[k*numPrev+k];
+	for (int j = k; j < numPrev; ++j) {
+	  gram[i*numPrev+j] -= factor * gram[k*numPrev+j];
+	} // for
+	proj[i] -= factor * proj[k];
+      } // for
+      ++rank;
+    } // for
+    std::vector<PetscScalar> coefsPivot(numPrev, 0.0);
+    for (int k = rank-1; k >= 0; --k) {
+      PetscScalar value = proj[k];
+      for (int j = k+1; j < rank; ++j) {
+	value -= gram[k*numPrev+j] * coefsPivot[j];
+      } // for
+      coefsPivot[k] = value / gram[k*numPrev+k];
+    } // for
+    for (int k = 0; k < numPrev; ++k) {
+      coefs[order[k]] = coefsPivot[k];
+    } // for
+    break;
+  } // GUESS_PROJECT
+  case GUESS_ZERO :
+  default :
+    assert(0);
+    throw std::logic_error("Unknown method for forming initial guess.");
+  } // switch
+
+  err = VecSet(solutionVec, 0.0);PYLITH_CHECK_ERROR(err);
+  err = VecMAXPY(solutionVec, numPrev, &coefs[0], &_historySolns[0]);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _formInitialGuess
+
+// ----------------------------------------------------------------------
+// Add solution to history of previous solutions.
+void
+pylith::problems::SolverLinear::_updateHistory(PetscVec solutionVec,
+					       PetscVec rhsVec)
+{ // _updateHistory
+  PYLITH_METHOD_BEGIN;
+
+  assert(solutionVec);
+  assert(rhsVec);
+  assert(_historySize > 0);
+
+  PetscErrorCode err = 0;
+  if (!_guessWork) {
+    err = VecDuplicate(solutionVec, &_guessWork);PYLITH_CHECK_ERROR(err);
+  } // if
+  if (_historySolns.size() < size_t(_historySize)) {
+    PetscVec vec = NULL;
+    err = VecDuplicate(solutionVec, &vec);PYLITH_CHECK_ERROR(err);
+    _historySolns.push_back(vec);
+    err = VecDuplicate(rhsVec, &vec);PYLITH_CHECK_ERROR(err);
+    _historyRhs.push_back(vec);
+  } // if
+
+  // Reuse vectors of oldest solution for most recent solution.
+  std::rotate(_historySolns.begin(), _historySolns.end()-1, _historySolns.end());
+  std::rotate(_historyRhs.begin(), _historyRhs.end()-1, _historyRhs.end());
+  err = VecCopy(solutionVec, _historySolns[0]);PYLITH_CHECK_ERROR(err);
+  err = VecCopy(rhsVec, _historyRhs[0]);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _updateHistory
+
+// ----------------------------------------------------------------------
+// Destroy history of previous solutions.
+void
+pylith::problems::SolverLinear::_destroyHistory(void)
+{ // _destroyHistory
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  const size_t numPrev = _historySolns.size();
+  for (size_t i = 0; i < numPrev; ++i) {
+    err = VecDestroy(&_historySolns[i]);PYLITH_CHECK_ERROR(err);
+    err = VecDestroy(&_historyRhs[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  _historySolns.clear();
+  _historyRhs.clear();
+  err = VecDestroy(&_guessWork);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _destroyHistory
+
+// ----------------------------------------------------------------------
+// Set operators of solver and get solver to use.
+PetscKSP
+pylith::problems::SolverLinear::_setOperators(PetscMat jacobianMat,
+					      const bool jacobianChanged)
+{ // _setOperators
+  PYLITH_METHOD_BEGIN;
+
+  assert(jacobianMat);
+
+  PetscErrorCode err = 0;
+  if (!_useFactorization) {
+    err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_RETURN(_ksp);
+  } // if
+
+  if (!_kspFactor) {
+    MPI_Comm comm = PETSC_COMM_WORLD;
+    err = PetscObjectGetComm((PetscObject)_ksp, &comm);PYLITH_CHECK_ERROR(err);
+    err = KSPCreate(comm, &_kspFactor);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOptionsPrefix(_kspFactor, "factor_");PYLITH_CHECK_ERROR(err);
+    err = KSPSetType(_kspFactor, KSPPREONLY);PYLITH_CHECK_ERROR(err);
+    PetscPC pc = NULL;
+    err = KSPGetPC(_kspFactor, &pc);PYLITH_CHECK_ERROR(err);
+    err = PCSetType(pc, PCLU);PYLITH_CHECK_ERROR(err);
+    err = KSPSetFromOptions(_kspFactor);PYLITH_CHECK_ERROR(err);
+    err = KSPSetInitialGuessNonzero(_kspFactor, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+    _numFactorizations = 0;
+  } // if
+
+  // Refactor only if the Jacobian changed since the last factorization.
+  const bool refactor = jacobianChanged || !_numFactorizations;
+  err = KSPSetOperators(_kspFactor, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+  err = KSPSetReusePreconditioner(_kspFactor, refactor ? PETSC_FALSE : PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+  if (!refactor) {
+    PYLITH_METHOD_RETURN(_kspFactor);
+  } // if
+
+  const int factorEvent = _logger->eventId("SoLi factor");
+  _logger->eventBegin(factorEvent);
+
+  // Check memory budget with a symbolic factorization before the
+  // first numeric factorization. The nonzero pattern of the Jacobian
+  // does not change, so the estimate holds for refactorizations.
+  if (_factorMaxMemory > 0.0 && !_numFactorizations) {
+    const PylithScalar memoryEstimate = _estimateFactorMemory(jacobianMat);
+    if (memoryEstimate > _factorMaxMemory) {
+      _logger->eventEnd(factorEvent);
+      // Factorization would exceed memory budget, so use iterative solver.
+      _factorMemory = memoryEstimate;
+      _useFactorization = false;
+      err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+      err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+      PYLITH_METHOD_RETURN(_ksp);
+    } // if
+  } // if
+
+  PetscLogDouble tStart = 0.0, tEnd = 0.0;
+  err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+  err = KSPSetUp(_kspFactor);PYLITH_CHECK_ERROR(err);
+  err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+  _factorTime = tEnd - tStart;
+  ++_numFactorizations;
+
+  // Maximum memory over processes used by factorization.
+  PetscPC pc = NULL;
+  err = KSPGetPC(_kspFactor, &pc);PYLITH_CHECK_ERROR(err);
+  PetscMat factorMat = NULL;
+  err = PCFactorGetMatrix(pc, &factorMat);PYLITH_CHECK_ERROR(err);
+  MatInfo info;
+  err = MatGetInfo(factorMat, MAT_GLOBAL_MAX, &info);PYLITH_CHECK_ERROR(err);
+  _factorMemory = std::max(PylithScalar(info.memory), PylithScalar(info.nz_used*(sizeof(PetscScalar)+sizeof(PetscInt))));
+
+  _logger->eventEnd(factorEvent);
+
+  if (_factorMaxMemory > 0.0 && _factorMemory > _factorMaxMemory) {
+    // Factorization exceeds memory budget (no estimate available from
+    // the factorization package), so use iterative solver.
+    _useFactorization = false;
+    err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+    err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_RETURN(_ksp);
+  } // if
+
+  PYLITH_METHOD_RETURN(_kspFactor);
+} // _setOperators
+
+// ----------------------------------------------------------------------
+// Estimate memory for factorization from symbolic factorization.
+PylithScalar
+pylith::problems::SolverLinear::_estimateFactorMemory(PetscMat jacobianMat)
+{ // _estimateFactorMemory
+  PYLITH_METHOD_BEGIN;
+
+  assert(_kspFactor);
+  assert(jacobianMat);
+
+  PetscErrorCode err = 0;
+  PetscPC pc = NULL;
+  err = KSPGetPC(_kspFactor, &pc);PYLITH_CHECK_ERROR(err);
+  PetscBool isLU = PETSC_FALSE, isCholesky = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject)pc, PCLU, &isLU);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject)pc, PCCHOLESKY, &isCholesky);PYLITH_CHECK_ERROR(err);
+  if (!isLU && !isCholesky) {
+    PYLITH_METHOD_RETURN(0.0);
+  } // if
+  const MatFactorType factorType = isLU ? MAT_FACTOR_LU : MAT_FACTOR_CHOLESKY;
+
+  MatSolverPackage solverPackage = NULL;
+  err = PCFactorGetMatSolverPackage(pc, &solverPackage);PYLITH_CHECK_ERROR(err);
+  if (!solverPackage) {
+    solverPackage = MATSOLVERPETSC;
+  } // if
+  PetscBool isAvailable = PETSC_FALSE;
+  err = MatGetFactorAvailable(jacobianMat, solverPackage, factorType, &isAvailable);PYLITH_CHECK_ERROR(err);
+  if (!isAvailable) {
+    PYLITH_METHOD_RETURN(0.0);
+  } // if
+
+  PetscMat factorMat = NULL;
+  PetscIS rowPerm = NULL, colPerm = NULL;
+  MatFactorInfo factorInfo;
+  err = MatFactorInfoInitialize(&factorInfo);PYLITH_CHECK_ERROR(err);
+  err = MatGetFactor(jacobianMat, solverPackage, factorType, &factorMat);PYLITH_CHECK_ERROR(err);
+  err = MatGetOrdering(jacobianMat, MATORDERINGND, &rowPerm, &colPerm);PYLITH_CHECK_ERROR(err);
+  if (isLU) {
+    err = MatLUFactorSymbolic(factorMat, jacobianMat, rowPerm, colPerm, &factorInfo);PYLITH_CHECK_ERROR(err);
+  } else {
+    err = MatCholeskyFactorSymbolic(factorMat, jacobianMat, rowPerm, &factorInfo);PYLITH_CHECK_ERROR(err);
+  } // if/else
+  MatInfo info;
+  err = MatGetInfo(factorMat, MAT_GLOBAL_MAX, &info);PYLITH_CHECK_ERROR(err);
+  const PylithScalar memoryEstimate = std::max(PylithScalar(info.memory), PylithScalar(info.nz_allocated*(sizeof(PetscScalar)+sizeof(PetscInt))));
+
+  err = ISDestroy(&rowPerm);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&colPerm);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&factorMat);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(memoryEstimate);
+} // _estimateFactorMemory
+
+// ----------------------------------------------------------------------
+// Check whether last solve with factorization succeeded.
+bool
+pylith::problems::SolverLinear::_factorSucceeded(void)
+{ // _factorSucceeded
+  PYLITH_METHOD_BEGIN;
+
+  assert(_kspFactor);
+
+  // Solve with factorization fails if the factorization failed, for
+  // example, because of a zero pivot.
+  KSPConvergedReason reason = KSP_CONVERGED_ITERATING;
+  PetscErrorCode err = KSPGetConvergedReason(_kspFactor, &reason);PYLITH_CHECK_ERROR(err);
+  if (reason >= 0) {
+    PYLITH_METHOD_RETURN(true);
+  } // if
+
+  _useFactorization = false;
+  err = KSPDestroy(&_kspFactor);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(false);
+} // _factorSucceeded
+
+// ----------------------------------------------------------------------
+// Solve block of systems using factored operator.
+bool
+pylith::problems::SolverLinear::_solveBlockFactored(PetscKSP ksp)
+{ // _solveBlockFactored
+  PYLITH_METHOD_BEGIN;
+
+  assert(ksp);
+
+  const size_t numRhs = _blockRhs.size();
+  if (!numRhs) {
+    PYLITH_METHOD_RETURN(true);
+  } // if
+
+  // Use factorization only if it is applied directly (no Krylov
+  // iterations and no field split).
+  PetscErrorCode err = 0;
+  PetscBool isPreonly = PETSC_FALSE, isFactor = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject)ksp, KSPPREONLY, &isPreonly);PYLITH_CHECK_ERROR(err);
+  PetscPC pc = NULL;
+  err = KSPGetPC(ksp, &pc);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompareAny((PetscObject)pc, &isFactor, PCLU, PCCHOLESKY, "");PYLITH_CHECK_ERROR(err);
+  if (!isPreonly || !isFactor) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  PetscMat factorMat = NULL;
+  err = PCFactorGetMatrix(pc, &factorMat);PYLITH_CHECK_ERROR(err);
+  PetscBool hasMatSolve = PETSC_FALSE;
+  err = MatHasOperation(factorMat, MATOP_MAT_SOLVE, &hasMatSolve);PYLITH_CHECK_ERROR(err);
+  MatFactorError factorError = MAT_FACTOR_NOERROR;
+  err = MatFactorGetError(factorMat, &factorError);PYLITH_CHECK_ERROR(err);
+  if (!hasMatSolve || factorError != MAT_FACTOR_NOERROR) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Pack right-hand sides into columns of dense matrix.
+  MPI_Comm comm = PETSC_COMM_WORLD;
+  err = PetscObjectGetComm((PetscObject)ksp, &comm);PYLITH_CHECK_ERROR(err);
+  PetscInt localSize = 0, globalSize = 0;
+  err = VecGetLocalSize(_blockRhs[0], &localSize);PYLITH_CHECK_ERROR(err);
+  err = VecGetSize(_blockRhs[0], &globalSize);PYLITH_CHECK_ERROR(err);
+
+  PetscMat rhsMat = NULL, solnMat = NULL;
+  err = MatCreateDense(comm, localSize, PETSC_DECIDE, globalSize, numRhs, NULL, &rhsMat);PYLITH_CHECK_ERROR(err);
+  err = MatCreateDense(comm, localSize, PETSC_DECIDE, globalSize, numRhs, NULL, &solnMat);PYLITH_CHECK_ERROR(err);
+
+  PetscScalar* matArray = NULL;
+  err = MatDenseGetArray(rhsMat, &matArray);PYLITH_CHECK_ERROR(err);
+  for (size_t i = 0; i < numRhs; ++i) {
+    const PetscScalar* vecArray = NULL;
+    err = VecGetArrayRead(_blockRhs[i], &vecArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iRow = 0; iRow < localSize; ++iRow) {
+      matArray[i*localSize+iRow] = vecArray[iRow];
+    } // for
+    err = VecRestoreArrayRead(_blockRhs[i], &vecArray);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = MatDenseRestoreArray(rhsMat, &matArray);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyBegin(rhsMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyEnd(rhsMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyBegin(solnMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+  err = MatAssemblyEnd(solnMat, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+  err = MatMatSolve(factorMat, rhsMat, solnMat);PYLITH_CHECK_ERROR(err);
+
+  // Unpack solutions from columns of dense matrix.
+  err = MatDenseGetArray(solnMat, &matArray);PYLITH_CHECK_ERROR(err);
+  for (size_t i = 0; i < numRhs; ++i) {
+    PetscScalar* vecArray = NULL;
+    err = VecGetArray(_blockSolns[i], &vecArray);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iRow = 0; iRow < localSize; ++iRow) {
+      vecArray[iRow] = matArray[i*localSize+iRow];
+    } // for
+    err = VecRestoreArray(_blockSolns[i], &vecArray);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = MatDenseRestoreArray(solnMat, &matArray);PYLITH_CHECK_ERROR(err);
+
+  err = MatDestroy(&rhsMat);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&solnMat);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(true);
+} // _solveBlockFactored
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -157,6 +907,8 @@ pylith::problems::SolverLinear::_initializeLogger(void)
   _logger->initialize();
   _logger->registerEvent("SoLi setup");
   _logger->registerEvent("SoLi solve");
+  _logger->registerEvent("SoLi solve block");
+  _logger->registerEvent("SoLi factor");
   _logger->registerEvent("SoLi scatter");
 
   PYLITH_METHOD_END;
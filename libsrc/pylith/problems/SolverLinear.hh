@@ -29,6 +29,9 @@
 #include "Solver.hh" // ISA Solver
 
 #include "pylith/utils/petscfwd.h" // HASA PetscKSP
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <vector> // HASA std::vector
 
 // SolverLinear ---------------------------------------------------------
 /** @brief Object for using PETSc scalable linear equation solvers
@@ -36,12 +39,32 @@
  *
  * The PETSc linear KSP solvers provide an interface to Krylov subspace
  * (KS) iterative methods and preconditioners (P).
+ *
+ * The initial guess for each solve can be formed from the solutions
+ * of previous solves, either by polynomial extrapolation or by
+ * projecting the right-hand side onto the right-hand sides of
+ * previous solves (Fischer, 1998). The projection reuses the subspace
+ * of previous solutions without additional matrix-vector products as
+ * long as the Jacobian does not change.
+ *
+ * A block of systems with the same operator and different right-hand
+ * sides, such as the Green's function impulses, can be solved together
+ * reusing a single setup of the solver.
  */
 
 class pylith::problems::SolverLinear : public Solver
 { // SolverLinear
   friend class TestSolverLinear; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum InitialGuessEnum {
+    GUESS_ZERO=0, ///< Zero initial guess.
+    GUESS_EXTRAPOLATE=1, ///< Polynomial extrapolation of previous solutions.
+    GUESS_PROJECT=2, ///< Projection onto previous solutions.
+  }; // InitialGuessEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -75,17 +98,209 @@ public :
 	     topology::Jacobian* jacobian,
 	     const topology::Field& residual);
 
+  /** Set method for forming initial guess from previous solutions.
+   *
+   * @param value Method for forming initial guess.
+   * @param historySize Number of previous solutions to use.
+   */
+  void initialGuess(const InitialGuessEnum value,
+		    const int historySize);
+
+  /** Get number of iterations in last solve.
+   *
+   * @returns Number of iterations.
+   */
+  int numIterations(void) const;
+
+  /** Get estimate of number of iterations saved in last solve by
+   * using the initial guess.
+   *
+   * The estimate is the reduction in the residual from the initial
+   * guess divided by the average reduction per iteration.
+   *
+   * @returns Number of iterations saved.
+   */
+  PylithScalar numIterationsSaved(void) const;
+
+  /** Get norm of residual at end of last solve.
+   *
+   * @returns Residual norm (as monitored by the KSP).
+   */
+  PylithScalar residualNorm(void) const;
+
+  /** Get PETSc reason the last solve converged or diverged.
+   *
+   * @returns KSPConvergedReason (negative if the solve diverged).
+   */
+  int convergedReason(void) const;
+
+  /** Add right-hand side to block of systems solved together with
+   * solveBlock().
+   *
+   * @param residual Residual field.
+   */
+  void addBlockRHS(const topology::Field& residual);
+
+  /** Get number of right-hand sides in block.
+   *
+   * @returns Number of right-hand sides.
+   */
+  int blockSize(void) const;
+
+  /** Solve the system for all right-hand sides in the block.
+   *
+   * The operator is set up (and factored for direct solvers) once for
+   * the entire block. If the preconditioner is a factorization that
+   * supports solves with multiple right-hand sides, all systems are
+   * solved with a single call to MatMatSolve(); otherwise the systems
+   * are solved one at a time with the same preconditioner.
+   *
+   * @param jacobian Jacobian of the system.
+   */
+  void solveBlock(topology::Jacobian* jacobian);
+
+  /** Get solution for right-hand side in block.
+   *
+   * @param solution Solution field.
+   * @param index Index of right-hand side in block.
+   */
+  void blockSolution(topology::Field* solution,
+		     const int index);
+
+  /// Remove all right-hand sides and solutions from block.
+  void clearBlock(void);
+
+  /** Set whether to factor the Jacobian and reuse the factorization
+   * for all solves until the Jacobian changes.
+   *
+   * The factorization uses a separate PETSc KSP with options prefix
+   * "factor_" (default is LU applied without Krylov iterations). The
+   * solver falls back to the iterative solver if the factorization
+   * fails or if it requires more memory than the maximum. The memory
+   * is estimated with a symbolic factorization before the first
+   * numeric factorization if the factorization package supports it;
+   * otherwise it is checked after the numeric factorization.
+   *
+   * @param value True if factorization should be used.
+   * @param maxMemory Maximum memory (bytes) per process for the
+   *   factorization (0 for no limit).
+   */
+  void useFactorization(const bool value,
+			const PylithScalar maxMemory =0.0);
+
+  /** Is the factorization used for solves?
+   *
+   * @returns True if factorization is used, false if using the
+   * iterative solver (not requested or fell back).
+   */
+  bool usingFactorization(void) const;
+
+  /** Get number of factorizations of the Jacobian.
+   *
+   * @returns Number of factorizations.
+   */
+  int numFactorizations(void) const;
+
+  /** Get maximum memory over processes used by last factorization.
+   *
+   * @returns Memory in bytes.
+   */
+  PylithScalar factorMemory(void) const;
+
+  /** Get time for last factorization.
+   *
+   * @returns Time in seconds.
+   */
+  PylithScalar factorTime(void) const;
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Form initial guess from previous solutions.
+   *
+   * @param solutionVec Vector for initial guess.
+   * @param rhsVec Right-hand side of system.
+   * @param jacobianMat Matrix of system.
+   * @param jacobianChanged True if matrix changed since last solve.
+   */
+  void _formInitialGuess(PetscVec solutionVec,
+			 PetscVec rhsVec,
+			 PetscMat jacobianMat,
+			 const bool jacobianChanged);
+
+  /** Add solution to history of previous solutions.
+   *
+   * @param solutionVec Solution of system.
+   * @param rhsVec Right-hand side of system.
+   */
+  void _updateHistory(PetscVec solutionVec,
+		      PetscVec rhsVec);
+
+  /// Destroy history of previous solutions.
+  void _destroyHistory(void);
+
+  /** Set operators for solve, factoring the Jacobian if necessary.
+   *
+   * @param jacobianMat Matrix of system.
+   * @param jacobianChanged True if matrix changed since last solve.
+   * @returns Solver to use.
+   */
+  PetscKSP _setOperators(PetscMat jacobianMat,
+			 const bool jacobianChanged);
+
+  /** Estimate memory for factorization of matrix from a symbolic
+   * factorization, before doing the numeric factorization.
+   *
+   * @param jacobianMat Matrix of system.
+   * @returns Maximum memory (bytes) over processes, or 0 if the
+   *   factorization package cannot provide an estimate.
+   */
+  PylithScalar _estimateFactorMemory(PetscMat jacobianMat);
+
+  /** Check whether the last solve with the factorization
+   * succeeded. If not, switch to the iterative solver.
+   *
+   * @returns True if solve succeeded, false otherwise.
+   */
+  bool _factorSucceeded(void);
+
+  /** Solve block of systems with a single solve with multiple
+   * right-hand sides using the factored operator.
+   *
+   * @param ksp Solver with operators set.
+   * @returns True if block was solved, false if the preconditioner
+   * does not support solves with multiple right-hand sides.
+   */
+  bool _solveBlockFactored(PetscKSP ksp);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscKSP _ksp; ///< PETSc KSP linear solver.
 
+  std::vector<PetscVec> _historySolns; ///< Previous solutions (most recent first).
+  std::vector<PetscVec> _historyRhs; ///< Right-hand sides of previous solutions.
+  PetscVec _guessWork; ///< Work vector for initial guess.
+  InitialGuessEnum _initialGuess; ///< Method for forming initial guess.
+  int _historySize; ///< Maximum number of previous solutions.
+  int _numIterations; ///< Number of iterations in last solve.
+  PylithScalar _numIterationsSaved; ///< Estimate of iterations saved in last solve.
+  PylithScalar _residualNorm; ///< Residual norm at end of last solve.
+  int _convergedReason; ///< PETSc converged reason for last solve.
+
+  std::vector<PetscVec> _blockRhs; ///< Right-hand sides of block of systems.
+  std::vector<PetscVec> _blockSolns; ///< Solutions of block of systems.
+
+  PetscKSP _kspFactor; ///< PETSc KSP for solves with factored Jacobian.
+  PylithScalar _factorMaxMemory; ///< Maximum memory (bytes) for factorization.
+  PylithScalar _factorMemory; ///< Memory (bytes) used by last factorization.
+  PylithScalar _factorTime; ///< Time (s) for last factorization.
+  int _numFactorizations; ///< Number of factorizations.
+  bool _useFactorization; ///< Use factorization in solves.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
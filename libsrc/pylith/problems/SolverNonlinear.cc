@@ -33,6 +33,10 @@
 
 #include <petscsnes.h> // USES PetscSNES
 
+#include <algorithm> // USES std::min()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 // KLUDGE, Fixes issue with PetscIsInfOrNanReal and include cmath
 // instead of math.h.
 #define isnan std::isnan // TEMPORARY
@@ -52,7 +56,25 @@ struct PetscSNESLineSearch_BT {
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverNonlinear::SolverNonlinear(void) :
-  _snes(0)
+  _snes(0),
+  _lagConvergenceThreshold(0.5),
+  _lagStiffnessThreshold(0.2),
+  _fnormPrev(-1.0),
+  _fnormCur(-1.0),
+  _maxLag(0),
+  _jacobianAge(-1),
+  _numJacobianReforms(0),
+  _numJacobianReuses(0),
+  _forceJacobian(false),
+  _lineSearchStepSum(0.0),
+  _lineSearchStepMin(1.0),
+  _numResidualEvals(0),
+  _numLineSearches(0),
+  _numLineSearchEvals(0),
+  _inLineSearch(false),
+  _numIterations(0),
+  _numLinearIterations(0),
+  _convergedReason(0)
 { // constructor
 } // constructor
 
@@ -100,17 +122,25 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
 
   const topology::Field& residual = fields.get("residual");
   const PetscVec residualVec = residual.globalVector();
-  err = SNESSetFunction(_snes, residualVec, reformResidual, (void*) formulation);
+  err = SNESSetFunction(_snes, residualVec, reformResidual, (void*) this);
   PYLITH_CHECK_ERROR(err);
+  _inLineSearch = false;
 
-  err = SNESSetJacobian(_snes, jacobian.matrix(), _jacobianPC, reformJacobian, (void*) formulation);PYLITH_CHECK_ERROR(err);
+  err = SNESSetJacobian(_snes, jacobian.matrix(), _jacobianPC, reformJacobian, (void*) this);PYLITH_CHECK_ERROR(err);
+  // Register the lagging monitor exactly once; options processed
+  // below may add user monitors.
+  err = SNESMonitorCancel(_snes);PYLITH_CHECK_ERROR(err);
+  err = SNESMonitorSet(_snes, _monitorLag, (void*) this, NULL);PYLITH_CHECK_ERROR(err);
+  _jacobianAge = -1;
+  _fnormPrev = -1.0;
+  _fnormCur = -1.0;
 
   // Set default line search type to SNESSHELL and use our custom line search
   PetscSNESLineSearch ls;
   err = SNESGetLineSearch(_snes, &ls);PYLITH_CHECK_ERROR(err);
   err = SNESLineSearchSetType(ls, SNESSHELL);PYLITH_CHECK_ERROR(err);
   err = SNESLineSearchSetOrder(ls, SNES_LINESEARCH_ORDER_CUBIC);PYLITH_CHECK_ERROR(err);
-  err = SNESLineSearchShellSetUserFunc(ls, lineSearch, (void*) formulation);PYLITH_CHECK_ERROR(err);
+  err = SNESLineSearchShellSetUserFunc(ls, lineSearch, (void*) this);PYLITH_CHECK_ERROR(err);
 
   // Get SNES options and allow the user to override the line search type
   err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
@@ -125,7 +155,7 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
   } // if
 
   if (!_skipNullSpaceCreation) {
-    _createNullSpace(fields);
+    _createNullSpace(fields, jacobian);
   } // if
 
   PYLITH_METHOD_END;
@@ -149,7 +179,41 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   PetscErrorCode err = 0;
   const PetscVec solutionVec = solution->globalVector();
 
+  // Keep the initial guess so a failed solve with a lagged Jacobian
+  // can be retried from the same starting point.
+  PetscVec initialGuessVec = NULL;
+  if (_maxLag > 0) {
+    err = VecDuplicate(solutionVec, &initialGuessVec);PYLITH_CHECK_ERROR(err);
+    err = VecCopy(solutionVec, initialGuessVec);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  const int numReusesStart = _numJacobianReuses;
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+  PetscInt numIterations = 0;
+  PetscInt numLinearIterations = 0;
+  err = SNESGetIterationNumber(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+  err = SNESGetLinearSolveIterations(_snes, &numLinearIterations);PYLITH_CHECK_ERROR(err);
+  _numIterations = numIterations;
+  _numLinearIterations = numLinearIterations;
+
+  // If solve with lagged Jacobian failed, try again with a new
+  // Jacobian in every iteration.
+  SNESConvergedReason reason = SNES_CONVERGED_ITERATING;
+  err = SNESGetConvergedReason(_snes, &reason);PYLITH_CHECK_ERROR(err);
+  if (reason < 0 && _numJacobianReuses > numReusesStart) {
+    assert(initialGuessVec);
+    err = VecCopy(initialGuessVec, solutionVec);PYLITH_CHECK_ERROR(err);
+    _forceJacobian = true;
+    err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+    _forceJacobian = false;
+    err = SNESGetIterationNumber(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+    err = SNESGetLinearSolveIterations(_snes, &numLinearIterations);PYLITH_CHECK_ERROR(err);
+    _numIterations += numIterations;
+    _numLinearIterations += numLinearIterations;
+    err = SNESGetConvergedReason(_snes, &reason);PYLITH_CHECK_ERROR(err);
+  } // if
+  _convergedReason = reason;
+  err = VecDestroy(&initialGuessVec);PYLITH_CHECK_ERROR(err);
   
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -177,9 +241,16 @@ pylith::problems::SolverNonlinear::reformResidual(PetscSNES snes,
   PYLITH_METHOD_BEGIN;
 
   assert(context);
-  Formulation* formulation = (Formulation*) context;
+  SolverNonlinear* solver = (SolverNonlinear*) context;
+  assert(solver);
+  Formulation* formulation = solver->_formulation;
   assert(formulation);
 
+  ++solver->_numResidualEvals;
+  if (solver->_inLineSearch) {
+    ++solver->_numLineSearchEvals;
+  } // if
+
   // Make sure we have an admissible Lagrange multiplier (\lambda)
   VecLockPop(tmpSolutionVec); // :KLUDGE: TEMPORARY
   formulation->constrainSolnSpace(&tmpSolutionVec);
@@ -204,20 +275,260 @@ pylith::problems::SolverNonlinear::reformJacobian(PetscSNES snes,
   PYLITH_METHOD_BEGIN;
 
   assert(context);
-  Formulation* formulation = (Formulation*) context;
+  SolverNonlinear* solver = (SolverNonlinear*) context;
+  assert(solver);
+  Formulation* formulation = solver->_formulation;
   assert(formulation);
+  assert(solver->_logger);
+
+  if (solver->_reuseJacobian(snes)) {
+    const int reuseEvent = solver->_logger->eventId("SoNl Jacobian reuse");
+    solver->_logger->eventBegin(reuseEvent);
+    ++solver->_numJacobianReuses;
+    solver->_logger->eventEnd(reuseEvent);
+    PYLITH_METHOD_RETURN(0);
+  } // if
+
+  const int reformEvent = solver->_logger->eventId("SoNl Jacobian reform");
+  solver->_logger->eventBegin(reformEvent);
 
   formulation->reformJacobian(&tmpSolutionVec);
+  solver->_jacobianAge = 0;
+  ++solver->_numJacobianReforms;
+
+  solver->_logger->eventEnd(reformEvent);
 
   PYLITH_METHOD_RETURN(0);
 } // reformJacobian
 
+// ----------------------------------------------------------------------
+// Set policy for lagging the Jacobian.
+void
+pylith::problems::SolverNonlinear::lagJacobian(const int maxLag,
+					       const PylithScalar convergenceThreshold,
+					       const PylithScalar stiffnessThreshold)
+{ // lagJacobian
+  PYLITH_METHOD_BEGIN;
+
+  if (maxLag < 0) {
+    std::ostringstream msg;
+    msg << "Maximum lag for Jacobian (" << maxLag << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (convergenceThreshold <= 0.0 || convergenceThreshold > 1.0) {
+    std::ostringstream msg;
+    msg << "Convergence threshold for lagging Jacobian (" << convergenceThreshold << ") must be in (0, 1].";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (stiffnessThreshold < 0.0) {
+    std::ostringstream msg;
+    msg << "Stiffness threshold for lagging Jacobian (" << stiffnessThreshold << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _maxLag = maxLag;
+  _lagConvergenceThreshold = convergenceThreshold;
+  _lagStiffnessThreshold = stiffnessThreshold;
+
+  PYLITH_METHOD_END;
+} // lagJacobian
+
+// ----------------------------------------------------------------------
+// Mark the Jacobian as out of date.
+void
+pylith::problems::SolverNonlinear::expireJacobian(void)
+{ // expireJacobian
+  _jacobianAge = -1;
+} // expireJacobian
+
+// ----------------------------------------------------------------------
+// Mark the Jacobian as current.
+void
+pylith::problems::SolverNonlinear::resetJacobianAge(void)
+{ // resetJacobianAge
+  _jacobianAge = 0;
+} // resetJacobianAge
+
+// ----------------------------------------------------------------------
+// Get number of times the Jacobian has been reformed.
+int
+pylith::problems::SolverNonlinear::numJacobianReforms(void) const
+{ // numJacobianReforms
+  return _numJacobianReforms;
+} // numJacobianReforms
+
+// ----------------------------------------------------------------------
+// Get number of times the Jacobian has been reused.
+int
+pylith::problems::SolverNonlinear::numJacobianReuses(void) const
+{ // numJacobianReuses
+  return _numJacobianReuses;
+} // numJacobianReuses
+
+// ----------------------------------------------------------------------
+// Get number of residual evaluations.
+int
+pylith::problems::SolverNonlinear::numResidualEvals(void) const
+{ // numResidualEvals
+  return _numResidualEvals;
+} // numResidualEvals
+
+// ----------------------------------------------------------------------
+// Get number of line searches.
+int
+pylith::problems::SolverNonlinear::numLineSearches(void) const
+{ // numLineSearches
+  return _numLineSearches;
+} // numLineSearches
+
+// ----------------------------------------------------------------------
+// Get number of residual evaluations in line searches.
+int
+pylith::problems::SolverNonlinear::numLineSearchEvals(void) const
+{ // numLineSearchEvals
+  return _numLineSearchEvals;
+} // numLineSearchEvals
+
+// ----------------------------------------------------------------------
+// Get mean step length selected by line searches.
+PylithScalar
+pylith::problems::SolverNonlinear::lineSearchMeanStep(void) const
+{ // lineSearchMeanStep
+  return (_numLineSearches > 0) ? _lineSearchStepSum / _numLineSearches : 0.0;
+} // lineSearchMeanStep
+
+// ----------------------------------------------------------------------
+// Get minimum step length selected by line searches.
+PylithScalar
+pylith::problems::SolverNonlinear::lineSearchMinStep(void) const
+{ // lineSearchMinStep
+  return (_numLineSearches > 0) ? _lineSearchStepMin : 0.0;
+} // lineSearchMinStep
+
+// ----------------------------------------------------------------------
+// Get number of Newton iterations in last solve.
+int
+pylith::problems::SolverNonlinear::numIterations(void) const
+{ // numIterations
+  return _numIterations;
+} // numIterations
+
+// ----------------------------------------------------------------------
+// Get number of linear solver iterations in last solve.
+int
+pylith::problems::SolverNonlinear::numLinearIterations(void) const
+{ // numLinearIterations
+  return _numLinearIterations;
+} // numLinearIterations
+
+// ----------------------------------------------------------------------
+// Get norm of residual at end of last solve.
+PylithScalar
+pylith::problems::SolverNonlinear::residualNorm(void) const
+{ // residualNorm
+  return (_fnormCur > 0.0) ? _fnormCur : 0.0;
+} // residualNorm
+
+// ----------------------------------------------------------------------
+// Get PETSc reason the last solve converged or diverged.
+int
+pylith::problems::SolverNonlinear::convergedReason(void) const
+{ // convergedReason
+  return _convergedReason;
+} // convergedReason
+
+// ----------------------------------------------------------------------
+// Determine whether to reuse the current Jacobian.
+bool
+pylith::problems::SolverNonlinear::_reuseJacobian(PetscSNES snes)
+{ // _reuseJacobian
+  PYLITH_METHOD_BEGIN;
+
+  assert(_formulation);
+
+  if (_maxLag <= 0 || _forceJacobian || _jacobianAge < 0 || _jacobianAge >= _maxLag) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Reform if convergence degraded in the last iteration. The residual
+  // norms are global, so all processes reach the same decision.
+  PetscErrorCode err = 0;
+  PetscInt its = 0;
+  err = SNESGetIterationNumber(snes, &its);PYLITH_CHECK_ERROR(err);
+  if (its > 0 && _fnormPrev > 0.0 && _fnormCur > _lagConvergenceThreshold * _fnormPrev) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  // Reform if the materials report a large change in stiffness.
+  MPI_Comm comm = PETSC_COMM_WORLD;
+  err = PetscObjectGetComm((PetscObject) snes, &comm);PYLITH_CHECK_ERROR(err);
+  PylithScalar changeLocal = _formulation->stiffnessChange();
+  PylithScalar change = changeLocal;
+  err = MPI_Allreduce(&changeLocal, &change, 1, MPIU_SCALAR, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+  if (change > _lagStiffnessThreshold) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  ++_jacobianAge;
+
+  PYLITH_METHOD_RETURN(true);
+} // _reuseJacobian
+
+// ----------------------------------------------------------------------
+// PETSc SNES monitor recording residual norms.
+PetscErrorCode
+pylith::problems::SolverNonlinear::_monitorLag(PetscSNES snes,
+					       PetscInt its,
+					       PetscReal fnorm,
+					       void* context)
+{ // _monitorLag
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+  SolverNonlinear* solver = (SolverNonlinear*) context;
+  solver->_fnormPrev = (its > 0) ? solver->_fnormCur : -1.0;
+  solver->_fnormCur = fnorm;
+
+  PYLITH_METHOD_RETURN(0);
+} // _monitorLag
+
 // ----------------------------------------------------------------------
 // Generic C interface for customized PETSc line search.
 PetscErrorCode
 pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
 					      void* lsctx)
 { // lineSearch
+  PetscErrorCode ierr;
+  PetscReal      lambda = 1.0;
+
+  PetscFunctionBegin;
+  assert(lsctx);
+  SolverNonlinear* solver = (SolverNonlinear*) lsctx;
+  assert(solver->_logger);
+
+  const int searchEvent = solver->_logger->eventId("SoNl line search");
+  solver->_logger->eventBegin(searchEvent);
+
+  solver->_inLineSearch = true;
+  ierr = _lineSearchBT(linesearch, solver->_formulation);CHKERRQ(ierr);
+  solver->_inLineSearch = false;
+
+  ierr = SNESLineSearchGetLambda(linesearch, &lambda);CHKERRQ(ierr);
+  solver->_lineSearchStepMin = (solver->_numLineSearches > 0) ? std::min(solver->_lineSearchStepMin, PylithScalar(lambda)) : lambda;
+  solver->_lineSearchStepSum += lambda;
+  ++solver->_numLineSearches;
+
+  solver->_logger->eventEnd(searchEvent);
+
+  PetscFunctionReturn(0);
+} // lineSearch
+
+// ----------------------------------------------------------------------
+// Backtracking line search.
+PetscErrorCode
+pylith::problems::SolverNonlinear::_lineSearchBT(PetscSNESLineSearch linesearch,
+						 Formulation* formulation)
+{ // _lineSearchBT
   // Note that for line search purposes we work with with the related
   // minimization problem:
   // min  z(x):  R^n -> R,
@@ -431,8 +742,6 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
           }
 #if defined(PYLITH_CUSTOM_LINESEARCH)
 #if 0 // DEBUGGING
-	  assert(lsctx);
-	  Formulation* formulation = (Formulation*) lsctx;
 	  assert(formulation);
 	  formulation->printState(&w, &g, &x, &y);
 	  std::cerr << "WARNING: Line search diverged ... continuing nonlinear iterations anyway in hopes that solution will converge anyway."
@@ -544,7 +853,11 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
     }
   }
 #if defined(PYLITH_CUSTOM_LINESEARCH)
-  if (true) {
+  // The residual callback constrains the trial solution in place, so
+  // the last residual is consistent with W unless constraining the
+  // solution space adjusted it; only then iterate the constraint.
+  assert(formulation);
+  if (_lineSearchNeedsResidual(changed_y, changed_w, objective != NULL, formulation->solnAdjusted())) {
 #else // ORIGINAL
   if (changed_y || changed_w || objective) { /* recompute the function norm if the step has changed or the objective isn't the norm */
 #endif
@@ -571,7 +884,19 @@ pylith::problems::SolverNonlinear::lineSearch(PetscSNESLineSearch linesearch,
   ierr = SNESLineSearchSetNorms(linesearch, xnorm, gnorm, ynorm);CHKERRQ(ierr);
 
   PetscFunctionReturn(0);
-} // lineSearch
+} // _lineSearchBT
+
+// ----------------------------------------------------------------------
+// Check whether the line search must reevaluate the residual at the
+// accepted step.
+bool
+pylith::problems::SolverNonlinear::_lineSearchNeedsResidual(const bool changedStep,
+							    const bool changedSoln,
+							    const bool hasObjective,
+							    const bool solnAdjusted)
+{ // _lineSearchNeedsResidual
+  return changedStep || changedSoln || hasObjective || solnAdjusted;
+} // _lineSearchNeedsResidual
 
 // ----------------------------------------------------------------------
 // Generic C interface for customized PETSc initial guess.
@@ -600,6 +925,9 @@ pylith::problems::SolverNonlinear::_initializeLogger(void)
   _logger->registerEvent("SoNl setup");
   _logger->registerEvent("SoNl solve");
   _logger->registerEvent("SoNl scatter");
+  _logger->registerEvent("SoNl Jacobian reform");
+  _logger->registerEvent("SoNl Jacobian reuse");
+  _logger->registerEvent("SoNl line search");
 
   PYLITH_METHOD_END;
 } // initializeLogger
@@ -38,6 +38,12 @@
  *
  * The PETSc nonlinear solvers provide an interface to Newton-based
  * methods for solving nonlinear equations.
+ *
+ * The Jacobian (and thereby the preconditioner) may be lagged across
+ * Newton iterations and time steps. It is reformed when it reaches
+ * the maximum lag, when the reduction in the residual norm in the
+ * last iteration degrades past a threshold, or when the materials
+ * estimate a change in stiffness larger than a threshold.
  */
 class pylith::problems::SolverNonlinear : public Solver
 { // SolverNonlinear
@@ -76,6 +82,95 @@ public :
 	     topology::Jacobian* jacobian,
 	     const topology::Field& residual);
 
+  /** Set policy for lagging the Jacobian.
+   *
+   * @param maxLag Maximum number of Newton iterations in which the
+   *   Jacobian is reused (0 reforms Jacobian in every iteration).
+   * @param convergenceThreshold Reform Jacobian if the ratio of the
+   *   residual norms in consecutive iterations exceeds this value.
+   * @param stiffnessThreshold Reform Jacobian if the relative change
+   *   in stiffness estimated by the materials exceeds this value.
+   */
+  void lagJacobian(const int maxLag,
+		   const PylithScalar convergenceThreshold,
+		   const PylithScalar stiffnessThreshold);
+
+  /** Mark the Jacobian as out of date, so that it is reformed in the
+   * next Newton iteration regardless of the lagging policy.
+   */
+  void expireJacobian(void);
+
+  /** Mark the Jacobian as current after it has been reformed outside
+   * of the nonlinear solve (e.g., before advancing the time step).
+   */
+  void resetJacobianAge(void);
+
+  /** Get number of times the Jacobian has been reformed.
+   *
+   * @returns Number of Jacobian reformations.
+   */
+  int numJacobianReforms(void) const;
+
+  /** Get number of times the Jacobian has been reused.
+   *
+   * @returns Number of Newton iterations with lagged Jacobian.
+   */
+  int numJacobianReuses(void) const;
+
+  /** Get number of residual evaluations.
+   *
+   * @returns Number of residual evaluations.
+   */
+  int numResidualEvals(void) const;
+
+  /** Get number of line searches.
+   *
+   * @returns Number of line searches.
+   */
+  int numLineSearches(void) const;
+
+  /** Get number of residual evaluations in line searches.
+   *
+   * @returns Number of residual evaluations in line searches.
+   */
+  int numLineSearchEvals(void) const;
+
+  /** Get mean step length selected by line searches.
+   *
+   * @returns Mean step length.
+   */
+  PylithScalar lineSearchMeanStep(void) const;
+
+  /** Get minimum step length selected by line searches.
+   *
+   * @returns Minimum step length.
+   */
+  PylithScalar lineSearchMinStep(void) const;
+
+  /** Get number of Newton iterations in last solve.
+   *
+   * @returns Number of iterations.
+   */
+  int numIterations(void) const;
+
+  /** Get number of linear solver iterations in last solve.
+   *
+   * @returns Number of iterations (total over Newton iterations).
+   */
+  int numLinearIterations(void) const;
+
+  /** Get norm of residual at end of last solve.
+   *
+   * @returns Residual norm.
+   */
+  PylithScalar residualNorm(void) const;
+
+  /** Get PETSc reason the last solve converged or diverged.
+   *
+   * @returns SNESConvergedReason (negative if the solve diverged).
+   */
+  int convergedReason(void) const;
+
   /** Generic C interface for reformResidual for integration with
    * PETSc SNES solvers.
    *
@@ -111,7 +206,7 @@ public :
   /** Generic C interface for customized PETSc line search.
    *
    * @param linesearch PETSc line search.
-   * @param lsctx Optional context for line search (not used here).
+   * @param lsctx Context for line search (solver).
    * @returns PETSc error code.
    */
   static
@@ -136,11 +231,83 @@ private :
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Determine whether to reuse the current Jacobian.
+   *
+   * @param snes PETSc SNES solver.
+   * @returns True if Jacobian should be reused, false otherwise.
+   */
+  bool _reuseJacobian(PetscSNES snes);
+
+  /** PETSc SNES monitor recording residual norms for lagging the
+   * Jacobian.
+   *
+   * @param snes PETSc SNES solver.
+   * @param its Iteration number.
+   * @param fnorm Norm of residual.
+   * @param context Solver.
+   * @returns PETSc error code.
+   */
+  static
+  PetscErrorCode _monitorLag(PetscSNES snes,
+			     PetscInt its,
+			     PetscReal fnorm,
+			     void* context);
+
+  /** Backtracking line search.
+   *
+   * @param linesearch PETSc line search.
+   * @param formulation Formulation for problem.
+   * @returns PETSc error code.
+   */
+  static
+  PetscErrorCode _lineSearchBT(PetscSNESLineSearch linesearch,
+			       Formulation* formulation);
+
+  /** Check whether the line search must reevaluate the residual at
+   * the accepted step. The last residual evaluation is consistent
+   * with the accepted step unless the postcheck changed the step or
+   * solution, the line search uses an objective function, or
+   * constraining the solution space adjusted the trial solution.
+   *
+   * @param changedStep True if postcheck changed the search direction.
+   * @param changedSoln True if postcheck changed the new solution.
+   * @param hasObjective True if SNES has an objective function.
+   * @param solnAdjusted True if constraining the solution space
+   *   changed the last trial solution.
+   * @returns True if residual must be reevaluated, false otherwise.
+   */
+  static
+  bool _lineSearchNeedsResidual(const bool changedStep,
+				const bool changedSoln,
+				const bool hasObjective,
+				const bool solnAdjusted);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscSNES _snes; ///< PETSc SNES nonlinear solver.
 
+  PylithScalar _lagConvergenceThreshold; ///< Maximum ratio of residual norms for lagging Jacobian.
+  PylithScalar _lagStiffnessThreshold; ///< Maximum change in stiffness for lagging Jacobian.
+  PylithScalar _fnormPrev; ///< Residual norm in previous iteration.
+  PylithScalar _fnormCur; ///< Residual norm in current iteration.
+  int _maxLag; ///< Maximum number of iterations with lagged Jacobian.
+  int _jacobianAge; ///< Number of iterations since Jacobian was formed (-1 if not formed).
+  int _numJacobianReforms; ///< Number of times Jacobian was reformed.
+  int _numJacobianReuses; ///< Number of times Jacobian was reused.
+  bool _forceJacobian; ///< Reform Jacobian in every iteration (retry after failure).
+
+  PylithScalar _lineSearchStepSum; ///< Sum of step lengths selected by line searches.
+  PylithScalar _lineSearchStepMin; ///< Minimum step length selected by line searches.
+  int _numResidualEvals; ///< Number of residual evaluations.
+  int _numLineSearches; ///< Number of line searches.
+  int _numLineSearchEvals; ///< Number of residual evaluations in line searches.
+  bool _inLineSearch; ///< True if evaluating residual within line search.
+
+  int _numIterations; ///< Number of Newton iterations in last solve.
+  int _numLinearIterations; ///< Number of linear iterations in last solve.
+  int _convergedReason; ///< PETSc converged reason for last solve.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
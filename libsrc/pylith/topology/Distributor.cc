@@ -57,6 +57,7 @@ pylith::topology::Distributor::distribute(topology::Mesh* const newMesh,
   
   assert(newMesh);
   newMesh->coordsys(origMesh.coordsys());
+  newMesh->topologyCheck(origMesh.topologyCheck());
 
   journal::info_t info("mesh_distributor");
   const int commRank = origMesh.commRank();
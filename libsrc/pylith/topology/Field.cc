@@ -23,12 +23,14 @@
 #include "Mesh.hh" // USES Mesh
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/EventTracer.hh" // USES EventTracer
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <iostream> // USES std::cout
+#include <algorithm> // USES std::swap
 
 // ----------------------------------------------------------------------
 // Default constructor.
@@ -36,7 +38,8 @@ pylith::topology::Field::Field(const Mesh& mesh) :
   _mesh(mesh),
   _dm(NULL),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _layoutShared(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -69,7 +72,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _layoutShared(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -94,7 +98,8 @@ pylith::topology::Field::Field(const Mesh& mesh,
   _mesh(mesh),
   _dm(dm),
   _globalVec(NULL),
-  _localVec(NULL)
+  _localVec(NULL),
+  _layoutShared(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
@@ -128,6 +133,7 @@ pylith::topology::Field::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   clear();
+  _releaseLayout(_dm);
   PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
 
   PYLITH_METHOD_END;
@@ -236,6 +242,7 @@ pylith::topology::Field::setupSolnChart(void)
   PYLITH_METHOD_BEGIN;
 
   assert(_dm);
+  _unshareLayout();
 
   // :TODO: Update this to use discretization information after removing FIAT.
 
@@ -279,6 +286,7 @@ void
   PYLITH_METHOD_BEGIN;
 
   assert(_dm);
+  _unshareLayout();
 
   // :TODO: Update this to use discretization information after removing FIAT.
 
@@ -318,6 +326,7 @@ pylith::topology::Field::newSection(const int_array& points,
   // Clear memory
   clear();
   assert(_dm);
+  _unshareLayout();
   if (fiberDim < 0) {
     std::ostringstream msg;
     msg << "Fiber dimension (" << fiberDim << ") for field '" << _metadata.label
@@ -366,6 +375,7 @@ pylith::topology::Field::newSection(const PetscInt *points,
   // Clear memory
   clear();
   assert(_dm);
+  _unshareLayout();
   if (fiberDim < 0) {
     std::ostringstream msg;
     msg << "Fiber dimension (" << fiberDim << ") for field '" << _metadata.label
@@ -446,6 +456,7 @@ pylith::topology::Field::newSection(const PetscInt pStart,
 
   // Changing this because cells/vertices are numbered differently in the new scheme
   assert(_dm);
+  _unshareLayout();
   PetscSection s = NULL;
   PetscErrorCode err;
 
@@ -471,6 +482,7 @@ pylith::topology::Field::newSection(const Field& src,
   // Clear memory
   clear();
   assert(_dm);assert(src._dm);
+  _unshareLayout();
 
   if (fiberDim < 0) {
     std::ostringstream msg;
@@ -511,14 +523,19 @@ pylith::topology::Field::cloneSection(const Field& src)
   _metadata = src._metadata;
   label(origLabel.c_str());
 
-  PetscSection section = src.localSection();
-  PetscSection newSection = NULL;
   PetscErrorCode err;
 
-  assert(_dm);
-  err = PetscSectionClone(section, &newSection);PYLITH_CHECK_ERROR(err);
-  err = DMSetDefaultSection(_dm, newSection);PYLITH_CHECK_ERROR(err);
-  err = PetscSectionDestroy(&newSection);PYLITH_CHECK_ERROR(err);
+  // Share DM (and its local and global sections) with source field.
+  assert(src._dm);
+  if (_dm != src._dm) {
+    _releaseLayout(_dm);
+    err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+    _dm = src._dm;
+    err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+  } // if
+  _layoutShared = true;
+  src._layoutShared = true;
+  src._holdsLayout(_dm);
 
   assert(!_globalVec);
   err = DMCreateGlobalVector(_dm, &_globalVec);PYLITH_CHECK_ERROR(err);
@@ -540,17 +557,13 @@ pylith::topology::Field::cloneSection(const Field& src)
     sinfo.dm = s_iter->second.dm;
     err = PetscObjectReference((PetscObject) sinfo.dm);PYLITH_CHECK_ERROR(err);
 
-    // Create vector using sizes from source section
-    PetscInt vecGlobalSize = 0, vecGlobalSize2 = 0;
-    err = VecGetSize(s_iter->second.vector, &vecGlobalSize);PYLITH_CHECK_ERROR(err);
-    err = VecGetSize(_globalVec, &vecGlobalSize2);PYLITH_CHECK_ERROR(err);      
-    if (vecGlobalSize != vecGlobalSize2) {
-      err = DMCreateGlobalVector(sinfo.dm, &sinfo.vector);PYLITH_CHECK_ERROR(err);
-    } else {
+    // Reuse global vector if scatter has the same layout; otherwise
+    // create vector when it is first used.
+    if (sinfo.dm == _dm) {
       sinfo.vector = _globalVec;
       err = PetscObjectReference((PetscObject) sinfo.vector);PYLITH_CHECK_ERROR(err);
-    } // if/else
-    err = PetscObjectSetName((PetscObject)sinfo.vector, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+      err = PetscObjectSetName((PetscObject)sinfo.vector, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+    } // if
   } // for
 
   // Reuse subfields in clone
@@ -580,6 +593,7 @@ pylith::topology::Field::clear(void)
   
   const scatter_map_type::const_iterator scattersEnd = _scatters.end();
   for (scatter_map_type::iterator s_iter=_scatters.begin(); s_iter != scattersEnd; ++s_iter) {
+    _releaseLayout(s_iter->second.dm);
     err = DMDestroy(&s_iter->second.dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&s_iter->second.vector);PYLITH_CHECK_ERROR(err);
   } // for
@@ -692,11 +706,17 @@ pylith::topology::Field::complete(void)
   // Not sure if DMLocalToLocal() would work
   PetscErrorCode err;
 
+  utils::EventTracer::spanBegin("Field complete");
   err = VecSet(_globalVec, 0.0);PYLITH_CHECK_ERROR(err);
   err = DMLocalToGlobalBegin(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
+  utils::EventTracer::spanBegin("MPI wait");
   err = DMLocalToGlobalEnd(_dm, _localVec, ADD_VALUES, _globalVec);PYLITH_CHECK_ERROR(err);
+  utils::EventTracer::spanEnd("MPI wait");
   err = DMGlobalToLocalBegin(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+  utils::EventTracer::spanBegin("MPI wait");
   err = DMGlobalToLocalEnd(_dm, _globalVec, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+  utils::EventTracer::spanEnd("MPI wait");
+  utils::EventTracer::spanEnd("Field complete");
 
   PYLITH_METHOD_END;
 } // complete
@@ -742,6 +762,81 @@ pylith::topology::Field::copy(const Field& field)
   PYLITH_METHOD_END;
 } // copy
 
+// ----------------------------------------------------------------------
+// Exchange values with another field with the same layout.
+void
+pylith::topology::Field::swapValues(Field& field)
+{ // swapValues
+  PYLITH_METHOD_BEGIN;
+
+  assert(_localVec && field._localVec);
+  assert(_globalVec && field._globalVec);
+
+  // Check compatibility of sections
+  const int srcSize = field.chartSize();
+  const int dstSize = chartSize();
+  PetscInt srcLocalSize = 0, dstLocalSize = 0, srcGlobalSize = 0, dstGlobalSize = 0;
+  PetscErrorCode err;
+  err = VecGetLocalSize(field._localVec, &srcLocalSize);PYLITH_CHECK_ERROR(err);
+  err = VecGetLocalSize(_localVec, &dstLocalSize);PYLITH_CHECK_ERROR(err);
+  err = VecGetLocalSize(field._globalVec, &srcGlobalSize);PYLITH_CHECK_ERROR(err);
+  err = VecGetLocalSize(_globalVec, &dstGlobalSize);PYLITH_CHECK_ERROR(err);
+  if (field.spaceDim() != spaceDim() ||
+      field._metadata.scale != _metadata.scale ||
+      srcSize != dstSize ||
+      srcLocalSize != dstLocalSize ||
+      srcGlobalSize != dstGlobalSize) {
+    std::ostringstream msg;
+
+    msg << "Cannot swap values of section '" << field._metadata.label 
+	<< "' with section '" << _metadata.label
+	<< "'. Sections are incompatible.\n"
+	<< "  Source section:\n"
+	<< "    space dim: " << field.spaceDim() << "\n"
+	<< "    scale: " << field._metadata.scale << "\n"
+	<< "    size: " << srcSize << "\n"
+	<< "    local vector size: " << srcLocalSize << "\n"
+	<< "  Destination section:\n"
+	<< "    space dim: " << spaceDim() << "\n"
+	<< "    scale: " << _metadata.scale << "\n"
+	<< "    size: " << dstSize << "\n"
+	<< "    local vector size: " << dstLocalSize;
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PetscVec globalVecOld = _globalVec;
+  PetscVec fieldGlobalVecOld = field._globalVec;
+  std::swap(_localVec, field._localVec);
+  std::swap(_globalVec, field._globalVec);
+
+  // Scatter vectors that alias the global vector must follow it, or
+  // they would refer to the values of the other field.
+  const scatter_map_type::const_iterator scattersEnd = _scatters.end();
+  for (scatter_map_type::iterator s_iter=_scatters.begin(); s_iter != scattersEnd; ++s_iter) {
+    if (s_iter->second.vector && s_iter->second.vector == globalVecOld) {
+      err = VecDestroy(&s_iter->second.vector);PYLITH_CHECK_ERROR(err);
+      s_iter->second.vector = _globalVec;
+      err = PetscObjectReference((PetscObject) s_iter->second.vector);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+  const scatter_map_type::const_iterator fieldScattersEnd = field._scatters.end();
+  for (scatter_map_type::iterator s_iter=field._scatters.begin(); s_iter != fieldScattersEnd; ++s_iter) {
+    if (s_iter->second.vector && s_iter->second.vector == fieldGlobalVecOld) {
+      err = VecDestroy(&s_iter->second.vector);PYLITH_CHECK_ERROR(err);
+      s_iter->second.vector = field._globalVec;
+      err = PetscObjectReference((PetscObject) s_iter->second.vector);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+
+  // Vectors carry the name of the field that owns them.
+  err = PetscObjectSetName((PetscObject) _localVec, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) _globalVec, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) field._localVec, field._metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+  err = PetscObjectSetName((PetscObject) field._globalVec, field._metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // swapValues
+
 // ----------------------------------------------------------------------
 // Add two fields, storing the result in one of the fields.
 pylith::topology::Field&
@@ -897,10 +992,11 @@ pylith::topology::Field::createScatter(const Mesh& mesh,
   const bool createScatterOk = true;
   ScatterInfo& sinfo = _getScatter(context, createScatterOk);
   if (sinfo.dm) {
-    assert(sinfo.vector);
+    // Vector may be created when it is first used (see cloneSection()).
     PYLITH_METHOD_END;
   } // if
 
+  _releaseLayout(sinfo.dm);
   err = DMDestroy(&sinfo.dm);PYLITH_CHECK_ERROR(err);
   sinfo.dm = _dm;
   err = PetscObjectReference((PetscObject) sinfo.dm);PYLITH_CHECK_ERROR(err);
@@ -931,13 +1027,14 @@ pylith::topology::Field::createScatterWithBC(const Mesh& mesh,
   const bool createScatterOk = true;
   ScatterInfo& sinfo = _getScatter(context, createScatterOk);
   if (sinfo.dm) {
-    assert(sinfo.vector);
+    // Vector may be created when it is first used (see cloneSection()).
     PYLITH_METHOD_END;
   } // if
 
   PetscSection section = NULL, newSection = NULL, gsection = NULL;
   PetscSF sf = NULL;
 
+  _releaseLayout(sinfo.dm);
   err = DMDestroy(&sinfo.dm);PYLITH_CHECK_ERROR(err);
   err = DMClone(_dm, &sinfo.dm);PYLITH_CHECK_ERROR(err);
   err = DMGetDefaultSection(_dm, &section);PYLITH_CHECK_ERROR(err);
@@ -977,7 +1074,7 @@ pylith::topology::Field::createScatterWithBC(const Mesh& mesh,
   
   // Only create if scatter and scatterVec do not alreay exist.
   if (sinfo.dm) {
-    assert(sinfo.vector);
+    // Vector may be created when it is first used (see cloneSection()).
     PYLITH_METHOD_END;
   } // if
 
@@ -1035,6 +1132,7 @@ pylith::topology::Field::createScatterWithBC(const Mesh& mesh,
     numExcludes = 0;
   } // if
 
+  _releaseLayout(sinfo.dm);
   err = DMDestroy(&sinfo.dm);PYLITH_CHECK_ERROR(err);
   err = DMClone(dm, &sinfo.dm);PYLITH_CHECK_ERROR(err);
   err = PetscSectionClone(section, &newSection);PYLITH_CHECK_ERROR(err);
@@ -1067,9 +1165,9 @@ pylith::topology::Field::vector(const char* context)
 { // vector
   PYLITH_METHOD_BEGIN;
 
-  ScatterInfo& sinfo = _getScatter(context);
+  _getScatter(context);
 
-  PYLITH_METHOD_RETURN(sinfo.vector);
+  PYLITH_METHOD_RETURN(_scatterVector(context));
 } // vector
 
 // ----------------------------------------------------------------------
@@ -1079,9 +1177,7 @@ pylith::topology::Field::vector(const char* context) const
 { // vector
   PYLITH_METHOD_BEGIN;
 
-  const ScatterInfo& sinfo = _getScatter(context);
-
-  PYLITH_METHOD_RETURN(sinfo.vector);
+  PYLITH_METHOD_RETURN(_scatterVector(context));
 } // vector
 
 // ----------------------------------------------------------------------
@@ -1093,8 +1189,7 @@ pylith::topology::Field::scatterLocalToGlobal(const char* context) const
   PYLITH_METHOD_BEGIN;
 
   assert(context);
-  const ScatterInfo& sinfo = _getScatter(context);
-  scatterLocalToGlobal(sinfo.vector, context);
+  scatterLocalToGlobal(_scatterVector(context), context);
 
   PYLITH_METHOD_END;
 } // scatterLocalToGlobal
@@ -1113,8 +1208,12 @@ pylith::topology::Field::scatterLocalToGlobal(const PetscVec vector,
   const ScatterInfo& sinfo = _getScatter(context);
   PetscErrorCode err = 0;
   if (sinfo.dm) {
+    utils::EventTracer::spanBegin("Field scatter local to global");
     err = DMLocalToGlobalBegin(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
+    utils::EventTracer::spanBegin("MPI wait");
     err = DMLocalToGlobalEnd(sinfo.dm, _localVec, INSERT_VALUES, vector);PYLITH_CHECK_ERROR(err);
+    utils::EventTracer::spanEnd("MPI wait");
+    utils::EventTracer::spanEnd("Field scatter local to global");
   } // if
   
   PYLITH_METHOD_END;
@@ -1130,8 +1229,7 @@ pylith::topology::Field::scatterGlobalToLocal(const char* context) const
 
   assert(context);
 
-  const ScatterInfo& sinfo = _getScatter(context);
-  scatterGlobalToLocal(sinfo.vector, context);
+  scatterGlobalToLocal(_scatterVector(context), context);
 
   PYLITH_METHOD_END;
 } // scatterGlobalToLocal
@@ -1151,8 +1249,12 @@ pylith::topology::Field::scatterGlobalToLocal(const PetscVec vector,
   PetscErrorCode err = 0;
 
   if (sinfo.dm) {
+    utils::EventTracer::spanBegin("Field scatter global to local");
     err = DMGlobalToLocalBegin(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+    utils::EventTracer::spanBegin("MPI wait");
     err = DMGlobalToLocalEnd(sinfo.dm, vector, INSERT_VALUES, _localVec);PYLITH_CHECK_ERROR(err);
+    utils::EventTracer::spanEnd("MPI wait");
+    utils::EventTracer::spanEnd("Field scatter global to local");
   } // if
 
   PYLITH_METHOD_END;
@@ -1179,6 +1281,7 @@ pylith::topology::Field::_getScatter(const char* context,
     // remove old scatter
     ScatterInfo& sinfo = _scatters[context];
     PetscErrorCode err = 0;
+    _releaseLayout(sinfo.dm);
     err = DMDestroy(&sinfo.dm);PYLITH_CHECK_ERROR(err);
     err = VecDestroy(&sinfo.vector);PYLITH_CHECK_ERROR(err);
 
@@ -1222,6 +1325,125 @@ pylith::topology::Field::_getScatter(const char* context) const
   PYLITH_METHOD_RETURN(s_iter->second);
 } // _getScatter
 
+// ----------------------------------------------------------------------
+// Get vector for scatter, creating it if necessary.
+PetscVec
+pylith::topology::Field::_scatterVector(const char* context) const
+{ // _scatterVector
+  PYLITH_METHOD_BEGIN;
+
+  assert(context);
+
+  // Creating the vector on demand does not change the field.
+  ScatterInfo& sinfo = const_cast<ScatterInfo&>(_getScatter(context));
+  if (!sinfo.vector && sinfo.dm) {
+    PetscErrorCode err;
+
+    // Reuse global vector if scatter has the same size on all processes.
+    PetscSection globalSection = NULL;
+    PetscInt storageSize = 0, localSize = 0;
+    err = DMGetDefaultGlobalSection(sinfo.dm, &globalSection);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstrainedStorageSize(globalSection, &storageSize);PYLITH_CHECK_ERROR(err);
+    err = VecGetLocalSize(_globalVec, &localSize);PYLITH_CHECK_ERROR(err);
+    int sameSizeLocal = (storageSize == localSize) ? 1 : 0;
+    int sameSize = 0;
+    MPI_Allreduce(&sameSizeLocal, &sameSize, 1, MPI_INT, MPI_MIN, _mesh.comm());
+    if (sameSize) {
+      sinfo.vector = _globalVec;
+      err = PetscObjectReference((PetscObject) sinfo.vector);PYLITH_CHECK_ERROR(err);
+    } else {
+      err = DMCreateGlobalVector(sinfo.dm, &sinfo.vector);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    err = PetscObjectSetName((PetscObject) sinfo.vector, _metadata.label.c_str());PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_RETURN(sinfo.vector);
+} // _scatterVector
+
+// ----------------------------------------------------------------------
+// Give field its own copy of layout if it is shared with other fields.
+void
+pylith::topology::Field::_unshareLayout(void)
+{ // _unshareLayout
+  PYLITH_METHOD_BEGIN;
+
+  if (!_layoutShared) {
+    PYLITH_METHOD_END;
+  } // if
+
+  assert(_dm);
+  PetscDM dm = NULL;
+  PetscSection section = NULL, newSection = NULL;
+  PetscErrorCode err;
+
+  // Other fields keep the shared DM, so we replace ours with a copy.
+  err = DMGetDefaultSection(_dm, &section);PYLITH_CHECK_ERROR(err);
+  err = DMClone(_dm, &dm);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionClone(section, &newSection);PYLITH_CHECK_ERROR(err);
+  err = DMSetDefaultSection(dm, newSection);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&newSection);PYLITH_CHECK_ERROR(err);
+  _releaseLayout(_dm);
+  err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+  _dm = dm;
+
+  _layoutShared = false;
+
+  PYLITH_METHOD_END;
+} // _unshareLayout
+
+// ----------------------------------------------------------------------
+// Check whether memory of layout in DM is counted with this field.
+bool
+pylith::topology::Field::_holdsLayout(PetscDM dm) const
+{ // _holdsLayout
+  PYLITH_METHOD_BEGIN;
+
+  if (!dm) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  PetscErrorCode err;
+  PetscContainer holder = NULL;
+  err = PetscObjectQuery((PetscObject) dm, "pylith_layout_holder", (PetscObject*) &holder);PYLITH_CHECK_ERROR(err);
+  if (holder) {
+    void* field = NULL;
+    err = PetscContainerGetPointer(holder, &field);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_RETURN(field == (void*) this);
+  } // if
+
+  err = PetscContainerCreate(PetscObjectComm((PetscObject) dm), &holder);PYLITH_CHECK_ERROR(err);
+  err = PetscContainerSetPointer(holder, (void*) this);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectCompose((PetscObject) dm, "pylith_layout_holder", (PetscObject) holder);PYLITH_CHECK_ERROR(err);
+  err = PetscContainerDestroy(&holder);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(true);
+} // _holdsLayout
+
+// ----------------------------------------------------------------------
+// Stop counting memory of layout in DM with this field.
+void
+pylith::topology::Field::_releaseLayout(PetscDM dm) const
+{ // _releaseLayout
+  PYLITH_METHOD_BEGIN;
+
+  if (!dm) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscErrorCode err;
+  PetscContainer holder = NULL;
+  err = PetscObjectQuery((PetscObject) dm, "pylith_layout_holder", (PetscObject*) &holder);PYLITH_CHECK_ERROR(err);
+  if (holder) {
+    void* field = NULL;
+    err = PetscContainerGetPointer(holder, &field);PYLITH_CHECK_ERROR(err);
+    if (field == (void*) this) {
+      err = PetscObjectCompose((PetscObject) dm, "pylith_layout_holder", NULL);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // if
+
+  PYLITH_METHOD_END;
+} // _releaseLayout
+
 // ----------------------------------------------------------------------
 // Experimental
 void
@@ -1255,6 +1477,7 @@ pylith::topology::Field::subfieldsSetup(void)
   PYLITH_METHOD_BEGIN;
 
   assert(_dm);
+  _unshareLayout();
 
   // Setup section now that we know the total number of sub-fields and components.
   PetscSection section = NULL;
@@ -1286,6 +1509,7 @@ pylith::topology::Field::subfieldSetDof(const char *name,
   PetscErrorCode err;
 
   assert(_dm);
+  _unshareLayout();
   switch(domain) {
   case VERTICES_FIELD:
     err = DMPlexGetDepthStratum(_dm, 0, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
@@ -1412,6 +1636,7 @@ pylith::topology::Field::_extractSubfield(const Field& field,
   const int numSubfields = 1;
   int indicesSubfield[1];
   indicesSubfield[0] = subfieldIndex;
+  _releaseLayout(_dm);
   err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
   if (subfieldInfo.dm) {
     PetscSection s;
@@ -1421,6 +1646,7 @@ pylith::topology::Field::_extractSubfield(const Field& field,
   } else {
     err = DMCreateSubDM(field.dmMesh(), numSubfields, indicesSubfield, &subfieldIS, &_dm);PYLITH_CHECK_ERROR(err);assert(_dm);
   } // if/else
+  _layoutShared = false;
   err = ISDestroy(&subfieldIS);PYLITH_CHECK_ERROR(err);
   
   err = DMCreateLocalVector(_dm, &_localVec);PYLITH_CHECK_ERROR(err);
@@ -61,6 +61,7 @@ class pylith::topology::Field : public FieldBase
 { // Field
   friend class TestFieldMesh; // unit testing
   friend class TestFieldSubMesh; // unit testing
+  friend class MemoryUsage; // memory accounting
 
 // PUBLIC STRUCTS ///////////////////////////////////////////////////////
 public :
@@ -293,7 +294,15 @@ public :
    * structures to be reused across multiple fields, reducing memory
    * usage.
    *
-   * @param sec Field defining layout.
+   * The fields share the DM, so they share the local and global
+   * sections and the point SF. Scatter vectors that differ in size
+   * from the global vector are created when they are first used. The
+   * layout is copied before it is changed (for example, by
+   * newSection()) by either field, so the other fields are not
+   * affected. Sections obtained from localSection() must not be
+   * modified while the layout is shared.
+   *
+   * @param src Field defining layout.
    *
    * @note Don't forget to call label(), especially if reusing a field.
    */
@@ -367,6 +376,16 @@ public :
   void copySubfield(const Field& field,
 		    const char* name);
 
+  /** Exchange values with another field with the same layout by
+   * swapping the underlying PETSc vectors (no data is copied).
+   *
+   * Labels, metadata, and scatters remain with each field; scatter
+   * vectors that share the global vector are swapped with it.
+   *
+   * @param field Field with which to exchange values.
+   */
+  void swapValues(Field& field);
+
   /** Add two fields, storing the result in one of the fields.
    *
    * @param field Field to add.
@@ -521,6 +540,37 @@ private :
    */
   const ScatterInfo& _getScatter(const char* context) const;
 
+  /** Get vector for scatter, creating it if necessary. Vectors for
+   * scatters are created when first used, so this must be called by
+   * all processes.
+   *
+   * @param context Context for scatter.
+   * @returns PETSc vector for scatter.
+   */
+  PetscVec _scatterVector(const char* context) const;
+
+  /// Give field its own copy of layout if it is shared with other fields.
+  void _unshareLayout(void);
+
+  /** Check whether memory of layout in DM is counted with this field.
+   *
+   * Fields sharing a DM count its sections with only one of them,
+   * recorded in the DM. If no field holds the layout (for example,
+   * after the field that held it gave up its reference), this field
+   * takes it over.
+   *
+   * @param dm PETSc DM with layout.
+   * @returns True if layout is counted with this field, false otherwise.
+   */
+  bool _holdsLayout(PetscDM dm) const;
+
+  /** Stop counting memory of layout in DM with this field. Called
+   * before this field gives up its reference to the DM.
+   *
+   * @param dm PETSc DM with layout.
+   */
+  void _releaseLayout(PetscDM dm) const;
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -533,6 +583,7 @@ private :
   PetscVec _globalVec; ///< Global PETSc vector
   PetscVec _localVec; ///< Local PETSc vector
   subfields_type _subfields; ///< Map of subfields bundled together.
+  mutable bool _layoutShared; ///< True if DM and section may be shared with other fields.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -25,21 +25,81 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <iostream> // USES std::cerr
+#include <fstream> // USES std::ifstream, std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <vector> // USES std::vector
+#include <cstring> // USES strcmp(), strncmp(), strlen()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _Jacobian {
+
+      /// Identifier at beginning of nonzero pattern cache files.
+      static const char* patternMagic = "PYLITHJP";
+
+      /// Version of nonzero pattern cache file format.
+      static const long long patternVersion = 1;
+
+      /// 64-bit FNV-1a hash of a sequence of integers.
+      class Hash {
+      public :
+	Hash(void) : value(14695981039346656037ULL) {}
+	void add(const long long v) {
+	  const unsigned char* bytes = reinterpret_cast<const unsigned char*>(&v);
+	  for (size_t i=0; i < sizeof(v); ++i) {
+	    value ^= bytes[i];
+	    value *= 1099511628211ULL;
+	  } // for
+	} // add
+	unsigned long long value;
+      }; // Hash
+
+      /** Get name of cache file for this process.
+       *
+       * @param prefix Filename prefix for cache.
+       * @param rank Rank of process.
+       * @returns Name of cache file.
+       */
+      std::string
+      patternFilename(const char* prefix,
+		      const int rank) {
+	std::ostringstream filename;
+	filename << prefix << "." << rank;
+	return filename.str();
+      } // patternFilename
+
+    } // _Jacobian
+  } // topology
+} // pylith
 
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::topology::Jacobian::Jacobian(const Field& field,
                                      const char* matrixType,
-                                     const bool blockOkay) :
+                                     const bool blockOkay,
+				     const char* patternCache) :
   _matrix(0),
-  _valuesChanged(true)
+  _valuesChanged(true),
+  _patternFromCache(false),
+  _patternSaved(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
 
   PetscDM dmMesh = field.dmMesh();assert(dmMesh);
 
-  const char* msg = "Could not create PETSc sparse matrix associated with system Jacobian.";
-  PetscErrorCode err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+  const bool useCache = patternCache && strlen(patternCache) > 0;
+  if (useCache) {
+    _patternFromCache = _loadPattern(field, patternCache);
+  } // if
+  if (!_patternFromCache) {
+    const char* msg = "Could not create PETSc sparse matrix associated with system Jacobian.";
+    PetscErrorCode err = DMCreateMatrix(dmMesh, &_matrix);PYLITH_CHECK_ERROR_MSG(err, msg);
+    if (useCache) {
+      _patternSaved = _savePattern(field, patternCache);
+    } // if
+  } // if
 
   _type = matrixType;
 
@@ -260,5 +320,284 @@ pylith::topology::Jacobian::resetValuesChanged(void)
   _valuesChanged = false;
 } // resteValuesChanged
 
+// ----------------------------------------------------------------------
+// Get flag indicating if the nonzero pattern was loaded from the cache.
+bool
+pylith::topology::Jacobian::patternFromCache(void) const
+{ // patternFromCache
+  return _patternFromCache;
+} // patternFromCache
+
+// ----------------------------------------------------------------------
+// Get flag indicating if the nonzero pattern was written to the cache.
+bool
+pylith::topology::Jacobian::patternSaved(void) const
+{ // patternSaved
+  return _patternSaved;
+} // patternSaved
+
+// ----------------------------------------------------------------------
+// Create matrix from cached nonzero pattern.
+bool
+pylith::topology::Jacobian::_loadPattern(const Field& field,
+					 const char* filename)
+{ // _loadPattern
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+  assert(!_matrix);
+
+  PetscDM dmMesh = field.dmMesh();assert(dmMesh);
+  MPI_Comm comm = PETSC_COMM_WORLD;
+  PetscMPIInt commRank = 0, commSize = 1;
+  PetscErrorCode err;
+  err = PetscObjectGetComm((PetscObject) dmMesh, &comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+  // Read header and check that it matches the current mesh,
+  // partition, and layout.
+  std::vector<long long> rowOffsets;
+  std::vector<long long> columns;
+  long long header[8] = { 0, 0, 0, 0, 0, 0, 0, 0 }; // version, signature, commSize, rank, M, N, mLocal, bs
+  std::string matType;
+  int isMatch = 0;
+  std::ifstream fin(_Jacobian::patternFilename(filename, commRank).c_str(), std::ios::in | std::ios::binary);
+  if (fin.is_open()) {
+    char magic[8];
+    fin.read(magic, 8);
+    fin.read(reinterpret_cast<char*>(header), sizeof(header));
+    long long typeLength = 0;
+    fin.read(reinterpret_cast<char*>(&typeLength), sizeof(typeLength));
+    if (fin.good() && !strncmp(magic, _Jacobian::patternMagic, 8) && typeLength > 0 && typeLength < 256) {
+      std::vector<char> typeBuffer(typeLength);
+      fin.read(&typeBuffer[0], typeLength);
+      matType.assign(&typeBuffer[0], typeLength);
+
+      PetscSection globalSection = field.globalSection();assert(globalSection);
+      PetscInt mLocal = 0;
+      err = PetscSectionGetConstrainedStorageSize(globalSection, &mLocal);PYLITH_CHECK_ERROR(err);
+
+      isMatch = fin.good() &&
+	header[0] == _Jacobian::patternVersion &&
+	(unsigned long long)(header[1]) == _layoutSignature(field) &&
+	header[2] == commSize &&
+	header[3] == commRank &&
+	header[6] == mLocal;
+    } // if
+    if (isMatch) {
+      long long numRows = 0, numNonzeros = 0;
+      fin.read(reinterpret_cast<char*>(&numRows), sizeof(numRows));
+      fin.read(reinterpret_cast<char*>(&numNonzeros), sizeof(numNonzeros));
+      isMatch = fin.good() && numRows == header[6] && numNonzeros >= 0;
+      if (isMatch) {
+	rowOffsets.resize(numRows+1);
+	columns.resize(numNonzeros);
+	fin.read(reinterpret_cast<char*>(&rowOffsets[0]), (numRows+1)*sizeof(long long));
+	if (numNonzeros > 0) {
+	  fin.read(reinterpret_cast<char*>(&columns[0]), numNonzeros*sizeof(long long));
+	} // if
+	isMatch = fin.good() && rowOffsets[0] == 0 && rowOffsets[numRows] == numNonzeros;
+      } // if
+    } // if
+    fin.close();
+  } // if
+
+  // All processes must use the same path to create the matrix.
+  int isMatchAll = 0;
+  err = MPI_Allreduce(&isMatch, &isMatchAll, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+  if (!isMatchAll) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  const PetscInt numRows = header[6];
+  const PetscInt numNonzeros = columns.size();
+  std::vector<PetscInt> ia(numRows+1);
+  std::vector<PetscInt> ja(numNonzeros > 0 ? numNonzeros : 1);
+  for (PetscInt i=0; i <= numRows; ++i) {
+    ia[i] = rowOffsets[i];
+  } // for
+  for (PetscInt i=0; i < numNonzeros; ++i) {
+    ja[i] = columns[i];
+  } // for
+
+  err = MatCreate(comm, &_matrix);PYLITH_CHECK_ERROR(err);
+  err = MatSetSizes(_matrix, numRows, numRows, header[4], header[5]);PYLITH_CHECK_ERROR(err);
+  err = MatSetBlockSize(_matrix, header[7]);PYLITH_CHECK_ERROR(err);
+  err = MatSetType(_matrix, matType.c_str());PYLITH_CHECK_ERROR(err);
+  // Honor -mat_* options as DMCreateMatrix() does. The cached pattern
+  // can only be used if the matrix is still AIJ (the options are the
+  // same on all processes).
+  err = MatSetFromOptions(_matrix);PYLITH_CHECK_ERROR(err);
+  PetscBool isAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompareAny((PetscObject) _matrix, &isAIJ, MATSEQAIJ, MATMPIAIJ, "");PYLITH_CHECK_ERROR(err);
+  if (!isAIJ) {
+    err = MatDestroy(&_matrix);PYLITH_CHECK_ERROR(err);
+    PYLITH_METHOD_RETURN(false);
+  } // if
+  if (1 == commSize) {
+    err = MatSeqAIJSetPreallocationCSR(_matrix, &ia[0], &ja[0], NULL);PYLITH_CHECK_ERROR(err);
+  } else {
+    err = MatMPIAIJSetPreallocationCSR(_matrix, &ia[0], &ja[0], NULL);PYLITH_CHECK_ERROR(err);
+  } // if/else
+  err = MatSetOption(_matrix, MAT_NEW_NONZERO_ALLOCATION_ERR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+  err = MatSetDM(_matrix, dmMesh);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(true);
+} // _loadPattern
+
+// ----------------------------------------------------------------------
+// Write nonzero pattern of matrix to cache.
+bool
+pylith::topology::Jacobian::_savePattern(const Field& field,
+					 const char* filename) const
+{ // _savePattern
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+  assert(_matrix);
+
+  PetscErrorCode err;
+
+  // Only AIJ matrices can be created directly from the nonzero pattern.
+  PetscBool isAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompareAny((PetscObject) _matrix, &isAIJ, MATSEQAIJ, MATMPIAIJ, "");PYLITH_CHECK_ERROR(err);
+  if (!isAIJ) {
+    PYLITH_METHOD_RETURN(false);
+  } // if
+
+  MPI_Comm comm = PETSC_COMM_WORLD;
+  PetscMPIInt commRank = 0, commSize = 1;
+  err = PetscObjectGetComm((PetscObject) _matrix, &comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+
+  MatType matType = NULL;
+  PetscInt M = 0, N = 0, mLocal = 0, nLocal = 0, blockSize = 1, rStart = 0, rEnd = 0;
+  err = MatGetType(_matrix, &matType);PYLITH_CHECK_ERROR(err);
+  err = MatGetSize(_matrix, &M, &N);PYLITH_CHECK_ERROR(err);
+  err = MatGetLocalSize(_matrix, &mLocal, &nLocal);PYLITH_CHECK_ERROR(err);
+  err = MatGetBlockSize(_matrix, &blockSize);PYLITH_CHECK_ERROR(err);
+  err = MatGetOwnershipRange(_matrix, &rStart, &rEnd);PYLITH_CHECK_ERROR(err);
+
+  std::vector<long long> rowOffsets(rEnd-rStart+1);
+  std::vector<long long> columns;
+  rowOffsets[0] = 0;
+  for (PetscInt r=rStart; r < rEnd; ++r) {
+    PetscInt numCols = 0;
+    const PetscInt* cols = NULL;
+    err = MatGetRow(_matrix, r, &numCols, &cols, NULL);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i=0; i < numCols; ++i) {
+      columns.push_back(cols[i]);
+    } // for
+    err = MatRestoreRow(_matrix, r, &numCols, &cols, NULL);PYLITH_CHECK_ERROR(err);
+    rowOffsets[r-rStart+1] = columns.size();
+  } // for
+
+  const std::string cacheFilename = _Jacobian::patternFilename(filename, commRank);
+  std::ofstream fout(cacheFilename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+  const long long header[8] = {
+    _Jacobian::patternVersion,
+    (long long)(_layoutSignature(field)),
+    commSize,
+    commRank,
+    M,
+    N,
+    mLocal,
+    blockSize,
+  };
+  const long long typeLength = strlen(matType);
+  const long long numRows = rEnd - rStart;
+  const long long numNonzeros = columns.size();
+  int isOkay = 0;
+  if (fout.is_open()) {
+    fout.write(_Jacobian::patternMagic, 8);
+    fout.write(reinterpret_cast<const char*>(header), sizeof(header));
+    fout.write(reinterpret_cast<const char*>(&typeLength), sizeof(typeLength));
+    fout.write(matType, typeLength);
+    fout.write(reinterpret_cast<const char*>(&numRows), sizeof(numRows));
+    fout.write(reinterpret_cast<const char*>(&numNonzeros), sizeof(numNonzeros));
+    fout.write(reinterpret_cast<const char*>(&rowOffsets[0]), rowOffsets.size()*sizeof(long long));
+    if (numNonzeros > 0) {
+      fout.write(reinterpret_cast<const char*>(&columns[0]), numNonzeros*sizeof(long long));
+    } // if
+    isOkay = fout.good() ? 1 : 0;
+    fout.close();
+  } // if
+
+  // Throw on all processes if writing failed on any of them, so that
+  // no process continues into collective operations alone.
+  int isOkayAll = 0;
+  err = MPI_Allreduce(&isOkay, &isOkayAll, 1, MPI_INT, MPI_MIN, comm);PYLITH_CHECK_ERROR(err);
+  if (!isOkayAll) {
+    std::ostringstream msg;
+    if (!isOkay) {
+      msg << "Could not write nonzero pattern of Jacobian to file '" << cacheFilename << "'.";
+    } else {
+      msg << "Could not write nonzero pattern of Jacobian to cache '" << filename << "' on another process.";
+    } // if/else
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_RETURN(true);
+} // _savePattern
+
+// ----------------------------------------------------------------------
+// Compute signature of mesh topology, partition, and layout of field.
+unsigned long long
+pylith::topology::Jacobian::_layoutSignature(const Field& field)
+{ // _layoutSignature
+  PYLITH_METHOD_BEGIN;
+
+  _Jacobian::Hash hash;
+  PetscErrorCode err;
+
+  PetscDM dmMesh = field.dmMesh();assert(dmMesh);
+
+  // Mesh topology
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  hash.add(pStart);
+  hash.add(pEnd);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    PetscInt coneSize = 0;
+    const PetscInt* cone = NULL;
+    err = DMPlexGetConeSize(dmMesh, p, &coneSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetCone(dmMesh, p, &cone);PYLITH_CHECK_ERROR(err);
+    hash.add(coneSize);
+    for (PetscInt i=0; i < coneSize; ++i) {
+      hash.add(cone[i]);
+    } // for
+  } // for
+
+  // Partition (points shared with other processes)
+  PetscSF sf = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotePoints = NULL;
+  err = DMGetPointSF(dmMesh, &sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &leaves, &remotePoints);PYLITH_CHECK_ERROR(err);
+  hash.add(numLeaves);
+  for (PetscInt i=0; i < numLeaves && remotePoints; ++i) {
+    hash.add(leaves ? leaves[i] : i);
+    hash.add(remotePoints[i].rank);
+    hash.add(remotePoints[i].index);
+  } // for
+
+  // Layout of field
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+  for (PetscInt p=pStart; p < pEnd; ++p) {
+    PetscInt dof = 0, cdof = 0, off = 0;
+    err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(globalSection, p, &cdof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(globalSection, p, &off);PYLITH_CHECK_ERROR(err);
+    hash.add(dof);
+    hash.add(cdof);
+    hash.add(off);
+  } // for
+
+  PYLITH_METHOD_RETURN(hash.value);
+} // _layoutSignature
+
 
 // End of file 
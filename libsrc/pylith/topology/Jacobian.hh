@@ -43,15 +43,24 @@ class pylith::topology::Jacobian
 public :
 
   /** Default constructor.
+   *
+   * If a pattern cache is given and the cached nonzero pattern
+   * matches the mesh, partition, and layout of the field, the matrix
+   * is created directly from the cached pattern. Otherwise, the
+   * nonzero pattern is computed from the mesh topology and written
+   * to the cache.
    *
    * @param field Field associated with mesh and solution of the problem.
    * @param matrixType Type of PETSc sparse matrix.
    * @param blockOkay True if okay to use block size equal to fiberDim
    * (all or none of the DOF at each point are constrained).
+   * @param patternCache Filename prefix for cache of nonzero pattern
+   * (NULL or empty for no cache).
    */
   Jacobian(const Field& field,
            const char* matrixType ="aij",
-           const bool blockOkay =false);
+           const bool blockOkay =false,
+	   const char* patternCache =0);
 
   /// Destructor.
   ~Jacobian(void);
@@ -111,12 +120,62 @@ public :
   /// Reset flag indicating if sparse matrix values have been updated.
   void resetValuesChanged(void);
 
+  /** Get flag indicating if the nonzero pattern was loaded from the
+   * pattern cache.
+   *
+   * @returns True if the nonzero pattern was loaded from the cache.
+   */
+  bool patternFromCache(void) const;
+
+  /** Get flag indicating if the nonzero pattern was written to the
+   * pattern cache.
+   *
+   * @returns True if the nonzero pattern was written to the cache.
+   */
+  bool patternSaved(void) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Create matrix from cached nonzero pattern.
+   *
+   * Collective over the processes associated with the field.
+   *
+   * @param field Field associated with mesh and solution of the problem.
+   * @param filename Filename prefix for cache of nonzero pattern.
+   * @returns True if the cache matched on all processes and the matrix
+   * was created, false otherwise.
+   */
+  bool _loadPattern(const Field& field,
+		    const char* filename);
+
+  /** Write nonzero pattern of matrix to cache.
+   *
+   * @param field Field associated with mesh and solution of the problem.
+   * @param filename Filename prefix for cache of nonzero pattern.
+   * @returns True if the pattern was written, false if the matrix
+   * type does not support creating the matrix from the pattern.
+   */
+  bool _savePattern(const Field& field,
+		    const char* filename) const;
+
+  /** Compute signature of mesh topology, partition, and layout of
+   * field on this process.
+   *
+   * @param field Field associated with mesh and solution of the problem.
+   * @returns Signature (hash) of local mesh and layout.
+   */
+  static
+  unsigned long long _layoutSignature(const Field& field);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscMat _matrix; ///< Sparse matrix for Jacobian of problem.
 
   bool _valuesChanged; ///< Sparse matrix values have been updated.
+  bool _patternFromCache; ///< Nonzero pattern loaded from cache.
+  bool _patternSaved; ///< Nonzero pattern written to cache.
 
   std::string _type; ///< String associated with matrix type.
 
@@ -0,0 +1,186 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "LoadBalance.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+#include "Stratum.hh" // USES Stratum
+#include "VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/meshio/DataWriter.hh" // USES DataWriter
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "petsclog.h" // USES petsc_send_len, petsc_isend_len
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Get number of ghost points in field.
+int
+pylith::topology::LoadBalance::numGhostPoints(const Field& field)
+{ // numGhostPoints
+  PYLITH_METHOD_BEGIN;
+
+  int count = 0;
+  if (!field.hasSection()) {
+    PYLITH_METHOD_RETURN(count);
+  } // if
+
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+  PetscErrorCode err;
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    // Points owned by other processes have dof encoded as -(dof+1).
+    PetscInt dof = 0;
+    err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+    if (dof < -1) {
+      ++count;
+    } // if
+  } // for
+
+  PYLITH_METHOD_RETURN(count);
+} // numGhostPoints
+
+// ----------------------------------------------------------------------
+// Get number of degrees of freedom at ghost points in field.
+int
+pylith::topology::LoadBalance::numGhostDof(const Field& field)
+{ // numGhostDof
+  PYLITH_METHOD_BEGIN;
+
+  int count = 0;
+  if (!field.hasSection()) {
+    PYLITH_METHOD_RETURN(count);
+  } // if
+
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+  PetscErrorCode err;
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(globalSection, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt dof = 0;
+    err = PetscSectionGetDof(globalSection, p, &dof);PYLITH_CHECK_ERROR(err);
+    if (dof < -1) {
+      count += -(dof+1);
+    } // if
+  } // for
+
+  PYLITH_METHOD_RETURN(count);
+} // numGhostDof
+
+// ----------------------------------------------------------------------
+// Get cumulative number of MPI messages sent by this process.
+double
+pylith::topology::LoadBalance::numMessages(void)
+{ // numMessages
+#if defined(PETSC_USE_LOG)
+  return petsc_send_ct + petsc_isend_ct;
+#else
+  return 0.0;
+#endif
+} // numMessages
+
+// ----------------------------------------------------------------------
+// Get cumulative length of MPI messages sent by this process.
+double
+pylith::topology::LoadBalance::messageBytes(void)
+{ // messageBytes
+#if defined(PETSC_USE_LOG)
+  return petsc_send_len + petsc_isend_len;
+#else
+  return 0.0;
+#endif
+} // messageBytes
+
+// ----------------------------------------------------------------------
+// Write cell fields with rank and imbalance ratios.
+void
+pylith::topology::LoadBalance::write(meshio::DataWriter* const writer,
+				     const Mesh& mesh,
+				     const PylithScalar computeTime,
+				     const PylithScalar messageBytes)
+{ // write
+  PYLITH_METHOD_BEGIN;
+
+  assert(writer);
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  // Ratio of value on this process to average over all processes.
+  const int numValues = 4;
+  const char* labels[numValues] = {
+    "partition",
+    "cells_ratio",
+    "compute_ratio",
+    "message_ratio",
+  };
+  PylithScalar valuesLocal[numValues] = {
+    PylithScalar(mesh.commRank()),
+    PylithScalar(cEnd - cStart),
+    computeTime,
+    messageBytes,
+  };
+  PylithScalar valuesSum[numValues];
+  PetscErrorCode err = MPI_Allreduce(valuesLocal, valuesSum, numValues, MPIU_SCALAR, MPI_SUM, mesh.comm());PYLITH_CHECK_ERROR(err);
+  int commSize = 1;
+  err = MPI_Comm_size(mesh.comm(), &commSize);PYLITH_CHECK_ERROR(err);
+  PylithScalar values[numValues];
+  values[0] = valuesLocal[0];
+  for (int i=1; i < numValues; ++i) {
+    const PylithScalar avg = valuesSum[i] / commSize;
+    values[i] = (avg > 0.0) ? valuesLocal[i] / avg : 0.0;
+  } // for
+
+  const PylithScalar t = 0.0;
+  const int numTimeSteps = 0;
+  writer->open(mesh, numTimeSteps);
+  writer->openTimeStep(t, mesh);
+  for (int i=0; i < numValues; ++i) {
+    const int fiberDim = 1;
+    Field field(mesh);
+    field.newSection(FieldBase::CELLS_FIELD, fiberDim);
+    field.allocate();
+    field.scale(1.0);
+    field.label(labels[i]);
+    field.vectorFieldType(FieldBase::SCALAR);
+
+    VecVisitorMesh fieldVisitor(field);
+    PetscScalar* fieldArray = fieldVisitor.localArray();
+    for (PetscInt c = cStart; c < cEnd; ++c) {
+      const PetscInt off = fieldVisitor.sectionOffset(c);
+      assert(fiberDim == fieldVisitor.sectionDof(c));
+      fieldArray[off] = values[i];
+    } // for
+
+    writer->writeCellField(t, field);
+  } // for
+  writer->closeTimeStep();
+  writer->close();
+
+  PYLITH_METHOD_END;
+} // write
+
+
+// End of file 
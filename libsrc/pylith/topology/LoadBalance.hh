@@ -0,0 +1,111 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/LoadBalance.hh
+ *
+ * @brief Measure distribution of work and communication among
+ * processes.
+ */
+
+#if !defined(pylith_topology_loadbalance_hh)
+#define pylith_topology_loadbalance_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/meshio/meshiofwd.hh" // USES DataWriter
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+// LoadBalance ----------------------------------------------------------
+/** @brief Measure distribution of work and communication among
+ * processes.
+ *
+ * Ghost points are the points in the local section of a field that
+ * are owned by another process, so their values are exchanged in
+ * every scatter. The message counters are the cumulative number and
+ * length of MPI messages sent by this process as recorded by PETSc
+ * (requires PETSc built with logging), so the volume for an interval
+ * is the difference of the counters at its end and beginning.
+ */
+class pylith::topology::LoadBalance
+{ // LoadBalance
+  friend class TestLoadBalance; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Get number of ghost points (points with values that are owned
+   * by another process) in field.
+   *
+   * @param field Field over mesh.
+   * @returns Number of ghost points on this process.
+   */
+  static
+  int numGhostPoints(const Field& field);
+
+  /** Get number of degrees of freedom at ghost points in field.
+   *
+   * @param field Field over mesh.
+   * @returns Number of ghost degrees of freedom on this process.
+   */
+  static
+  int numGhostDof(const Field& field);
+
+  /** Get cumulative number of MPI messages sent by this process.
+   *
+   * @returns Number of messages.
+   */
+  static
+  double numMessages(void);
+
+  /** Get cumulative length of MPI messages sent by this process.
+   *
+   * @returns Length of messages in bytes.
+   */
+  static
+  double messageBytes(void);
+
+  /** Write cell fields with the rank of each cell and the ratio of
+   * the number of cells, compute time, and message volume of the
+   * process to the average over all processes.
+   *
+   * @param writer Data writer for load balance information.
+   * @param mesh Distributed mesh.
+   * @param computeTime Compute time on this process.
+   * @param messageBytes Message volume sent by this process.
+   */
+  static
+  void write(meshio::DataWriter* const writer,
+	     const Mesh& mesh,
+	     const PylithScalar computeTime,
+	     const PylithScalar messageBytes);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  LoadBalance(void); ///< Not Implemented
+  LoadBalance(const LoadBalance&); ///< Not implemented
+  const LoadBalance& operator=(const LoadBalance&); ///< Not implemented
+
+}; // LoadBalance
+
+#endif // pylith_topology_loadbalance_hh
+
+
+// End of file 
@@ -0,0 +1,258 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MemoryUsage.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+#include "Jacobian.hh" // USES Jacobian
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::max
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Get memory used by finite-element mesh.
+size_t
+pylith::topology::MemoryUsage::mesh(const Mesh& mesh)
+{ // mesh
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(dmPlex(mesh.dmMesh()));
+} // mesh
+
+// ----------------------------------------------------------------------
+// Get memory used by field.
+size_t
+pylith::topology::MemoryUsage::field(const Field& field)
+{ // field
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  if (!field._dm || !field.hasSection()) {
+    PYLITH_METHOD_RETURN(bytes);
+  } // if
+
+  // The DM of the field is a clone of the mesh DM, so it shares the
+  // topology and we only count the sections and vectors. Sections
+  // shared by several fields are counted with only one of them.
+  const bool holdsLayout = field._holdsLayout(field._dm);
+  if (holdsLayout) {
+    bytes += section(field.localSection());
+  } // if
+  bytes += vector(field._localVec);
+  if (field._globalVec) {
+    if (holdsLayout) {
+      bytes += section(field.globalSection());
+    } // if
+    bytes += vector(field._globalVec);
+  } // if
+
+  PetscErrorCode err;
+  const Field::scatter_map_type::const_iterator scattersEnd = field._scatters.end();
+  for (Field::scatter_map_type::const_iterator s_iter=field._scatters.begin(); s_iter != scattersEnd; ++s_iter) {
+    const Field::ScatterInfo& sinfo = s_iter->second;
+    if (sinfo.vector && sinfo.vector != field._globalVec) {
+      bytes += vector(sinfo.vector);
+    } // if
+    if (sinfo.dm && sinfo.dm != field._dm && field._holdsLayout(sinfo.dm)) {
+      PetscSection s = NULL;
+      err = DMGetDefaultSection(sinfo.dm, &s);PYLITH_CHECK_ERROR(err);
+      if (s) {
+	bytes += section(s);
+	err = DMGetDefaultGlobalSection(sinfo.dm, &s);PYLITH_CHECK_ERROR(err);
+	bytes += section(s);
+      } // if
+    } // if
+  } // for
+
+  PYLITH_METHOD_RETURN(bytes);
+} // field
+
+// ----------------------------------------------------------------------
+// Get memory used by sparse matrix for Jacobian.
+size_t
+pylith::topology::MemoryUsage::jacobian(const Jacobian& jacobian)
+{ // jacobian
+  PYLITH_METHOD_BEGIN;
+
+  PYLITH_METHOD_RETURN(matrix(jacobian.matrix()));
+} // jacobian
+
+// ----------------------------------------------------------------------
+// Get memory used by PETSc section.
+size_t
+pylith::topology::MemoryUsage::section(const PetscSection section)
+{ // section
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  if (!section) {
+    PYLITH_METHOD_RETURN(bytes);
+  } // if
+
+  PetscErrorCode err;
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  const size_t chartSize = (pEnd > pStart) ? size_t(pEnd - pStart) : 0;
+
+  // Number of dof and offset for each point.
+  bytes += 2*chartSize*sizeof(PetscInt);
+
+  // Constraint section and constrained dof.
+  PetscInt storageSize = 0, constrainedStorageSize = 0;
+  err = PetscSectionGetStorageSize(section, &storageSize);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionGetConstrainedStorageSize(section, &constrainedStorageSize);PYLITH_CHECK_ERROR(err);
+  if (storageSize > constrainedStorageSize) {
+    bytes += (2*chartSize + size_t(storageSize - constrainedStorageSize))*sizeof(PetscInt);
+  } // if
+
+  // Sections for the fields.
+  PetscInt numFields = 0;
+  err = PetscSectionGetNumFields(section, &numFields);PYLITH_CHECK_ERROR(err);
+  for (PetscInt f=0; f < numFields; ++f) {
+    PetscSection fieldSection = NULL;
+    err = PetscSectionGetField(section, f, &fieldSection);PYLITH_CHECK_ERROR(err);
+    bytes += MemoryUsage::section(fieldSection);
+  } // for
+
+  PYLITH_METHOD_RETURN(bytes);
+} // section
+
+// ----------------------------------------------------------------------
+// Get memory used by values of PETSc vector on this process.
+size_t
+pylith::topology::MemoryUsage::vector(const PetscVec vector)
+{ // vector
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  if (vector) {
+    PetscInt localSize = 0;
+    PetscErrorCode err = VecGetLocalSize(vector, &localSize);PYLITH_CHECK_ERROR(err);
+    bytes = size_t(localSize)*sizeof(PetscScalar);
+  } // if
+
+  PYLITH_METHOD_RETURN(bytes);
+} // vector
+
+// ----------------------------------------------------------------------
+// Get memory used by PETSc matrix on this process.
+size_t
+pylith::topology::MemoryUsage::matrix(const PetscMat matrix)
+{ // matrix
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  if (!matrix) {
+    PYLITH_METHOD_RETURN(bytes);
+  } // if
+
+  PetscErrorCode err;
+  MatInfo info;
+  err = MatGetInfo(matrix, MAT_LOCAL, &info);PYLITH_CHECK_ERROR(err);
+  PetscInt numRows = 0, numCols = 0;
+  err = MatGetLocalSize(matrix, &numRows, &numCols);PYLITH_CHECK_ERROR(err);
+
+  // PETSc only tracks the memory of a matrix if it was built with
+  // logging, so we also compute the memory from the nonzeros
+  // allocated (values and column indices plus row offsets).
+  const size_t bytesNonzeros = size_t(info.nz_allocated)*(sizeof(PetscScalar)+sizeof(PetscInt)) + size_t(numRows+1)*sizeof(PetscInt);
+  bytes = std::max(size_t(info.memory), bytesNonzeros);
+
+  PYLITH_METHOD_RETURN(bytes);
+} // matrix
+
+// ----------------------------------------------------------------------
+// Get memory used by topology, coordinates, and labels of DMPlex.
+size_t
+pylith::topology::MemoryUsage::dmPlex(const PetscDM dm)
+{ // dmPlex
+  PYLITH_METHOD_BEGIN;
+
+  size_t bytes = 0;
+  if (!dm) {
+    PYLITH_METHOD_RETURN(bytes);
+  } // if
+
+  PetscErrorCode err;
+
+  // Topology: cones with orientations and supports.
+  PetscSection coneSection = NULL, supportSection = NULL;
+  err = DMPlexGetConeSection(dm, &coneSection);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetSupportSection(dm, &supportSection);PYLITH_CHECK_ERROR(err);
+  PetscInt coneSize = 0, supportSize = 0;
+  if (coneSection) {
+    err = PetscSectionGetStorageSize(coneSection, &coneSize);PYLITH_CHECK_ERROR(err);
+    bytes += section(coneSection) + 2*size_t(coneSize)*sizeof(PetscInt);
+  } // if
+  if (supportSection) {
+    err = PetscSectionGetStorageSize(supportSection, &supportSize);PYLITH_CHECK_ERROR(err);
+    bytes += section(supportSection) + size_t(supportSize)*sizeof(PetscInt);
+  } // if
+
+  // Coordinates.
+  PetscVec coordinates = NULL;
+  err = DMGetCoordinatesLocal(dm, &coordinates);PYLITH_CHECK_ERROR(err);
+  bytes += vector(coordinates);
+  PetscSection coordSection = NULL;
+  err = DMGetCoordinateSection(dm, &coordSection);PYLITH_CHECK_ERROR(err);
+  bytes += section(coordSection);
+
+  // Labels (depth, material ids, and groups): points in each stratum.
+  PetscInt numLabels = 0;
+  err = DMGetNumLabels(dm, &numLabels);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iLabel=0; iLabel < numLabels; ++iLabel) {
+    PetscDMLabel label = NULL;
+    err = DMGetLabelByNum(dm, iLabel, &label);PYLITH_CHECK_ERROR(err);
+    PetscIS valuesIS = NULL;
+    err = DMLabelGetValueIS(label, &valuesIS);PYLITH_CHECK_ERROR(err);
+    PetscInt numValues = 0;
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    const PetscInt* values = NULL;
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+      PetscInt stratumSize = 0;
+      err = DMLabelGetStratumSize(label, values[iValue], &stratumSize);PYLITH_CHECK_ERROR(err);
+      bytes += (size_t(stratumSize) + 2)*sizeof(PetscInt);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Star forest for points shared with other processes.
+  PetscSF sf = NULL;
+  err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+  if (sf) {
+    PetscInt numRoots = 0, numLeaves = 0;
+    const PetscInt* localPoints = NULL;
+    const PetscSFNode* remotePoints = NULL;
+    err = PetscSFGetGraph(sf, &numRoots, &numLeaves, &localPoints, &remotePoints);PYLITH_CHECK_ERROR(err);
+    if (numLeaves > 0) {
+      bytes += size_t(numLeaves)*(sizeof(PetscInt) + sizeof(PetscSFNode));
+    } // if
+  } // if
+
+  PYLITH_METHOD_RETURN(bytes);
+} // dmPlex
+
+
+// End of file
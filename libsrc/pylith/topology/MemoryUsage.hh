@@ -0,0 +1,125 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/MemoryUsage.hh
+ *
+ * @brief Measure memory used by PETSc data structures in meshes,
+ * fields, and Jacobians.
+ */
+
+#if !defined(pylith_topology_memoryusage_hh)
+#define pylith_topology_memoryusage_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscDM, PetscSection, PetscVec, PetscMat
+
+#include <cstddef> // USES size_t
+
+// MemoryUsage ----------------------------------------------------------
+/** @brief Measure memory used by PETSc data structures in meshes,
+ * fields, and Jacobians.
+ *
+ * The sizes are computed from the local sizes of the DMPlex
+ * topology, PetscSection charts, Vec storage, and the nonzeros
+ * allocated in Mat objects on this process, so they reflect the data
+ * structures actually in use rather than a model of them. Objects
+ * shared with another object (for example, the topology of the DM
+ * cloned for a field) are only counted once.
+ */
+class pylith::topology::MemoryUsage
+{ // MemoryUsage
+  friend class TestMemoryUsage; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Get memory used by finite-element mesh (topology, coordinates,
+   * and labels).
+   *
+   * @param mesh Finite-element mesh.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t mesh(const Mesh& mesh);
+
+  /** Get memory used by field (sections and vectors, including
+   * vectors for scatters).
+   *
+   * @param field Field over mesh.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t field(const Field& field);
+
+  /** Get memory used by sparse matrix for Jacobian.
+   *
+   * @param jacobian Jacobian of system.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t jacobian(const Jacobian& jacobian);
+
+  /** Get memory used by PETSc section.
+   *
+   * @param section PETSc section.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t section(const PetscSection section);
+
+  /** Get memory used by values of PETSc vector on this process.
+   *
+   * @param vector PETSc vector.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t vector(const PetscVec vector);
+
+  /** Get memory used by PETSc matrix on this process.
+   *
+   * @param matrix PETSc matrix.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t matrix(const PetscMat matrix);
+
+  /** Get memory used by topology, coordinates, and labels of DMPlex
+   * on this process.
+   *
+   * @param dm PETSc DM.
+   * @returns Memory in bytes.
+   */
+  static
+  size_t dmPlex(const PetscDM dm);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  MemoryUsage(void); ///< Not Implemented
+  MemoryUsage(const MemoryUsage&); ///< Not implemented
+  const MemoryUsage& operator=(const MemoryUsage&); ///< Not implemented
+
+}; // MemoryUsage
+
+#endif // pylith_topology_memoryusage_hh
+
+
+// End of file
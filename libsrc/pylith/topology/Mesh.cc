@@ -43,6 +43,7 @@ pylith::topology::Mesh::Mesh(const bool isSubMesh) :
   _numLagrangeVertices(0),
   _coordsys(0),
   _debug(false),
+  _topologyCheck(MeshOps::CHECK_FULL),
   _isSubMesh(isSubMesh)
 { // constructor
 } // constructor
@@ -59,6 +60,7 @@ pylith::topology::Mesh::Mesh(const int dim,
   _numLagrangeVertices(0),
   _coordsys(0),
   _debug(false),
+  _topologyCheck(MeshOps::CHECK_FULL),
   _isSubMesh(false)
 { // constructor
   PYLITH_METHOD_BEGIN;
@@ -84,6 +86,7 @@ pylith::topology::Mesh::Mesh(const Mesh& mesh,
   _numLagrangeVertices(0),
   _coordsys(0),
   _debug(mesh._debug),
+  _topologyCheck(mesh._topologyCheck),
   _isSubMesh(true)
 { // Submesh constructor
   PYLITH_METHOD_BEGIN;
@@ -134,7 +137,7 @@ pylith::topology::Mesh::Mesh(const Mesh& mesh,
   err = DMPlexSetScale(_dmMesh, PETSC_UNIT_LENGTH, lengthScale);PYLITH_CHECK_ERROR(err);
 
   // Check topology
-  MeshOps::checkTopology(*this);
+  MeshOps::checkTopology(*this, _topologyCheck);
 
   PYLITH_METHOD_END;
 } // SubMesh constructor
@@ -27,6 +27,7 @@
 
 // Include directives ---------------------------------------------------
 #include "topologyfwd.hh" // forward declarations
+#include "MeshOps.hh" // USES MeshOps::TopologyCheckEnum
 #include "spatialdata/geocoords/geocoordsfwd.hh" // forward declarations
 
 #include "pylith/utils/petscfwd.h" // HASA PetscDM
@@ -138,6 +139,18 @@ public :
    */
    bool debug(void) const;
 
+  /** Set level of topology verification for meshes derived from this mesh.
+   *
+   * @param level Level of verification.
+   */
+  void topologyCheck(const MeshOps::TopologyCheckEnum level);
+
+  /** Get level of topology verification for meshes derived from this mesh.
+   *
+   * @returns Level of verification.
+   */
+  MeshOps::TopologyCheckEnum topologyCheck(void) const;
+
   /** Get dimension of mesh.
    *
    * @returns Dimension of mesh.
@@ -213,6 +226,7 @@ private :
 
   spatialdata::geocoords::CoordSys* _coordsys; ///< Coordinate system.
   bool _debug; ///< Debugging flag for mesh.
+  MeshOps::TopologyCheckEnum _topologyCheck; ///< Level of topology verification.
   const bool _isSubMesh; ///< True if mesh is a submesh of another mesh.
   
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
@@ -30,8 +30,7 @@
 #include <sstream> // USES std::ostringstream
 #include <cassert> // USES assert()
 
-#include <algorithm> // USES std::sort, std::find
-#include <map> // USES std::map
+#include <algorithm> // USES std::sort, std::find, std::min, std::max
 
 
 // ----------------------------------------------------------------------
@@ -77,13 +76,30 @@ pylith::topology::MeshOps::nondimensionalize(Mesh* const mesh,
 } // nondimensionalize
 
 
+// ----------------------------------------------------------------------
+const int pylith::topology::MeshOps::_numSampledCells = 1000;
+
 // ----------------------------------------------------------------------
 // Check topology of mesh.
 void
-pylith::topology::MeshOps::checkTopology(const Mesh& mesh)
+pylith::topology::MeshOps::checkTopology(const Mesh& mesh,
+					 const TopologyCheckEnum level)
 { // checkTopology
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
 
+  switch (level) {
+  case CHECK_OFF :
+    return;
+  case CHECK_SAMPLED :
+    _checkTopologySampled(mesh);
+    return;
+  case CHECK_FULL :
+    break;
+  default :
+    assert(0);
+    throw std::logic_error("Unknown topology check level.");
+  } // switch
+
   const int cellDim = mesh.dimension();
   const int numCorners = mesh.numCorners();
   PetscBool isSimplexMesh = PETSC_TRUE;
@@ -114,20 +130,7 @@ pylith::topology::MeshOps::checkMaterialIds(const Mesh& mesh,
   assert((!numMaterials && !materialIds) || (numMaterials && materialIds));
   PetscErrorCode err;
 
-  // Create map with indices for each material
-  std::map<int, int> materialIndex;
-  for (int i=0; i < numMaterials; ++i) {
-    materialIndex[materialIds[i]] = i;
-  } // for
-
-  int_array matCellCounts(numMaterials);
-  matCellCounts = 0;
-
   PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
-  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
-  const PetscInt cStart = cellsStratum.begin();
-  const PetscInt cEnd = cellsStratum.end();
-
   PetscDMLabel materialsLabel = NULL;
   err = DMGetLabel(dmMesh, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);assert(materialsLabel);
 
@@ -135,40 +138,56 @@ pylith::topology::MeshOps::checkMaterialIds(const Mesh& mesh,
   int *matEnd = materialIds + numMaterials;
   std::sort(matBegin, matEnd);
 
-  for (PetscInt c = cStart; c < cEnd; ++c) {
-    PetscInt matId;
-
-    err = DMLabelGetValue(materialsLabel, c, &matId);PYLITH_CHECK_ERROR(err);
+  // Check values in label against material ids using the strata of
+  // the label rather than looking up the value for every cell.
+  PetscIS valuesIS = NULL;
+  PetscInt numValues = 0;
+  const PetscInt* values = NULL;
+  err = DMLabelGetValueIS(materialsLabel, &valuesIS);PYLITH_CHECK_ERROR(err);
+  err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+    const PetscInt matId = values[iValue];
     if (matId < 0) {
       // :KLUDGE: Skip cells that are probably hybrid cells in halo
       // around fault that we currently ignore when looping over
       // materials (including cohesive cells).
       continue;
     } // if
-    const int *result = std::find(matBegin, matEnd, matId);
-    if (result == matEnd) {
+    if (std::find(matBegin, matEnd, matId) == matEnd) {
+      PetscIS pointsIS = NULL;
+      PetscInt numPoints = 0;
+      const PetscInt* points = NULL;
+      err = DMLabelGetStratumIS(materialsLabel, matId, &pointsIS);PYLITH_CHECK_ERROR(err);
+      err = ISGetLocalSize(pointsIS, &numPoints);PYLITH_CHECK_ERROR(err);assert(numPoints > 0);
+      err = ISGetIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
       std::ostringstream msg;
-      msg << "Material id '" << matId << "' for cell '" << c
+      msg << "Material id '" << matId << "' for cell '" << points[0]
           << "' does not match the id of any available materials or interfaces.";
+      err = ISRestoreIndices(pointsIS, &points);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&pointsIS);PYLITH_CHECK_ERROR(err);
+      err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
       throw std::runtime_error(msg.str());
     } // if
-
-    const int matIndex = materialIndex[matId];
-    assert(0 <= matIndex && matIndex < numMaterials);
-    ++matCellCounts[matIndex];
   } // for
+  err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
 
   // Make sure each material has cells.
+  int_array matCellCounts(numMaterials);
+  for (int i=0; i < numMaterials; ++i) {
+    PetscInt numCells = 0;
+    err = DMLabelGetStratumSize(materialsLabel, materialIds[i], &numCells);PYLITH_CHECK_ERROR(err);
+    matCellCounts[i] = numCells;
+  } // for
   int_array matCellCountsAll(matCellCounts.size());
   err = MPI_Allreduce(&matCellCounts[0], &matCellCountsAll[0],
                       matCellCounts.size(), MPI_INT, MPI_SUM, mesh.comm());PYLITH_CHECK_ERROR(err);
   for (int i=0; i < numMaterials; ++i) {
-    const int matId = materialIds[i];
-    const int matIndex = materialIndex[matId];
-    assert(0 <= matIndex && matIndex < numMaterials);
-    if (matCellCountsAll[matIndex] <= 0) {
+    if (matCellCountsAll[i] <= 0) {
       std::ostringstream msg;
-      msg << "No cells associated with material with id '" << matId << "'.";
+      msg << "No cells associated with material with id '" << materialIds[i] << "'.";
       throw std::runtime_error(msg.str());
     } // if
   } // for
@@ -193,4 +212,79 @@ pylith::topology::MeshOps::numMaterialCells(const Mesh& mesh,
 } // numMaterialCells
 
 
+// ----------------------------------------------------------------------
+// Check closure and cone/support symmetry for a sample of the cells.
+void
+pylith::topology::MeshOps::_checkTopologySampled(const Mesh& mesh)
+{ // _checkTopologySampled
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err;
+
+  DMLabel subpointMap = NULL;
+  err = DMPlexGetSubpointMap(dmMesh, &subpointMap);PYLITH_CHECK_ERROR(err);
+  const PetscInt cellHeight = subpointMap ? 1 : 0;
+
+  PetscInt cStart = 0, cEnd = 0, cMax = PETSC_DETERMINE;
+  err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax >= 0) {
+    cEnd = std::min(cEnd, cMax);
+  } // if
+  if (cEnd <= cStart) {
+    PYLITH_METHOD_END;
+  } // if
+
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  const int numCorners = mesh.numCorners();
+  const PetscInt stride = std::max(PetscInt(1), (cEnd - cStart) / _numSampledCells);
+  
+  for (PetscInt c=cStart; c < cEnd; c += stride) {
+    PetscInt closureSize = 0, *closure = NULL;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    int cellNumCorners = 0;
+    for (PetscInt iPt=0; iPt < closureSize*2; iPt += 2) {
+      const PetscInt point = closure[iPt];
+      if (point >= vStart && point < vEnd) {
+	++cellNumCorners;
+      } // if
+
+      // Each point in the cone must have this point in its support.
+      PetscInt coneSize = 0;
+      const PetscInt* cone = NULL;
+      err = DMPlexGetConeSize(dmMesh, point, &coneSize);PYLITH_CHECK_ERROR(err);
+      err = DMPlexGetCone(dmMesh, point, &cone);PYLITH_CHECK_ERROR(err);
+      for (PetscInt iCone=0; iCone < coneSize; ++iCone) {
+	PetscInt supportSize = 0;
+	const PetscInt* support = NULL;
+	err = DMPlexGetSupportSize(dmMesh, cone[iCone], &supportSize);PYLITH_CHECK_ERROR(err);
+	err = DMPlexGetSupport(dmMesh, cone[iCone], &support);PYLITH_CHECK_ERROR(err);
+	if (std::find(support, support+supportSize, point) == support+supportSize) {
+	  err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+	  std::ostringstream msg;
+	  msg << "Error in topology of mesh associated with symmetry of adjacency information. "
+	      << "Point " << point << " in closure of cell " << c << " is not in the support of point " << cone[iCone] << ".";
+	  throw std::runtime_error(msg.str());
+	} // if
+      } // for
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    if (cellNumCorners != numCorners) {
+      std::ostringstream msg;
+      msg << "Error in topology of mesh cells. Cell " << c << " has " << cellNumCorners
+	  << " vertices but expected " << numCorners << " vertices.";
+      throw std::runtime_error(msg.str());
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkTopologySampled
+
+
 // End of file 
@@ -36,6 +36,15 @@ class pylith::topology::MeshOps
 { // MeshOps
   friend class TestMeshOps; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum TopologyCheckEnum {
+    CHECK_OFF=0, ///< Skip topology checks.
+    CHECK_SAMPLED=1, ///< Check a sample of the local cells.
+    CHECK_FULL=2, ///< Check symmetry and skeleton of the entire local mesh.
+  }; // TopologyCheckEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
@@ -62,11 +71,17 @@ public :
 			 const spatialdata::units::Nondimensional& normalizer);
 
   /** Check topology of mesh.
+   *
+   * The checks only involve the local portion of the mesh on each
+   * process, so full checks of a large mesh should be done after it
+   * has been distributed.
    *
    * @param mesh Finite-element mesh.
+   * @param level Level of verification.
    */
   static
-  void checkTopology(const Mesh& mesh);
+  void checkTopology(const Mesh& mesh,
+		     const TopologyCheckEnum level =CHECK_FULL);
 
   /** Check to make sure material id of every cell matches the id of
    *  one of the materials.
@@ -90,6 +105,22 @@ public :
   static
   int numMaterialCells(const Mesh& mesh,
 		       int materialId);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Check consistency of the closure and the cone/support symmetry
+   * for a sample of the (non-hybrid) cells in the mesh.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  static
+  void _checkTopologySampled(const Mesh& mesh);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  static const int _numSampledCells; ///< Number of cells checked in sampled topology check.
   
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
@@ -22,6 +22,11 @@
 
 #include "Mesh.hh" // USES Mesh
 #include "MeshOps.hh" // USES MeshOps
+#include "Stratum.hh" // USES Stratum
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <petsctime.h> // USES PetscTime()
 
 #include <cassert> // USES assert()
 #include <sstream> // USES std::ostringstream
@@ -29,7 +34,8 @@
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::topology::RefineUniform::RefineUniform(void)
+pylith::topology::RefineUniform::RefineUniform(void) :
+  _checkTopology(MeshOps::CHECK_FULL)
 { // constructor
 } // constructor
  
@@ -45,8 +51,19 @@ pylith::topology::RefineUniform::~RefineUniform(void)
 void
 pylith::topology::RefineUniform::deallocate(void)
 { // deallocate
+  _levelNumCells.clear();
+  _levelWallTime.clear();
+  _levelMemory.clear();
 } // deallocate
 
+// ----------------------------------------------------------------------
+// Set level of topology verification of refined mesh.
+void
+pylith::topology::RefineUniform::checkTopology(const MeshOps::TopologyCheckEnum level)
+{ // checkTopology
+  _checkTopology = level;
+} // checkTopology
+
 // ----------------------------------------------------------------------
 // Refine mesh.
 void
@@ -56,14 +73,17 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
 { // refine
   PYLITH_METHOD_BEGIN;
   
+  deallocate();
   if (levels < 1) {
     PYLITH_METHOD_END;
   } // if
 
   assert(newMesh);
+  newMesh->topologyCheck(mesh.topologyCheck());
 
   PetscErrorCode err;
   PetscDM dmOrig = mesh.dmMesh();assert(dmOrig);
+  _appendStats(dmOrig, 0.0);
   
   PetscInt meshDepth = 0;
   err = DMPlexGetDepth(dmOrig, &meshDepth);
@@ -76,28 +96,146 @@ pylith::topology::RefineUniform::refine(Mesh* const newMesh,
     throw std::runtime_error(msg.str());
   } // if
 
-  // Refine, keeping original mesh intact.
+  // Refine, keeping original mesh intact. Each process refines its
+  // local portion of the distributed mesh.
   PetscDM dmNew = NULL;
+  PetscLogDouble tBegin = 0.0, tEnd = 0.0;
+  err = PetscTime(&tBegin);PYLITH_CHECK_ERROR(err);
   err = DMPlexSetRefinementUniform(dmOrig, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
   err = DMRefine(dmOrig, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
+  err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+  _appendStats(dmNew, tEnd-tBegin);
 
   for (int i=1; i < levels; ++i) {
     PetscDM dmCur = dmNew; dmNew = NULL;
+    err = PetscTime(&tBegin);PYLITH_CHECK_ERROR(err);
     err = DMPlexSetRefinementUniform(dmCur, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
     err = DMRefine(dmCur, mesh.comm(), &dmNew);PYLITH_CHECK_ERROR(err);
 
     err = DMDestroy(&dmCur);PYLITH_CHECK_ERROR(err);
+    err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+    _appendStats(dmNew, tEnd-tBegin);
   } // for
 
+  _checkLabels(dmOrig, dmNew);
   newMesh->dmMesh(dmNew);
 
   // Check consistency
-  topology::MeshOps::checkTopology(*newMesh);
+  topology::MeshOps::checkTopology(*newMesh, _checkTopology);
 
   //newMesh->view("REFINED_MESH", "::ascii_info_detail");
 
   PYLITH_METHOD_END;
 } // refine
+
+// ----------------------------------------------------------------------
+// Get number of levels in statistics from last refinement.
+int
+pylith::topology::RefineUniform::numLevels(void) const
+{ // numLevels
+  return _levelNumCells.size();
+} // numLevels
+
+// ----------------------------------------------------------------------
+// Get global number of cells at refinement level.
+PylithInt
+pylith::topology::RefineUniform::levelNumCells(const int level) const
+{ // levelNumCells
+  assert(0 <= level && level < int(_levelNumCells.size()));
+  return _levelNumCells[level];
+} // levelNumCells
+
+// ----------------------------------------------------------------------
+// Get wall time required to refine mesh to level.
+PylithScalar
+pylith::topology::RefineUniform::levelWallTime(const int level) const
+{ // levelWallTime
+  assert(0 <= level && level < int(_levelWallTime.size()));
+  return _levelWallTime[level];
+} // levelWallTime
+
+// ----------------------------------------------------------------------
+// Get memory in use after refining mesh to level.
+PylithScalar
+pylith::topology::RefineUniform::levelMemory(const int level) const
+{ // levelMemory
+  assert(0 <= level && level < int(_levelMemory.size()));
+  return _levelMemory[level];
+} // levelMemory
+
+// ----------------------------------------------------------------------
+// Append statistics for current refinement level.
+void
+pylith::topology::RefineUniform::_appendStats(const PetscDM dm,
+					      const PylithScalar wallTime)
+{ // _appendStats
+  PYLITH_METHOD_BEGIN;
+
+  assert(dm);
+
+  PetscErrorCode err;
+  PetscLogDouble memory = 0.0;
+  err = PetscMemoryGetCurrentUsage(&memory);PYLITH_CHECK_ERROR(err);
+
+  // Count only cells owned by this process (skip ghost cells). NULL
+  // leaves means the leaves are the contiguous points [0, numLeaves).
+  Stratum cellsStratum(dm, Stratum::HEIGHT, 0);
+  PetscInt numCells = cellsStratum.size();
+  PetscSF sf = NULL;
+  PetscInt numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dm, &sf);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sf, NULL, &numLeaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  for (PetscInt i=0; i < numLeaves; ++i) {
+    const PetscInt point = leaves ? leaves[i] : i;
+    if (point >= cellsStratum.begin() && point < cellsStratum.end()) {
+      --numCells;
+    } // if
+  } // for
+
+  MPI_Comm comm = PETSC_COMM_WORLD;
+  err = PetscObjectGetComm((PetscObject) dm, &comm);PYLITH_CHECK_ERROR(err);
+  PetscInt numCellsGlobal = 0;
+  double valuesLocal[2] = { wallTime, memory };
+  double valuesGlobal[2] = { 0.0, 0.0 };
+  err = MPI_Allreduce(&numCells, &numCellsGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Allreduce(valuesLocal, valuesGlobal, 2, MPI_DOUBLE, MPI_MAX, comm);PYLITH_CHECK_ERROR(err);
+
+  _levelNumCells.push_back(numCellsGlobal);
+  _levelWallTime.push_back(valuesGlobal[0]);
+  _levelMemory.push_back(valuesGlobal[1]);
+
+  PYLITH_METHOD_END;
+} // _appendStats
+
+// ----------------------------------------------------------------------
+// Check that all labels in original mesh are present in refined mesh.
+void
+pylith::topology::RefineUniform::_checkLabels(const PetscDM dmOrig,
+					      const PetscDM dmNew)
+{ // _checkLabels
+  PYLITH_METHOD_BEGIN;
+
+  assert(dmOrig);
+  assert(dmNew);
+
+  PetscErrorCode err;
+  PetscInt numLabels = 0;
+  err = DMGetNumLabels(dmOrig, &numLabels);PYLITH_CHECK_ERROR(err);
+  for (PetscInt iLabel=0; iLabel < numLabels; ++iLabel) {
+    const char* name = NULL;
+    PetscBool hasLabel = PETSC_FALSE;
+    err = DMGetLabelName(dmOrig, iLabel, &name);PYLITH_CHECK_ERROR(err);
+    err = DMHasLabel(dmNew, name, &hasLabel);PYLITH_CHECK_ERROR(err);
+    if (!hasLabel) {
+      std::ostringstream msg;
+      msg << "Label '" << name << "' lost during mesh refinement.";
+      throw std::logic_error(msg.str());
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // _checkLabels
     
 
 // End of file 
@@ -28,8 +28,21 @@
 // Include directives ---------------------------------------------------
 #include "topologyfwd.hh" // forward declarations
 
+#include "MeshOps.hh" // USES MeshOps::TopologyCheckEnum
+#include "pylith/utils/array.hh" // HASA double_vector, std::vector<PylithInt>
+#include "pylith/utils/petscfwd.h" // USES PetscDM
+
 // RefineUniform --------------------------------------------------------
-/// Object for managing uniform global mesh refinement.
+/** @brief Object for managing uniform global mesh refinement.
+ *
+ * Refinement is applied to the local (distributed) mesh on each
+ * process, so the refined mesh is never assembled on a single
+ * process. All labels, including material ids, vertex groups, and
+ * cohesive cells, are carried over to the refined mesh.
+ *
+ * Statistics (global number of cells, wall time, and maximum memory
+ * use over all processes) are collected for each refinement level.
+ */
 class pylith::topology::RefineUniform
 { // RefineUniform
   friend class TestRefineUniform; // unit testing
@@ -46,6 +59,12 @@ public :
   /// Deallocate data structures.
   void deallocate(void);
 
+  /** Set level of topology verification of refined mesh.
+   *
+   * @param level Level of topology verification.
+   */
+  void checkTopology(const MeshOps::TopologyCheckEnum level);
+
   /** Refine mesh.
    *
    * @param newMesh Refined mesh (result).
@@ -56,6 +75,63 @@ public :
 	      const Mesh& mesh,
 	      const int levels =1);
 
+  /** Get number of levels in statistics from last refinement.
+   *
+   * Level 0 corresponds to the original mesh.
+   *
+   * @returns Number of levels including original mesh.
+   */
+  int numLevels(void) const;
+
+  /** Get global number of cells at refinement level.
+   *
+   * @param level Refinement level (0 is original mesh).
+   * @returns Number of cells summed over all processes.
+   */
+  PylithInt levelNumCells(const int level) const;
+
+  /** Get wall time required to refine mesh to level.
+   *
+   * @param level Refinement level (0 is original mesh).
+   * @returns Maximum wall time (s) over all processes.
+   */
+  PylithScalar levelWallTime(const int level) const;
+
+  /** Get memory in use after refining mesh to level.
+   *
+   * @param level Refinement level (0 is original mesh).
+   * @returns Maximum memory (bytes) over all processes.
+   */
+  PylithScalar levelMemory(const int level) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Append statistics for current refinement level.
+   *
+   * @param dm PETSc DM at current refinement level.
+   * @param wallTime Wall time for refining to current level.
+   */
+  void _appendStats(const PetscDM dm,
+		    const PylithScalar wallTime);
+
+  /** Check that all labels in original mesh are present in refined mesh.
+   *
+   * @param dmOrig PETSc DM for original mesh.
+   * @param dmNew PETSc DM for refined mesh.
+   */
+  static
+  void _checkLabels(const PetscDM dmOrig,
+		    const PetscDM dmNew);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::vector<PylithInt> _levelNumCells; ///< Global number of cells at each level.
+  double_vector _levelWallTime; ///< Wall time for each level.
+  double_vector _levelMemory; ///< Memory in use after each level.
+  MeshOps::TopologyCheckEnum _checkTopology; ///< Level of topology verification.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
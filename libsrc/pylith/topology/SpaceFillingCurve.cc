@@ -0,0 +1,314 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SpaceFillingCurve.hh" // implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/utils/array.hh" // USES scalar_array, int_array
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::sort, std::min, std::max
+#include <vector> // USES std::vector
+#include <stdexcept> // USES std::logic_error
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _SpaceFillingCurve {
+
+      // Maximum number of bits in curve index.
+      const int maxBits = 63;
+
+      // Maximum number of bits per coordinate.
+      const int maxBitsCoord = 31;
+
+      // Sort key for cells.
+      struct CellKey {
+	PetscInt materialId; ///< Material id (cells are grouped by material).
+	unsigned long long index; ///< Index along space-filling curve.
+	PetscInt cell; ///< Original point number of cell.
+      }; // CellKey
+
+      // Order cells by material id, then curve index, then original number.
+      bool lessThan(const CellKey& a,
+		    const CellKey& b) {
+	if (a.materialId != b.materialId)
+	  return a.materialId < b.materialId;
+	if (a.index != b.index)
+	  return a.index < b.index;
+	return a.cell < b.cell;
+      } // lessThan
+
+    } // _SpaceFillingCurve
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Reorder vertices and cells in mesh.
+void
+pylith::topology::SpaceFillingCurve::reorder(topology::Mesh* mesh,
+					     const CurveEnum curve)
+{ // reorder
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  PetscDM dmOrig = mesh->dmMesh();assert(dmOrig);
+  PetscErrorCode err;
+
+  PetscInt dim = 0, depth = 0, pStart = 0, pEnd = 0;
+  err = DMGetDimension(dmOrig, &dim);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepth(dmOrig, &depth);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  if (dim < 1 || dim > 3) {
+    throw std::logic_error("Space-filling curve reordering only supports meshes with dimension 1, 2, or 3.");
+  } // if
+
+  // Hybrid (cohesive) points are at the end of each stratum and are
+  // left in place.
+  PetscInt hybridMax[4] = { -1, -1, -1, -1 };
+  err = DMPlexGetHybridBounds(dmOrig, &hybridMax[dim], (dim > 1) ? &hybridMax[dim-1] : PETSC_NULL, (dim > 2) ? &hybridMax[1] : PETSC_NULL, &hybridMax[0]);PYLITH_CHECK_ERROR(err);
+
+  // Bounds of each depth stratum and number of non-hybrid points in it.
+  int_array stratumBegin(depth+1);
+  int_array stratumEnd(depth+1);
+  int_array stratumMax(depth+1);
+  for (PetscInt d=0; d <= depth; ++d) {
+    PetscInt sStart = 0, sEnd = 0;
+    err = DMPlexGetDepthStratum(dmOrig, d, &sStart, &sEnd);PYLITH_CHECK_ERROR(err);
+    const PetscInt hMax = (d == depth) ? hybridMax[dim] : hybridMax[d];
+    stratumBegin[d] = sStart;
+    stratumEnd[d] = sEnd;
+    stratumMax[d] = (hMax >= 0) ? std::min(hMax, sEnd) : sEnd;
+  } // for
+
+  // Compute cell centroids and bounding box of centroids.
+  const PetscInt cStart = stratumBegin[depth];
+  const PetscInt cMax = stratumMax[depth];
+  const PetscInt numCells = cMax - cStart;
+  scalar_array centroids(numCells*dim);
+  scalar_array bboxMin(dim);
+  scalar_array bboxMax(dim);
+  for (int iDim=0; iDim < dim; ++iDim) {
+    bboxMin[iDim] = PETSC_MAX_REAL;
+    bboxMax[iDim] = PETSC_MIN_REAL;
+  } // for
+
+  topology::CoordsVisitor coordsVisitor(dmOrig);
+  for (PetscInt c = cStart; c < cMax; ++c) {
+    PetscScalar* coordsCell = NULL;
+    PetscInt coordsSize = 0;
+    coordsVisitor.getClosure(&coordsCell, &coordsSize, c);
+    const int numVertices = coordsSize / dim;assert(numVertices > 0);
+    for (int iDim=0; iDim < dim; ++iDim) {
+      PylithScalar value = 0.0;
+      for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+	value += coordsCell[iVertex*dim+iDim];
+      } // for
+      value /= numVertices;
+      centroids[(c-cStart)*dim+iDim] = value;
+      bboxMin[iDim] = std::min(bboxMin[iDim], value);
+      bboxMax[iDim] = std::max(bboxMax[iDim], value);
+    } // for
+    coordsVisitor.restoreClosure(&coordsCell, &coordsSize, c);
+  } // for
+
+  // Quantize centroids and compute index along curve.
+  const int numBits = std::min(_SpaceFillingCurve::maxBitsCoord, _SpaceFillingCurve::maxBits / dim);
+  const PylithScalar maxQuantized = PylithScalar((1ULL << numBits) - 1);
+  PetscDMLabel materialsLabel = NULL;
+  err = DMGetLabel(dmOrig, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);
+
+  std::vector<_SpaceFillingCurve::CellKey> cellKeys(numCells);
+  for (PetscInt c = cStart; c < cMax; ++c) {
+    unsigned long long coordsInt[3];
+    for (int iDim=0; iDim < dim; ++iDim) {
+      const PylithScalar range = bboxMax[iDim] - bboxMin[iDim];
+      const PylithScalar xi = (range > 0.0) ? (centroids[(c-cStart)*dim+iDim] - bboxMin[iDim]) / range : 0.0;
+      coordsInt[iDim] = (unsigned long long)(xi * maxQuantized);
+    } // for
+
+    _SpaceFillingCurve::CellKey& key = cellKeys[c-cStart];
+    key.materialId = 0;
+    if (materialsLabel) {
+      err = DMLabelGetValue(materialsLabel, c, &key.materialId);PYLITH_CHECK_ERROR(err);
+    } // if
+    key.index = _curveIndex(coordsInt, dim, numBits, curve);
+    key.cell = c;
+  } // for
+  std::sort(cellKeys.begin(), cellKeys.end(), _SpaceFillingCurve::lessThan);
+
+  // Create permutation: perm[old point] = new point. Non-hybrid
+  // cells follow the sorted keys; all other non-hybrid points are
+  // numbered by first touch in the closures of the reordered cells.
+  int_array perm(-1, pEnd-pStart);
+  int_array nextPoint(stratumBegin);
+  for (PetscInt d=0; d <= depth; ++d) {
+    for (PetscInt p = stratumMax[d]; p < stratumEnd[d]; ++p) {
+      perm[p-pStart] = p;
+    } // for
+  } // for
+
+  for (PetscInt i=0; i < numCells; ++i) {
+    const PetscInt cell = cellKeys[i].cell;
+    perm[cell-pStart] = nextPoint[depth]++;
+
+    PetscInt closureSize = 0, *closure = NULL;
+    err = DMPlexGetTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+      const PetscInt point = closure[cl];
+      if (perm[point-pStart] >= 0) {
+	continue;
+      } // if
+      for (PetscInt d=0; d < depth; ++d) {
+	if (point >= stratumBegin[d] && point < stratumMax[d]) {
+	  perm[point-pStart] = nextPoint[d]++;
+	  break;
+	} // if
+      } // for
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Points not in the closure of any non-hybrid cell keep their
+  // relative order after the touched points.
+  for (PetscInt d=0; d < depth; ++d) {
+    for (PetscInt p = stratumBegin[d]; p < stratumMax[d]; ++p) {
+      if (perm[p-pStart] < 0) {
+	perm[p-pStart] = nextPoint[d]++;
+      } // if
+    } // for
+    assert(nextPoint[d] == stratumMax[d]);
+  } // for
+  assert(nextPoint[depth] == stratumMax[depth]);
+
+  PetscIS permutation = NULL;
+  PetscDM dmNew = NULL;
+  err = ISCreateGeneral(PETSC_COMM_SELF, pEnd-pStart, &perm[0], PETSC_COPY_VALUES, &permutation);PYLITH_CHECK_ERROR(err);
+  err = ISSetPermutation(permutation);PYLITH_CHECK_ERROR(err);
+  err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+  mesh->dmMesh(dmNew);
+
+  PYLITH_METHOD_END;
+} // reorder
+
+// ----------------------------------------------------------------------
+// Compute mean span of vertex indices over cell closures.
+PylithScalar
+pylith::topology::SpaceFillingCurve::closureSpan(const topology::Mesh& mesh)
+{ // closureSpan
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err;
+
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt cEnd = cellsStratum.end();
+
+  PylithScalar spanSum = 0.0;
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    PetscInt closureSize = 0, *closure = NULL;
+    PetscInt vMin = vEnd, vMax = vStart;
+    err = DMPlexGetTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+      const PetscInt point = closure[cl];
+      if (point >= vStart && point < vEnd) {
+	vMin = std::min(vMin, point);
+	vMax = std::max(vMax, point);
+      } // if
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, c, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    if (vMax >= vMin) {
+      spanSum += vMax - vMin;
+    } // if
+  } // for
+
+  const PylithScalar span = (cEnd > cStart) ? spanSum / (cEnd - cStart) : 0.0;
+
+  PYLITH_METHOD_RETURN(span);
+} // closureSpan
+
+// ----------------------------------------------------------------------
+// Compute index along space-filling curve.
+unsigned long long
+pylith::topology::SpaceFillingCurve::_curveIndex(unsigned long long coords[],
+						 const int dim,
+						 const int numBits,
+						 const CurveEnum curve)
+{ // _curveIndex
+  assert(numBits > 0);
+  assert(dim*numBits <= _SpaceFillingCurve::maxBits);
+
+  if (HILBERT == curve && dim > 1) {
+    // Convert coordinates to the transpose of the Hilbert index
+    // (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc.,
+    // 2004).
+    const unsigned long long M = 1ULL << (numBits-1);
+    for (unsigned long long Q = M; Q > 1; Q >>= 1) {
+      const unsigned long long P = Q - 1;
+      for (int i=0; i < dim; ++i) {
+	if (coords[i] & Q) {
+	  coords[0] ^= P; // invert
+	} else {
+	  const unsigned long long t = (coords[0] ^ coords[i]) & P; // exchange
+	  coords[0] ^= t;
+	  coords[i] ^= t;
+	} // if/else
+      } // for
+    } // for
+
+    // Gray encode
+    for (int i=1; i < dim; ++i) {
+      coords[i] ^= coords[i-1];
+    } // for
+    unsigned long long t = 0;
+    for (unsigned long long Q = M; Q > 1; Q >>= 1) {
+      if (coords[dim-1] & Q) {
+	t ^= Q - 1;
+      } // if
+    } // for
+    for (int i=0; i < dim; ++i) {
+      coords[i] ^= t;
+    } // for
+  } else if (HILBERT != curve && MORTON != curve) {
+    throw std::logic_error("Unknown space-filling curve.");
+  } // if/else
+
+  // Interleave bits, most significant first.
+  unsigned long long index = 0;
+  for (int iBit=numBits-1; iBit >= 0; --iBit) {
+    for (int i=0; i < dim; ++i) {
+      index = (index << 1) | ((coords[i] >> iBit) & 1ULL);
+    } // for
+  } // for
+
+  return index;
+} // _curveIndex
+
+
+// End of file
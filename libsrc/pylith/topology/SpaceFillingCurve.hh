@@ -0,0 +1,113 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/SpaceFillingCurve.hh
+ *
+ * @brief Reordering of mesh cells and vertices along a space-filling
+ * curve for cache locality.
+ */
+
+#if !defined(pylith_topology_spacefillingcurve_hh)
+#define pylith_topology_spacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+// SpaceFillingCurve ----------------------------------------------------
+/** @brief Reordering of mesh cells and vertices along a space-filling
+ * curve.
+ *
+ * Cells are grouped by material id and ordered within each material
+ * by the position of their centroid along a Hilbert or Morton
+ * curve. All other points (vertices, edges, faces) are numbered in
+ * the order in which they are first touched by the closures of the
+ * reordered cells. Cohesive (hybrid) points remain at the end of
+ * their strata.
+ *
+ * Unlike reverse Cuthill-McKee, which minimizes the bandwidth of the
+ * Jacobian, this ordering targets reuse of vertex data in the cell
+ * loops over each material.
+ */
+class pylith::topology::SpaceFillingCurve
+{ // SpaceFillingCurve
+  friend class TestSpaceFillingCurve; // unit testing
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  enum CurveEnum {
+    HILBERT=0, ///< Hilbert curve.
+    MORTON=1, ///< Morton (Z-order) curve.
+  }; // CurveEnum
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Reorder vertices and cells of mesh along a space-filling curve.
+   *
+   * @param mesh PyLith finite-element mesh.
+   * @param curve Type of space-filling curve.
+   */
+  static
+  void reorder(topology::Mesh* mesh,
+	       const CurveEnum curve =HILBERT);
+
+  /** Compute the mean span of vertex indices over the closures of
+   * the cells in the mesh.
+   *
+   * This is a simple measure of the locality of the vertex data
+   * gathered in cell loops and is used to compare orderings.
+   *
+   * @param mesh PyLith finite-element mesh.
+   * @returns Mean of (max - min) vertex index over cells.
+   */
+  static
+  PylithScalar closureSpan(const topology::Mesh& mesh);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute index along a space-filling curve of a point with
+   * integer coordinates.
+   *
+   * @param coords Integer coordinates of point (modified).
+   * @param dim Number of coordinates.
+   * @param numBits Number of bits per coordinate.
+   * @param curve Type of space-filling curve.
+   * @returns Index along curve.
+   */
+  static
+  unsigned long long _curveIndex(unsigned long long coords[],
+				 const int dim,
+				 const int numBits,
+				 const CurveEnum curve);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  SpaceFillingCurve(void); ///< Not Implemented
+  SpaceFillingCurve(const SpaceFillingCurve&); ///< Not implemented
+  const SpaceFillingCurve& operator=(const SpaceFillingCurve&); ///< Not implemented
+
+}; // SpaceFillingCurve
+
+#endif // pylith_topology_spacefillingcurve_hh
+
+
+// End of file
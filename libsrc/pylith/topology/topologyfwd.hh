@@ -34,6 +34,8 @@ namespace pylith {
 
     class Mesh;
     class MeshOps;
+    class MemoryUsage;
+    class LoadBalance;
     class CoordsVisitor;
     class SubMeshIS;
     class Stratum;
@@ -56,6 +58,7 @@ namespace pylith {
     class RefineUniform;
 
     class ReverseCuthillMcKee;
+    class SpaceFillingCurve;
 
   } // topology
 } // pylith
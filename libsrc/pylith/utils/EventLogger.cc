@@ -24,8 +24,140 @@
 
 #include <stdexcept> // USES std::runtime_error
 #include <sstream> // USES std::ostringstream
+#include <iterator> // USES std::advance()
 #include <cassert> // USES assert()
 
+// ----------------------------------------------------------------------
+pylith::utils::EventLogger::DetailEnum pylith::utils::EventLogger::_detailLevel = pylith::utils::EventLogger::DETAIL_NONE;
+int pylith::utils::EventLogger::_sampleInterval = 64;
+pylith::utils::EventLogger::map_bytes_type pylith::utils::EventLogger::_bytes;
+
+// ----------------------------------------------------------------------
+// Set level of detail for events logged with EventSampler.
+void
+pylith::utils::EventLogger::detailLevel(const DetailEnum value)
+{ // detailLevel
+  _detailLevel = value;
+} // detailLevel
+
+// ----------------------------------------------------------------------
+// Set interval between timed occurrences of detailed events when sampling.
+void
+pylith::utils::EventLogger::sampleInterval(const int value)
+{ // sampleInterval
+  if (value < 1) {
+    std::ostringstream msg;
+    msg << "Interval for sampling detailed events (" << value << ") must be positive.";
+    throw std::invalid_argument(msg.str());
+  } // if
+  _sampleInterval = value;
+} // sampleInterval
+
+// ----------------------------------------------------------------------
+// Add bytes moved between memory and cell (or vertex) arrays to event.
+void
+pylith::utils::EventLogger::logBytes(const int id,
+				     const double bytes)
+{ // logBytes
+  _bytes[id] += bytes;
+} // logBytes
+
+// ----------------------------------------------------------------------
+// Get bytes logged for event.
+double
+pylith::utils::EventLogger::eventBytes(const int id)
+{ // eventBytes
+  const map_bytes_type::const_iterator iter = _bytes.find(id);
+  return (iter != _bytes.end()) ? iter->second : 0.0;
+} // eventBytes
+
+// ----------------------------------------------------------------------
+// Get number of events with logged bytes.
+int
+pylith::utils::EventLogger::numBytesEvents(void)
+{ // numBytesEvents
+  return _bytes.size();
+} // numBytesEvents
+
+// ----------------------------------------------------------------------
+// Get identifier of event with logged bytes.
+int
+pylith::utils::EventLogger::bytesEvent(const int index)
+{ // bytesEvent
+  if (index < 0 || index >= int(_bytes.size())) {
+    std::ostringstream msg;
+    msg << "Index (" << index << ") of event with logged bytes must be in [0, " << _bytes.size() << ").";
+    throw std::out_of_range(msg.str());
+  } // if
+  map_bytes_type::const_iterator iter = _bytes.begin();
+  std::advance(iter, index);
+  return iter->first;
+} // bytesEvent
+
+// ----------------------------------------------------------------------
+// Get floating point operations for event summed over all stages.
+double
+pylith::utils::EventLogger::eventFlops(const int id)
+{ // eventFlops
+  double time = 0.0;
+  double flops = 0.0;
+  _eventPerfTotals(&time, &flops, id);
+  return flops;
+} // eventFlops
+
+// ----------------------------------------------------------------------
+// Get time for event summed over all stages.
+double
+pylith::utils::EventLogger::eventTime(const int id)
+{ // eventTime
+  double time = 0.0;
+  double flops = 0.0;
+  _eventPerfTotals(&time, &flops, id);
+  return time;
+} // eventTime
+
+// ----------------------------------------------------------------------
+// Get name of event.
+const char*
+pylith::utils::EventLogger::eventName(const int id)
+{ // eventName
+  PetscStageLog stageLog = 0;
+  PetscErrorCode err = PetscLogGetStageLog(&stageLog);
+  if (err || !stageLog || !stageLog->eventLog || id < 0 || id >= stageLog->eventLog->numEvents) {
+    std::ostringstream msg;
+    msg << "Could not find name of logging event with identifier " << id << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+  return stageLog->eventLog->eventInfo[id].name;
+} // eventName
+
+// ----------------------------------------------------------------------
+// Get time and floating point operations for event summed over all stages.
+void
+pylith::utils::EventLogger::_eventPerfTotals(double* time,
+					     double* flops,
+					     const int id)
+{ // _eventPerfTotals
+  assert(time);
+  assert(flops);
+
+  *time = 0.0;
+  *flops = 0.0;
+
+  // Totals are only available if PETSc logging is active.
+  PetscStageLog stageLog = 0;
+  if (!PetscLogPLB || PetscLogGetStageLog(&stageLog) || !stageLog) {
+    return;
+  } // if
+  for (int iStage=0; iStage < stageLog->numStages; ++iStage) {
+    PetscEventPerfLog eventLog = 0;
+    if (!PetscStageLogGetEventPerfLog(stageLog, iStage, &eventLog) && eventLog && id >= 0 && id < eventLog->numEvents) {
+      *time += eventLog->eventInfo[id].time;
+      *flops += eventLog->eventInfo[id].flops;
+    } // if
+  } // for
+} // _eventPerfTotals
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::utils::EventLogger::EventLogger(void) :
@@ -109,8 +241,13 @@ pylith::utils::EventLogger::registerStage(const char* name)
   PYLITH_METHOD_BEGIN;
 
   assert(_classId);
-  int id = 0;
-  PetscErrorCode err = PetscLogStageRegister(name, &id);
+  // Reuse stage if it has already been registered (possibly by
+  // another logger), so that each stage appears once in the log.
+  int id = -1;
+  PetscErrorCode err = PetscLogStageGetId(name, &id);
+  if (!err && id < 0) {
+    err = PetscLogStageRegister(name, &id);
+  } // if
   if (err) {
     std::ostringstream msg;
     msg << "Could not register logging stage '" << name << "'.";
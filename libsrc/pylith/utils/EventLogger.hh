@@ -30,6 +30,8 @@
 // Include directives ---------------------------------------------------
 #include "utilsfwd.hh" // forward declarations
 
+#include "EventTracer.hh" // USES EventTracer in inline methods
+
 #include <string> // USES std::string
 #include <map> // USES std::map
 
@@ -45,9 +47,114 @@ class pylith::utils::EventLogger
 { // EventLogger
   friend class TestEventLogger; // unit testing
 
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Level of detail for events inside loops over cells and vertices.
+  enum DetailEnum {
+    DETAIL_NONE=0, ///< Do not log detailed events.
+    DETAIL_SAMPLED=1, ///< Time every Nth occurrence and extrapolate totals.
+    DETAIL_FULL=2 ///< Log every occurrence as a PETSc event.
+  }; // DetailEnum
+
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
 public :
 
+  /** Set level of detail for events logged with EventSampler.
+   *
+   * The level applies to all loggers and must be set before the
+   * loops with detailed events are executed.
+   *
+   * @param value Level of detail.
+   */
+  static
+  void detailLevel(const DetailEnum value);
+
+  /** Get level of detail for events logged with EventSampler.
+   *
+   * @returns Level of detail.
+   */
+  static
+  DetailEnum detailLevel(void);
+
+  /** Set interval between timed occurrences of detailed events when
+   * sampling.
+   *
+   * @param value Interval (time every Nth occurrence).
+   */
+  static
+  void sampleInterval(const int value);
+
+  /** Get interval between timed occurrences of detailed events when
+   * sampling.
+   *
+   * @returns Interval.
+   */
+  static
+  int sampleInterval(void);
+
+  /** Add bytes moved between memory and cell (or vertex) arrays to
+   * event.
+   *
+   * PETSc only tracks floating point operations for events, so we
+   * track the bytes separately to compute the arithmetic intensity
+   * of events. The bytes are the total over all stages.
+   *
+   * @param id Event identifier.
+   * @param bytes Number of bytes.
+   */
+  static
+  void logBytes(const int id,
+		const double bytes);
+
+  /** Get bytes logged for event.
+   *
+   * @param id Event identifier.
+   * @returns Number of bytes.
+   */
+  static
+  double eventBytes(const int id);
+
+  /** Get number of events with logged bytes.
+   *
+   * @returns Number of events.
+   */
+  static
+  int numBytesEvents(void);
+
+  /** Get identifier of event with logged bytes.
+   *
+   * @param index Index of event in [0, numBytesEvents()).
+   * @returns Event identifier.
+   */
+  static
+  int bytesEvent(const int index);
+
+  /** Get floating point operations for event summed over all stages.
+   *
+   * @param id Event identifier.
+   * @returns Number of floating point operations (0 if PETSc logging
+   * is not active).
+   */
+  static
+  double eventFlops(const int id);
+
+  /** Get time for event summed over all stages.
+   *
+   * @param id Event identifier.
+   * @returns Time in seconds (0 if PETSc logging is not active).
+   */
+  static
+  double eventTime(const int id);
+
+  /** Get name of event.
+   *
+   * @param id Event identifier.
+   * @returns Name of event.
+   */
+  static
+  const char* eventName(const int id);
+
   /// Constructor
   EventLogger(void);
 
@@ -125,6 +232,18 @@ public :
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
+  /** Get time and floating point operations for event summed over
+   * all stages.
+   *
+   * @param time Time in seconds.
+   * @param flops Number of floating point operations.
+   * @param id Event identifier.
+   */
+  static
+  void _eventPerfTotals(double* time,
+			double* flops,
+			const int id);
+
   EventLogger(const EventLogger&); ///< Not implemented
   const EventLogger& operator=(const EventLogger&); ///< Not implemented
 
@@ -132,6 +251,7 @@ private :
 private :
 
   typedef std::map<std::string,int> map_event_type;
+  typedef std::map<int,double> map_bytes_type;
 
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
@@ -141,6 +261,10 @@ private :
   map_event_type _events; ///< PETSc logging identifiers for events
   map_event_type _stages; ///< PETSc logging identifiers for stages
 
+  static DetailEnum _detailLevel; ///< Level of detail for detailed events.
+  static int _sampleInterval; ///< Interval between timed occurrences when sampling.
+  static map_bytes_type _bytes; ///< Bytes moved for events.
+
 }; // EventLogger
 
 #include "EventLogger.icc" // inline methods
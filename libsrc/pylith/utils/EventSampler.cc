@@ -0,0 +1,73 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "EventSampler.hh" // Implementation of class methods
+
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::utils::EventSampler::EventSampler(void) :
+  _level(EventLogger::detailLevel()),
+  _interval(EventLogger::sampleInterval())
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::utils::EventSampler::~EventSampler(void)
+{ // destructor
+  flush();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Add extrapolated totals of sampled events to PETSc event log.
+void
+pylith::utils::EventSampler::flush(void)
+{ // flush
+  if (_accumulators.empty()) {
+    return;
+  } // if
+
+  // Only add to the log if PETSc logging is active.
+  PetscStageLog stageLog = 0;
+  int stage = -1;
+  PetscEventPerfLog eventLog = 0;
+  if (PetscLogPLB &&
+      !PetscLogGetStageLog(&stageLog) &&
+      !PetscStageLogGetCurrent(stageLog, &stage) && stage >= 0 &&
+      !PetscStageLogGetEventPerfLog(stageLog, stage, &eventLog)) {
+    assert(eventLog);
+    const size_t numEvents = _accumulators.size();
+    for (size_t i=0; i < numEvents; ++i) {
+      const Accumulator& info = _accumulators[i];
+      if (info.numSampled > 0 && info.id >= 0 && info.id < eventLog->numEvents) {
+	PetscEventPerfInfo& perfInfo = eventLog->eventInfo[info.id];
+	perfInfo.time += info.time * PetscLogDouble(info.count) / PetscLogDouble(info.numSampled);
+	perfInfo.count += info.count;
+      } // if
+    } // for
+  } // if
+
+  _accumulators.clear();
+} // flush
+
+
+// End of file
@@ -0,0 +1,121 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/EventSampler.hh
+ *
+ * @brief C++ object for logging detailed events inside loops over
+ * cells and vertices.
+ */
+
+#if !defined(pylith_utils_eventsampler_hh)
+#define pylith_utils_eventsampler_hh
+
+// Include directives ---------------------------------------------------
+#include "EventLogger.hh" // USES EventLogger::DetailEnum
+
+#include <vector> // USES std::vector
+
+#include "petsctime.h" // USES PetscTime() in inline methods
+
+// EventSampler ---------------------------------------------------------
+/** @brief C++ object for logging detailed events inside loops over
+ * cells and vertices.
+ *
+ * The level of detail is set at runtime via
+ * EventLogger::detailLevel(). With DETAIL_NONE, begin() and end() do
+ * nothing. With DETAIL_FULL, every occurrence is logged as a PETSc
+ * event. With DETAIL_SAMPLED, only every Nth occurrence of each event
+ * is timed; the accumulated time is extrapolated to all occurrences
+ * and added to the PETSc event log when the sampler is flushed (or
+ * destroyed), so the overhead of the other occurrences is a counter
+ * increment.
+ *
+ * A sampler is meant to be a local variable in a method with a loop
+ * over cells or vertices, so the totals are added to the PETSc stage
+ * that is current when the loop is executed.
+ */
+class pylith::utils::EventSampler
+{ // EventSampler
+  friend class TestEventSampler; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  EventSampler(void);
+
+  /// Destructor
+  ~EventSampler(void);
+
+  /** Log event begin.
+   *
+   * @param id Event identifier.
+   */
+  void begin(const int id);
+
+  /** Log event end.
+   *
+   * @param id Event identifier.
+   */
+  void end(const int id);
+
+  /// Add extrapolated totals of sampled events to PETSc event log.
+  void flush(void);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Timing of sampled event.
+  struct Accumulator {
+    int id; ///< Event identifier.
+    int count; ///< Number of occurrences.
+    int numSampled; ///< Number of timed occurrences.
+    bool isSampled; ///< True if current occurrence is timed.
+    PetscLogDouble tBegin; ///< Time at beginning of current occurrence.
+    PetscLogDouble time; ///< Total time of timed occurrences.
+  }; // Accumulator
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Get accumulator for event, creating it if necessary.
+   *
+   * @param id Event identifier.
+   * @returns Accumulator for event.
+   */
+  Accumulator& _accumulator(const int id);
+
+  EventSampler(const EventSampler&); ///< Not implemented
+  const EventSampler& operator=(const EventSampler&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  const EventLogger::DetailEnum _level; ///< Level of detail.
+  const int _interval; ///< Interval between timed occurrences.
+  std::vector<Accumulator> _accumulators; ///< Timing of sampled events.
+
+}; // EventSampler
+
+#include "EventSampler.icc" // inline methods
+
+#endif // pylith_utils_eventsampler_hh
+
+
+// End of file
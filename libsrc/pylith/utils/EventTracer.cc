@@ -0,0 +1,192 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "EventTracer.hh" // implementation of class methods
+
+#include "error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petsclog.h" // USES PetscLogGetStageLog(), PetscStageLog
+
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setprecision
+#include <stdexcept> // USES std::invalid_argument, std::runtime_error
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+bool pylith::utils::EventTracer::_enabled = false;
+std::vector<pylith::utils::EventTracer::Record> pylith::utils::EventTracer::_records;
+size_t pylith::utils::EventTracer::_next = 0;
+size_t pylith::utils::EventTracer::_numRecorded = 0;
+PetscLogDouble pylith::utils::EventTracer::_tStart = 0.0;
+
+// ----------------------------------------------------------------------
+// Start recording events, discarding any previous records.
+void
+pylith::utils::EventTracer::enable(const int capacity)
+{ // enable
+  PYLITH_METHOD_BEGIN;
+
+  if (capacity < 1) {
+    std::ostringstream msg;
+    msg << "Capacity of event tracer (" << capacity << ") must be positive.";
+    throw std::invalid_argument(msg.str());
+  } // if
+
+  _records.resize(capacity);
+  _next = 0;
+  _numRecorded = 0;
+  PetscTime(&_tStart);
+  _enabled = true;
+
+  PYLITH_METHOD_END;
+} // enable
+
+// ----------------------------------------------------------------------
+// Stop recording events.
+void
+pylith::utils::EventTracer::disable(void)
+{ // disable
+  _enabled = false;
+} // disable
+
+// ----------------------------------------------------------------------
+// Get number of records in ring buffer.
+int
+pylith::utils::EventTracer::numRecords(void)
+{ // numRecords
+  return int((_numRecorded < _records.size()) ? _numRecorded : _records.size());
+} // numRecords
+
+// ----------------------------------------------------------------------
+// Get number of records overwritten because the ring buffer was full.
+int
+pylith::utils::EventTracer::numDropped(void)
+{ // numDropped
+  return int((_numRecorded > _records.size()) ? _numRecorded - _records.size() : 0);
+} // numDropped
+
+// ----------------------------------------------------------------------
+// Record end of current PETSc stage.
+void
+pylith::utils::EventTracer::stagePop(void)
+{ // stagePop
+  if (!_enabled) {
+    return;
+  } // if
+
+  PetscStageLog stageLog = 0;
+  int stage = -1;
+  if (!PetscLogGetStageLog(&stageLog) && stageLog) {
+    PetscStageLogGetCurrent(stageLog, &stage);
+  } // if
+  _record(STAGE_END, stage, 0);
+} // stagePop
+
+// ----------------------------------------------------------------------
+// Write records in ring buffer to file in Chrome trace event format.
+void
+pylith::utils::EventTracer::write(const char* filename,
+				  const int rank)
+{ // write
+  PYLITH_METHOD_BEGIN;
+
+  assert(filename);
+
+  std::ofstream fout(filename);
+  if (!(fout.is_open() && fout.good())) {
+    std::ostringstream msg;
+    msg << "Could not open trace file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  // Names of events and stages are only available while PETSc is
+  // initialized.
+  PetscStageLog stageLog = 0;
+  if (PetscLogGetStageLog(&stageLog)) {
+    stageLog = 0;
+  } // if
+
+  fout << "{\"traceEvents\":[\n"
+       << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank << ",\"tid\":0,\"args\":{\"name\":\"rank " << rank << "\"}}";
+
+  const size_t numInBuffer = EventTracer::numRecords();
+  const size_t iStart = (_numRecorded > _records.size()) ? _next : 0;
+  int depth = 0;
+  fout << std::fixed << std::setprecision(3);
+  for (size_t i=0; i < numInBuffer; ++i) {
+    const Record& record = _records[(iStart + i) % _records.size()];
+
+    // Skip ends whose beginnings were overwritten in the ring buffer.
+    const bool isBegin = EVENT_BEGIN == record.kind || STAGE_BEGIN == record.kind || SPAN_BEGIN == record.kind;
+    if (isBegin) {
+      ++depth;
+    } else if (depth > 0) {
+      --depth;
+    } else {
+      continue;
+    } // if/else
+
+    fout << ",\n{\"name\":\"";
+    switch (record.kind) {
+    case EVENT_BEGIN :
+    case EVENT_END :
+      if (stageLog && stageLog->eventLog && record.id >= 0 && record.id < stageLog->eventLog->numEvents) {
+	fout << stageLog->eventLog->eventInfo[record.id].name;
+      } else {
+	fout << "event " << record.id;
+      } // if/else
+      fout << "\",\"cat\":\"event";
+      break;
+    case STAGE_BEGIN :
+    case STAGE_END :
+      if (stageLog && record.id >= 0 && record.id < stageLog->numStages) {
+	fout << stageLog->stageInfo[record.id].name;
+      } else {
+	fout << "stage " << record.id;
+      } // if/else
+      fout << "\",\"cat\":\"stage";
+      break;
+    case SPAN_BEGIN :
+    case SPAN_END :
+      fout << (record.name ? record.name : "span") << "\",\"cat\":\"span";
+      break;
+    default :
+      assert(0);
+      throw std::logic_error("Unknown kind of record in event tracer.");
+    } // switch
+    fout << "\",\"ph\":\"" << (isBegin ? "B" : "E") << "\""
+	 << ",\"ts\":" << 1.0e+6*(record.time - _tStart)
+	 << ",\"pid\":" << rank << ",\"tid\":0}";
+  } // for
+
+  fout << "\n],\n\"displayTimeUnit\":\"ms\",\n"
+       << "\"otherData\":{\"numDropped\":" << numDropped() << "}}\n";
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing trace file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // write
+
+
+// End of file
@@ -0,0 +1,213 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/EventTracer.hh
+ *
+ * @brief Record timestamped spans of events and stages for viewing
+ * as a timeline.
+ */
+
+#if !defined(pylith_utils_eventtracer_hh)
+#define pylith_utils_eventtracer_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include <vector> // USES std::vector
+
+#include "petscsys.h"
+#include "petsctime.h" // USES PetscTime() in inline methods
+
+// EventTracer ----------------------------------------------------------
+/** @brief Record timestamped spans of events and stages for viewing
+ * as a timeline.
+ *
+ * PETSc logging only gives aggregate times for events and stages, so
+ * it does not show the order of events within a time step or where a
+ * process waits on the others. When the tracer is enabled,
+ * EventLogger records the beginning and end of every event and stage
+ * in a fixed-size ring buffer, and other code can add spans (for
+ * example, waiting on MPI communication in scatters). Once the buffer
+ * is full the oldest records are overwritten, so the trace always
+ * holds the most recent activity and the memory use is bounded.
+ *
+ * The trace is written in the Chrome trace event format (JSON), which
+ * can be viewed with chrome://tracing or Perfetto
+ * (https://ui.perfetto.dev). Each process writes its own file with
+ * the rank as the process identifier, so the files from several
+ * processes can be loaded together. Timestamps are relative to the
+ * time the tracer was enabled on each process.
+ *
+ * When the tracer is disabled the overhead is a test of a static
+ * flag. Names of events and stages are looked up in the PETSc event
+ * log when the trace is written, so it must be written before PETSc
+ * is finalized.
+ */
+class pylith::utils::EventTracer
+{ // EventTracer
+  friend class TestEventTracer; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Start recording events, discarding any previous records.
+   *
+   * @param capacity Maximum number of records kept in ring buffer.
+   */
+  static
+  void enable(const int capacity);
+
+  /// Stop recording events (records are kept until next enable()).
+  static
+  void disable(void);
+
+  /** Is the tracer recording events?
+   *
+   * @returns True if enabled, false otherwise.
+   */
+  static
+  bool isEnabled(void);
+
+  /** Get number of records in ring buffer.
+   *
+   * @returns Number of records.
+   */
+  static
+  int numRecords(void);
+
+  /** Get number of records overwritten because the ring buffer was
+   * full.
+   *
+   * @returns Number of records.
+   */
+  static
+  int numDropped(void);
+
+  /** Record beginning of PETSc event.
+   *
+   * @param id Event identifier.
+   */
+  static
+  void eventBegin(const int id);
+
+  /** Record end of PETSc event.
+   *
+   * @param id Event identifier.
+   */
+  static
+  void eventEnd(const int id);
+
+  /** Record beginning of PETSc stage.
+   *
+   * @param id Stage identifier.
+   */
+  static
+  void stagePush(const int id);
+
+  /// Record end of current PETSc stage (call before popping stage).
+  static
+  void stagePop(void);
+
+  /** Record beginning of span that is not a PETSc event.
+   *
+   * @param name Name of span (must be a string literal, because only
+   * the pointer is stored).
+   */
+  static
+  void spanBegin(const char* name);
+
+  /** Record end of span that is not a PETSc event.
+   *
+   * @param name Name of span (must be a string literal).
+   */
+  static
+  void spanEnd(const char* name);
+
+  /** Write records in ring buffer to file in Chrome trace event
+   * format.
+   *
+   * @param filename Name of file.
+   * @param rank Rank of process (used as process identifier).
+   */
+  static
+  void write(const char* filename,
+	     const int rank);
+
+// PRIVATE ENUMS ////////////////////////////////////////////////////////
+private :
+
+  /// Kind of record.
+  enum RecordEnum {
+    EVENT_BEGIN=0, ///< Beginning of PETSc event.
+    EVENT_END=1, ///< End of PETSc event.
+    STAGE_BEGIN=2, ///< Beginning of PETSc stage.
+    STAGE_END=3, ///< End of PETSc stage.
+    SPAN_BEGIN=4, ///< Beginning of span.
+    SPAN_END=5 ///< End of span.
+  }; // RecordEnum
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Timestamped record.
+  struct Record {
+    PetscLogDouble time; ///< Time of record.
+    const char* name; ///< Name of span (NULL for events and stages).
+    int id; ///< Identifier of event or stage.
+    RecordEnum kind; ///< Kind of record.
+  }; // Record
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Add record to ring buffer.
+   *
+   * @param kind Kind of record.
+   * @param id Identifier of event or stage.
+   * @param name Name of span.
+   */
+  static
+  void _record(const RecordEnum kind,
+	       const int id,
+	       const char* name);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  EventTracer(void); ///< Not Implemented
+  EventTracer(const EventTracer&); ///< Not implemented
+  const EventTracer& operator=(const EventTracer&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  static bool _enabled; ///< True if recording events.
+  static std::vector<Record> _records; ///< Ring buffer of records.
+  static size_t _next; ///< Index of next record in ring buffer.
+  static size_t _numRecorded; ///< Number of records since enabled.
+  static PetscLogDouble _tStart; ///< Time tracer was enabled.
+
+}; // EventTracer
+
+#include "EventTracer.icc" // inline methods
+
+#endif // pylith_utils_eventtracer_hh
+
+
+// End of file
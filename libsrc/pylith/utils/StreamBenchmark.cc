@@ -0,0 +1,76 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "StreamBenchmark.hh" // implementation of class methods
+
+#include "error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petsctime.h" // USES PetscTime()
+
+#include <vector> // USES std::vector
+#include <stdexcept> // USES std::invalid_argument
+#include <sstream> // USES std::ostringstream
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Measure memory bandwidth with the STREAM triad kernel.
+double
+pylith::utils::StreamBenchmark::triad(const int arraySize,
+				      const int numTrials)
+{ // triad
+  PYLITH_METHOD_BEGIN;
+
+  if (arraySize < 1 || numTrials < 1) {
+    std::ostringstream msg;
+    msg << "Array size (" << arraySize << ") and number of trials (" << numTrials
+	<< ") for STREAM benchmark must be positive.";
+    throw std::invalid_argument(msg.str());
+  } // if
+
+  // Touch all of the arrays before timing, so page faults are not
+  // included.
+  std::vector<double> a(arraySize, 1.0);
+  std::vector<double> b(arraySize, 2.0);
+  std::vector<double> c(arraySize, 0.0);
+  const double scalar = 3.0;
+
+  double tBest = 0.0;
+  for (int iTrial=0; iTrial < numTrials; ++iTrial) {
+    PetscLogDouble tBegin = 0.0, tEnd = 0.0;
+    PetscTime(&tBegin);
+    for (int i=0; i < arraySize; ++i) {
+      a[i] = b[i] + scalar*c[i];
+    } // for
+    PetscTime(&tEnd);
+    // Use the result so the compiler cannot drop the loop.
+    c[iTrial % arraySize] += 1.0e-3*a[(iTrial+1) % arraySize];
+
+    const double t = tEnd - tBegin;
+    if (0 == iTrial || t < tBest) {
+      tBest = t;
+    } // if
+  } // for
+
+  const double bytes = 3.0*double(arraySize)*sizeof(double);
+  PYLITH_METHOD_RETURN((tBest > 0.0) ? bytes / tBest : 0.0);
+} // triad
+
+
+// End of file
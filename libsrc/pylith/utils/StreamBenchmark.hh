@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/StreamBenchmark.hh
+ *
+ * @brief Measure sustainable memory bandwidth using the STREAM triad
+ * kernel.
+ */
+
+#if !defined(pylith_utils_streambenchmark_hh)
+#define pylith_utils_streambenchmark_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+// StreamBenchmark ------------------------------------------------------
+/** @brief Measure sustainable memory bandwidth using the STREAM triad
+ * kernel, a[i] = b[i] + s*c[i].
+ *
+ * The bandwidth is the best over several trials, counting 3 arrays of
+ * doubles moved per trial as in the STREAM benchmark (McCalpin). The
+ * arrays should be much larger than the last level cache. Running the
+ * benchmark on all processes at the same time gives the bandwidth per
+ * process when the memory channels of the node are shared, which is
+ * the bandwidth the processes see during assembly.
+ */
+class pylith::utils::StreamBenchmark
+{ // StreamBenchmark
+  friend class TestStreamBenchmark; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Measure memory bandwidth with the STREAM triad kernel.
+   *
+   * @param arraySize Number of values in each array.
+   * @param numTrials Number of trials.
+   * @returns Bandwidth in bytes/s.
+   */
+  static
+  double triad(const int arraySize,
+	       const int numTrials);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  StreamBenchmark(void); ///< Not Implemented
+  StreamBenchmark(const StreamBenchmark&); ///< Not implemented
+  const StreamBenchmark& operator=(const StreamBenchmark&); ///< Not implemented
+
+}; // StreamBenchmark
+
+#endif // pylith_utils_streambenchmark_hh
+
+
+// End of file
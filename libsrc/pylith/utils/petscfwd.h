@@ -52,6 +52,9 @@ typedef struct _p_PC* PetscPC;
 /// forward declaration for PETSc DM
 typedef struct _p_DM* PetscDM;
 
+/// forward declaration for PETSc PetscSection
+typedef struct _p_PetscSection* PetscSection;
+
 /// forward declaration for PETSc DMLabel
 typedef struct _n_DMLabel* PetscDMLabel;
 
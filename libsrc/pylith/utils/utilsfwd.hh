@@ -31,6 +31,9 @@ namespace pylith {
   namespace utils {
 
     class EventLogger;
+    class EventSampler;
+    class EventTracer;
+    class StreamBenchmark;
     class PylithVersion;
     class PetscVersion;
     class DependenciesVersion;
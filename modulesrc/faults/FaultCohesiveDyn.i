@@ -125,6 +125,28 @@ namespace pylith {
 			    const PylithScalar t,
 			    const pylith::topology::Field& jacobian);
 
+      /** Get number of sensitivity solves used to enforce the friction
+       * criterion since the fault was initialized.
+       *
+       * @returns Number of sensitivity solves.
+       */
+      int numSensitivitySolves(void) const;
+
+      /** Get number of linear solver iterations in sensitivity solves
+       * since the fault was initialized.
+       *
+       * @returns Number of iterations.
+       */
+      int numSensitivityIterations(void) const;
+
+      /** Get number of iterations of the search for the update of the
+       * Lagrange multipliers satisfying the friction criterion since the
+       * fault was initialized.
+       *
+       * @returns Number of iterations.
+       */
+      int numFrictionSearchIterations(void) const;
+
       /** Verify configuration is acceptable.
        *
        * @param mesh Finite-element mesh
@@ -103,6 +103,13 @@ namespace pylith {
 			     const PylithScalar t,
 			     pylith::topology::SolutionFields* const fields);
       
+      /** Set relative displacement to the impulse corresponding to
+       * the given time without integrating the residual.
+       *
+       * @param t Current time (impulse index).
+       */
+      void updateImpulse(const PylithScalar t);
+
       /** Get vertex field associated with integrator.
        *
        * @param name Name of cell field.
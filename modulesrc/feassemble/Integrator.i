@@ -90,6 +90,15 @@ namespace pylith {
        */
       virtual
       bool needNewJacobian(void) const;
+
+      /** Get estimate of the relative change in stiffness since the
+       * Jacobian was last formed.
+       *
+       * @returns Relative change, or a negative value if the integrator
+       * does not provide an estimate.
+       */
+      virtual
+      PylithScalar stiffnessChange(void) const;
       
       /** Check whether integrator generates a symmetric Jacobian.
        *
@@ -85,6 +85,11 @@ namespace pylith {
       const pylith::topology::Field& cellField(const char* name,
 					       const pylith::topology::Mesh& mesh,
 					       pylith::topology::SolutionFields* const fields =0);
+
+      /** Free output (buffer) fields after writing cell fields. The
+       * buffers are recreated by cellField() when needed.
+       */
+      void releaseOutputFields(void);
       
       /** Get output fields.
        *
@@ -69,6 +69,12 @@ namespace pylith {
        */
       bool hasStateVars(void) const;
 
+      /** Set relative tolerance for updating cached stable time steps.
+       *
+       * @param value Relative tolerance.
+       */
+      void stableTimeStepTolerance(const PylithScalar value);
+
       /** Get stable time step for implicit time integration.
        *
        * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
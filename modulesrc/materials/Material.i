@@ -103,6 +103,25 @@ namespace pylith {
        */
       void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
       
+      /** Set whether physical properties are stored in single precision.
+       *
+       * @param flag True to store properties in single precision.
+       */
+      void singlePrecisionProperties(const bool flag);
+
+      /** Check whether physical properties are stored in single precision.
+       *
+       * @returns True if properties are stored in single precision.
+       */
+      bool singlePrecisionProperties(void) const;
+
+      /** Get memory used to store physical properties in single
+       * precision.
+       *
+       * @returns Number of bytes (0 if properties are in double precision).
+       */
+      size_t propertiesSingleBytes(void) const;
+      
       /** Set scales used to nondimensionalize physical properties.
        *
        * @param dim Nondimensionalizer
@@ -81,6 +81,18 @@ namespace pylith {
        */
       bool interpolate(void) const;
       
+      /** Set level of topology verification after reading mesh.
+       *
+       * @param level Level of topology verification.
+       */
+      void checkTopology(const pylith::topology::MeshOps::TopologyCheckEnum level);
+
+      /** Get level of topology verification after reading mesh.
+       *
+       * @returns Level of topology verification.
+       */
+      pylith::topology::MeshOps::TopologyCheckEnum checkTopology(void) const;
+      
       /** Read mesh from file.
        *
        * @param mesh PyLith finite-element mesh.
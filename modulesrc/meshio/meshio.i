@@ -68,6 +68,9 @@
 import_array();
 %}
 
+// Types from other modules
+%import "../topology/MeshOps.i"
+
 // Interfaces
 %include "MeshIOObj.i"
 %include "MeshIOAscii.i"
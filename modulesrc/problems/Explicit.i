@@ -40,6 +40,55 @@ namespace pylith {
       /// Compute rate fields (velocity and/or acceleration) at time t.
       void calcRateFields(void);
 
+      /** Advance displacement fields from time t to time t+dt.
+       *
+       * For all vertices, disp(t-dt) takes over the values of disp(t)
+       * by exchanging vectors, disp(t) is set to disp(t) +
+       * dispIncr(t->t+dt), and the displacement increment is
+       * zeroed. For a single time-step level, the same update is done
+       * only for the vertices in that level.
+       *
+       * @param level Time-step level (-1 for all vertices).
+       */
+      void rotateDisplacement(const int level =-1);
+
+      /** Setup time-step levels for local time stepping.
+       *
+       * @param fields Solution fields.
+       * @param dt Time step for level 0 (nondimensional).
+       * @param maxLevels Maximum number of levels.
+       * @returns Number of levels (same on all processes).
+       */
+      int setupTimeStepLevels(pylith::topology::SolutionFields* fields,
+			      const PylithScalar dt,
+			      const int maxLevels);
+
+      /** Get number of time-step levels.
+       *
+       * @returns Number of levels (0 if not using local time stepping).
+       */
+      int numTimeStepLevels(void) const;
+
+      /** Get number of local vertices (excluding ghost vertices) in a
+       * time-step level.
+       *
+       * @param level Time-step level.
+       * @returns Number of vertices.
+       */
+      int numVerticesInLevel(const int level) const;
+
+      /** Prepare for advancing vertices in a time-step level.
+       *
+       * @param level Time-step level.
+       * @param substep Index of current substep (in units of the
+       * level 0 time step) within the time step of the coarsest level.
+       */
+      void beginLevelStep(const int level,
+			  const int substep);
+
+      /// Restore displacements and integrators after advancing a time-step level.
+      void endLevelStep(void);
+
     }; // Explicit
 
   } // problems
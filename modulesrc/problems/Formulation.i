@@ -131,6 +131,15 @@ namespace pylith {
        */
       void reformJacobianLumped(void);
 
+      /** Get cumulative wall time spent in integrator on this process
+       * while reforming the residual and Jacobian and constraining the
+       * solution.
+       *
+       * @param index Index of integrator.
+       * @returns Time in seconds.
+       */
+      double integratorTime(const int index) const;
+
       /** Constrain solution space.
        *
        * @param tmpSolutionVec Temporary PETSc vector for solution.
@@ -52,6 +52,13 @@ namespace pylith {
        */
       void skipNullSpaceCreation(const bool value);
 
+      /** Set flag for caching contributions to the residual that do not
+       * depend on the solution.
+       *
+       * @param[in] value True to cache contributions.
+       */
+      void cacheResidual(const bool value);
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
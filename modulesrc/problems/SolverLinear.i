@@ -28,6 +28,15 @@ namespace pylith {
     class SolverLinear : public Solver
     { // SolverLinear
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum InitialGuessEnum {
+	GUESS_ZERO=0, ///< Zero initial guess.
+	GUESS_EXTRAPOLATE=1, ///< Polynomial extrapolation of previous solutions.
+	GUESS_PROJECT=2, ///< Projection onto previous solutions.
+      }; // InitialGuessEnum
+
       // PUBLIC MEMBERS /////////////////////////////////////////////////
     public :
 
@@ -61,6 +70,103 @@ namespace pylith {
 		 pylith::topology::Jacobian* jacobian,
 		 const pylith::topology::Field& residual);
 
+      /** Set method for forming initial guess from previous solutions.
+       *
+       * @param value Method for forming initial guess.
+       * @param historySize Number of previous solutions to use.
+       */
+      void initialGuess(const InitialGuessEnum value,
+			const int historySize);
+
+      /** Get number of iterations in last solve.
+       *
+       * @returns Number of iterations.
+       */
+      int numIterations(void) const;
+
+      /** Get estimate of number of iterations saved in last solve by
+       * using the initial guess.
+       *
+       * @returns Number of iterations saved.
+       */
+      PylithScalar numIterationsSaved(void) const;
+
+      /** Get norm of residual at end of last solve.
+       *
+       * @returns Residual norm (as monitored by the KSP).
+       */
+      PylithScalar residualNorm(void) const;
+
+      /** Get PETSc reason the last solve converged or diverged.
+       *
+       * @returns KSPConvergedReason (negative if the solve diverged).
+       */
+      int convergedReason(void) const;
+
+      /** Add right-hand side to block of systems solved together with
+       * solveBlock().
+       *
+       * @param residual Residual field.
+       */
+      void addBlockRHS(const pylith::topology::Field& residual);
+
+      /** Get number of right-hand sides in block.
+       *
+       * @returns Number of right-hand sides.
+       */
+      int blockSize(void) const;
+
+      /** Solve the system for all right-hand sides in the block.
+       *
+       * @param jacobian Jacobian of the system.
+       */
+      void solveBlock(pylith::topology::Jacobian* jacobian);
+
+      /** Get solution for right-hand side in block.
+       *
+       * @param solution Solution field.
+       * @param index Index of right-hand side in block.
+       */
+      void blockSolution(pylith::topology::Field* solution,
+			 const int index);
+
+      /// Remove all right-hand sides and solutions from block.
+      void clearBlock(void);
+
+      /** Set whether to factor the Jacobian and reuse the
+       * factorization for all solves until the Jacobian changes.
+       *
+       * @param value True if factorization should be used.
+       * @param maxMemory Maximum memory (bytes) per process for the
+       *   factorization (0 for no limit).
+       */
+      void useFactorization(const bool value,
+			    const PylithScalar maxMemory =0.0);
+
+      /** Is the factorization used for solves?
+       *
+       * @returns True if factorization is used, false otherwise.
+       */
+      bool usingFactorization(void) const;
+
+      /** Get number of factorizations of the Jacobian.
+       *
+       * @returns Number of factorizations.
+       */
+      int numFactorizations(void) const;
+
+      /** Get maximum memory over processes used by last factorization.
+       *
+       * @returns Memory in bytes.
+       */
+      PylithScalar factorMemory(void) const;
+
+      /** Get time for last factorization.
+       *
+       * @returns Time in seconds.
+       */
+      PylithScalar factorTime(void) const;
+
     }; // SolverLinear
 
   } // problems
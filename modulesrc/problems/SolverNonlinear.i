@@ -61,6 +61,95 @@ namespace pylith {
 		 pylith::topology::Jacobian* jacobian,
 		 const pylith::topology::Field& residual);
 
+      /** Set policy for lagging the Jacobian.
+       *
+       * @param maxLag Maximum number of Newton iterations in which the
+       *   Jacobian is reused (0 reforms Jacobian in every iteration).
+       * @param convergenceThreshold Reform Jacobian if the ratio of the
+       *   residual norms in consecutive iterations exceeds this value.
+       * @param stiffnessThreshold Reform Jacobian if the relative change
+       *   in stiffness estimated by the materials exceeds this value.
+       */
+      void lagJacobian(const int maxLag,
+		       const PylithScalar convergenceThreshold,
+		       const PylithScalar stiffnessThreshold);
+
+      /** Mark the Jacobian as out of date, so that it is reformed in the
+       * next Newton iteration regardless of the lagging policy.
+       */
+      void expireJacobian(void);
+
+      /** Mark the Jacobian as current after it has been reformed outside
+       * of the nonlinear solve (e.g., before advancing the time step).
+       */
+      void resetJacobianAge(void);
+
+      /** Get number of times the Jacobian has been reformed.
+       *
+       * @returns Number of Jacobian reformations.
+       */
+      int numJacobianReforms(void) const;
+
+      /** Get number of times the Jacobian has been reused.
+       *
+       * @returns Number of Newton iterations with lagged Jacobian.
+       */
+      int numJacobianReuses(void) const;
+
+      /** Get number of residual evaluations.
+       *
+       * @returns Number of residual evaluations.
+       */
+      int numResidualEvals(void) const;
+
+      /** Get number of line searches.
+       *
+       * @returns Number of line searches.
+       */
+      int numLineSearches(void) const;
+
+      /** Get number of residual evaluations in line searches.
+       *
+       * @returns Number of residual evaluations in line searches.
+       */
+      int numLineSearchEvals(void) const;
+
+      /** Get mean step length selected by line searches.
+       *
+       * @returns Mean step length.
+       */
+      PylithScalar lineSearchMeanStep(void) const;
+
+      /** Get minimum step length selected by line searches.
+       *
+       * @returns Minimum step length.
+       */
+      PylithScalar lineSearchMinStep(void) const;
+
+      /** Get number of Newton iterations in last solve.
+       *
+       * @returns Number of iterations.
+       */
+      int numIterations(void) const;
+
+      /** Get number of linear solver iterations in last solve.
+       *
+       * @returns Number of iterations (total over Newton iterations).
+       */
+      int numLinearIterations(void) const;
+
+      /** Get norm of residual at end of last solve.
+       *
+       * @returns Residual norm.
+       */
+      PylithScalar residualNorm(void) const;
+
+      /** Get PETSc reason the last solve converged or diverged.
+       *
+       * @returns SNESConvergedReason (negative if the solve diverged).
+       */
+      int convergedReason(void) const;
+
     }; // SolverNonlinear
 
   } // problems
@@ -212,6 +212,13 @@ namespace pylith {
       void copySubfield(const Field& field,
 			const char* name);
 
+      /** Exchange values with another field with the same layout by
+       * swapping the underlying PETSc vectors.
+       *
+       * @param field Field with which to exchange values.
+       */
+      void swapValues(Field& field);
+
       /** Add two fields, storing the result in one of the fields.
        *
        * @param field Field to add.
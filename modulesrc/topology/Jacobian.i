@@ -37,10 +37,13 @@ namespace pylith {
        * @param matrixType Type of PETSc sparse matrix.
        * @param blockOkay True if okay to use block size equal to fiberDim
        * (all or none of the DOF at each point are constrained).
+       * @param patternCache Filename prefix for cache of nonzero pattern
+       * (NULL or empty for no cache).
        */
       Jacobian(const Field& field,
 	       const char* matrixType ="aij",
-	       const bool blockOkay =false);
+	       const bool blockOkay =false,
+	       const char* patternCache =0);
 
       /// Destructor.
       ~Jacobian(void);
@@ -89,6 +92,20 @@ namespace pylith {
       /// Verify symmetry of matrix. For debugger purposes only.
       void verifySymmetry(void) const;
 
+      /** Get flag indicating if the nonzero pattern was loaded from the
+       * pattern cache.
+       *
+       * @returns True if the nonzero pattern was loaded from the cache.
+       */
+      bool patternFromCache(void) const;
+
+      /** Get flag indicating if the nonzero pattern was written to the
+       * pattern cache.
+       *
+       * @returns True if the nonzero pattern was written to the cache.
+       */
+      bool patternSaved(void) const;
+
     }; // Jacobian
 
   } // topology
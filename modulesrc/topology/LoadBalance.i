@@ -0,0 +1,93 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+//
+
+/**
+ * @file modulesrc/topology/LoadBalance.i
+ *
+ * @brief Python interface to C++ LoadBalance.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // LoadBalance ------------------------------------------------------
+    class LoadBalance
+    { // LoadBalance
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Get number of ghost points (points with values that are owned
+       * by another process) in field.
+       *
+       * @param field Field over mesh.
+       * @returns Number of ghost points on this process.
+       */
+      static
+      int numGhostPoints(const pylith::topology::Field& field);
+
+      /** Get number of degrees of freedom at ghost points in field.
+       *
+       * @param field Field over mesh.
+       * @returns Number of ghost degrees of freedom on this process.
+       */
+      static
+      int numGhostDof(const pylith::topology::Field& field);
+
+      /** Get cumulative number of MPI messages sent by this process.
+       *
+       * @returns Number of messages.
+       */
+      static
+      double numMessages(void);
+
+      /** Get cumulative length of MPI messages sent by this process.
+       *
+       * @returns Length of messages in bytes.
+       */
+      static
+      double messageBytes(void);
+
+      /** Write cell fields with the rank of each cell and the ratio of
+       * the number of cells, compute time, and message volume of the
+       * process to the average over all processes.
+       *
+       * @param writer Data writer for load balance information.
+       * @param mesh Distributed mesh.
+       * @param computeTime Compute time on this process.
+       * @param messageBytes Message volume sent by this process.
+       */
+      static
+      void write(pylith::meshio::DataWriter* const writer,
+		 const pylith::topology::Mesh& mesh,
+		 const PylithScalar computeTime,
+		 const PylithScalar messageBytes);
+
+      // NOT IMPLEMENTED ////////////////////////////////////////////////
+    private :
+
+      LoadBalance(void); ///< Not Implemented
+
+    }; // LoadBalance
+
+  } // topology
+} // pylith
+
+
+// End of file 
@@ -0,0 +1,73 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+//
+
+/**
+ * @file modulesrc/topology/MemoryUsage.i
+ *
+ * @brief Python interface to C++ MemoryUsage.
+ */
+
+namespace pylith {
+  namespace topology {
+
+    // MemoryUsage ------------------------------------------------------
+    class MemoryUsage
+    { // MemoryUsage
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Get memory used by finite-element mesh (topology, coordinates,
+       * and labels).
+       *
+       * @param mesh Finite-element mesh.
+       * @returns Memory in bytes.
+       */
+      static
+      size_t mesh(const Mesh& mesh);
+
+      /** Get memory used by field (sections and vectors, including
+       * vectors for scatters).
+       *
+       * @param field Field over mesh.
+       * @returns Memory in bytes.
+       */
+      static
+      size_t field(const Field& field);
+
+      /** Get memory used by sparse matrix for Jacobian.
+       *
+       * @param jacobian Jacobian of system.
+       * @returns Memory in bytes.
+       */
+      static
+      size_t jacobian(const Jacobian& jacobian);
+
+      // NOT IMPLEMENTED ////////////////////////////////////////////////
+    private :
+
+      MemoryUsage(void); ///< Not Implemented
+
+    }; // MemoryUsage
+
+  } // topology
+} // pylith
+
+
+// End of file 
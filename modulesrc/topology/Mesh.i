@@ -82,6 +82,18 @@ namespace pylith {
        */
       bool debug(void) const;
 
+      /** Set level of topology verification for meshes derived from this mesh.
+       *
+       * @param level Level of verification.
+       */
+      void topologyCheck(const pylith::topology::MeshOps::TopologyCheckEnum level);
+
+      /** Get level of topology verification for meshes derived from this mesh.
+       *
+       * @returns Level of verification.
+       */
+      pylith::topology::MeshOps::TopologyCheckEnum topologyCheck(void) const;
+
       /** Get dimension of mesh.
        *
        * @returns Dimension of mesh.
@@ -22,6 +22,44 @@
  * @brief Python interface to C++ MeshOps.
  */
 
+namespace pylith {
+  namespace topology {
+
+    // MeshOps ----------------------------------------------------------
+    class MeshOps
+    { // MeshOps
+
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      enum TopologyCheckEnum {
+	CHECK_OFF=0, ///< Skip topology checks.
+	CHECK_SAMPLED=1, ///< Check a sample of the local cells.
+	CHECK_FULL=2, ///< Check symmetry and skeleton of the entire local mesh.
+      }; // TopologyCheckEnum
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Check topology of mesh.
+       *
+       * @param mesh Finite-element mesh.
+       * @param level Level of verification.
+       */
+      static
+      void checkTopology(const pylith::topology::Mesh& mesh,
+			 const TopologyCheckEnum level =CHECK_FULL);
+
+      // NOT IMPLEMENTED ////////////////////////////////////////////////
+    private :
+
+      MeshOps(void); ///< Not Implemented
+
+    }; // MeshOps
+
+  } // topology
+} // pylith
+
 %inline %{
   /** Nondimensionalize the finite-element mesh.
    *
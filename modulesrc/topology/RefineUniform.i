@@ -38,6 +38,12 @@ namespace pylith {
       /// Destructor
       ~RefineUniform(void);
       
+      /** Set level of topology verification of refined mesh.
+       *
+       * @param level Level of topology verification.
+       */
+      void checkTopology(const MeshOps::TopologyCheckEnum level);
+
       /** Refine mesh.
        *
        * @param newMesh Refined mesh (result).
@@ -48,6 +54,35 @@ namespace pylith {
 		  const Mesh& mesh,
 		  const int levels =1);
 
+      /** Get number of levels in statistics from last refinement.
+       *
+       * Level 0 corresponds to the original mesh.
+       *
+       * @returns Number of levels including original mesh.
+       */
+      int numLevels(void) const;
+
+      /** Get global number of cells at refinement level.
+       *
+       * @param level Refinement level (0 is original mesh).
+       * @returns Number of cells summed over all processes.
+       */
+      long levelNumCells(const int level) const;
+
+      /** Get wall time required to refine mesh to level.
+       *
+       * @param level Refinement level (0 is original mesh).
+       * @returns Maximum wall time (s) over all processes.
+       */
+      PylithScalar levelWallTime(const int level) const;
+
+      /** Get memory in use after refining mesh to level.
+       *
+       * @param level Refinement level (0 is original mesh).
+       * @returns Maximum memory (bytes) over all processes.
+       */
+      PylithScalar levelMemory(const int level) const;
+
     }; // RefineUniform
 
   } // topology
@@ -23,14 +23,17 @@
 %{
 #include "pylith/topology/Mesh.hh"
 #include "pylith/topology/MeshOps.hh"
+#include "pylith/topology/MemoryUsage.hh"
 #include "pylith/topology/FieldBase.hh"
 #include "pylith/topology/Field.hh"
 #include "pylith/topology/Fields.hh"
 #include "pylith/topology/SolutionFields.hh"
 #include "pylith/topology/Jacobian.hh"
 #include "pylith/topology/Distributor.hh"
+#include "pylith/topology/LoadBalance.hh"
 #include "pylith/topology/RefineUniform.hh"
 #include "pylith/topology/ReverseCuthillMcKee.hh"
+#include "pylith/topology/SpaceFillingCurve.hh"
 %}
 
 %include "exception.i"
@@ -56,16 +59,19 @@ import_array();
 %}
 
 // Interfaces
-%include "Mesh.i"
 %include "MeshOps.i"
+%include "Mesh.i"
+%include "MemoryUsage.i"
 %include "FieldBase.i"
 %include "Field.i"
 %include "Fields.i"
 %include "SolutionFields.i"
 %include "Jacobian.i"
 %include "Distributor.i"
+%include "LoadBalance.i"
 %include "RefineUniform.i"
 %include "ReverseCuthillMcKee.i"
+%include "SpaceFillingCurve.i"
 
 // End of file
 
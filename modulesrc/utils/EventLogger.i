@@ -29,9 +29,107 @@ namespace pylith {
     class EventLogger
     { // EventLogger
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      /// Level of detail for events inside loops over cells and vertices.
+      enum DetailEnum {
+	DETAIL_NONE=0, ///< Do not log detailed events.
+	DETAIL_SAMPLED=1, ///< Time every Nth occurrence and extrapolate totals.
+	DETAIL_FULL=2 ///< Log every occurrence as a PETSc event.
+      }; // DetailEnum
+
       // PUBLIC MEMBERS /////////////////////////////////////////////////
     public :
 
+      /** Set level of detail for events logged with EventSampler.
+       *
+       * @param value Level of detail.
+       */
+      static
+      void detailLevel(const DetailEnum value);
+
+      /** Get level of detail for events logged with EventSampler.
+       *
+       * @returns Level of detail.
+       */
+      static
+      DetailEnum detailLevel(void);
+
+      /** Set interval between timed occurrences of detailed events
+       * when sampling.
+       *
+       * @param value Interval (time every Nth occurrence).
+       */
+      static
+      void sampleInterval(const int value);
+
+      /** Get interval between timed occurrences of detailed events
+       * when sampling.
+       *
+       * @returns Interval.
+       */
+      static
+      int sampleInterval(void);
+
+      /** Add bytes moved between memory and cell (or vertex) arrays
+       * to event.
+       *
+       * @param id Event identifier.
+       * @param bytes Number of bytes.
+       */
+      static
+      void logBytes(const int id,
+		    const double bytes);
+
+      /** Get bytes logged for event.
+       *
+       * @param id Event identifier.
+       * @returns Number of bytes.
+       */
+      static
+      double eventBytes(const int id);
+
+      /** Get number of events with logged bytes.
+       *
+       * @returns Number of events.
+       */
+      static
+      int numBytesEvents(void);
+
+      /** Get identifier of event with logged bytes.
+       *
+       * @param index Index of event in [0, numBytesEvents()).
+       * @returns Event identifier.
+       */
+      static
+      int bytesEvent(const int index);
+
+      /** Get floating point operations for event summed over all
+       * stages.
+       *
+       * @param id Event identifier.
+       * @returns Number of floating point operations.
+       */
+      static
+      double eventFlops(const int id);
+
+      /** Get time for event summed over all stages.
+       *
+       * @param id Event identifier.
+       * @returns Time in seconds.
+       */
+      static
+      double eventTime(const int id);
+
+      /** Get name of event.
+       *
+       * @param id Event identifier.
+       * @returns Name of event.
+       */
+      static
+      const char* eventName(const int id);
+
       /// Constructor
       EventLogger(void);
 
@@ -0,0 +1,89 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/EventTracer.i
+ *
+ * @brief Python interface to C++ EventTracer.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class EventTracer
+    { // EventTracer
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Start recording events, discarding any previous records.
+       *
+       * @param capacity Maximum number of records kept in ring buffer.
+       */
+      static
+      void enable(const int capacity);
+
+      /// Stop recording events (records are kept until next enable()).
+      static
+      void disable(void);
+
+      /** Is the tracer recording events?
+       *
+       * @returns True if enabled, false otherwise.
+       */
+      static
+      bool isEnabled(void);
+
+      /** Get number of records in ring buffer.
+       *
+       * @returns Number of records.
+       */
+      static
+      int numRecords(void);
+
+      /** Get number of records overwritten because the ring buffer
+       * was full.
+       *
+       * @returns Number of records.
+       */
+      static
+      int numDropped(void);
+
+      /** Write records in ring buffer to file in Chrome trace event
+       * format.
+       *
+       * @param filename Name of file.
+       * @param rank Rank of process (used as process identifier).
+       */
+      static
+      void write(const char* filename,
+		 const int rank);
+
+      // NOT IMPLEMENTED ////////////////////////////////////////////////
+    private :
+
+      EventTracer(void); ///< Not Implemented
+
+    }; // EventTracer
+
+  } // utils
+} // pylith
+
+
+// End of file
@@ -0,0 +1,56 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file modulesrc/utils/StreamBenchmark.i
+ *
+ * @brief Python interface to C++ StreamBenchmark.
+ */
+
+
+namespace pylith {
+  namespace utils {
+
+    class StreamBenchmark
+    { // StreamBenchmark
+
+      // PUBLIC MEMBERS /////////////////////////////////////////////////
+    public :
+
+      /** Measure memory bandwidth with the STREAM triad kernel.
+       *
+       * @param arraySize Number of values in each array.
+       * @param numTrials Number of trials.
+       * @returns Bandwidth in bytes/s.
+       */
+      static
+      double triad(const int arraySize,
+		   const int numTrials);
+
+      // NOT IMPLEMENTED ////////////////////////////////////////////////
+    private :
+
+      StreamBenchmark(void); ///< Not Implemented
+
+    }; // StreamBenchmark
+
+  } // utils
+} // pylith
+
+
+// End of file
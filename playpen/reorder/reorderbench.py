@@ -0,0 +1,109 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file playpen/reorder/reorderbench.py
+
+## @brief Python script to compare assembly times for different
+## orderings of mesh cells and vertices.
+
+import sys
+import subprocess
+
+# Events in PETSc log summary to compare.
+EVENTS = ["ElIR compute",
+          "ElIJ compute",
+          "ElIR restrict",
+          "ElIJ restrict",
+          "MeIm reorder",
+          ]
+
+# Orderings to compare.
+ORDERINGS = ["none", "rcm", "hilbert", "morton"]
+
+
+# ----------------------------------------------------------------------
+def runOrdering(ordering, cfgFiles, nprocs):
+  """
+  Run PyLith with given ordering and return filename of PETSc log.
+  """
+  logFilename = "reorderbench_%s.log" % ordering
+  args = ["pylith"] + cfgFiles
+  args += ["--nodes=%d" % nprocs,
+           "--petsc.log_view=:%s" % logFilename]
+  if ordering == "none":
+    args += ["--mesh_generator.reorder_mesh=False"]
+  else:
+    args += ["--mesh_generator.reorder_mesh=True",
+             "--mesh_generator.reorder_type=%s" % ordering]
+  subprocess.check_call(args)
+  return logFilename
+
+
+# ----------------------------------------------------------------------
+def parseLog(filename):
+  """
+  Get maximum time over processes for events in PETSc log summary.
+  """
+  times = {}
+  for line in open(filename, "r"):
+    for event in EVENTS:
+      if line.startswith(event):
+        # Event name, count max, count ratio, time max, ...
+        fields = line[len(event):].split()
+        times[event] = times.get(event, 0.0) + float(fields[2])
+  return times
+
+
+# ----------------------------------------------------------------------
+def main(argv):
+  from optparse import OptionParser
+  parser = OptionParser(usage="%prog [options] CFG_FILE [CFG_FILE ...]")
+  parser.add_option("--nprocs", action="store", type="int", dest="nprocs", default=1)
+  parser.add_option("--orderings", action="store", type="string", dest="orderings",
+                    default=",".join(ORDERINGS))
+  (options, cfgFiles) = parser.parse_args(argv)
+  if 0 == len(cfgFiles):
+    parser.error("Must specify at least one PyLith parameter file.")
+
+  results = {}
+  orderings = options.orderings.split(",")
+  for ordering in orderings:
+    logFilename = runOrdering(ordering, cfgFiles, options.nprocs)
+    results[ordering] = parseLog(logFilename)
+
+  reference = results[orderings[0]]
+  print "%-16s" % "Event" + "".join(["%20s" % ordering for ordering in orderings])
+  for event in EVENTS:
+    line = "%-16s" % event
+    for ordering in orderings:
+      t = results[ordering].get(event, 0.0)
+      tRef = reference.get(event, 0.0)
+      if tRef > 0.0:
+        line += "%12.3e (%5.2f)" % (t, t/tRef)
+      else:
+        line += "%12.3e        " % t
+    print line
+  return
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+  main(sys.argv[1:])
+
+
+# End of file
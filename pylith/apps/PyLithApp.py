@@ -120,10 +120,14 @@ class PyLithApp(PetscApplication):
 
         # Setup problem, verify configuration, and then initialize
         self._eventLogger.stagePush("Setup")
+        self.perfLogger.phaseBegin("Preinitialize")
         self.problem.preinitialize(mesh)
+        self.perfLogger.phaseEnd("Preinitialize")
         self._debug.log(resourceUsageString())
 
+        self.perfLogger.phaseBegin("Verify Configuration")
         self.problem.verifyConfiguration()
+        self.perfLogger.phaseEnd("Verify Configuration")
 
         self.problem.initialize()
         self._debug.log(resourceUsageString())
@@ -132,10 +136,17 @@ class PyLithApp(PetscApplication):
 
         # If initializing only, stop before running problem
         if self.initializeOnly:
+            self.compilePerformanceLog()
+            self.perfLogger.writeStartupReport(comm)
+            self.perfLogger.writeTrace()
             return
 
-        # Run problem
-        self.problem.run(self)
+        # Run problem (keep trace of what led up to an error)
+        try:
+            self.problem.run(self)
+        except:
+            self.perfLogger.writeTrace()
+            raise
         self._debug.log(resourceUsageString())
 
         # Cleanup
@@ -145,8 +156,12 @@ class PyLithApp(PetscApplication):
 
         self.perfLogger.logMesh('Mesh', mesh)
         self.compilePerformanceLog()
+        self.perfLogger.writeStartupReport(comm)
+        self.perfLogger.writeMemoryReport(comm)
+        self.perfLogger.writeRooflineReport(comm)
+        self.perfLogger.writeTrace()
         if self.perfLogger.verbose:
-            self.perfLogger.show()
+            self.perfLogger.show(comm)
 
         return
 
@@ -286,6 +301,11 @@ class PyLithApp(PetscApplication):
         logger.initialize()
 
         self._eventLogger = logger
+
+        self.perfLogger.setupEventLogging()
+
+        from pylith.mpi.Communicator import mpi_comm_world
+        self.perfLogger.startTrace(mpi_comm_world())
         return
 
 
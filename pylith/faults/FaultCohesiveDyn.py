@@ -91,6 +91,7 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     FaultCohesive.__init__(self, name)
     Integrator.__init__(self)
     self._loggingPrefix = "CoDy "
+    self._telemetryTotals = {}
 
     self.availableFields = \
         {'vertex': \
@@ -192,6 +193,27 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     return field
 
 
+  def telemetry(self):
+    """
+    Get iterations used to enforce the friction criterion since the
+    last call. This must be called by all processes.
+    """
+    totals = {'sensitivity_solves': self.numSensitivitySolves(),
+              'sensitivity_iterations': self.numSensitivityIterations(),
+              'friction_search_iterations': self.numFrictionSearchIterations(),
+              }
+    info = dict([(name, value - self._telemetryTotals.get(name, 0)) for name, value in totals.items()])
+    self._telemetryTotals = totals
+
+    # Each process searches over its own fault vertices, so report the
+    # total over all processes. Sensitivity solves are collective.
+    import pylith.mpi.mpi as mpi
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    info['friction_search_iterations'] = mpi.allreduce_scalar_int(info['friction_search_iterations'], mpi.mpi_sum(), comm.handle)
+    return info
+
+
   def finalize(self):
     """
     Cleanup.
@@ -145,11 +145,9 @@ class FrictionModel(PetscComponent):
 
   def _modelMemoryUse(self):
     """
-    Model allocated memory.
+    Log allocated memory.
     """
     self.perfLogger.logFrictionModel('Friction', self)
-    self.perfLogger.logField('Friction', self.propertiesField())
-    self.perfLogger.logField('Friction', self.stateVarsField())
     return
 
 
@@ -45,7 +45,8 @@ class ElasticMaterial(Material):
     ## Python object for managing FaultCohesiveKin facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b stable_dt_tolerance Relative increase in stable time step
+    ##   that triggers an update of the cached value.
     ##
     ## \b Facilities
     ## @li \b output Output manager associated with material data.
@@ -54,6 +55,10 @@ class ElasticMaterial(Material):
 
     import pyre.inventory
 
+    stableDtTolerance = pyre.inventory.float("stable_dt_tolerance", default=0.0,
+                                             validator=pyre.inventory.greaterEqual(0.0))
+    stableDtTolerance.meta['tip'] = "Relative increase in stable time step that triggers an update of the cached value."
+
     from pylith.meshio.OutputMatElastic import OutputMatElastic
     output = pyre.inventory.facility("output", family="output_manager",
                                      factory=OutputMatElastic)
@@ -89,6 +94,7 @@ class ElasticMaterial(Material):
     """
     Material._configure(self)
     self.output = self.inventory.output
+    self.stableTimeStepTolerance(self.inventory.stableDtTolerance)
     from pylith.utils.NullComponent import NullComponent
     if not isinstance(self.inventory.dbInitialStress, NullComponent):
       self.dbInitialStress(self.inventory.dbInitialStress)
@@ -67,6 +67,7 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b single_precision_properties Store physical properties in single precision.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +82,9 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    singlePrecisionProperties = pyre.inventory.bool("single_precision_properties", default=False)
+    singlePrecisionProperties.meta['tip'] = "Store physical properties in single precision (state variables remain double precision)."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -186,6 +190,7 @@ class Material(PetscComponent):
       self.id(self.inventory.id)
       self.label(self.inventory.label)
       self.dbProperties(self.inventory.dbProperties)
+      self.singlePrecisionProperties(self.inventory.singlePrecisionProperties)
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
         self.dbInitialState(self.inventory.dbInitialState)
@@ -209,11 +214,9 @@ class Material(PetscComponent):
 
   def _modelMemoryUse(self):
     """
-    Model allocated memory.
+    Log allocated memory.
     """
     self.perfLogger.logMaterial('Materials', self)
-    self.perfLogger.logField('Materials', self.propertiesField())
-    self.perfLogger.logField('Materials', self.stateVarsField())
     return
 
 
@@ -453,9 +453,11 @@ class OutputManager(PetscComponent, ModuleOutputManager):
 
   def _closeTimeStep(self):
     """
-    Call C++ closeTimeStep().
+    Call C++ closeTimeStep() and free output buffers of data provider.
     """
     ModuleOutputManager.closeTimeStep(self)
+    if "releaseOutputFields" in dir(self.dataProvider()):
+      self.dataProvider().releaseOutputFields()
     return
 
 
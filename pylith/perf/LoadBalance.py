@@ -0,0 +1,290 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/perf/LoadBalance.py
+##
+## @brief Python object for reporting the distribution of work and
+## communication among processes.
+##
+## Factory: load_balance.
+
+from pylith.utils.PetscComponent import PetscComponent
+
+# LoadBalance class
+class LoadBalance(PetscComponent):
+  """
+  Python object for reporting the distribution of work and
+  communication among processes.
+
+  For each quantity (local cells, cells and compute time of each
+  integrator, ghost points of the solution, and messages sent), the
+  report contains the minimum, maximum, and average over the
+  processes, the imbalance ratio (maximum/average), and the rank of
+  the process with the maximum value.
+
+  Factory: load_balance.
+  """
+  
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(PetscComponent.Inventory):
+    """
+    Python object for managing LoadBalance facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing LoadBalance facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Filename for JSON report.
+    ## @li \b per_step Include report for each time step.
+    ## @li \b write_fields Write cell fields with rank and imbalance ratios.
+    ##
+    ## \b Facilities
+    ## @li \b data_writer Data writer for cell fields.
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Filename for JSON report of load balance " \
+        "(empty for no report)."
+
+    perStep = pyre.inventory.bool("per_step", default=False)
+    perStep.meta['tip'] = "Include report for each time step."
+
+    writeFields = pyre.inventory.bool("write_fields", default=False)
+    writeFields.meta['tip'] = "Write cell fields with rank and ratios of " \
+        "cells, compute time, and message volume to average over processes."
+
+    from pylith.meshio.DataWriterVTK import DataWriterVTK
+    dataWriter = pyre.inventory.facility("data_writer", factory=DataWriterVTK, family="data_writer")
+    dataWriter.meta['tip'] = "Data writer for load balance cell fields."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="load_balance"):
+    """
+    Constructor.
+    """
+    PetscComponent.__init__(self, name, facility="load_balance")
+    self.filename = ""
+    self.perStep = False
+    self.writeFields = False
+    self.steps = []
+    self._messagesBegin = 0.0
+    self._bytesBegin = 0.0
+    self._stepBegin = None
+    self._normalizer = None
+    return
+
+
+  def enabled(self):
+    """
+    Return True if a report or cell fields will be written.
+    """
+    return len(self.filename) > 0 or self.writeFields
+
+
+  def initialize(self, normalizer):
+    """
+    Start counting messages.
+    """
+    if not self.enabled():
+      return
+    from pylith.topology.topology import LoadBalance as ModuleLoadBalance
+    self._messagesBegin = ModuleLoadBalance.numMessages()
+    self._bytesBegin = ModuleLoadBalance.messageBytes()
+    self._stepBegin = None
+    self._normalizer = normalizer
+    if self.writeFields:
+      self.dataWriter.initialize(normalizer)
+    return
+
+
+  def poststep(self, t, formulation):
+    """
+    Add report for time step (t is nondimensional). This must be
+    called by all processes.
+    """
+    if not self.enabled() or not self.perStep:
+      return
+    sample = self.sample(formulation)
+    if self._stepBegin is None:
+      stepValues = sample
+    else:
+      stepValues = self._difference(sample, self._stepBegin)
+    self._stepBegin = sample
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    report = self.reduce(stepValues, mpi_comm_world())
+    report['t'] = self._normalizer.dimensionalize(t, self._normalizer.timeScale()).value
+    self.steps.append(report)
+    return
+
+
+  def finalize(self, formulation):
+    """
+    Write report and cell fields. This must be called by all
+    processes.
+    """
+    if not self.enabled():
+      return
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    sample = self.sample(formulation)
+    report = self.reduce(sample, comm)
+
+    if self.filename and 0 == comm.rank:
+      import json
+      info = {'num_processes': comm.size,
+              'units': {'time': "s", 'message_bytes': "bytes"},
+              'total': report,
+              }
+      if self.perStep:
+        info['steps'] = self.steps
+      fout = open(self.filename, "w")
+      json.dump(info, fout, indent=2, sort_keys=True)
+      fout.close()
+
+    if self.writeFields:
+      from pylith.topology.topology import LoadBalance as ModuleLoadBalance
+      ModuleLoadBalance.write(self.dataWriter, formulation.mesh(),
+                              sample['compute_time'], sample['message_bytes'])
+    return
+
+
+  def sample(self, formulation):
+    """
+    Get values on this process.
+
+    @returns Dictionary with number of cells, ghost points and
+    degrees of freedom of the solution, messages, compute time, and
+    cells and compute time of each integrator.
+    """
+    from pylith.topology.topology import LoadBalance as ModuleLoadBalance
+
+    solution = formulation.fields.solution()
+    values = {'cells': formulation.mesh().numCells(),
+              'ghost_points': ModuleLoadBalance.numGhostPoints(solution),
+              'ghost_dof': ModuleLoadBalance.numGhostDof(solution),
+              'messages': ModuleLoadBalance.numMessages() - self._messagesBegin,
+              'message_bytes': ModuleLoadBalance.messageBytes() - self._bytesBegin,
+              }
+    integrators = []
+    computeTime = 0.0
+    for i,integrator in enumerate(formulation.integrators):
+      (label, ncells) = self._integratorInfo(integrator)
+      time = formulation.integratorTime(i)
+      computeTime += time
+      integrators.append({'name': label,
+                          'cells': ncells,
+                          'compute_time': time,
+                          })
+    values['compute_time'] = computeTime
+    values['integrators'] = integrators
+    return values
+
+
+  def reduce(self, values, comm):
+    """
+    Reduce values over all processes. This must be called by all
+    processes with the same integrators.
+    """
+    import pylith.mpi.mpi as mpi
+
+    def _reduce(value):
+      vmin = mpi.allreduce_scalar_double(value, mpi.mpi_min(), comm.handle)
+      vmax = mpi.allreduce_scalar_double(value, mpi.mpi_max(), comm.handle)
+      vavg = mpi.allreduce_scalar_double(value, mpi.mpi_sum(), comm.handle) / comm.size
+      rankLocal = comm.rank if value == vmax else -1
+      rank = mpi.allreduce_scalar_int(rankLocal, mpi.mpi_max(), comm.handle)
+      return {'min': vmin,
+              'max': vmax,
+              'avg': vavg,
+              'imbalance': vmax / vavg if vavg > 0.0 else 1.0,
+              'max_rank': rank,
+              }
+
+    report = {}
+    for key in ['cells', 'ghost_points', 'ghost_dof', 'messages', 'message_bytes', 'compute_time']:
+      report[key] = _reduce(float(values[key]))
+    report['integrators'] = []
+    for info in values['integrators']:
+      report['integrators'].append({'name': info['name'],
+                                    'cells': _reduce(float(info['cells'])),
+                                    'compute_time': _reduce(info['compute_time']),
+                                    })
+    return report
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    PetscComponent._configure(self)
+    self.filename = self.inventory.filename
+    self.perStep = self.inventory.perStep
+    self.writeFields = self.inventory.writeFields
+    self.dataWriter = self.inventory.dataWriter
+    return
+
+
+  def _integratorInfo(self, integrator):
+    """
+    Get label and number of local cells of integrator.
+    """
+    if hasattr(integrator, "materialObj"):
+      material = integrator.materialObj
+      return ("material %s" % material.label(), material.ncells)
+    elif hasattr(integrator, "faultMesh"):
+      return ("fault %s" % integrator.label(), integrator.faultMesh().numCells())
+    elif hasattr(integrator, "boundaryMesh"):
+      return ("boundary %s" % integrator.label(), integrator.boundaryMesh().numCells())
+    return (integrator.name, 0)
+
+
+  def _difference(self, values, valuesBegin):
+    """
+    Get change in cumulative values since beginning of interval.
+    """
+    diff = dict(values)
+    for key in ['messages', 'message_bytes', 'compute_time']:
+      diff[key] = values[key] - valuesBegin[key]
+    diff['integrators'] = []
+    for info,infoBegin in zip(values['integrators'], valuesBegin['integrators']):
+      diff['integrators'].append({'name': info['name'],
+                                  'cells': info['cells'],
+                                  'compute_time': info['compute_time'] - infoBegin['compute_time'],
+                                  })
+    return diff
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def load_balance():
+  """
+  Factory associated with LoadBalance.
+  """
+  return LoadBalance()
+
+
+# End of file 
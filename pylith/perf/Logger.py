@@ -44,12 +44,58 @@ class Logger(PetscComponent):
     ##
     ## \b Properties
     ## @li \b verbose Should information be printed to the screen.
+    ## @li \b detailed_events Level of detail for events inside loops
+    ##   over cells and vertices ('none', 'sampled', or 'full').
+    ## @li \b detailed_events_interval Time every Nth occurrence of
+    ##   detailed events when sampling.
+    ## @li \b roofline_report Filename for JSON report of arithmetic
+    ##   intensity and achieved bandwidth of assembly events.
+    ## @li \b stream_array_size Number of values in each array for
+    ##   STREAM triad benchmark.
+    ## @li \b stream_trials Number of trials for STREAM triad benchmark.
+    ## @li \b trace_filename Filename for Chrome trace of events,
+    ##   stages, and MPI waits (one file per process).
+    ## @li \b trace_capacity Maximum number of records kept per process
+    ##   in ring buffer for trace.
 
     import pyre.inventory
 
     verbose = pyre.inventory.bool("verbose", default=False)
     verbose.meta['tip'] = "Print information to the screen."
 
+    detailedEvents = pyre.inventory.str("detailed_events", default="none",
+                                        validator=pyre.inventory.choice(["none", "sampled", "full"]))
+    detailedEvents.meta['tip'] = "Level of detail for events inside loops " \
+        "over cells and vertices ('sampled' times every Nth occurrence and " \
+        "extrapolates totals, 'full' times every occurrence)."
+
+    detailedEventsInterval = pyre.inventory.int("detailed_events_interval", default=64,
+                                                validator=pyre.inventory.greater(0))
+    detailedEventsInterval.meta['tip'] = "Time every Nth occurrence of " \
+        "detailed events when sampling."
+
+    rooflineReport = pyre.inventory.str("roofline_report", default="")
+    rooflineReport.meta['tip'] = "Filename for JSON report of arithmetic " \
+        "intensity and achieved bandwidth of assembly events (empty for no report)."
+
+    streamArraySize = pyre.inventory.int("stream_array_size", default=4000000,
+                                         validator=pyre.inventory.greater(0))
+    streamArraySize.meta['tip'] = "Number of values in each array for STREAM " \
+        "triad benchmark (should be much larger than the last level cache)."
+
+    streamTrials = pyre.inventory.int("stream_trials", default=10,
+                                      validator=pyre.inventory.greater(0))
+    streamTrials.meta['tip'] = "Number of trials for STREAM triad benchmark."
+
+    traceFilename = pyre.inventory.str("trace_filename", default="")
+    traceFilename.meta['tip'] = "Filename for Chrome trace of events, " \
+        "stages, and MPI waits (one file per process; empty for no trace)."
+
+    traceCapacity = pyre.inventory.int("trace_capacity", default=1000000,
+                                       validator=pyre.inventory.greater(0))
+    traceCapacity.meta['tip'] = "Maximum number of records kept per " \
+        "process in ring buffer for trace."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -58,6 +104,165 @@ class Logger(PetscComponent):
     Constructor.
     """
     PetscComponent.__init__(self, name, facility="perf_logger")
+    self.detailedEvents = "none"
+    self.detailedEventsInterval = 64
+    self.rooflineReport = ""
+    self.streamArraySize = 4000000
+    self.streamTrials = 10
+    self.traceFilename = ""
+    self.traceCapacity = 1000000
+    self._traceRank = 0
+    self._traceSize = 1
+    return
+
+
+  def setupEventLogging(self):
+    """
+    Set level of detail for events inside loops over cells and vertices.
+    """
+    from pylith.utils.EventLogger import EventLogger
+    levels = {'none': EventLogger.DETAIL_NONE,
+              'sampled': EventLogger.DETAIL_SAMPLED,
+              'full': EventLogger.DETAIL_FULL,
+              }
+    EventLogger.detailLevel(levels[self.detailedEvents])
+    EventLogger.sampleInterval(self.detailedEventsInterval)
+    return
+
+
+  def startTrace(self, comm):
+    """
+    Start recording events, stages, and MPI waits for trace if a trace
+    filename is given. The processes start together, so the timestamps
+    on the different processes are comparable. A trace of the most
+    recent activity can be written while running by sending SIGUSR1
+    to a process. This must be called by all processes.
+    """
+    if not self.traceFilename:
+      return
+
+    from pylith.utils.utils import EventTracer
+    self._traceRank = comm.rank
+    self._traceSize = comm.size
+    comm.barrier()
+    EventTracer.enable(self.traceCapacity)
+
+    import signal
+    signal.signal(signal.SIGUSR1, self._traceSignalHandler)
+    return
+
+
+  def writeTrace(self):
+    """
+    Write trace of events, stages, and MPI waits on this process in
+    Chrome trace event format. This must be called before PETSc is
+    finalized.
+    """
+    if not self.traceFilename:
+      return
+
+    from pylith.utils.utils import EventTracer
+    EventTracer.write(self._traceFilenameLocal(), self._traceRank)
+    if self.verbose:
+      print "Wrote trace with %d records (%d dropped) to '%s'." % \
+          (EventTracer.numRecords(), EventTracer.numDropped(), self._traceFilenameLocal())
+    return
+
+
+  def measureBandwidth(self, comm):
+    """
+    Measure memory bandwidth with the STREAM triad kernel on all
+    processes at the same time, so processes on a node share the
+    memory channels as they do during assembly. This must be called by
+    all processes.
+
+    Returns aggregate bandwidth (bytes/s) over all processes.
+    """
+    from pylith.utils.utils import StreamBenchmark
+    import pylith.mpi.mpi as mpi
+
+    comm.barrier()
+    bandwidth = StreamBenchmark.triad(self.streamArraySize, self.streamTrials)
+    return mpi.allreduce_scalar_double(bandwidth, mpi.mpi_sum(), comm.handle)
+
+
+  def reduceRoofline(self, comm):
+    """
+    Reduce floating point operations, bytes, and time of events with
+    logged bytes over all processes. This must be called by all
+    processes after PETSc has compiled the event log.
+
+    Returns list of events with totals and rates.
+    """
+    from pylith.utils.EventLogger import EventLogger
+    import pylith.mpi.mpi as mpi
+
+    # Events are registered in the same order on all processes, so the
+    # identifiers match, but a process may not have logged bytes for
+    # all of them.
+    idsLocal = [EventLogger.bytesEvent(i) for i in xrange(EventLogger.numBytesEvents())]
+    maxId = mpi.allreduce_scalar_int(max(idsLocal + [-1]), mpi.mpi_max(), comm.handle)
+
+    report = []
+    for id in xrange(maxId+1):
+      flops = mpi.allreduce_scalar_double(EventLogger.eventFlops(id), mpi.mpi_sum(), comm.handle)
+      nbytes = mpi.allreduce_scalar_double(EventLogger.eventBytes(id), mpi.mpi_sum(), comm.handle)
+      time = mpi.allreduce_scalar_double(EventLogger.eventTime(id), mpi.mpi_max(), comm.handle)
+      if nbytes <= 0.0:
+        continue
+      report.append({'name': EventLogger.eventName(id),
+                     'flops': flops,
+                     'bytes': nbytes,
+                     'time': time,
+                     'intensity': flops / nbytes,
+                     'gflops_rate': flops / time * 1.0e-9 if time > 0.0 else None,
+                     'gbytes_rate': nbytes / time * 1.0e-9 if time > 0.0 else None,
+                     })
+    return report
+
+
+  def writeRooflineReport(self, comm):
+    """
+    Write JSON report of arithmetic intensity and achieved bandwidth of
+    events with logged bytes and compare the bandwidth with the STREAM
+    triad bandwidth. This must be called by all processes.
+    """
+    if not self.rooflineReport:
+      return
+
+    events = self.reduceRoofline(comm)
+    stream = self.measureBandwidth(comm) * 1.0e-9
+    for event in events:
+      event['stream_fraction'] = event['gbytes_rate'] / stream \
+          if not event['gbytes_rate'] is None and stream > 0.0 else None
+
+    if 0 == comm.rank:
+      import json
+      fout = open(self.rooflineReport, "w")
+      json.dump({'num_processes': comm.size,
+                 'stream_triad': {'gbytes_rate': stream,
+                                  'array_size': self.streamArraySize,
+                                  'trials': self.streamTrials,
+                                  },
+                 'units': {'time': "s", 'gflops_rate': "GFlop/s",
+                           'gbytes_rate': "GB/s", 'intensity': "Flop/byte",
+                           },
+                 'events': events,
+                 }, fout, indent=2, sort_keys=True)
+      fout.close()
+
+      if self.verbose:
+        output = ["ROOFLINE on %d processes (STREAM triad %.2f GB/s)" % (comm.size, stream),
+                  "%-24s %10s %10s %10s %10s" % ("", "Flop/byte", "GFlop/s", "GB/s", "STREAM")]
+        for event in events:
+          if event['gbytes_rate'] is None:
+            output.append("%-24s %10.3f %10s %10s %10s" % \
+                            (event['name'], event['intensity'], "-", "-", "-"))
+          else:
+            output.append("%-24s %10.3f %10.3f %10.3f %9.1f%%" % \
+                            (event['name'], event['intensity'], event['gflops_rate'],
+                             event['gbytes_rate'], 100.0*event['stream_fraction']))
+        print '\n'.join(output)
     return
 
 
@@ -71,7 +276,7 @@ class Logger(PetscComponent):
 
   def logMesh(self, stage, mesh):
     """
-    Read mesh parameters to determine memory from our model.
+    Log memory used by mesh.
     """
     raise NotImplementedError, "logMesh() not implemented."
     return
@@ -85,6 +290,32 @@ class Logger(PetscComponent):
     """
     PetscComponent._configure(self)
     self.verbose = self.inventory.verbose
+    self.detailedEvents = self.inventory.detailedEvents
+    self.detailedEventsInterval = self.inventory.detailedEventsInterval
+    self.rooflineReport = self.inventory.rooflineReport
+    self.streamArraySize = self.inventory.streamArraySize
+    self.streamTrials = self.inventory.streamTrials
+    self.traceFilename = self.inventory.traceFilename
+    self.traceCapacity = self.inventory.traceCapacity
+    return
+
+
+  def _traceFilenameLocal(self):
+    """
+    Get name of trace file for this process.
+    """
+    if 1 == self._traceSize:
+      return self.traceFilename
+    import os
+    root, ext = os.path.splitext(self.traceFilename)
+    return "%s_p%d%s" % (root, self._traceRank, ext)
+
+
+  def _traceSignalHandler(self, signum, frame):
+    """
+    Write trace when process receives signal.
+    """
+    self.writeTrace()
     return
 
 
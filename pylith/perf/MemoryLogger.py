@@ -43,12 +43,18 @@ class MemoryLogger(Logger):
     ## Python object for managing Problem facilities and properties.
     ##
     ## \b Properties
-    ## @li \b include_dealloc Subtract deallocate memory when reporting.
+    ## @li \b startup_report Filename for JSON report of startup phases.
+    ## @li \b memory_report Filename for JSON report of measured memory.
 
     import pyre.inventory
 
-    includeDealloc = pyre.inventory.bool("include_dealloc", default=True)
-    includeDealloc.meta['tip'] = "Subtract deallocated memory when reporting."
+    startupReport = pyre.inventory.str("startup_report", default="")
+    startupReport.meta['tip'] = "Filename for JSON report of wall time " \
+        "and memory for each startup phase (empty for no report)."
+
+    memoryReport = pyre.inventory.str("memory_report", default="")
+    memoryReport.meta['tip'] = "Filename for JSON report of measured " \
+        "memory of meshes, fields, and Jacobian (empty for no report)."
 
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
@@ -59,135 +65,221 @@ class MemoryLogger(Logger):
     """
     Logger.__init__(self, name)
     self.megabyte = float(2**20)
-    self.memory   = {}
-    self.memory['Completion'] = 0
+    self.memory = {}
+    self.stagePeaks = {}
+    self.startupReport = ""
+    self.memoryReport = ""
+    self.phases = []
+    self._phaseStack = []
+    self._stageLogger = None
     return
 
 
-  def logMesh(self, stage, mesh, reset=True):
+  def phaseBegin(self, phase):
     """
-    Read mesh parameters to determine memory from our model.
+    Begin startup phase. The phase is also logged as a PETSc stage.
     """
-    import pylith.perf.Mesh
+    import time
+    from pylith.utils.profiling import memoryUsage
+
+    if self._stageLogger is None:
+      from pylith.utils.EventLogger import EventLogger
+      logger = EventLogger()
+      logger.className("Startup")
+      logger.initialize()
+      self._stageLogger = logger
+    self._stageLogger.stagePush(phase)
+
+    (memCurrent, memPeak) = memoryUsage()
+    self._phaseStack.append({'name': phase,
+                             'start': time.time(),
+                             'memory_begin': memCurrent,
+                             'peak_begin': memPeak,
+                             })
+    return
 
-    if not stage in self.memory or reset:
-      self.memory[stage] = {}
-    meshModel = pylith.perf.Mesh.Mesh(mesh.dimension(), mesh.numCorners(), 
-                                      mesh.numVertices(), mesh.numCells())
-    meshModel.tabulate(self.memory[stage])
-    for group, nvertices in mesh.groupSizes():
-      self.logVertexGroup(stage, group, nvertices, mesh.numVertices())
+
+  def phaseEnd(self, phase):
+    """
+    End startup phase.
+
+    The peak memory for the phase is the process high-water mark if it
+    increased during the phase, otherwise it is the larger of the
+    memory in use at the beginning and end of the phase.
+    """
+    import time
+    from pylith.utils.profiling import memoryUsage
+
+    if not len(self._phaseStack) or self._phaseStack[-1]['name'] != phase:
+      raise ValueError("Startup phase '%s' ended without matching call to phaseBegin()." % phase)
+    info = self._phaseStack.pop()
+    (memCurrent, memPeak) = memoryUsage()
+    if memPeak > info['peak_begin']:
+      peak = memPeak
+    else:
+      peak = max(info['memory_begin'], memCurrent)
+    self.phases.append({'name': phase,
+                        'start': info['start'],
+                        'wall_time': time.time() - info['start'],
+                        'memory_begin': info['memory_begin'],
+                        'memory_end': memCurrent,
+                        'memory_peak': peak,
+                        })
+    self._stageLogger.stagePop()
     return
 
 
-  def logVertexGroup(self, stage, label, nvertices, nMeshVertices):
+  def writeStartupReport(self, comm):
     """
-    Read vertex group parameters to determine memory from our model.
+    Write JSON report of startup phases.
+
+    Phases with the same name are combined. The wall time and memory
+    are reduced over all processes, so this must be called by all
+    processes.
     """
-    import pylith.perf.VertexGroup
+    if not self.startupReport:
+      return
 
-    if not stage in self.memory:
-      self.memory[stage] = {}
-    if not 'IntSections' in self.memory[stage]:
-      self.memory[stage]['IntSections'] = {}
-    groupModel = pylith.perf.VertexGroup.VertexGroup(label, nvertices, 
-                                                     nMeshVertices)
-    groupModel.tabulate(self.memory[stage]['IntSections'])
+    # Combine phases with the same name.
+    combined = {}
+    for phase in self.phases:
+      name = phase['name']
+      if not name in combined:
+        combined[name] = dict(phase)
+        combined[name]['count'] = 1
+      else:
+        info = combined[name]
+        info['start'] = min(info['start'], phase['start'])
+        info['wall_time'] += phase['wall_time']
+        info['memory_end'] = phase['memory_end']
+        info['memory_peak'] = max(info['memory_peak'], phase['memory_peak'])
+        info['count'] += 1
+
+    # Reduce over processes using the same ordering on all processes.
+    import pylith.mpi.mpi as mpi
+    report = []
+    for name in sorted(combined.keys()):
+      info = combined[name]
+      entry = {'name': name,
+               'count': info['count'],
+               'start': mpi.allreduce_scalar_double(info['start'], mpi.mpi_min(), comm.handle),
+               }
+      for key in ['wall_time', 'memory_begin', 'memory_end', 'memory_peak']:
+        value = info[key]
+        entry[key] = {
+          'min': mpi.allreduce_scalar_double(value, mpi.mpi_min(), comm.handle),
+          'max': mpi.allreduce_scalar_double(value, mpi.mpi_max(), comm.handle),
+          'avg': mpi.allreduce_scalar_double(value, mpi.mpi_sum(), comm.handle) / comm.size,
+          }
+      report.append(entry)
+    report.sort(key=lambda entry: entry['start'])
+    if len(report):
+      t0 = report[0]['start']
+      for entry in report:
+        entry['start'] -= t0
+
+    if 0 == comm.rank:
+      import json
+      fout = open(self.startupReport, "w")
+      json.dump({'num_processes': comm.size,
+                 'units': {'time': "s", 'memory': "MB"},
+                 'phases': report,
+                 }, fout, indent=2, sort_keys=True)
+      fout.close()
     return
 
 
-  def logMaterial(self, stage, material):
+  def logMesh(self, stage, mesh, reset=True):
     """
-    Read material parameters to determine memory from our model.
+    Log memory used by mesh (topology, coordinates, and labels).
     """
-    import pylith.perf.Material
+    from pylith.topology.topology import MemoryUsage
 
-    if not stage in self.memory:
+    if not stage in self.memory or reset:
       self.memory[stage] = {}
-    if not 'Labels' in self.memory[stage]:
-      self.memory[stage]['Labels'] = {}
-    materialModel = pylith.perf.Material.Material(material.label(), 
-                                                  material.ncells)
-    materialModel.tabulate(self.memory[stage]['Labels'])
+    self._log(stage, 'Mesh', "mesh", MemoryUsage.mesh(mesh))
     return
 
 
-  def logQuadrature(self, stage, quadrature):
-    ##self.logField(stage, quadrature.quadPtsPrecomp())
-    ##self.logField(stage, quadrature.jacobianPrecomp())
-    ##self.logField(stage, quadrature.jacobianDetPrecomp())
-    ##self.logField(stage, quadrature.basisDerivPrecomp())
-    # For debugging right now
-    ##self.logField('Field', quadrature.quadPtsPrecomp())
-    ##self.logField('Field', quadrature.jacobianPrecomp())
-    ##self.logField('Field', quadrature.jacobianDetPrecomp())
-    ##self.logField('Field', quadrature.basisDerivPrecomp())
+  def logMaterial(self, stage, material):
+    """
+    Log memory used by fields of material.
+    """
+    group = "Material %s" % material.label()
+    self.logField(stage, material.propertiesField(), group)
+    if material.singlePrecisionProperties():
+      # Values are stored outside the properties field.
+      self._log(stage, group, "properties (single precision)",
+                material.propertiesSingleBytes())
+    self.logField(stage, material.stateVarsField(), group)
     return
 
-  
-  def logFields(self, stage, fields):
+
+  def logFrictionModel(self, stage, friction):
     """
-    Log fields to determine memory from our model.
+    Log memory used by fields of friction model.
     """
-    if fields is None:
-      return
-    names = fields.fieldNames()
-    for name in names:
-      field = fields.get(name)
-      self.logField(stage, field)
+    group = "Friction %s" % friction.label()
+    self.logFields(stage, friction.fieldsPropsStateVars(), group)
     return
 
 
-  def logField(self, stage, field):
+  def logFault(self, stage, fault):
     """
-    Read field parameters to determine memory from our model.
+    Log memory used by fault mesh.
     """
-    import pylith.perf.Field
+    from pylith.topology.topology import MemoryUsage
 
-    if not stage in self.memory: self.memory[stage] = {}
-    if not 'Fields' in self.memory[stage]:
-      self.memory[stage]['Fields'] = {}
-    if not field is None:
-      fieldModel = pylith.perf.Field.Field(field.label(), field.sectionSize(), 
-                                           field.chartSize())
-      fieldModel.tabulate(self.memory[stage]['Fields'])
+    self._log(stage, "Fault %s" % fault.label(), "mesh",
+              MemoryUsage.mesh(fault.faultMesh()))
     return
 
 
-  def logGlobalOrder(self, stage, label, field):
+  def logQuadrature(self, stage, quadrature):
     """
-    Read parameters to determine memory from our model.
+    Log memory used by quadrature. Quadrature information is
+    computed on the fly for each cell, so there is nothing to log.
     """
-    import pylith.perf.GlobalOrder
+    return
 
-    if not stage in self.memory: self.memory[stage] = {}
-    orderModel = pylith.perf.GlobalOrder.GlobalOrder(label, field.chartSize())
-    orderModel.tabulate(self.memory[stage])
+  
+  def logFields(self, stage, fields, group="Fields"):
+    """
+    Log memory used by fields in manager.
+    """
+    if fields is None:
+      return
+    names = fields.fieldNames()
+    for name in names:
+      field = fields.get(name)
+      self.logField(stage, field, group)
     return
 
 
-  def logJacobian(self, stage, label):
+  def logField(self, stage, field, group="Fields"):
     """
-    Read parameters to determine memory from our model.
+    Log memory used by field.
     """
-    import pylith.perf.Jacobian
+    from pylith.topology.topology import MemoryUsage
 
-    if not stage in self.memory: self.memory[stage] = {}
-    jacModel = pylith.perf.Jacobian.Jacobian(label)
-    jacModel.tabulate(self.memory[stage])
+    if not field is None:
+      self._log(stage, group, field.label(), MemoryUsage.field(field))
     return
 
 
-  def logFault(self, stage, mesh):
+  def logJacobian(self, stage, jacobian):
     """
-    Lof fault parameters to determine memory from our model.
+    Log memory used by Jacobian (sparse matrix or lumped field).
     """
-    import pylith.perf.Fault
+    from pylith.topology.topology import MemoryUsage
+    from pylith.topology.Jacobian import Jacobian
 
-    if not stage in self.memory: self.memory[stage] = {}
-    faultModel = pylith.perf.Fault.Fault(mesh.dimension(), mesh.numCorners(),
-                                         mesh.numVertices(), mesh.numCells())
-    faultModel.tabulate(self.memory[stage])
+    if jacobian is None:
+      return
+    if isinstance(jacobian, Jacobian):
+      self._log(stage, "Jacobian", "matrix", MemoryUsage.jacobian(jacobian))
+    else:
+      self._log(stage, "Jacobian", jacobian.label(), MemoryUsage.field(jacobian))
     return
 
 
@@ -208,93 +300,135 @@ class MemoryLogger(Logger):
     """
     Incorporate information from another logger.
     """
+    if logger is self:
+      return
     self.mergeMemDict(self.memory, logger.memory)
+    for stage,peak in logger.stagePeaks.iteritems():
+      self.stagePeaks[stage] = max(peak, self.stagePeaks.get(stage, 0.0))
+    self.phases.extend(logger.phases)
     return
 
 
-  def prefix(self, indent):
-    prefix = ''
-    for i in range(indent):
-      prefix += '  '
-    return prefix
-
-
-  def memLine(self, source, name, mem, indent = 0):
-    return '%s%-30s %8d bytes (%.3f MB)' % \
-        (self.prefix(indent), name+' ('+source+'):', mem, mem / self.megabyte)
-
-
-  def processMemDict(self, memDict, indent = 0, namePrefix = '', 
-                     includeDealloc = True):
-    output    = []
-    total     = 0
-    codeTotal = 0
-    indent   += 1
-    for name,m in memDict.iteritems():
-      fullname = namePrefix+name
-      if isinstance(m, dict):
-        output.append(self.prefix(indent)+name)
-        out,mem,codeMem = self.processMemDict(m, indent, fullname, 
-                                              includeDealloc)
-        output.extend(out)
-        total     += mem
-        codeTotal += codeMem
-      else:
-        mem = 0 #logger.getAllocationTotal(fullname)
-        if includeDealloc:
-          mem     -= 0 #logger.getDeallocationTotal(fullname)
-        total     += m
-        codeTotal += mem
-        output.append(self.memLine('Model', name, m, indent))
-        if False: #logger.getAllocationTotal(fullname):
-          output.append(self.memLine('Code',  name, mem, indent))
-    if namePrefix:
-      mem = 0 #logger.getAllocationTotal(namePrefix)
-      if includeDealloc:
-        mem -= 0 #logger.getDeallocationTotal(namePrefix)
-    else:
-      mem = 0 #logger.getAllocationTotal()
-      if includeDealloc:
-        mem -= 0 #logger.getDeallocationTotal()
-    if mem == 0:
-      mem = codeTotal
-    output.append(self.prefix(indent)+'-'*(60-indent))
-    output.append(self.memLine('Model', 'Total', total, indent))
-    output.append(self.memLine('Code',  'Total', mem, indent))
-    if mem:
-      output.append('%sPercentage memory modeled: %.2f%%' % \
-                      (self.prefix(indent), total*100.0/mem))
-    else:
-      output.append('%sMemory modeled:            %d (no measured memory)' % \
-                      (self.prefix(indent), total))
-    return output, total, codeTotal
+  def reduceMemory(self, comm):
+    """
+    Reduce measured memory over all processes.
 
+    Objects are logged collectively, so all processes have the same
+    entries and we reduce them in the same (sorted) order. This must
+    be called by all processes.
 
-  def show(self):
+    @returns List of stages with min/max/avg memory (MB) of each
+    entry, the stage total, and the process high-water mark.
+    """
+    import pylith.mpi.mpi as mpi
+
+    def _reduce(value):
+      return {
+        'min': mpi.allreduce_scalar_double(value, mpi.mpi_min(), comm.handle),
+        'max': mpi.allreduce_scalar_double(value, mpi.mpi_max(), comm.handle),
+        'avg': mpi.allreduce_scalar_double(value, mpi.mpi_sum(), comm.handle) / comm.size,
+        }
+
+    report = []
+    for stage in sorted(self.memory.keys()):
+      entries = []
+      total = 0
+      for group in sorted(self.memory[stage].keys()):
+        for name in sorted(self.memory[stage][group].keys()):
+          nbytes = self.memory[stage][group][name]
+          total += nbytes
+          entries.append({'group': group,
+                          'name': name,
+                          'memory': _reduce(nbytes / self.megabyte),
+                          })
+      report.append({'name': stage,
+                     'entries': entries,
+                     'total': _reduce(total / self.megabyte),
+                     'peak': _reduce(self.stagePeaks.get(stage, 0.0)),
+                     })
+    return report
+
+
+  def writeMemoryReport(self, comm):
     """
-    Print memory usage.
+    Write JSON report of measured memory. This must be called by all
+    processes.
     """
-    output = ["MEMORY USAGE"]
-    output.extend(self.processMemDict(self.memory, includeDealloc = \
-                                        self.includeDealloc)[0])
+    if not self.memoryReport:
+      return
+
+    report = self.reduceMemory(comm)
+    if 0 == comm.rank:
+      import json
+      fout = open(self.memoryReport, "w")
+      json.dump({'num_processes': comm.size,
+                 'units': {'memory': "MB"},
+                 'stages': report,
+                 }, fout, indent=2, sort_keys=True)
+      fout.close()
+    return
+
 
-    output.append(self.memLine('Code',  'Total Alloced', 0))
-                               #logger.getAllocationTotal('default'), 1))
-    output.append(self.memLine('Code',  'Total Dealloced', 0))
-                               #logger.getDeallocationTotal('default'), 1))
+  def show(self, comm=None):
+    """
+    Print measured memory (min/max/avg over processes) on process
+    0. This must be called by all processes.
+    """
+    if comm is None:
+      from pylith.mpi.Communicator import mpi_comm_world
+      comm = mpi_comm_world()
+    report = self.reduceMemory(comm)
+    if comm.rank > 0:
+      return
 
+    def _line(name, memory, indent):
+      return "%s%-40s %10.3f %10.3f %10.3f" % \
+          ("  "*indent, name, memory['min'], memory['max'], memory['avg'])
+
+    output = ["MEMORY USAGE (MB) on %d processes" % comm.size,
+              "%-40s %10s %10s %10s" % ("", "min", "max", "avg")]
+    for stage in report:
+      output.append(stage['name'])
+      group = None
+      for entry in stage['entries']:
+        if entry['group'] != group:
+          group = entry['group']
+          output.append("  %s" % group)
+        output.append(_line(entry['name'], entry['memory'], 2))
+      output.append("  " + "-"*78)
+      output.append(_line("Total", stage['total'], 1))
+      output.append(_line("Process high-water mark", stage['peak'], 1))
     print '\n'.join(output)
     return
 
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
+  def _log(self, stage, group, name, nbytes):
+    """
+    Add measured memory of object and update high-water mark of stage.
+    """
+    from pylith.utils.profiling import memoryUsage
+
+    if not stage in self.memory:
+      self.memory[stage] = {}
+    if not group in self.memory[stage]:
+      self.memory[stage][group] = {}
+    entries = self.memory[stage][group]
+    entries[name] = entries.get(name, 0) + nbytes
+
+    (memCurrent, memPeak) = memoryUsage()
+    self.stagePeaks[stage] = max(memPeak, self.stagePeaks.get(stage, 0.0))
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
     """
     Logger._configure(self)
-    self.includeDealloc = self.inventory.includeDealloc
+    self.startupReport = self.inventory.startupReport
+    self.memoryReport = self.inventory.memoryReport
     return
 
 
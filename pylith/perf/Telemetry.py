@@ -0,0 +1,199 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+## @file pylith/perf/Telemetry.py
+##
+## @brief Python object for writing solver convergence and time step
+## telemetry.
+##
+## Factory: telemetry.
+
+from pylith.utils.PetscComponent import PetscComponent
+
+# Telemetry class
+class Telemetry(PetscComponent):
+  """
+  Python object for writing solver convergence and time step
+  telemetry.
+
+  Each time step is written as one line of JSON (newline-delimited
+  JSON) with the time, time step, wall time of each stage (prestep,
+  step, and poststep), solver iterations, residual norms and line
+  search evaluations, and iterations used to enforce the friction
+  criterion on each fault. The file is flushed after every step, so it
+  can be monitored (for example, with tail -f) while the simulation
+  runs.
+
+  Factory: telemetry.
+  """
+  
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(PetscComponent.Inventory):
+    """
+    Python object for managing Telemetry facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing Telemetry facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Filename for newline-delimited JSON telemetry.
+    ##
+    ## \b Facilities
+    ## @li None
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="")
+    filename.meta['tip'] = "Filename for newline-delimited JSON telemetry " \
+        "of each time step (empty for no telemetry)."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="telemetry"):
+    """
+    Constructor.
+    """
+    PetscComponent.__init__(self, name, facility="telemetry")
+    self.filename = ""
+    self._fout = None
+    self._step = 0
+    self._stageTimes = {}
+    self._stageBegin = {}
+    self._wallBegin = None
+    return
+
+
+  def enabled(self):
+    """
+    Return True if telemetry will be written.
+    """
+    return len(self.filename) > 0
+
+
+  def open(self):
+    """
+    Open telemetry file.
+    """
+    if not self.enabled():
+      return
+    import time
+    self._wallBegin = time.time()
+    self._step = 0
+    self._stageTimes = {}
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    if 0 == comm.rank:
+      self._fout = open(self.filename, "w")
+    return
+
+
+  def close(self):
+    """
+    Close telemetry file.
+    """
+    if not self._fout is None:
+      self._fout.close()
+      self._fout = None
+    return
+
+
+  def stageBegin(self, name):
+    """
+    Start timing stage of current time step.
+    """
+    if not self.enabled():
+      return
+    import time
+    self._stageBegin[name] = time.time()
+    return
+
+
+  def stageEnd(self, name):
+    """
+    Stop timing stage of current time step.
+    """
+    if not self.enabled() or not name in self._stageBegin:
+      return
+    import time
+    elapsed = time.time() - self._stageBegin.pop(name)
+    self._stageTimes[name] = self._stageTimes.get(name, 0.0) + elapsed
+    return
+
+
+  def record(self, t, dt, formulation, elastic=False):
+    """
+    Write telemetry for time step (t and dt are in seconds, either as
+    floats or dimensional quantities). This must be called by all
+    processes after the poststep stage.
+    """
+    if not self.enabled():
+      return
+
+    import time
+    entry = {'step': self._step,
+             't': self._seconds(t),
+             'dt': self._seconds(dt),
+             'elastic_prestep': elastic,
+             'wall_time': time.time() - self._wallBegin,
+             'stage_time': self._stageTimes,
+             }
+    entry.update(formulation.telemetry())
+    self._stageTimes = {}
+    self._step += 1
+
+    if not self._fout is None:
+      import json
+      self._fout.write(json.dumps(entry, sort_keys=True) + "\n")
+      self._fout.flush()
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    PetscComponent._configure(self)
+    self.filename = self.inventory.filename
+    return
+
+
+  def _seconds(self, value):
+    """
+    Get time in seconds as a float, which JSON can serialize.
+    """
+    from pyre.units.time import second
+    if hasattr(value, "value"):
+      return float(value / second)
+    return float(value)
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def telemetry():
+  """
+  Factory associated with Telemetry.
+  """
+  return Telemetry()
+
+
+# End of file 
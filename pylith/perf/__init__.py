@@ -20,14 +20,10 @@
 
 ## @brief Python PyLith perf module initialization.
 
-__all__ = ['Memory', 
-           'Logger', 
+__all__ = ['Logger', 
            'MemoryLogger',
-           'Mesh', 
-           'Fault',
-           'Material', 
-           'Field',
-           'GlobalOrder',
+           'LoadBalance',
+           'Telemetry',
            ]
 
 
@@ -59,6 +59,10 @@ class Explicit(Formulation, ModuleExplicit):
     ##
     ## \b Properties
     ## @li \b norm_viscosity Normalized viscosity for numerical damping.
+    ## @li \b local_time_stepping Advance regions with larger stable
+    ##   time steps using multiples of the time step.
+    ## @li \b lts_max_levels Maximum number of time-step levels.
+    ## @li \b lts_report Filename for JSON report of time-step levels.
     ##
     ## \b Facilities
     ## @li \b solver Algebraic solver.
@@ -68,6 +72,16 @@ class Explicit(Formulation, ModuleExplicit):
     normViscosity = pyre.inventory.float("norm_viscosity", default=0.1)
     normViscosity.meta['tip'] = "Normalized viscosity for numerical damping."
 
+    localTimeStepping = pyre.inventory.bool("local_time_stepping", default=False)
+    localTimeStepping.meta['tip'] = "Advance regions with larger stable time steps using multiples of the time step."
+
+    ltsMaxLevels = pyre.inventory.int("lts_max_levels", default=4,
+                                      validator=pyre.inventory.greater(0))
+    ltsMaxLevels.meta['tip'] = "Maximum number of time-step levels for local time stepping."
+
+    ltsReport = pyre.inventory.str("lts_report", default="")
+    ltsReport.meta['tip'] = "Filename for JSON report of local time-step levels (empty for none)."
+
     from SolverLumped import SolverLumped
     solver = pyre.inventory.facility("solver", family="solver",
                                      factory=SolverLumped)
@@ -84,6 +98,8 @@ class Explicit(Formulation, ModuleExplicit):
     ModuleExplicit.__init__(self)
     self._loggingPrefix = "TSEx "
     self.dtStable = None
+    self.dtLevel0 = None
+    self.ltsInfo = None
     return
 
 
@@ -108,6 +124,7 @@ class Explicit(Formulation, ModuleExplicit):
     comm = mpi_comm_world()
 
     self._initialize(dimension, normalizer)
+    self.timeScale = normalizer.timeScale()
 
     #from pylith.utils.petsc import MemoryLogger
     #memoryLogger = MemoryLogger.singleton()
@@ -149,6 +166,7 @@ class Explicit(Formulation, ModuleExplicit):
 
     if 0 == comm.rank:
       self._info.log("Creating lumped Jacobian matrix.")
+    self.perfLogger.phaseBegin("Jacobian Preallocation")
     from pylith.topology.Field import Field
     jacobian = Field(self.mesh())
     jacobian.label("jacobian")
@@ -168,12 +186,15 @@ class Explicit(Formulation, ModuleExplicit):
     jacobian.allocate()
     jacobian.zeroAll()
     self.jacobian = jacobian
+    self.perfLogger.phaseEnd("Jacobian Preallocation")
     self._debug.log(resourceUsageString())
 
     #memoryLogger.stagePush("Problem")
     if 0 == comm.rank:
       self._info.log("Initializing solver.")
+    self.perfLogger.phaseBegin("Solver Init")
     self.solver.initialize(self.fields, self.jacobian, self)
+    self.perfLogger.phaseEnd("Solver Init")
     self._debug.log(resourceUsageString())
 
     #memoryLogger.stagePop()
@@ -188,10 +209,15 @@ class Explicit(Formulation, ModuleExplicit):
     """
     logEvent = "%sprestep" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)
-    
-    dispIncr = self.fields.get("dispIncr(t->t+dt)")
-    for constraint in self.constraints:
-      constraint.setFieldIncr(t, t+dt, dispIncr)
+
+    if self.localTimeStepping:
+      # Constraints are set for each substep of level 0 and all
+      # integrators use the time step of level 0.
+      dt = self.dtLevel0
+    else:
+      dispIncr = self.fields.get("dispIncr(t->t+dt)")
+      for constraint in self.constraints:
+        constraint.setFieldIncr(t, t+dt, dispIncr)
 
     needNewJacobian = False
     for integrator in self.integrators:
@@ -212,6 +238,10 @@ class Explicit(Formulation, ModuleExplicit):
     from pylith.mpi.Communicator import mpi_comm_world
     comm = mpi_comm_world()
 
+    if self.localTimeStepping:
+      self._stepLevels(t, dt)
+      return
+
     self._reformResidual(t, dt)
     
     if 0 == comm.rank:
@@ -234,24 +264,30 @@ class Explicit(Formulation, ModuleExplicit):
     from pylith.mpi.Communicator import mpi_comm_world
     comm = mpi_comm_world()
 
-    # The velocity and acceleration at time t depends on the
-    # displacement at time t+dt, we want to output BEFORE updating the
-    # displacement fields so that the displacement, velocity, and
-    # acceleration files are all at time t.
-    if 0 == comm.rank:
-      self._info.log("Writing solution fields.")
-    for output in self.output.components():
-      output.writeData(t, self.fields)
-    self._writeData(t)
-
-    # Update displacement field from time t to time t+dt.
-    dispIncr = self.fields.get("dispIncr(t->t+dt)")
-    dispT = self.fields.get("disp(t)")
-    dispTmdt = self.fields.get("disp(t-dt)")
-
-    dispTmdt.copy(dispT)
-    dispT.add(dispIncr)
-    dispIncr.zeroAll()
+    if self.localTimeStepping:
+      # Levels end their time steps at different substeps, so the rate
+      # fields are not at a common time. Output the displacement after
+      # all levels have been advanced to time t+dt.
+      ModuleExplicit.rotateDisplacement(self)
+
+      if 0 == comm.rank:
+        self._info.log("Writing solution fields.")
+      for output in self.output.components():
+        output.writeData(t+dt, self.fields)
+      self._writeData(t+dt)
+    else:
+      # The velocity and acceleration at time t depends on the
+      # displacement at time t+dt, we want to output BEFORE updating
+      # the displacement fields so that the displacement, velocity,
+      # and acceleration files are all at time t.
+      if 0 == comm.rank:
+        self._info.log("Writing solution fields.")
+      for output in self.output.components():
+        output.writeData(t, self.fields)
+      self._writeData(t)
+
+      # Update displacement field from time t to time t+dt.
+      ModuleExplicit.rotateDisplacement(self)
 
     # Complete post-step processing.
     Formulation.poststep(self, t, dt)
@@ -274,6 +310,8 @@ class Explicit(Formulation, ModuleExplicit):
     for constraint in self.constraints:
       constraint.setField(t+dt, disp)
 
+    if self.localTimeStepping:
+      dt = self.dtLevel0
     needNewJacobian = False
     for integrator in self.integrators:
       integrator.timeStep(dt)
@@ -297,9 +335,29 @@ class Explicit(Formulation, ModuleExplicit):
     self._eventLogger.eventBegin(logEvent)
 
     if self.dtStable is None:
-      self.dtStable = self.timeStep.timeStep(self.mesh(), self.integrators)
+      dt = self.timeStep.timeStep(self.mesh(), self.integrators)
+      if self.localTimeStepping:
+        dt = self._setupTimeStepLevels(dt)
+      self.dtStable = dt
     self._eventLogger.eventEnd(logEvent)
     return self.dtStable
+
+
+  def finalize(self):
+    """
+    Cleanup after time stepping.
+    """
+    if not self.ltsInfo is None and len(self.ltsReport) > 0:
+      from pylith.mpi.Communicator import mpi_comm_world
+      comm = mpi_comm_world()
+      if 0 == comm.rank:
+        import json
+        fout = open(self.ltsReport, "w")
+        json.dump(self.ltsInfo, fout, indent=2, sort_keys=True)
+        fout.close()
+
+    Formulation.finalize(self)
+    return
   
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
@@ -311,10 +369,95 @@ class Explicit(Formulation, ModuleExplicit):
     Formulation._configure(self)
 
     self.normViscosity = self.inventory.normViscosity
+    self.localTimeStepping = self.inventory.localTimeStepping
+    self.ltsMaxLevels = self.inventory.ltsMaxLevels
+    self.ltsReport = self.inventory.ltsReport
     self.solver = self.inventory.solver
     return
 
 
+  def _setupTimeStepLevels(self, dt):
+    """
+    Assign vertices to time-step levels for local time stepping.
+
+    @param dt Time step of level 0 (nondimensional).
+    @returns Time step of coarsest level (nondimensional).
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    import pylith.mpi.mpi as mpi
+
+    self.dtLevel0 = dt
+    numLevels = ModuleExplicit.setupTimeStepLevels(self, self.fields, dt, self.ltsMaxLevels)
+
+    levels = []
+    numVerticesTotal = 0
+    for level in xrange(numLevels):
+      numVertices = mpi.allreduce_scalar_int(self.numVerticesInLevel(level), mpi.mpi_sum(), comm.handle)
+      levels.append({'level': level,
+                     'time_step': self.timeScale.value * dt * 2**level,
+                     'num_vertices': numVertices,
+                     })
+      numVerticesTotal += numVertices
+
+    # Vertex updates relative to advancing all vertices with the
+    # time step of level 0.
+    work = sum([entry['num_vertices'] * 2.0**(-entry['level']) for entry in levels])
+    workRatio = work / max(1, numVerticesTotal)
+    self.ltsInfo = {'num_levels': numLevels,
+                    'levels': levels,
+                    'work_ratio': workRatio,
+                    'num_steps': 0,
+                    }
+
+    if 0 == comm.rank:
+      self._info.log("Local time stepping with %d levels, relative work %.3f." % \
+                       (numLevels, workRatio))
+      for entry in levels:
+        self._info.log("  Level %d: dt=%12.4e s, %d vertices." % \
+                         (entry['level'], entry['time_step'], entry['num_vertices']))
+    return dt * 2**(numLevels-1)
+
+
+  def _stepLevels(self, t, dt):
+    """
+    Advance time-step levels over one time step of the coarsest level.
+
+    The time step is divided into substeps of the level 0 time
+    step. At each substep, levels whose time step starts at the
+    substep are advanced from the coarsest to the finest level.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    residual = self.fields.get("residual")
+    dispIncr = self.fields.get("dispIncr(t->t+dt)")
+
+    dt0 = self.dtLevel0
+    numLevels = self.numTimeStepLevels()
+    numSubsteps = 2**(numLevels-1)
+    for substep in xrange(numSubsteps):
+      tk = t + substep*dt0
+      levels = [level for level in xrange(numLevels) if 0 == substep % 2**level]
+      if substep > 0:
+        for level in levels:
+          ModuleExplicit.rotateDisplacement(self, level)
+
+      for level in reversed(levels):
+        if 0 == level:
+          for constraint in self.constraints:
+            constraint.setFieldIncr(tk, tk+dt0, dispIncr)
+        self.beginLevelStep(level, substep)
+        self._reformResidual(tk, dt0)
+        if 0 == comm.rank:
+          self._info.log("Solving equations for time-step level %d." % level)
+        self.solver.solve(dispIncr, self.jacobian, residual)
+        self.endLevelStep()
+
+    self.ltsInfo['num_steps'] += 1
+    return
+
+
   def _reformJacobian(self, t, dt):
     """
     Reform Jacobian matrix for operator.
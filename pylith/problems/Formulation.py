@@ -66,12 +66,14 @@ class Formulation(PetscComponent, ModuleFormulation):
     ## @li \b split_fields Split solution fields into displacements and Lagrange constraints.
     ## @li \b use_custom_constraint_pc Use custom preconditioner for Lagrange constraints.
     ## @li \b view_jacobian Flag to output Jacobian matrix when it is reformed.
+    ## @li \b jacobian_pattern_cache Filename prefix for cache of Jacobian nonzero pattern.
     ##
     ## \b Facilities
     ## @li \b time_step Time step size manager.
     ## @li \b solver Algebraic solver.
     ## @li \b output Output manager associated with solution.
     ## @li \b jacobian_viewer Writer for Jacobian sparse matrix.
+    ## @li \b load_balance Report of distribution of work and communication.
 
     import pyre.inventory
 
@@ -89,6 +91,10 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     viewJacobian = pyre.inventory.bool("view_jacobian", default=False)
     viewJacobian.meta['tip'] = "Write Jacobian matrix to binary file."
+
+    jacobianPatternCache = pyre.inventory.str("jacobian_pattern_cache", default="")
+    jacobianPatternCache.meta['tip'] = "Filename prefix for cache of Jacobian " \
+        "nonzero pattern (empty for no cache)."
     
     from TimeStepUniform import TimeStepUniform
     timeStep = pyre.inventory.facility("time_step", family="time_step",
@@ -112,6 +118,12 @@ class Formulation(PetscComponent, ModuleFormulation):
                                              factory=JacobianViewer)
     jacobianViewer.meta['tip'] = "Writer for Jacobian sparse matrix."
 
+    from pylith.perf.LoadBalance import LoadBalance
+    loadBalance = pyre.inventory.facility("load_balance", family="load_balance",
+                                          factory=LoadBalance)
+    loadBalance.meta['tip'] = "Report of distribution of work and " \
+        "communication among processes."
+
     from pylith.perf.MemoryLogger import MemoryLogger
     perfLogger = pyre.inventory.facility("perf_logger", family="perf_logger",
                                          factory=MemoryLogger)
@@ -158,6 +170,14 @@ class Formulation(PetscComponent, ModuleFormulation):
     self._setupBC(boundaryConditions)
     self._setupInterfaces(interfaceConditions)
 
+    if self.solver.useAMG and len(interfaceConditions.components()) > 0 and \
+          not self.inventory.useSplitFields:
+      print "WARNING: Algebraic multigrid preconditioner for problem with " \
+            "faults requires splitting fields. " \
+            "Setting split fields flag to 'True'."
+      self.inventory.useSplitFields = True
+      ModuleFormulation.splitFields(self, True)
+
     if 0 == comm.rank:
       self._info.log("Pre-initializing output.")
     for output in self.output.components():
@@ -254,11 +274,27 @@ class Formulation(PetscComponent, ModuleFormulation):
       integrator.poststep(t, dt, self.fields)
     for constraint in self.constraints:
       constraint.poststep(t, dt, self.fields)
+    self.loadBalance.poststep(t, self)
 
     self._eventLogger.eventEnd(logEvent)
     return
 
 
+  def telemetry(self):
+    """
+    Get convergence information of the solver and the faults for the
+    last time step.
+    """
+    info = {'solver': self.solver.telemetry()}
+    faults = {}
+    for integrator in self.integrators:
+      if hasattr(integrator, "telemetry"):
+        faults[integrator.label()] = integrator.telemetry()
+    if len(faults) > 0:
+      info['faults'] = faults
+    return info
+
+
   def finalize(self):
     """
     Cleanup after time stepping.
@@ -272,6 +308,7 @@ class Formulation(PetscComponent, ModuleFormulation):
     if 0 == comm.rank:
       self._info.log("Formulation finalize.")
     self._debug.log(resourceUsageString())
+    self.loadBalance.finalize(self)
     for integrator in self.integrators:
       integrator.finalize()
     for constraint in self.constraints:
@@ -299,7 +336,9 @@ class Formulation(PetscComponent, ModuleFormulation):
     self.solver = self.inventory.solver
     self.output = self.inventory.output
     self.viewJacobian = self.inventory.viewJacobian
+    self.jacobianPatternCache = self.inventory.jacobianPatternCache
     self.jacobianViewer = self.inventory.jacobianViewer
+    self.loadBalance = self.inventory.loadBalance
     self.perfLogger = self.inventory.perfLogger
 
     import journal
@@ -464,30 +503,39 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     if 0 == comm.rank:
       self._info.log("Initializing integrators.")
+    self.perfLogger.phaseBegin("Integrator Init")
     for integrator in self.integrators:
       if not self.gravityField is None:
         integrator.gravityField(self.gravityField)
       integrator.initialize(totalTime, numTimeSteps, normalizer)
     ModuleFormulation.integrators(self, self.integrators)
+    self.perfLogger.phaseEnd("Integrator Init")
     self._debug.log(resourceUsageString())
 
     if 0 == comm.rank:
       self._info.log("Initializing constraints.")
+    self.perfLogger.phaseBegin("Constraint Init")
     for constraint in self.constraints:
       constraint.initialize(totalTime, numTimeSteps, normalizer)
+    self.perfLogger.phaseEnd("Constraint Init")
     self._debug.log(resourceUsageString())
 
     if 0 == comm.rank:
       self._info.log("Setting up solution output.")
+    self.perfLogger.phaseBegin("Output Setup")
     for output in self.output.components():
       output.initialize(self.mesh(), normalizer)
       output.writeInfo()
       output.open(totalTime, numTimeSteps)
+    self.perfLogger.phaseEnd("Output Setup")
     self._debug.log(resourceUsageString())
 
+    self.loadBalance.initialize(normalizer)
+
     # Setup fields
     if 0 == comm.rank:
       self._info.log("Creating solution field.")
+    self.perfLogger.phaseBegin("Solution Field")
     #from pylith.utils.petsc import MemoryLogger
     #memoryLogger = MemoryLogger.singleton()
     #memoryLogger.setDebug(0)
@@ -525,6 +573,7 @@ class Formulation(PetscComponent, ModuleFormulation):
 
     # This also creates a global order.
     solution.createScatter(solution.mesh())
+    self.perfLogger.phaseEnd("Solution Field")
 
     #memoryLogger.stagePush("Problem")
     dispT = self.fields.get("disp(t)")
@@ -654,12 +703,10 @@ class Formulation(PetscComponent, ModuleFormulation):
 
   def _modelMemoryUse(self):
     """
-    Model memory allocation.
+    Log allocated memory.
     """
     self.perfLogger.logFields('Problem', self.fields)
-    self.perfLogger.logJacobian('Jacobian', 'dummy')
-    self.perfLogger.logGlobalOrder('GlobalOrder', 'VectorOrder',
-                                   self.fields.get('residual'))
+    self.perfLogger.logJacobian('Problem', self.jacobian)
     for integrator in self.integrators:
       self.perfLogger.logQuadrature('Quadrature', integrator.quadrature())
     return
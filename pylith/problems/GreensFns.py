@@ -45,6 +45,7 @@ class GreensFns(Problem):
     ##
     ## \b Properties
     ## @li \b faultId Id of fault on which to impose impulses.
+    ## @li \b impulse_block_size Number of impulses solved together.
     ##
     ## \b Facilities
     ## @li \b formulation Formulation for solving PDE.
@@ -56,6 +57,10 @@ class GreensFns(Problem):
     faultId = pyre.inventory.int("fault_id", default=100)
     faultId.meta['tip'] = "Id of fault on which to impose impulses."
 
+    blockSize = pyre.inventory.int("impulse_block_size", default=1,
+                                   validator=pyre.inventory.greater(0))
+    blockSize.meta['tip'] = "Number of impulses solved together."
+
     from Implicit import Implicit
     formulation = pyre.inventory.facility("formulation",
                                           family="pde_formulation",
@@ -119,10 +124,19 @@ class GreensFns(Problem):
     Problem.verifyConfiguration(self)
     self.formulation.verifyConfiguration()
 
-    if not "numImpulses" in dir(self.source) or not "numComponents" in dir(self.source):
+    if not "numImpulses" in dir(self.source) or not "numComponents" in dir(self.source) or \
+          not "updateImpulse" in dir(self.source):
       raise ValueError("Incompatible source for green's function impulses "
                        "with id '%d' and label '%s'." % \
                          (self.source.id(), self.source.label()))
+    if self.blockSize > 1:
+      if not "solveBlock" in dir(self.formulation):
+        raise ValueError("Formulation '%s' does not support solving blocks of "
+                         "Green's function impulses." % self.formulation.name)
+      if not "solveBlock" in dir(self.formulation.solver):
+        raise ValueError("Solver '%s' does not support solving blocks of "
+                         "Green's function impulses. Use a linear solver." % \
+                           self.formulation.solver.name)
     return
   
 
@@ -160,6 +174,11 @@ class GreensFns(Problem):
     if nimpulses > 0:
       self.progressMonitor.open()
     
+    if self.blockSize > 1:
+      self._runBlocks(nimpulses)
+      self.progressMonitor.close()
+      return
+
     ipulse = 0;
     dt = 1.0
     while ipulse < nimpulses:
@@ -227,6 +246,62 @@ class GreensFns(Problem):
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
+  def _runBlocks(self, nimpulses):
+    """
+    Compute Green's functions for blocks of impulses.
+
+    The right-hand sides for all impulses in a block are assembled
+    first and then solved together with a single setup of the
+    solver. Because the problem is linear, each impulse is solved
+    with zero displacement at time t rather than starting from the
+    solution of the previous impulse.
+    """
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+
+    dt = 1.0
+    iblock = 0
+    while iblock < nimpulses:
+      nblock = min(self.blockSize, nimpulses-iblock)
+      if 0 == comm.rank:
+        self._info.log("Main loop, impulses %d-%d of %d." % (iblock+1, iblock+nblock, nimpulses))
+
+      # Checkpoint if necessary
+      self.checkpointTimer.update(float(iblock)-dt)
+
+      self._eventLogger.stagePush("Prestep")
+      if 0 == comm.rank:
+        self._info.log("Preparing impulses %d-%d of %d." % (iblock+1, iblock+nblock, nimpulses))
+      for ipulse in xrange(iblock, iblock+nblock):
+        t = float(ipulse)-dt
+        self.formulation.prestep(t, dt)
+        self.formulation.addBlockRHS(t, dt)
+      self._eventLogger.stagePop()
+
+      if 0 == comm.rank:
+        self._info.log("Computing response to impulses %d-%d of %d." % (iblock+1, iblock+nblock, nimpulses))
+      self._eventLogger.stagePush("Step")
+      self.formulation.solveBlock()
+      self._eventLogger.stagePop()
+
+      if 0 == comm.rank:
+        self._info.log("Finishing impulses %d-%d of %d." % (iblock+1, iblock+nblock, nimpulses))
+      self._eventLogger.stagePush("Poststep")
+      for ipulse in xrange(iblock, iblock+nblock):
+        self.progressMonitor.update(ipulse, 0, nimpulses)
+        t = float(ipulse)-dt
+        # Restore constrained values of solution increment for impulse.
+        self.formulation.prestep(t, dt)
+        self.formulation.stepBlock(ipulse-iblock)
+        self.source.updateImpulse(t+dt)
+        self.formulation.poststep(t, dt)
+      self.formulation.clearBlock()
+      self._eventLogger.stagePop()
+
+      iblock += nblock
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
@@ -234,6 +309,7 @@ class GreensFns(Problem):
     Problem._configure(self)
 
     self.faultId = self.inventory.faultId
+    self.blockSize = self.inventory.blockSize
     self.formulation = self.inventory.formulation
     self.progressMonitor = self.inventory.progressMonitor
     self.checkpointTimer = self.inventory.checkpointTimer
@@ -97,6 +97,7 @@ class Implicit(Formulation, ModuleImplicit):
     Formulation.__init__(self, name)
     ModuleImplicit.__init__(self)
     self._loggingPrefix = "TSIm "
+    self._dtJacobian = None
     return
 
 
@@ -151,17 +152,27 @@ class Implicit(Formulation, ModuleImplicit):
     # Allocates memory for nonzero pattern and Jacobian
     if 0 == comm.rank:
       self._info.log("Creating Jacobian matrix.")
+    self.perfLogger.phaseBegin("Jacobian Preallocation")
     self._setJacobianMatrixType()
     from pylith.topology.Jacobian import Jacobian
     self.jacobian = Jacobian(self.fields.solution(),
-                             self.matrixType, self.blockMatrixOkay)
+                             self.matrixType, self.blockMatrixOkay,
+                             self.jacobianPatternCache)
+    if self.jacobianPatternCache and 0 == comm.rank:
+      if self.jacobian.patternFromCache():
+        self._info.log("Created Jacobian matrix from nonzero pattern cache '%s'." % self.jacobianPatternCache)
+      elif self.jacobian.patternSaved():
+        self._info.log("Wrote nonzero pattern of Jacobian matrix to cache '%s'." % self.jacobianPatternCache)
     self.jacobian.zero() # TEMPORARY, to get correct memory usage
+    self.perfLogger.phaseEnd("Jacobian Preallocation")
     self._debug.log(resourceUsageString())
 
     #memoryLogger.stagePush("Problem")
     if 0 == comm.rank:
       self._info.log("Initializing solver.")
+    self.perfLogger.phaseBegin("Solver Init")
     self.solver.initialize(self.fields, self.jacobian, self)
+    self.perfLogger.phaseEnd("Solver Init")
     self._debug.log(resourceUsageString())
 
     #memoryLogger.stagePop()
@@ -183,12 +194,23 @@ class Implicit(Formulation, ModuleImplicit):
       constraint.setFieldIncr(t, t+dt, dispIncr)
 
     needNewJacobian = False
+    unknownStiffness = False
     for integrator in self.integrators:
       integrator.timeStep(dt)
       if integrator.needNewJacobian():
         needNewJacobian = True
+        if integrator.stiffnessChange() < 0.0:
+          unknownStiffness = True
     if self._collectNeedNewJacobian(needNewJacobian):
-      self._reformJacobian(t, dt)
+      if self.solver.lagsJacobian and dt == self._dtJacobian:
+        # Nonlinear solver compares the change in stiffness with its
+        # threshold to decide whether to reuse the Jacobian. Without an
+        # estimate, it reforms the Jacobian in its first iteration.
+        if self._collectNeedNewJacobian(unknownStiffness):
+          self.solver.expireJacobian()
+      else:
+        self._reformJacobian(t, dt)
+        self._dtJacobian = dt
 
     return
 
@@ -247,6 +269,54 @@ class Implicit(Formulation, ModuleImplicit):
     return
 
 
+  def addBlockRHS(self, t, dt):
+    """
+    Form residual at time t+dt with zero displacement at time t and
+    add it to the block of systems solved together by solveBlock().
+    """
+    disp = self.fields.get("disp(t)")
+    disp.zeroAll()
+    self._reformResidual(t+dt, dt)
+
+    residual = self.fields.get("residual")
+    self.solver.addBlockRHS(residual)
+    return
+
+
+  def solveBlock(self):
+    """
+    Solve block of systems with the current Jacobian.
+    """
+    comm = self.mesh().comm()
+
+    if 0 == comm.rank:
+      self._info.log("Solving equations for block of %d right-hand sides." % self.solver.blockSize())
+    self._eventLogger.stagePush("Solve")
+    self.solver.solveBlock(self.jacobian)
+    self._eventLogger.stagePop()
+    return
+
+
+  def stepBlock(self, index):
+    """
+    Set solution increment to solution of system in block, so that
+    poststep() completes the step with zero displacement at time t.
+    """
+    disp = self.fields.get("disp(t)")
+    disp.zeroAll()
+    dispIncr = self.fields.get("dispIncr(t->t+dt)")
+    self.solver.blockSolution(dispIncr, index)
+    return
+
+
+  def clearBlock(self):
+    """
+    Remove all systems from block.
+    """
+    self.solver.clearBlock()
+    return
+
+
   def prestepElastic(self, t, dt):
     """
     Hook for doing stuff before advancing time step.
@@ -292,6 +362,17 @@ class Implicit(Formulation, ModuleImplicit):
     return
 
 
+  def _reformJacobian(self, t, dt):
+    """
+    Reform Jacobian matrix for operator.
+    """
+    Formulation._reformJacobian(self, t, dt)
+    if self.solver.lagsJacobian:
+      # Nonlinear solver may reuse the Jacobian we just formed.
+      self.solver.resetJacobianAge()
+    return
+
+
 # FACTORIES ////////////////////////////////////////////////////////////
 
 def pde_formulation():
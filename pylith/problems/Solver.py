@@ -54,6 +54,10 @@ class Solver(PetscComponent):
     ##
     ## \b Properties
     ## @li \b use_cuda Use CUDA in solve if supported by solver.
+    ## @li \b use_amg_preconditioner Use built-in algebraic multigrid
+    ##   preconditioner settings.
+    ## @li \b cache_residual Reuse contributions to the residual that do
+    ##   not depend on the solution until they change.
     ##
     ## \b Facilities
     ## @li None
@@ -67,6 +71,13 @@ class Solver(PetscComponent):
                                   validator=validateUseCUDA)
     useCUDA.meta['tip'] = "Enable use of CUDA for finite-element integrations."
 
+    useAMG = pyre.inventory.bool("use_amg_preconditioner", default=False)
+    useAMG.meta['tip'] = "Use built-in algebraic multigrid preconditioner settings " \
+        "(split fields for problems with faults)."
+
+    useResidualCache = pyre.inventory.bool("cache_residual", default=False)
+    useResidualCache.meta['tip'] = "Reuse contributions to the residual that do not depend on the solution until they change."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -84,11 +95,61 @@ class Solver(PetscComponent):
       from pylith.utils.petsc import optionsSetValue, optionsHasName
       if not optionsHasName("-vec_type", 0):
         optionsSetValue("-vec_type", "cusp")
+    if self.useAMG:
+      self._setAMGOptions()
     return
 
 
+  def telemetry(self):
+    """
+    Get convergence information for the last solve.
+    """
+    return {}
+
+
   # PRIVATE METHODS /////////////////////////////////////////////////////
 
+  def _setAMGOptions(self):
+    """
+    Set PETSc options for algebraic multigrid preconditioning, if
+    they have not already been set.
+
+    Without split fields, the entire Jacobian is preconditioned with
+    smoothed aggregation (GAMG) using the rigid body modes as the near
+    null space. With split fields (problems with faults), GAMG is
+    applied to the displacement block, which has no coupling across
+    the fault, so aggregates do not straddle the fault; the Lagrange
+    multiplier block uses Jacobi (with the custom fault preconditioner
+    if enabled). The multigrid interpolation is reused when the
+    Jacobian is reformed with the same nonzero pattern.
+    """
+    gamgOptions = [
+      ("pc_type", "gamg"),
+      ("pc_gamg_type", "agg"),
+      ("pc_gamg_agg_nsmooths", "1"),
+      ("pc_gamg_threshold", "0.01"),
+      ("pc_gamg_square_graph", "1"),
+      ("pc_gamg_reuse_interpolation", "true"),
+      ("mg_levels_ksp_type", "chebyshev"),
+      ("mg_levels_pc_type", "jacobi"),
+      ]
+    options = gamgOptions + [
+      ("fs_pc_type", "fieldsplit"),
+      ("fs_pc_use_amat", "true"),
+      ("fs_pc_fieldsplit_type", "multiplicative"),
+      ("fs_fieldsplit_displacement_ksp_type", "preonly"),
+      ("fs_fieldsplit_lagrange_multiplier_ksp_type", "preonly"),
+      ("fs_fieldsplit_lagrange_multiplier_pc_type", "jacobi"),
+      ]
+    options += [("fs_fieldsplit_displacement_" + name, value) for name, value in gamgOptions]
+
+    from pylith.utils.petsc import optionsSetValue, optionsHasName
+    for name, value in options:
+      if not optionsHasName("-" + name, 0):
+        optionsSetValue("-" + name, value)
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
@@ -97,6 +158,9 @@ class Solver(PetscComponent):
 
     self.useCUDA = self.inventory.useCUDA
     self.createNullSpace = self.inventory.createNullSpace
+    self.useAMG = self.inventory.useAMG
+    self.useResidualCache = self.inventory.useResidualCache
+    self.lagsJacobian = False
     return
 
 
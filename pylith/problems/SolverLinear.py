@@ -40,13 +40,35 @@ class SolverLinear(Solver, ModuleSolverLinear):
     ## Python object for managing SolverLinear facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b initial_guess Method for forming initial guess from
+    ##   previous solutions.
+    ## @li \b initial_guess_history Number of previous solutions used
+    ##   in initial guess.
+    ## @li \b use_factorization Factor Jacobian once and reuse the
+    ##   factorization until the Jacobian changes.
+    ## @li \b factorization_max_memory Maximum memory (MB) per process
+    ##   for factorization (0 for no limit).
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    guessMethod = pyre.inventory.str("initial_guess", default="zero",
+                                     validator=pyre.inventory.choice(["zero", "extrapolate", "project"]))
+    guessMethod.meta['tip'] = "Method for forming initial guess from previous solutions."
+
+    guessHistory = pyre.inventory.int("initial_guess_history", default=4,
+                                      validator=pyre.inventory.greater(0))
+    guessHistory.meta['tip'] = "Number of previous solutions used in initial guess."
+
+    factorJacobian = pyre.inventory.bool("use_factorization", default=False)
+    factorJacobian.meta['tip'] = "Factor Jacobian once and reuse the factorization until the Jacobian changes."
+
+    factorMaxMemory = pyre.inventory.float("factorization_max_memory", default=0.0,
+                                           validator=pyre.inventory.greaterEqual(0.0))
+    factorMaxMemory.meta['tip'] = "Maximum memory (MB) per process for factorization (0 for no limit)."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="solverlinear"):
@@ -55,6 +77,10 @@ class SolverLinear(Solver, ModuleSolverLinear):
     """
     Solver.__init__(self, name)
     ModuleSolverLinear.__init__(self)
+    self.numSolves = 0
+    self.numIterationsTotal = 0
+    self.numIterationsSavedTotal = 0.0
+    self.numFactorizationsLogged = 0
     return
 
 
@@ -66,8 +92,74 @@ class SolverLinear(Solver, ModuleSolverLinear):
     return
 
 
+  def solve(self, solution, jacobian, residual):
+    """
+    Solve linear system.
+    """
+    ModuleSolverLinear.solve(self, solution, jacobian, residual)
+    self._logFactorization()
+
+    if self.guessMethod != "zero":
+      numIterations = self.numIterations()
+      numSaved = self.numIterationsSaved()
+      self.numSolves += 1
+      self.numIterationsTotal += numIterations
+      self.numIterationsSavedTotal += numSaved
+
+      from pylith.mpi.Communicator import mpi_comm_world
+      comm = mpi_comm_world()
+      if 0 == comm.rank:
+        self._info.log("Linear solve converged in %d iterations, initial guess saved about %.1f iterations "
+                       "(%d iterations, %.1f saved over %d solves)." % \
+                         (numIterations, numSaved, self.numIterationsTotal, self.numIterationsSavedTotal, self.numSolves))
+    return
+
+
+  def telemetry(self):
+    """
+    Get convergence information for the last solve.
+    """
+    return {'ksp_iterations': self.numIterations(),
+            'residual_norm': self.residualNorm(),
+            'converged_reason': self.convergedReason(),
+            }
+
+
+  def solveBlock(self, jacobian):
+    """
+    Solve block of linear systems.
+    """
+    ModuleSolverLinear.solveBlock(self, jacobian)
+    self._logFactorization()
+    return
+
+
   # PRIVATE METHODS /////////////////////////////////////////////////////
 
+  def _logFactorization(self):
+    """
+    Log time and memory for new factorizations of the Jacobian and
+    fall back to the iterative solver.
+    """
+    if not self.factorJacobian:
+      return
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    numFactorizations = self.numFactorizations()
+    if numFactorizations > self.numFactorizationsLogged:
+      if 0 == comm.rank:
+        self._info.log("Factored Jacobian in %.3f s using %.1f MB per process (%d factorizations)." % \
+                         (self.factorTime(), self.factorMemory()/(1024.0*1024.0), numFactorizations))
+      self.numFactorizationsLogged = numFactorizations
+    if not self.usingFactorization():
+      if 0 == comm.rank:
+        self._info.log("WARNING: Factorization of Jacobian failed or exceeded the maximum memory "
+                       "(%.1f MB); using iterative solver." % self.inventory.factorMaxMemory)
+      self.factorJacobian = False
+    return
+
+
   def _configure(self):
     """
     Set members based using inventory.
@@ -75,6 +167,17 @@ class SolverLinear(Solver, ModuleSolverLinear):
     Solver._configure(self)
 
     ModuleSolverLinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverLinear.cacheResidual(self, self.useResidualCache)
+
+    self.guessMethod = self.inventory.guessMethod
+    guessMethods = {'zero': ModuleSolverLinear.GUESS_ZERO,
+                    'extrapolate': ModuleSolverLinear.GUESS_EXTRAPOLATE,
+                    'project': ModuleSolverLinear.GUESS_PROJECT,
+                    }
+    ModuleSolverLinear.initialGuess(self, guessMethods[self.guessMethod], self.inventory.guessHistory)
+
+    self.factorJacobian = self.inventory.factorJacobian
+    ModuleSolverLinear.useFactorization(self, self.factorJacobian, self.inventory.factorMaxMemory*1024.0*1024.0)
     return
 
 
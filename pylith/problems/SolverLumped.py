@@ -74,6 +74,8 @@ class SolverLumped(Solver, ModuleSolverLumped):
     Set members based using inventory.
     """
     Solver._configure(self)
+
+    ModuleSolverLumped.cacheResidual(self, self.useResidualCache)
     return
 
 
@@ -40,13 +40,30 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     ## Python object for managing SolverNonlinear facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b jacobian_max_lag Maximum number of Newton iterations in
+    ##   which the Jacobian is reused (0 to reform every iteration).
+    ## @li \b jacobian_lag_convergence Reform Jacobian if ratio of
+    ##   residual norms in consecutive iterations exceeds this value.
+    ## @li \b jacobian_lag_stiffness Reform Jacobian if relative change
+    ##   in stiffness estimated by materials exceeds this value.
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    jacobianMaxLag = pyre.inventory.int("jacobian_max_lag", default=0,
+                                        validator=pyre.inventory.greaterEqual(0))
+    jacobianMaxLag.meta['tip'] = "Maximum number of Newton iterations in which the Jacobian is reused (0 to reform every iteration)."
+
+    jacobianLagConvergence = pyre.inventory.float("jacobian_lag_convergence", default=0.5,
+                                                  validator=pyre.inventory.greater(0.0))
+    jacobianLagConvergence.meta['tip'] = "Reform Jacobian if ratio of residual norms in consecutive iterations exceeds this value."
+
+    jacobianLagStiffness = pyre.inventory.float("jacobian_lag_stiffness", default=0.2,
+                                                validator=pyre.inventory.greaterEqual(0.0))
+    jacobianLagStiffness.meta['tip'] = "Reform Jacobian if relative change in stiffness estimated by materials exceeds this value."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -56,9 +73,51 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     """
     Solver.__init__(self, name)
     ModuleSolverNonlinear.__init__(self)
+    self._telemetryTotals = {}
     return
 
 
+  def solve(self, solution, jacobian, residual):
+    """
+    Solve nonlinear system.
+    """
+    ModuleSolverNonlinear.solve(self, solution, jacobian, residual)
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    comm = mpi_comm_world()
+    if 0 == comm.rank:
+      if self.lagsJacobian:
+        self._info.log("Jacobian reformed %d times and reused %d times." % \
+                         (self.numJacobianReforms(), self.numJacobianReuses()))
+      self._info.log("Line search: %d searches, %d of %d residual evaluations, "
+                     "mean step length %.3f, minimum step length %.3f." % \
+                       (self.numLineSearches(), self.numLineSearchEvals(), self.numResidualEvals(),
+                        self.lineSearchMeanStep(), self.lineSearchMinStep()))
+    return
+
+
+  def telemetry(self):
+    """
+    Get convergence information for the last solve.
+    """
+    # The counters accumulate over solves, so report the increments.
+    totals = {'residual_evals': self.numResidualEvals(),
+              'line_searches': self.numLineSearches(),
+              'line_search_evals': self.numLineSearchEvals(),
+              'jacobian_reforms': self.numJacobianReforms(),
+              'jacobian_reuses': self.numJacobianReuses(),
+              }
+    info = dict([(name, value - self._telemetryTotals.get(name, 0)) for name, value in totals.items()])
+    self._telemetryTotals = totals
+
+    info.update({'snes_iterations': self.numIterations(),
+                 'ksp_iterations': self.numLinearIterations(),
+                 'residual_norm': self.residualNorm(),
+                 'converged_reason': self.convergedReason(),
+                 })
+    return info
+
+
   # PRIVATE METHODS /////////////////////////////////////////////////////
 
   def _configure(self):
@@ -68,6 +127,12 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     Solver._configure(self)
 
     ModuleSolverNonlinear.skipNullSpaceCreation(self, not self.createNullSpace)
+
+    maxLag = self.inventory.jacobianMaxLag
+    ModuleSolverNonlinear.lagJacobian(self, maxLag, self.inventory.jacobianLagConvergence, self.inventory.jacobianLagStiffness)
+    self.lagsJacobian = maxLag > 0
+
+    ModuleSolverNonlinear.cacheResidual(self, self.useResidualCache)
     return
 
 
@@ -50,6 +50,7 @@ class TimeDependent(Problem):
     ## @li \b formulation Formulation for solving PDE.
     ## @li \b progress_monitor Simple progress monitor via text file.
     ## @li \b checkpoint Checkpoint manager.
+    ## @li \b telemetry Solver convergence and time step telemetry.
 
     import pyre.inventory
 
@@ -68,6 +69,10 @@ class TimeDependent(Problem):
     checkpointTimer = pyre.inventory.facility("checkpoint", family="checkpointer", factory=CheckpointTimer)
     checkpointTimer.meta['tip'] = "Checkpoint manager."
 
+    from pylith.perf.Telemetry import Telemetry
+    telemetry = pyre.inventory.facility("telemetry", family="telemetry", factory=Telemetry)
+    telemetry.meta['tip'] = "Solver convergence and time step telemetry."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -131,6 +136,8 @@ class TimeDependent(Problem):
     if 0 == comm.rank:
       self._info.log("Solving problem.")
     self.checkpointTimer.toplevel = app # Set handle for saving state
+    self.telemetry.open()
+    timeScale = self.normalizer.timeScale()
     
     # Elastic prestep
     if self.elasticPrestep:
@@ -146,20 +153,29 @@ class TimeDependent(Problem):
       for material in self.materials.components():
         material.useElasticBehavior(True)
 
+      self.telemetry.stageBegin("prestep")
       self.formulation.prestepElastic(t, dt)
+      self.telemetry.stageEnd("prestep")
       self._eventLogger.stagePop()
 
       if 0 == comm.rank:
         self._info.log("Computing prestep with elastic behavior.")
       self._eventLogger.stagePush("Step")
+      self.telemetry.stageBegin("step")
       self.formulation.step(t, dt)
+      self.telemetry.stageEnd("step")
       self._eventLogger.stagePop()
 
       if 0 == comm.rank:
         self._info.log("Finishing prestep with elastic behavior.")
       self._eventLogger.stagePush("Poststep")
+      self.telemetry.stageBegin("poststep")
       self.formulation.poststep(t, dt)
+      self.telemetry.stageEnd("poststep")
       self._eventLogger.stagePop()
+      self.telemetry.record(self.normalizer.dimensionalize(t, timeScale).value,
+                            self.normalizer.dimensionalize(dt, timeScale).value,
+                            self.formulation, elastic=True)
 
 
     # Allow inelastic behavior
@@ -172,7 +188,6 @@ class TimeDependent(Problem):
 
     # Normal time loop
     t = self.formulation.getStartTime()
-    timeScale = self.normalizer.timeScale()
     while t < self.formulation.getTotalTime():
       tsec = self.normalizer.dimensionalize(t, timeScale)
       tStart = self.normalizer.dimensionalize(self.formulation.getStartTime(), timeScale)
@@ -180,6 +195,7 @@ class TimeDependent(Problem):
       self.progressMonitor.update(tsec, tStart, tEnd)
 
       self._eventLogger.stagePush("Prestep")
+      self.telemetry.stageBegin("prestep")
       if 0 == comm.rank:
         self._info.log("Main time loop, current time is t=%s" % tsec)
       
@@ -194,26 +210,33 @@ class TimeDependent(Problem):
         self._info.log("Preparing to advance solution from time t=%s to t=%s." %\
                          (tsec, tsec+dtsec))
       self.formulation.prestep(t, dt)
+      self.telemetry.stageEnd("prestep")
       self._eventLogger.stagePop()
 
       if 0 == comm.rank:
         self._info.log("Advancing solution from t=%s to t=%s." % \
                          (tsec, tsec+dtsec))
       self._eventLogger.stagePush("Step")
+      self.telemetry.stageBegin("step")
       self.formulation.step(t, dt)
+      self.telemetry.stageEnd("step")
       self._eventLogger.stagePop()
 
       if 0 == comm.rank:
         self._info.log("Finishing advancing solution from t=%s to t=%s." % \
                          (tsec, tsec+dtsec))
       self._eventLogger.stagePush("Poststep")
+      self.telemetry.stageBegin("poststep")
       self.formulation.poststep(t, dt)
+      self.telemetry.stageEnd("poststep")
       self._eventLogger.stagePop()
+      self.telemetry.record(tsec.value, dtsec.value, self.formulation)
 
       # Update time
       t += dt
 
     self.progressMonitor.close()
+    self.telemetry.close()
     return
 
 
@@ -250,6 +273,7 @@ class TimeDependent(Problem):
     self.formulation = self.inventory.formulation
     self.progressMonitor = self.inventory.progressMonitor
     self.checkpointTimer = self.inventory.checkpointTimer
+    self.telemetry = self.inventory.telemetry
     return
 
 
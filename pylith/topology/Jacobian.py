@@ -31,18 +31,19 @@ class Jacobian(ModuleJacobian):
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
-  def __init__(self, field, matrixType="unknown", blockOkay=False):
+  def __init__(self, field, matrixType="unknown", blockOkay=False, patternCache=""):
     """
     Constructor.
 
     @param fields Solution fields.
+    @param patternCache Filename prefix for cache of nonzero pattern.
     """
     # If matrix type has not been set, then set it to a value that will work.
     if matrixType == "unknown":
       matrixType = "sbaij"
 
     #print "MATRIX TYPE: %s, BLOCKOKAY: %s" % (matrixType, blockOkay)
-    ModuleJacobian.__init__(self, field, matrixType, blockOkay)
+    ModuleJacobian.__init__(self, field, matrixType, blockOkay, patternCache)
     return
     
 
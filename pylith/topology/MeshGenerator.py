@@ -47,7 +47,7 @@ class MeshGenerator(PetscComponent):
     ## @li \b interpolate Build intermediate mesh topology elements (if true)
     ##
     ## \b Facilities
-    ## @li None
+    ## @li \b perf_logger Performance and memory logging.
 
     import pyre.inventory
 
@@ -57,6 +57,11 @@ class MeshGenerator(PetscComponent):
     interpolate = pyre.inventory.bool("interpolate", default=False)
     interpolate.meta['tip'] = "Build intermediate mesh topology elements"
 
+    from pylith.perf.MemoryLogger import MemoryLogger
+    perfLogger = pyre.inventory.facility("perf_logger", family="perf_logger",
+                                         factory=MemoryLogger)
+    perfLogger.meta['tip'] = "Performance and memory logging."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -90,6 +95,7 @@ class MeshGenerator(PetscComponent):
     PetscComponent._configure(self)
     self.debug = self.inventory.debug
     self.interpolate = self.inventory.interpolate
+    self.perfLogger = self.inventory.perfLogger
     return
 
 
@@ -43,7 +43,9 @@ class MeshImporter(MeshGenerator):
     ## Python object for managing MeshImporter facilities and properties.
     ##
     ## \b Properties
-    ## @li reorder_mesh Reorder mesh using reverse Cuthill-McKee if true.
+    ## @li reorder_mesh Reorder mesh if true.
+    ## @li reorder_type Type of reordering {rcm, hilbert, morton}.
+    ## @li check_topology Level of topology verification {off, sampled, full}.
     ##
     ## \b Facilities
     ## @li \b reader Mesh reader.
@@ -53,7 +55,15 @@ class MeshImporter(MeshGenerator):
     import pyre.inventory
 
     reorderMesh = pyre.inventory.bool("reorder_mesh", default=False)
-    reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
+    reorderMesh.meta['tip'] = "Reorder mesh."
+
+    reorderType = pyre.inventory.str("reorder_type", default="rcm",
+                                     validator=pyre.inventory.choice(["rcm", "hilbert", "morton"]))
+    reorderType.meta['tip'] = "Type of reordering (reverse Cuthill-McKee or space-filling curve)."
+
+    checkTopology = pyre.inventory.str("check_topology", default="full",
+                                       validator=pyre.inventory.choice(["off", "sampled", "full"]))
+    checkTopology.meta['tip'] = "Level of topology verification of distributed mesh."
 
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pyre.inventory.facility("reader", family="mesh_io",
@@ -96,8 +106,24 @@ class MeshImporter(MeshGenerator):
     logEvent = "%screate" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)    
 
-    # Read mesh
+    # Read mesh. Only do a sampled check of the topology here and when
+    # inserting cohesive cells; the requested check is done on the
+    # distributed (and refined) mesh.
+    from pylith.topology.topology import MeshOps as ModuleMeshOps
+    if self.checkTopology == "off":
+      checkLevel = ModuleMeshOps.CHECK_OFF
+    elif self.checkTopology == "full":
+      checkLevel = ModuleMeshOps.CHECK_FULL
+    else:
+      checkLevel = ModuleMeshOps.CHECK_SAMPLED
+    if checkLevel == ModuleMeshOps.CHECK_OFF:
+      self.reader.checkTopology(ModuleMeshOps.CHECK_OFF)
+    else:
+      self.reader.checkTopology(ModuleMeshOps.CHECK_SAMPLED)
+    self.perfLogger.phaseBegin("Mesh Read")
     mesh = self.reader.read(self.debug, self.interpolate)
+    mesh.topologyCheck(self.reader.checkTopology())
+    self.perfLogger.phaseEnd("Mesh Read")
     if self.debug:
       mesh.view()
 
@@ -108,32 +134,59 @@ class MeshImporter(MeshGenerator):
       self._debug.log(resourceUsageString())
       if 0 == comm.rank:
         self._info.log("Reordering cells and vertices.")
-      from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
-      ordering = ReverseCuthillMcKee()
+      if self.reorderType == "rcm":
+        from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+        ordering = ReverseCuthillMcKee()
+      else:
+        from pylith.topology.SpaceFillingCurve import SpaceFillingCurve
+        ordering = SpaceFillingCurve(self.reorderType)
+      self.perfLogger.phaseBegin("Mesh Reorder")
       ordering.reorder(mesh)
+      self.perfLogger.phaseEnd("Mesh Reorder")
       self._eventLogger.eventEnd(logEvent2)
 
     # Adjust topology
     self._debug.log(resourceUsageString())
     if 0 == comm.rank:
       self._info.log("Adjusting topology.")
+    self.perfLogger.phaseBegin("Cohesive Cells")
     self._adjustTopology(mesh, faults)
+    self.perfLogger.phaseEnd("Cohesive Cells")
 
     # Distribute mesh
     if comm.size > 1:
       if 0 == comm.rank:
         self._info.log("Distributing mesh.")
+      self.perfLogger.phaseBegin("Mesh Distribute")
       mesh = self.distributor.distribute(mesh, normalizer)
+      self.perfLogger.phaseEnd("Mesh Distribute")
       if self.debug:
         mesh.view()
       mesh.memLoggingStage = "DistributedMesh"
 
     # Refine mesh (if necessary)
+    if hasattr(self.refiner, "checkTopology"):
+      self.refiner.checkTopology(ModuleMeshOps.CHECK_OFF)
+    self.perfLogger.phaseBegin("Mesh Refine")
     newMesh = self.refiner.refine(mesh)
+    self.perfLogger.phaseEnd("Mesh Refine")
     if not newMesh == mesh:
       mesh.cleanup()
       newMesh.memLoggingStage = "RefinedMesh"
 
+    # Check topology of distributed mesh. Submeshes and fault meshes
+    # created from it are checked at the same level.
+    newMesh.topologyCheck(checkLevel)
+    if checkLevel != ModuleMeshOps.CHECK_OFF:
+      logEvent2 = "%scheckTopo" % self._loggingPrefix
+      self._eventLogger.eventBegin(logEvent2)
+      self.perfLogger.phaseBegin("Mesh Check")
+      if 0 == comm.rank:
+        self._info.log("Checking topology of mesh (%s)." % self.checkTopology)
+      ModuleMeshOps.checkTopology(newMesh, checkLevel)
+      self.perfLogger.phaseEnd("Mesh Check")
+      self._eventLogger.eventEnd(logEvent2)
+
     # Can't reorder mesh again, because we do not have routine to
     # unmix normal and hybrid cells.
 
@@ -156,6 +209,8 @@ class MeshImporter(MeshGenerator):
     self.distributor = self.inventory.distributor
     self.refiner = self.inventory.refiner
     self.reorderMesh = self.inventory.reorderMesh
+    self.reorderType = self.inventory.reorderType
+    self.checkTopology = self.inventory.checkTopology
     return
   
 
@@ -165,6 +220,7 @@ class MeshImporter(MeshGenerator):
     """
     MeshGenerator._setupLogging(self)
     self._eventLogger.registerEvent("%sreorder" % self._loggingPrefix)
+    self._eventLogger.registerEvent("%scheckTopo" % self._loggingPrefix)
     return
   
 
@@ -73,6 +73,14 @@ class RefineUniform(MeshRefiner, ModuleRefineUniform):
     ModuleRefineUniform.refine(self, newMesh, mesh, self.levels)
     mesh.cleanup()
 
+    if 0 == comm.rank:
+      for level in xrange(self.numLevels()):
+        self._info.log("Refinement level %d: %d cells, wall time %.3f s, "
+                       "max memory per process %.1f MB." % \
+                         (level, self.levelNumCells(level),
+                          self.levelWallTime(level),
+                          self.levelMemory(level)/(1024.0*1024.0)))
+
     self._eventLogger.eventEnd(logEvent)
     return newMesh
 
@@ -0,0 +1,63 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/topology/SpaceFillingCurve.py
+##
+## @brief Python interface to reordering of mesh cells and vertices
+## along a space-filling curve.
+
+from topology import SpaceFillingCurve as ModuleSpaceFillingCurve
+
+# SpaceFillingCurve class
+class SpaceFillingCurve(ModuleSpaceFillingCurve):
+  """
+  Python interface to reordering of mesh cells and vertices along a
+  space-filling curve.
+  """
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, curve="hilbert"):
+    """
+    Constructor.
+    """
+    if curve == "hilbert":
+      self.curve = ModuleSpaceFillingCurve.HILBERT
+    elif curve == "morton":
+      self.curve = ModuleSpaceFillingCurve.MORTON
+    else:
+      raise ValueError("Unknown space-filling curve '%s'." % curve)
+    return
+
+
+  def reorder(self, mesh):
+    """
+    Reorder cells and vertices of mesh.
+    """
+    ModuleSpaceFillingCurve.reorder(mesh, self.curve)
+    return
+
+
+  def closureSpan(self, mesh):
+    """
+    Get mean span of vertex indices over the closures of the cells.
+    """
+    return ModuleSpaceFillingCurve.closureSpan(mesh)
+
+
+# End of file
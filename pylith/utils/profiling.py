@@ -37,6 +37,34 @@ def resourceUsage():
   return (cputime, memory)
 
 
+# ----------------------------------------------------------------------
+def memoryUsage():
+  """
+  Get current and peak (high-water mark) resident memory (MB) of
+  this process.
+  """
+  current = 0.0
+  peak = 0.0
+  try:
+    f = open("/proc/self/status", "r")
+    for line in f.readlines():
+      if line.startswith("VmRSS:"):
+        current = float(line.split()[1])/1024.0
+      elif line.startswith("VmHWM:"):
+        peak = float(line.split()[1])/1024.0
+    f.close()
+  except IOError:
+    import resource
+    import sys
+    peak = float(resource.getrusage(resource.RUSAGE_SELF).ru_maxrss)
+    if sys.platform == "darwin":
+      peak /= 1024.0*1024.0
+    else:
+      peak /= 1024.0
+    current = resourceUsage()[1]
+  return (current, max(current, peak))
+
+
 # ----------------------------------------------------------------------
 def resourceUsageString():
   """
@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/quad4/TestLocalTimeStep.py
+##
+## @brief Test suite for testing pylith with local time stepping in
+## explicit time integration.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class GlobalApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="ltsglobal")
+    return
+
+
+class MultirateApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="ltsmultirate")
+    return
+
+
+class TestLocalTimeStep(unittest.TestCase):
+  """
+  Test suite for testing pylith with local time stepping.
+
+  A P wave propagates along a strip with element size graded by a
+  factor of 8. The solution with local time stepping is compared
+  against the solution with a global time step.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(GlobalApp)
+    run_pylith(MultirateApp)
+    self.checkResults = has_h5py()
+    return
+
+
+  def test_levels(self):
+    """
+    Check assignment of vertices to time-step levels.
+    """
+    import json
+    fin = open("ltsmultirate-levels.json", "r")
+    report = json.load(fin)
+    fin.close()
+
+    self.assertEqual(4, report['num_levels'])
+    numVertices = sum([level['num_vertices'] for level in report['levels']])
+    self.assertEqual(46, numVertices)
+    for level in report['levels']:
+      self.assertTrue(level['num_vertices'] > 0)
+    return
+
+
+  def test_work(self):
+    """
+    Check that local time stepping reduces the number of vertex updates.
+    """
+    import json
+    fin = open("ltsmultirate-levels.json", "r")
+    report = json.load(fin)
+    fin.close()
+
+    # Most of the vertices are in the coarse cells.
+    self.assertTrue(report['work_ratio'] < 0.5)
+
+    # Each time step of the coarsest level spans 8 global time steps.
+    self.assertEqual(5, report['num_steps'])
+    return
+
+
+  def test_soln(self):
+    """
+    Check displacement field against solution with global time step.
+    """
+    if not self.checkResults:
+      return
+
+    import h5py
+    h5 = h5py.File("ltsglobal.h5", "r", driver="sec2")
+    timeG = h5['time'][:].ravel()
+    dispG = h5['vertex_fields/displacement'][:]
+    h5.close()
+
+    h5 = h5py.File("ltsmultirate.h5", "r", driver="sec2")
+    timeM = h5['time'][:].ravel()
+    dispM = h5['vertex_fields/displacement'][:]
+    h5.close()
+
+    # Output with local time stepping is after each time step of the
+    # coarsest level, which coincides with every 8th global time step.
+    tolerance = 0.02
+    numCompared = 0
+    for iM, t in enumerate(timeM):
+      iG = numpy.flatnonzero(numpy.abs(timeG - t) < 1.0e-6)
+      if 0 == len(iG):
+        continue
+      numCompared += 1
+      scale = numpy.max(numpy.abs(dispG[iG[0],:,:]))
+      diff = numpy.max(numpy.abs(dispM[iM,:,:] - dispG[iG[0],:,:]))
+      if diff > tolerance*scale:
+        print "Error in displacement at t=%g s." % t
+        print "Global time step: ",dispG[iG[0],:,:]
+        print "Local time stepping: ",dispM[iM,:,:]
+      self.assertTrue(diff <= tolerance*scale)
+    self.assertTrue(numCompared > 0)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestLocalTimeStep import TestLocalTimeStep as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
@@ -0,0 +1,137 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/quad4/TestSinglePrecision.py
+##
+## @brief Test suite for testing pylith with material properties
+## stored in single precision.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+from axialdisp_gendb import GenerateDB
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class DoubleApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="genmaxwelldouble")
+    return
+
+
+class SingleApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="genmaxwellsingle")
+    return
+
+
+class TestSinglePrecision(unittest.TestCase):
+  """
+  Test suite for testing pylith with material properties stored in
+  single precision.
+
+  A generalized Maxwell viscoelastic material relaxes under axial
+  extension. The solution with the physical properties stored in
+  single precision is compared against the solution with the
+  properties stored in double precision.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(DoubleApp, GenerateDB)
+    run_pylith(SingleApp, GenerateDB)
+    self.checkResults = has_h5py()
+    return
+
+
+  def test_soln(self):
+    """
+    Check displacement field against solution with properties in
+    double precision.
+    """
+    if not self.checkResults:
+      return
+
+    self._compare("genmaxwelldouble.h5", "genmaxwellsingle.h5",
+                  "vertex_fields/displacement")
+    return
+
+
+  def test_stress(self):
+    """
+    Check stress field against solution with properties in double
+    precision.
+    """
+    if not self.checkResults:
+      return
+
+    self._compare("genmaxwelldouble-viscoelastic.h5",
+                  "genmaxwellsingle-viscoelastic.h5",
+                  "cell_fields/stress")
+    return
+
+
+  def _compare(self, filenameDouble, filenameSingle, name):
+    """
+    Check that field differs by less than the precision of single
+    precision properties at every time step.
+    """
+    import h5py
+    h5 = h5py.File(filenameDouble, "r", driver="sec2")
+    timeD = h5['time'][:].ravel()
+    valuesD = h5[name][:]
+    h5.close()
+
+    h5 = h5py.File(filenameSingle, "r", driver="sec2")
+    timeS = h5['time'][:].ravel()
+    valuesS = h5[name][:]
+    h5.close()
+
+    self.assertEqual(timeD.shape, timeS.shape)
+    self.assertTrue(numpy.max(numpy.abs(timeS - timeD)) < 1.0e-6)
+    self.assertEqual(valuesD.shape, valuesS.shape)
+
+    # Relative precision of single precision values is about 6.0e-8.
+    tolerance = 1.0e-5
+    for iStep, t in enumerate(timeD):
+      scale = numpy.max(numpy.abs(valuesD[iStep,:,:]))
+      diff = numpy.max(numpy.abs(valuesS[iStep,:,:] - valuesD[iStep,:,:]))
+      if diff > tolerance*scale:
+        print "Error in %s at t=%g." % (name, t)
+        print "Double precision properties: ",valuesD[iStep,:,:]
+        print "Single precision properties: ",valuesS[iStep,:,:]
+      self.assertTrue(diff <= tolerance*scale)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestSinglePrecision import TestSinglePrecision as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
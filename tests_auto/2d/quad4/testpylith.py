@@ -63,6 +63,12 @@ def suite():
   from TestSlipWeakeningShearSliding import TestSlipWeakeningShearSliding
   suite.addTest(unittest.makeSuite(TestSlipWeakeningShearSliding))
 
+  from TestLocalTimeStep import TestLocalTimeStep
+  suite.addTest(unittest.makeSuite(TestLocalTimeStep))
+
+  from TestSinglePrecision import TestSinglePrecision
+  suite.addTest(unittest.makeSuite(TestSinglePrecision))
+
   return suite
 
 
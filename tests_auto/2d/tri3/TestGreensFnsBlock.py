@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/2d/tri3/TestGreensFnsBlock.py
+##
+## @brief Test suite for testing that solving Green's function
+## impulses in blocks gives the same result as solving them one at a
+## time.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+# Local versions of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class GreensFnsSeqApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfnsseq")
+    return
+
+
+class GreensFnsBlockApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="greensfnsblock")
+    return
+
+
+class TestGreensFnsBlock(unittest.TestCase):
+  """
+  Test suite for comparing Green's functions computed in blocks of
+  impulses with those computed one impulse at a time.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    # 9 impulses (one per fault vertex) in blocks of 4.
+    self.nimpulses = 9
+    self.nvertices = 88 + 9
+    self.faultNumVertices = 9
+
+    run_pylith(GreensFnsSeqApp)
+    run_pylith(GreensFnsBlockApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_soln(self):
+    """
+    Check displacement field for all impulses.
+    """
+    if not self.checkResults:
+      return
+
+    (valuesSeq, valuesBlock) = self._getFields("greensfnsseq.h5", "greensfnsblock.h5", "displacement")
+    self.assertEqual((self.nimpulses, self.nvertices, 2), valuesSeq.shape)
+    self._checkFields(valuesSeq, valuesBlock)
+    return
+
+
+  def test_fault_data(self):
+    """
+    Check slip impulses and fault tractions for all impulses.
+    """
+    if not self.checkResults:
+      return
+
+    for name in ["slip", "traction_change"]:
+      (valuesSeq, valuesBlock) = self._getFields("greensfnsseq-fault.h5", "greensfnsblock-fault.h5", name)
+      self.assertEqual((self.nimpulses, self.faultNumVertices, 2), valuesSeq.shape)
+      self._checkFields(valuesSeq, valuesBlock)
+    return
+
+
+  def _getFields(self, filenameSeq, filenameBlock, name):
+    """
+    Get values of vertex field from output of both simulations.
+    """
+    import h5py
+    h5 = h5py.File(filenameSeq, "r", driver="sec2")
+    valuesSeq = h5['vertex_fields/%s' % name][:]
+    h5.close()
+    h5 = h5py.File(filenameBlock, "r", driver="sec2")
+    valuesBlock = h5['vertex_fields/%s' % name][:]
+    h5.close()
+    return (valuesSeq, valuesBlock)
+
+
+  def _checkFields(self, valuesSeq, valuesBlock):
+    """
+    Check that values match to within round-off.
+    """
+    self.assertEqual(valuesSeq.shape, valuesBlock.shape)
+    tolerance = 1.0e-8
+    scale = max(1.0, numpy.max(numpy.abs(valuesSeq)))
+    diff = numpy.max(numpy.abs(valuesBlock-valuesSeq))
+    if diff > tolerance*scale:
+      print "Maximum difference: %g, scale: %g" % (diff, scale)
+    self.assertTrue(diff <= tolerance*scale)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestGreensFnsBlock import TestGreensFnsBlock as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
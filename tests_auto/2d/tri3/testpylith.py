@@ -39,6 +39,9 @@ def suite():
   from TestShearDispNoSlipRefine import TestShearDispNoSlipRefine
   suite.addTest(unittest.makeSuite(TestShearDispNoSlipRefine))
 
+  from TestShearDispNoSlipRefineLevels import TestShearDispNoSlipRefineLevels
+  suite.addTest(unittest.makeSuite(TestShearDispNoSlipRefineLevels))
+
   from TestSlipOneFault import TestSlipOneFault
   suite.addTest(unittest.makeSuite(TestSlipOneFault))
 
@@ -48,6 +51,9 @@ def suite():
   from TestFaultsIntersect import TestFaultsIntersect
   suite.addTest(unittest.makeSuite(TestFaultsIntersect))
 
+  from TestGreensFnsBlock import TestGreensFnsBlock
+  suite.addTest(unittest.makeSuite(TestGreensFnsBlock))
+
   return suite
 
 
@@ -39,6 +39,8 @@
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <vector> // USES std::vector
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::bc::TestAbsorbingDampers );
 
@@ -401,6 +403,50 @@ pylith::bc::TestAbsorbingDampers::testIntegrateJacobianLumped(void)
   PYLITH_METHOD_END;
 } // testIntegrateJacobianLumped
 
+// ----------------------------------------------------------------------
+// Test restrictTimeStepLevels().
+void
+pylith::bc::TestAbsorbingDampers::testRestrictTimeStepLevels(void)
+{ // testRestrictTimeStepLevels
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  AbsorbingDampers bc;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &bc, &fields);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscInt pStart = 0, pEnd = 0;
+  PetscErrorCode err = DMPlexGetChart(dmMesh, &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), pStart);
+
+  const int levelDefault = 3;
+  int_array pointLevels(levelDefault, pEnd);
+  bc.restrictTimeStepLevels(&pointLevels, mesh);
+
+  // Vertices on the boundary are in level 0.
+  CPPUNIT_ASSERT(bc._boundaryMesh);
+  PetscDM subMesh = bc._boundaryMesh->dmMesh();CPPUNIT_ASSERT(subMesh);
+  topology::Stratum subVerticesStratum(subMesh, topology::Stratum::DEPTH, 0);
+  PetscIS subpointIS = NULL;
+  const PetscInt* subpoints = NULL;
+  err = DMPlexCreateSubpointIS(subMesh, &subpointIS);CPPUNIT_ASSERT(!err);CPPUNIT_ASSERT(subpointIS);
+  err = ISGetIndices(subpointIS, &subpoints);CPPUNIT_ASSERT(!err);
+  std::vector<bool> isBoundary(pEnd, false);
+  for (PetscInt v = subVerticesStratum.begin(); v < subVerticesStratum.end(); ++v) {
+    isBoundary[subpoints[v]] = true;
+  } // for
+  err = ISRestoreIndices(subpointIS, &subpoints);CPPUNIT_ASSERT(!err);
+  err = ISDestroy(&subpointIS);CPPUNIT_ASSERT(!err);
+
+  // All other points are unchanged.
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    CPPUNIT_ASSERT_EQUAL(isBoundary[p] ? 0 : levelDefault, int(pointLevels[p]));
+  } // for
+
+  PYLITH_METHOD_END;
+} // testRestrictTimeStepLevels
+
 // ----------------------------------------------------------------------
 void
 pylith::bc::TestAbsorbingDampers::_initialize(topology::Mesh* mesh,
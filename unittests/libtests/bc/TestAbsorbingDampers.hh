@@ -80,6 +80,9 @@ public :
   /// Test integrateJacobianLumped().
   void testIntegrateJacobianLumped(void);
 
+  /// Test restrictTimeStepLevels().
+  void testRestrictTimeStepLevels(void);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
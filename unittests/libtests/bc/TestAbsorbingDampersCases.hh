@@ -50,6 +50,7 @@ class pylith::bc::TestAbsorbingDampersTri3 : public TestAbsorbingDampers
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
+  CPPUNIT_TEST( testRestrictTimeStepLevels );
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -71,6 +72,7 @@ class pylith::bc::TestAbsorbingDampersQuad4 : public TestAbsorbingDampers
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
+  CPPUNIT_TEST( testRestrictTimeStepLevels );
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -93,6 +95,7 @@ class pylith::bc::TestAbsorbingDampersTet4 : public TestAbsorbingDampers
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
+  CPPUNIT_TEST( testRestrictTimeStepLevels );
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -115,6 +118,7 @@ class pylith::bc::TestAbsorbingDampersHex8 : public TestAbsorbingDampers
   CPPUNIT_TEST( testIntegrateResidual );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
+  CPPUNIT_TEST( testRestrictTimeStepLevels );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -134,6 +134,9 @@ pylith::bc::TestNeumann::testConstructor(void)
 
   Neumann bc;
 
+  // Residual contributions are independent of the solution.
+  CPPUNIT_ASSERT_EQUAL(false, bc.residualDependsOnSoln());
+
   PYLITH_METHOD_END;
 } // testConstructor
 
@@ -75,6 +75,9 @@ pylith::bc::TestPointForce::testConstructor(void)
 
   PointForce bc;
 
+  // Residual contributions are independent of the solution.
+  CPPUNIT_ASSERT_EQUAL(false, bc.residualDependsOnSoln());
+
   PYLITH_METHOD_END;
 } // testConstructor
 
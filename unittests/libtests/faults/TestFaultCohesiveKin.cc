@@ -313,6 +313,72 @@ pylith::faults::TestFaultCohesiveKin::testIntegrateResidual(void)
   PYLITH_METHOD_END;
 } // testIntegrateResidual
 
+// ----------------------------------------------------------------------
+// Test integrateResidualConst() and integrateResidual() with split
+// residual.
+void
+pylith::faults::TestFaultCohesiveKin::testIntegrateResidualSplit(void)
+{ // testIntegrateResidualSplit
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  CPPUNIT_ASSERT(_data->fieldT);
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT, _data->lengthScale);
+  
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+  topology::Field& residual = fields.get("residual");
+  fault.integrateResidual(residual, t, &fields);
+
+  fields.add("residual split", "residual");
+  topology::Field& residualSplit = fields.get("residual split");
+  residualSplit.cloneSection(residual);
+  residualSplit.zeroAll();
+
+  // Constant part contains the prescribed slip.
+  fault.splitResidual(true);
+  fault.integrateResidualConst(residualSplit, t, &fields);
+  PylithScalar constNorm = 0.0;
+  PetscErrorCode err = VecNorm(residualSplit.localVector(), NORM_INFINITY, &constNorm);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(constNorm > 0.0);
+
+  // Constant part plus solution-dependent part matches unsplit residual.
+  fault.integrateResidual(residualSplit, t, &fields);
+
+  PetscInt pStart, pEnd;
+  err = PetscSectionGetChart(residual.localSection(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+  topology::VecVisitorMesh residualVisitor(residual);
+  const PetscScalar* residualArray = residualVisitor.localArray();CPPUNIT_ASSERT(residualArray);
+  topology::VecVisitorMesh residualSplitVisitor(residualSplit);
+  const PetscScalar* residualSplitArray = residualSplitVisitor.localArray();CPPUNIT_ASSERT(residualSplitArray);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  const int spaceDim = _data->spaceDim;
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    CPPUNIT_ASSERT_EQUAL(residualVisitor.sectionDof(p), residualSplitVisitor.sectionDof(p));
+    if (residualVisitor.sectionDof(p) > 0) {
+      const PetscInt off = residualVisitor.sectionOffset(p);
+      const PetscInt offSplit = residualSplitVisitor.sectionOffset(p);
+      for(PetscInt d = 0; d < spaceDim; ++d) {
+	const PylithScalar valE = residualArray[off+d];
+	if (fabs(valE) > 1.0)
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualSplitArray[offSplit+d]/valE, tolerance);
+	else
+	  CPPUNIT_ASSERT_DOUBLES_EQUAL(valE, residualSplitArray[offSplit+d], tolerance);
+      } // for
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualSplit
+
 // ----------------------------------------------------------------------
 // Test integrateJacobian().
 void
@@ -105,6 +105,13 @@ pylith::feassemble::TestElasticityExplicit::testTimeStep(void)
   CPPUNIT_ASSERT_EQUAL(dt1, integrator._dtm1);
   CPPUNIT_ASSERT_EQUAL(dt1, integrator._dt);
 
+  // Residual uses time step of active time-step level.
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._residualTimeStep());
+  integrator._activeLevel = 2;
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(4.0*dt1), integrator._residualTimeStep());
+  integrator._activeLevel = 0;
+  CPPUNIT_ASSERT_EQUAL(dt1, integrator._residualTimeStep());
+
   PYLITH_METHOD_END;
 } // testTimeStep
 
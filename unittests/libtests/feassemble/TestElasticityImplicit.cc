@@ -221,6 +221,66 @@ pylith::feassemble::TestElasticityImplicit::testIntegrateResidual(void)
   PYLITH_METHOD_END;
 } // testIntegrateResidual
 
+// ----------------------------------------------------------------------
+// Test integrateResidualConst() and integrateResidual() with split
+// residual.
+void
+pylith::feassemble::TestElasticityImplicit::testIntegrateResidualSplit(void)
+{ // testIntegrateResidualSplit
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  ElasticityImplicit integrator;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &integrator, &fields);
+
+  topology::Field& residual = fields.get("residual");
+  const PylithScalar t = 1.0;
+  integrator.integrateResidual(residual, t, &fields);
+
+  fields.add("residual split", "residual");
+  topology::Field& residualSplit = fields.get("residual split");
+  residualSplit.cloneSection(residual);
+  residualSplit.zeroAll();
+
+  // Constant part contains the gravitational body forces.
+  integrator.splitResidual(true);
+  integrator.integrateResidualConst(residualSplit, t, &fields);
+  PylithScalar constNorm = 0.0;
+  PetscErrorCode err = VecNorm(residualSplit.localVector(), NORM_INFINITY, &constNorm);CPPUNIT_ASSERT(!err);
+  if (_gravityField) {
+    CPPUNIT_ASSERT(constNorm > 0.0);
+  } else {
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), constNorm);
+  } // if/else
+
+  // Constant part plus solution-dependent part matches unsplit residual.
+  integrator.integrateResidual(residualSplit, t, &fields);
+
+  PetscInt size = 0, sizeSplit = 0;
+  err = VecGetLocalSize(residual.localVector(), &size);CPPUNIT_ASSERT(!err);
+  err = VecGetLocalSize(residualSplit.localVector(), &sizeSplit);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(size, sizeSplit);
+
+  const PetscScalar* residualArray = NULL;
+  const PetscScalar* residualSplitArray = NULL;
+  err = VecGetArrayRead(residual.localVector(), &residualArray);CPPUNIT_ASSERT(!err);
+  err = VecGetArrayRead(residualSplit.localVector(), &residualSplitArray);CPPUNIT_ASSERT(!err);
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  for (PetscInt i=0; i < size; ++i) {
+    if (fabs(residualArray[i]) > 1.0)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, residualSplitArray[i]/residualArray[i], tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(residualArray[i], residualSplitArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(residual.localVector(), &residualArray);CPPUNIT_ASSERT(!err);
+  err = VecRestoreArrayRead(residualSplit.localVector(), &residualSplitArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testIntegrateResidualSplit
+
 // ----------------------------------------------------------------------
 // Test integrateJacobian().
 void
@@ -91,6 +91,10 @@ public :
   /// Test integrateResidual().
   void testIntegrateResidual(void);
 
+  /// Test integrateResidualConst() and integrateResidual() with
+  /// split residual.
+  void testIntegrateResidualSplit(void);
+
   /// Test integrateJacobian().
   void testIntegrateJacobian(void);
 
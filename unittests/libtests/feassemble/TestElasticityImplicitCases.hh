@@ -55,6 +55,7 @@ class pylith::feassemble::TestElasticityImplicit2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -81,6 +82,7 @@ class pylith::feassemble::TestElasticityImplicit2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -107,6 +109,7 @@ class pylith::feassemble::TestElasticityImplicit3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -133,6 +136,7 @@ class pylith::feassemble::TestElasticityImplicit3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -159,6 +163,7 @@ class pylith::feassemble::TestElasticityImplicitGrav2DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -185,6 +190,7 @@ class pylith::feassemble::TestElasticityImplicitGrav2DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -211,6 +217,7 @@ class pylith::feassemble::TestElasticityImplicitGrav3DLinear :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -237,6 +244,7 @@ class pylith::feassemble::TestElasticityImplicitGrav3DQuadratic :
 
   CPPUNIT_TEST( testInitialize );
   CPPUNIT_TEST( testIntegrateResidual );
+  CPPUNIT_TEST( testIntegrateResidualSplit );
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStep );
@@ -82,6 +82,29 @@ pylith::feassemble::TestIntegrator::testIsJacobianSymmetric(void)
   PYLITH_METHOD_END;
 } // testIsJacobianSymmetric
 
+// ----------------------------------------------------------------------
+// Test residualDependsOnSoln(), needNewResidualConst(), and splitResidual().
+void
+pylith::feassemble::TestIntegrator::testResidualConst(void)
+{ // testResidualConst
+  PYLITH_METHOD_BEGIN;
+
+  ElasticityExplicit integrator;
+
+  CPPUNIT_ASSERT_EQUAL(true, integrator.residualDependsOnSoln());
+  CPPUNIT_ASSERT_EQUAL(true, integrator.residualConstDependsOnTime());
+
+  CPPUNIT_ASSERT_EQUAL(true, integrator.needNewResidualConst());
+  integrator.resetNeedNewResidualConst();
+  CPPUNIT_ASSERT_EQUAL(false, integrator.needNewResidualConst());
+
+  // Integrator does not support splitting residual.
+  integrator.splitResidual(true);
+  CPPUNIT_ASSERT_EQUAL(false, integrator._splitResidual);
+
+  PYLITH_METHOD_END;
+} // testResidualConst
+
 // ----------------------------------------------------------------------
 // Test quadrature().
 void
@@ -285,6 +308,25 @@ pylith::feassemble::TestIntegrator::testLumpCellMatrix(void)
   PYLITH_METHOD_END;
 } // testLumpCellMatrix
 
+// ----------------------------------------------------------------------
+// Test _valueBytes().
+void
+pylith::feassemble::TestIntegrator::testValueBytes(void)
+{ // testValueBytes
+  PYLITH_METHOD_BEGIN;
+
+  const double scalarBytes = sizeof(PetscScalar);
+  const double indexBytes = sizeof(PetscInt);
+
+  const double tolerance = 1.0e-12;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, Integrator::_valueBytes(0, 0), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(4*(scalarBytes+indexBytes), Integrator::_valueBytes(4, 0), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(4*(scalarBytes+indexBytes) + 3*(2*scalarBytes+indexBytes),
+			       Integrator::_valueBytes(4, 3), tolerance);
+
+  PYLITH_METHOD_END;
+} // testValueBytes
+
 // ----------------------------------------------------------------------
 // Set quadrature information.
 void
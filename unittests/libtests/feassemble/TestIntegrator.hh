@@ -49,6 +49,7 @@ class pylith::feassemble::TestIntegrator : public CppUnit::TestFixture
   CPPUNIT_TEST( testTimeStep );
   CPPUNIT_TEST( testStableTimeStep );  
   CPPUNIT_TEST( testIsJacobianSymmetric );
+  CPPUNIT_TEST( testResidualConst );
 
   CPPUNIT_TEST( testQuadrature );
   CPPUNIT_TEST( testNormalizer );
@@ -58,6 +59,7 @@ class pylith::feassemble::TestIntegrator : public CppUnit::TestFixture
   CPPUNIT_TEST( testInitCellMatrix );
   CPPUNIT_TEST( testResetCellMatrix );
   CPPUNIT_TEST( testLumpCellMatrix );
+  CPPUNIT_TEST( testValueBytes );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -73,6 +75,9 @@ public :
   /// Test isJacobianSymmetric().
   void testIsJacobianSymmetric(void);
 
+  /// Test residualDependsOnSoln(), needNewResidualConst(), and splitResidual().
+  void testResidualConst(void);
+
   /// Test quadrature().
   void testQuadrature(void);
 
@@ -97,6 +102,9 @@ public :
   /// Test _lumpCellMatrix().
   void testLumpCellMatrix(void);
 
+  /// Test _valueBytes().
+  void testValueBytes(void);
+
   // PRIVATE METHODS /////////////////////////////////////////////////////
 private :
 
@@ -501,9 +501,154 @@ pylith::materials::TestElasticMaterial::testStableTimeStepExplicit(void)
   const PylithScalar dtE = 2.0*1.757359312880716 / 5196.15242;
   CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dt/dtE, tolerance);
 
+  // Stable time step is cached for each quadrature point.
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells*numQuadPts), material._dtStableExplicitCells.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells), material._minCellWidthCells.size());
+  const PylithScalar dtCached = material.stableTimeStepExplicit(mesh, &quadrature);
+  CPPUNIT_ASSERT_EQUAL(dt, dtCached);
+
   PYLITH_METHOD_END;
 } // testStableTimeStepExplicit
 
+// ----------------------------------------------------------------------
+// Test _updateStableTimeStep()
+void
+pylith::materials::TestElasticMaterial::testUpdateStableTimeStep(void)
+{ // testUpdateStableTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  ElasticPlaneStrain material;
+  material.stableTimeStepTolerance(0.1);
+
+  PylithScalar dtMin = 1.0;
+  bool needRescan = false;
+
+  // Decrease is always applied and updates minimum.
+  PylithScalar dtCached = 2.0;
+  material._updateStableTimeStep(&dtCached, &dtMin, &needRescan, 0.5);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.5), dtCached);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.5), dtMin);
+  CPPUNIT_ASSERT(!needRescan);
+
+  // Increase within tolerance is ignored.
+  material._updateStableTimeStep(&dtCached, &dtMin, &needRescan, 0.54);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.5), dtCached);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.5), dtMin);
+  CPPUNIT_ASSERT(!needRescan);
+
+  // Increase of minimum beyond tolerance requires rescan.
+  material._updateStableTimeStep(&dtCached, &dtMin, &needRescan, 0.6);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.6), dtCached);
+  CPPUNIT_ASSERT(needRescan);
+
+  PYLITH_METHOD_END;
+} // testUpdateStableTimeStep
+
+// ----------------------------------------------------------------------
+// Test storing properties in single precision.
+void
+pylith::materials::TestElasticMaterial::testSinglePrecisionProperties(void)
+{ // testSinglePrecisionProperties
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  ElasticPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data);
+  CPPUNIT_ASSERT(!material.singlePrecisionProperties());
+
+  topology::Mesh meshSingle;
+  ElasticPlaneStrain materialSingle;
+  materialSingle.singlePrecisionProperties(true);
+  _initialize(&meshSingle, &materialSingle, &data);
+  CPPUNIT_ASSERT(materialSingle.singlePrecisionProperties());
+
+  // Only the layout of the properties field is kept.
+  CPPUNIT_ASSERT(materialSingle._properties);
+  CPPUNIT_ASSERT(!materialSingle._properties->localVector());
+  CPPUNIT_ASSERT(materialSingle._materialIS);
+  const size_t numPropsCell = data.numLocs*data.numPropsQuadPt;
+  CPPUNIT_ASSERT_EQUAL(size_t(materialSingle._materialIS->size())*numPropsCell, materialSingle._propertiesSingle.size());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), material._propertiesSingle.size());
+  CPPUNIT_ASSERT_EQUAL(materialSingle._propertiesSingle.size()*sizeof(float), materialSingle.propertiesSingleBytes());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), material.propertiesSingleBytes());
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  const int tensorSize = material._tensorSize;
+  const int numQuadPts = data.numLocs;
+  scalar_array strain(data.strain, numQuadPts*tensorSize);
+
+  // Properties, stresses, and elastic constants computed from the
+  // single precision properties should match to single precision.
+  const PylithScalar tolerance = 1.0e-06;
+  material.createPropsAndVarsVisitors();
+  materialSingle.createPropsAndVarsVisitors();
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    material.retrievePropsAndVars(cell);
+    materialSingle.retrievePropsAndVars(cell);
+
+    const scalar_array& propertiesE = material._propertiesCell;
+    const scalar_array& properties = materialSingle._propertiesCell;
+    CPPUNIT_ASSERT_EQUAL(propertiesE.size(), properties.size());
+    for (size_t i=0; i < propertiesE.size(); ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, properties[i]/propertiesE[i], tolerance);
+    } // for
+
+    const scalar_array stressE = material.calcStress(strain);
+    const scalar_array& stress = materialSingle.calcStress(strain);
+    CPPUNIT_ASSERT_EQUAL(stressE.size(), stress.size());
+    for (size_t i=0; i < stressE.size(); ++i) {
+      if (fabs(stressE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, stress[i]/stressE[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(stressE[i], stress[i], tolerance);
+      } // if/else
+    } // for
+
+    const scalar_array elasticConstsE = material.calcDerivElastic(strain);
+    const scalar_array& elasticConsts = materialSingle.calcDerivElastic(strain);
+    CPPUNIT_ASSERT_EQUAL(elasticConstsE.size(), elasticConsts.size());
+    for (size_t i=0; i < elasticConstsE.size(); ++i) {
+      if (fabs(elasticConstsE[i]) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, elasticConsts[i]/elasticConstsE[i], tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(elasticConstsE[i], elasticConsts[i], tolerance);
+      } // if/else
+    } // for
+  } // for
+  material.destroyPropsAndVarsVisitors();
+  materialSingle.destroyPropsAndVarsVisitors();
+
+  // Output of properties uses the single precision values.
+  topology::Field field(mesh);
+  material.getField(&field, "density");
+  topology::Field fieldSingle(meshSingle);
+  materialSingle.getField(&fieldSingle, "density");
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  topology::VecVisitorMesh fieldSingleVisitor(fieldSingle);
+  const PetscScalar* fieldSingleArray = fieldSingleVisitor.localArray();CPPUNIT_ASSERT(fieldSingleArray);
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt cell = cells[c];
+    const PetscInt off = fieldVisitor.sectionOffset(cell);
+    const PetscInt offSingle = fieldSingleVisitor.sectionOffset(cell);
+    const PetscInt fiberDim = fieldVisitor.sectionDof(cell);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, fieldSingleVisitor.sectionDof(cell));
+    for (PetscInt d=0; d < fiberDim; ++d) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fieldSingleArray[offSingle+d]/fieldArray[off+d], tolerance);
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // testSinglePrecisionProperties
+
 // ----------------------------------------------------------------------
 // Setup testing data.
 void
@@ -57,6 +57,8 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStepImplicit );
   CPPUNIT_TEST( testStableTimeStepExplicit );
+  CPPUNIT_TEST( testUpdateStableTimeStep );
+  CPPUNIT_TEST( testSinglePrecisionProperties );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -93,6 +95,12 @@ public :
   /// Test stableTimeStepExplicit().
   void testStableTimeStepExplicit(void);
 
+  /// Test _updateStableTimeStep().
+  void testUpdateStableTimeStep(void);
+
+  /// Test storing properties in single precision.
+  void testSinglePrecisionProperties(void);
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
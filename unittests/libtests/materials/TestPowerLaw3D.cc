@@ -24,6 +24,7 @@
 #include "data/PowerLaw3DTimeDepData.hh" // USES PowerLaw3DTimeDepData
 
 #include "pylith/materials/PowerLaw3D.hh" // USES PowerLaw3D
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include <cstring> // USES memcpy()
 
@@ -179,6 +180,74 @@ pylith::materials::TestPowerLaw3D::test_updateStateVarsTimeDep(void)
 
 } // test_updateStateVarsTimeDep
 
+// ----------------------------------------------------------------------
+// Test stiffnessChange().
+void
+pylith::materials::TestPowerLaw3D::testStiffnessChange(void)
+{ // testStiffnessChange
+  PowerLaw3D material;
+  material.useElasticBehavior(false);
+  const PowerLaw3DTimeDepData data;
+
+  const int numLocs = data.numLocs;
+  const int numPropsQuadPt = data.numPropsQuadPt;
+  const int numVarsQuadPt = data.numVarsQuadPt;
+  const int tensorSize = material._tensorSize;
+
+  scalar_array properties(numPropsQuadPt);
+  scalar_array stateVars(numVarsQuadPt);
+  scalar_array strain(tensorSize);
+  scalar_array initialStress(tensorSize);
+  scalar_array initialStrain(tensorSize);
+
+  const PylithScalar dt = 2.0e+5;
+  material.timeStep(dt);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), material.stiffnessChange());
+
+  const int numSteps = 2;
+  PylithScalar changeStep = 0.0;
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    // Update state variables at the end of the time step.
+    for (int iLoc=0; iLoc < numLocs; ++iLoc) {
+      memcpy(&properties[0], &data.properties[iLoc*numPropsQuadPt],
+	     numPropsQuadPt*sizeof(PylithScalar));
+      memcpy(&stateVars[0], &data.stateVars[iLoc*numVarsQuadPt],
+	     numVarsQuadPt*sizeof(PylithScalar));
+      memcpy(&strain[0], &data.strain[iLoc*tensorSize],
+	     tensorSize*sizeof(PylithScalar));
+      memcpy(&initialStress[0], &data.initialStress[iLoc*tensorSize],
+	     tensorSize*sizeof(PylithScalar));
+      memcpy(&initialStrain[0], &data.initialStrain[iLoc*tensorSize],
+	     tensorSize*sizeof(PylithScalar));
+
+      material._updateStateVars(&stateVars[0], stateVars.size(),
+				&properties[0], properties.size(),
+				&strain[0], strain.size(),
+				&initialStress[0], initialStress.size(),
+				&initialStrain[0], initialStrain.size());
+    } // for
+    CPPUNIT_ASSERT(material.needNewJacobian());
+
+    // Change is not counted until the next time step begins.
+    const PylithScalar changeBefore = material.stiffnessChange();
+    material.timeStep(dt);
+    if (0 == iStep) {
+      CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), changeBefore);
+      changeStep = material.stiffnessChange();
+      CPPUNIT_ASSERT(changeStep > 0.0);
+    } // if
+
+    // Change accumulates over time steps while the Jacobian is reused.
+    const PylithScalar tolerance = 1.0e-06;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, material.stiffnessChange() / ((iStep+1)*changeStep), tolerance);
+  } // for
+
+  // Forming the Jacobian resets the change.
+  material.resetNeedNewJacobian();
+  CPPUNIT_ASSERT(!material.needNewJacobian());
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), material.stiffnessChange());
+} // testStiffnessChange
+
 // ----------------------------------------------------------------------
 // Test _stableTimeStepImplicit()
 void
@@ -68,6 +68,7 @@ class pylith::materials::TestPowerLaw3D : public TestElasticMaterial
   CPPUNIT_TEST( test_calcElasticConstsTimeDep );
   CPPUNIT_TEST( test_updateStateVarsElastic );
   CPPUNIT_TEST( test_updateStateVarsTimeDep );
+  CPPUNIT_TEST( testStiffnessChange );
 
   CPPUNIT_TEST( testHasProperty );
   CPPUNIT_TEST( testHasStateVar );
@@ -107,6 +108,9 @@ public :
   /// Test _updateStatevarsTimeDep()
   void test_updateStateVarsTimeDep(void);
 
+  /// Test stiffnessChange()
+  void testStiffnessChange(void);
+
   /// Test _stableTimeStepImplicit()
   void test_stableTimeStepImplicit(void);
 
@@ -24,6 +24,7 @@
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/meshio/OutputManager.hh"
 
 #include "TestDataWriterVTK.hh" // USES TestDataWriterVTK::checkFile()
@@ -263,6 +264,10 @@ pylith::meshio::TestOutputManager::testAppendVertexField(void)
   manager.closeTimeStep();
   manager.close();
 
+  // Buffers are freed between time steps.
+  const topology::Fields* buffers = manager.fields();
+  CPPUNIT_ASSERT(!buffers || !buffers->hasField("buffer (vector)"));
+
   TestDataWriterVTK::checkFile(filenameRoot, t, timeFormat);
 
   VertexFilterVecNorm filter;
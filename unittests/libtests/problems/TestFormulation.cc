@@ -0,0 +1,336 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestFormulation.hh" // Implementation of class methods
+
+#include "pylith/problems/Implicit.hh" // USES Implicit
+
+#include "pylith/feassemble/Integrator.hh" // ISA Integrator
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestFormulation );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestFormulation {
+
+      /** Integrator with a residual that depends on the solution
+       * (residual = 1 + solution) and that supports splitting off the
+       * constant part. Constraining the solution space adds a constant
+       * adjustment to the solution.
+       */
+      class SplitIntegrator : public feassemble::Integrator {
+      public :
+	SplitIntegrator(void) : numConstEvals(0), adjustValue(0.0) {}
+
+	void verifyConfiguration(const topology::Mesh& mesh) const {}
+
+	bool residualConstDependsOnTime(void) const {
+	  return false;
+	} // residualConstDependsOnTime
+
+	void splitResidual(const bool flag) {
+	  _splitResidual = flag;
+	} // splitResidual
+
+	bool isSplit(void) const {
+	  return _splitResidual;
+	} // isSplit
+
+	void requestNewResidualConst(void) {
+	  _needNewResidualConst = true;
+	} // requestNewResidualConst
+
+	void integrateResidual(const topology::Field& residual,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields) {
+	  PetscErrorCode err = 0;
+	  if (!_splitResidual) {
+	    err = VecShift(residual.localVector(), 1.0);CPPUNIT_ASSERT(!err);
+	  } // if
+	  err = VecAXPY(residual.localVector(), 1.0, fields->solution().localVector());CPPUNIT_ASSERT(!err);
+	} // integrateResidual
+
+	void integrateResidualConst(const topology::Field& residual,
+				    const PylithScalar t,
+				    topology::SolutionFields* const fields) {
+	  CPPUNIT_ASSERT(_splitResidual);
+	  PetscErrorCode err = VecShift(residual.localVector(), 1.0);CPPUNIT_ASSERT(!err);
+	  ++numConstEvals;
+	} // integrateResidualConst
+
+	void constrainSolnSpace(topology::SolutionFields* const fields,
+				const PylithScalar t,
+				const topology::Jacobian& jacobian) {
+	  topology::Field& adjust = fields->get("dispIncr adjust");
+	  PetscErrorCode err = VecSet(adjust.localVector(), adjustValue);CPPUNIT_ASSERT(!err);
+	} // constrainSolnSpace
+
+	int numConstEvals; ///< Number of evaluations of constant part of residual.
+	PylithScalar adjustValue; ///< Adjustment to solution.
+      }; // SplitIntegrator
+
+      /// Integrator with a residual that does not depend on the
+      /// solution (residual = 2).
+      class ConstIntegrator : public feassemble::Integrator {
+      public :
+	ConstIntegrator(void) : numEvals(0), dependsOnTime(false) {}
+
+	void verifyConfiguration(const topology::Mesh& mesh) const {}
+
+	bool residualDependsOnSoln(void) const {
+	  return false;
+	} // residualDependsOnSoln
+
+	bool residualConstDependsOnTime(void) const {
+	  return dependsOnTime;
+	} // residualConstDependsOnTime
+
+	void integrateResidual(const topology::Field& residual,
+			       const PylithScalar t,
+			       topology::SolutionFields* const fields) {
+	  PetscErrorCode err = VecShift(residual.localVector(), 2.0);CPPUNIT_ASSERT(!err);
+	  ++numEvals;
+	} // integrateResidual
+
+	int numEvals; ///< Number of residual evaluations.
+	bool dependsOnTime; ///< True if residual changes with time.
+      }; // ConstIntegrator
+
+    } // _TestFormulation
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test cacheResidual().
+void
+pylith::problems::TestFormulation::testCacheResidual(void)
+{ // testCacheResidual
+  PYLITH_METHOD_BEGIN;
+
+  _TestFormulation::SplitIntegrator integrator;
+  feassemble::Integrator* integrators[1] = { &integrator };
+
+  Implicit formulation;
+  formulation.integrators(integrators, 1);
+  CPPUNIT_ASSERT(!integrator.isSplit());
+
+  formulation.cacheResidual(true);
+  CPPUNIT_ASSERT(integrator.isSplit());
+
+  formulation.cacheResidual(false);
+  CPPUNIT_ASSERT(!integrator.isSplit());
+
+  PYLITH_METHOD_END;
+} // testCacheResidual
+
+// ----------------------------------------------------------------------
+// Test reformResidual() reuses and invalidates cached contributions.
+void
+pylith::problems::TestFormulation::testReformResidualCache(void)
+{ // testReformResidualCache
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+  topology::Jacobian jacobian(fields.solution());
+
+  _TestFormulation::SplitIntegrator integratorSplit;
+  _TestFormulation::ConstIntegrator integratorConst;
+  feassemble::Integrator* integrators[2] = { &integratorSplit, &integratorConst };
+
+  Implicit formulation;
+  formulation.integrators(integrators, 2);
+  formulation.cacheResidual(true);
+  formulation.updateSettings(&jacobian, &fields, 0.0, 1.0);
+
+  PetscVec solutionVec = fields.solution().localVector();
+  PetscErrorCode err = VecSet(solutionVec, 2.0);CPPUNIT_ASSERT(!err);
+  formulation.reformResidual();
+  _checkResidual(fields, 5.0);
+  CPPUNIT_ASSERT_EQUAL(1, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(1, integratorConst.numEvals);
+
+  // New solution uses cached contributions.
+  err = VecSet(solutionVec, 3.0);CPPUNIT_ASSERT(!err);
+  formulation.reformResidual();
+  _checkResidual(fields, 6.0);
+  CPPUNIT_ASSERT_EQUAL(1, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(1, integratorConst.numEvals);
+
+  // Cached contributions do not depend on time.
+  formulation.updateSettings(&jacobian, &fields, 1.0, 1.0);
+  formulation.reformResidual();
+  _checkResidual(fields, 6.0);
+  CPPUNIT_ASSERT_EQUAL(1, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(1, integratorConst.numEvals);
+
+  // Cached contributions depend on time.
+  integratorConst.dependsOnTime = true;
+  formulation.updateSettings(&jacobian, &fields, 2.0, 1.0);
+  formulation.reformResidual();
+  _checkResidual(fields, 6.0);
+  CPPUNIT_ASSERT_EQUAL(2, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(2, integratorConst.numEvals);
+
+  // Integrator requests new contributions (e.g., state variables changed).
+  integratorSplit.requestNewResidualConst();
+  formulation.reformResidual();
+  _checkResidual(fields, 6.0);
+  CPPUNIT_ASSERT_EQUAL(3, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(3, integratorConst.numEvals);
+
+  // Without caching, all contributions are integrated every time.
+  formulation.cacheResidual(false);
+  formulation.reformResidual();
+  _checkResidual(fields, 6.0);
+  CPPUNIT_ASSERT_EQUAL(3, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(4, integratorConst.numEvals);
+
+  PYLITH_METHOD_END;
+} // testReformResidualCache
+
+// ----------------------------------------------------------------------
+// Test reformResidual() after constrainSolnSpace() adjusts the solution.
+void
+pylith::problems::TestFormulation::testReformResidualSolnAdjusted(void)
+{ // testReformResidualSolnAdjusted
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+  topology::Jacobian jacobian(fields.solution());
+
+  _TestFormulation::SplitIntegrator integratorSplit;
+  _TestFormulation::ConstIntegrator integratorConst;
+  feassemble::Integrator* integrators[2] = { &integratorSplit, &integratorConst };
+
+  Implicit formulation;
+  formulation.integrators(integrators, 2);
+  formulation.cacheResidual(true);
+  formulation.updateSettings(&jacobian, &fields, 0.0, 1.0);
+
+  topology::Field& solution = fields.solution();
+  PetscErrorCode err = VecSet(solution.localVector(), 2.0);CPPUNIT_ASSERT(!err);
+  formulation.reformResidual();
+  _checkResidual(fields, 5.0);
+
+  // Constraint leaves solution unchanged.
+  solution.scatterLocalToGlobal();
+  PetscVec solutionVec = solution.globalVector();
+  formulation.constrainSolnSpace(&solutionVec);
+  CPPUNIT_ASSERT(!formulation.solnAdjusted());
+
+  // Constraint adjusts solution; residual must reflect the adjusted
+  // solution while the cached contributions remain valid.
+  integratorSplit.adjustValue = 0.5;
+  formulation.constrainSolnSpace(&solutionVec);
+  CPPUNIT_ASSERT(formulation.solnAdjusted());
+  formulation.reformResidual(NULL, &solutionVec);
+  _checkResidual(fields, 5.5);
+  CPPUNIT_ASSERT_EQUAL(1, integratorSplit.numConstEvals);
+  CPPUNIT_ASSERT_EQUAL(1, integratorConst.numEvals);
+
+  // Residual with cached contributions matches residual without caching.
+  formulation.cacheResidual(false);
+  formulation.reformResidual(NULL, &solutionVec);
+  _checkResidual(fields, 5.5);
+
+  PYLITH_METHOD_END;
+} // testReformResidualSolnAdjusted
+
+// ----------------------------------------------------------------------
+// Initialize mesh and solution fields.
+void
+pylith::problems::TestFormulation::_initialize(topology::Mesh* mesh,
+					       topology::SolutionFields* fields) const
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(fields);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  fields->add("residual", "residual");
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->add("velocity(t)", "velocity");
+  fields->solutionName("dispIncr(t->t+dt)");
+
+  const int spaceDim = mesh->dimension();
+  topology::Field& residual = fields->get("residual");
+  residual.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR);
+  residual.subfieldsSetup();
+  residual.setupSolnChart();
+  residual.setupSolnDof(spaceDim);
+  residual.allocate();
+  residual.zeroAll();
+
+  fields->copyLayout("residual");
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+// ----------------------------------------------------------------------
+// Check residual values.
+void
+pylith::problems::TestFormulation::_checkResidual(topology::SolutionFields& fields,
+						  const PylithScalar valueE) const
+{ // _checkResidual
+  PYLITH_METHOD_BEGIN;
+
+  const topology::Field& residual = fields.get("residual");
+  PetscVec residualVec = residual.localVector();CPPUNIT_ASSERT(residualVec);
+  PetscInt size = 0;
+  PetscErrorCode err = VecGetLocalSize(residualVec, &size);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(size > 0);
+
+  const PetscScalar* residualArray = NULL;
+  err = VecGetArrayRead(residualVec, &residualArray);CPPUNIT_ASSERT(!err);
+  const PylithScalar tolerance = 1.0e-12;
+  for (PetscInt i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, residualArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(residualVec, &residualArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _checkResidual
+
+
+// End of file 
@@ -0,0 +1,92 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestFormulation.hh
+ *
+ * @brief C++ TestFormulation object.
+ * 
+ * C++ unit testing for Formulation.
+ */
+
+#if !defined(pylith_problems_testformulation_hh)
+#define pylith_problems_testformulation_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestFormulation;
+  } // problems
+} // pylith
+
+/// C++ unit testing for Formulation.
+class pylith::problems::TestFormulation : public CppUnit::TestFixture
+{ // class TestFormulation
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestFormulation );
+
+  CPPUNIT_TEST( testCacheResidual );
+  CPPUNIT_TEST( testReformResidualCache );
+  CPPUNIT_TEST( testReformResidualSolnAdjusted );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test cacheResidual().
+  void testCacheResidual(void);
+
+  /// Test reformResidual() reuses and invalidates cached contributions.
+  void testReformResidualCache(void);
+
+  /// Test reformResidual() after constrainSolnSpace() adjusts the solution.
+  void testReformResidualSolnAdjusted(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh and solution fields.
+   *
+   * @param mesh Finite-element mesh.
+   * @param fields Solution fields.
+   */
+  void _initialize(topology::Mesh* mesh,
+		   topology::SolutionFields* fields) const;
+
+  /** Check that all residual values are equal to the expected value.
+   *
+   * @param fields Solution fields.
+   * @param valueE Expected value.
+   */
+  void _checkResidual(topology::SolutionFields& fields,
+		      const PylithScalar valueE) const;
+
+}; // class TestFormulation
+
+#endif // pylith_problems_testformulation_hh
+
+
+// End of file 
@@ -0,0 +1,194 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolver.hh" // Implementation of class methods
+
+#include "pylith/problems/Solver.hh" // USES Solver
+
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <petscmat.h> // USES MatNullSpace
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolver );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestSolver::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  Solver solver;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test _createNullSpace().
+void
+pylith::problems::TestSolver::testCreateNullSpace(void)
+{ // testCreateNullSpace
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+
+  topology::Field& solution = fields.solution();
+  topology::Jacobian jacobian(solution);
+
+  Solver solver;
+  solver._createNullSpace(fields, jacobian);
+
+  MatNullSpace nullsp = NULL;
+  PetscErrorCode err = MatGetNearNullSpace(jacobian.matrix(), &nullsp);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(nullsp);
+  PetscBool hasConstant = PETSC_FALSE;
+  PetscInt numModes = 0;
+  const PetscVec* modes = NULL;
+  err = MatNullSpaceGetVecs(nullsp, &hasConstant, &numModes, &modes);CPPUNIT_ASSERT(!err);
+  const int spaceDim = 2;
+  CPPUNIT_ASSERT_EQUAL(PetscInt(3), numModes); // 2 translations, 1 rotation
+
+  // Lagrange multiplier DOF are on the hybrid edges of the cohesive cells.
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  topology::Stratum edgesStratum(dmMesh, topology::Stratum::DEPTH, 1);
+  const PetscInt eEnd = edgesStratum.end();
+  PetscInt eMax = -1;
+  err = DMPlexGetHybridBounds(dmMesh, NULL, NULL, &eMax, NULL);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(eMax >= 0 && eMax < eEnd);
+
+  PetscSection solutionSection = solution.localSection();CPPUNIT_ASSERT(solutionSection);
+  PetscVec solutionVec = solution.localVector();CPPUNIT_ASSERT(solutionVec);
+  const PylithScalar tolerance = 1.0e-12;
+  for (PetscInt iMode=0; iMode < numModes; ++iMode) {
+    err = VecSet(solutionVec, 1.0);CPPUNIT_ASSERT(!err);
+    err = DMGlobalToLocalBegin(dmMesh, modes[iMode], INSERT_VALUES, solutionVec);CPPUNIT_ASSERT(!err);
+    err = DMGlobalToLocalEnd(dmMesh, modes[iMode], INSERT_VALUES, solutionVec);CPPUNIT_ASSERT(!err);
+
+    const PetscScalar* solutionArray = NULL;
+    err = VecGetArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+
+    // Modes are zero on Lagrange multiplier DOF.
+    for (PetscInt e = eMax; e < eEnd; ++e) {
+      PetscInt dof = 0, off = 0;
+      err = PetscSectionGetDof(solutionSection, e, &dof);CPPUNIT_ASSERT(!err);
+      err = PetscSectionGetOffset(solutionSection, e, &off);CPPUNIT_ASSERT(!err);
+      CPPUNIT_ASSERT_EQUAL(PetscInt(spaceDim), dof);
+      for (PetscInt d=0; d < dof; ++d) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, solutionArray[off+d], tolerance);
+      } // for
+    } // for
+
+    // Modes are normalized over the displacement DOF.
+    PylithScalar normSquared = 0.0;
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      PetscInt dof = 0, off = 0;
+      err = PetscSectionGetDof(solutionSection, v, &dof);CPPUNIT_ASSERT(!err);
+      err = PetscSectionGetOffset(solutionSection, v, &off);CPPUNIT_ASSERT(!err);
+      for (PetscInt d=0; d < dof; ++d) {
+	normSquared += solutionArray[off+d]*solutionArray[off+d];
+      } // for
+    } // for
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, normSquared, tolerance);
+
+    err = VecRestoreArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testCreateNullSpace
+
+// ----------------------------------------------------------------------
+// Initialize mesh and solution field.
+void
+pylith::problems::TestSolver::_initialize(topology::Mesh* mesh,
+					  topology::SolutionFields* fields) const
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(fields);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  // Insert cohesive cells.
+  faults::FaultCohesiveKin fault;
+  fault.id(10);
+  fault.label("fault");
+  PetscInt firstFaultVertex = 0;
+  PetscInt firstLagrangeVertex = 0;
+  PetscDM dmMesh = mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err = DMGetStratumSize(dmMesh, "fault", 1, &firstLagrangeVertex);CPPUNIT_ASSERT(!err);
+  PetscInt firstFaultCell = firstLagrangeVertex + firstLagrangeVertex;
+  fault.adjustTopology(mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+  dmMesh = mesh->dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->solutionName("dispIncr(t->t+dt)");
+
+  const int spaceDim = mesh->dimension();
+  topology::Field& solution = fields->solution();
+  solution.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR);
+  solution.subfieldAdd("lagrange_multiplier", spaceDim, topology::Field::VECTOR);
+  solution.subfieldsSetup();
+  solution.setupSolnChart();
+  solution.setupSolnDof(spaceDim);
+
+  // Lagrange multiplier DOF on hybrid edges (as in
+  // FaultCohesiveLagrange::setupSolnDof()).
+  const int indexLagrange = solution.subfieldInfo("lagrange_multiplier").index;
+  PetscSection solutionSection = solution.localSection();CPPUNIT_ASSERT(solutionSection);
+  topology::Stratum edgesStratum(dmMesh, topology::Stratum::DEPTH, 1);
+  const PetscInt eEnd = edgesStratum.end();
+  PetscInt eMax = -1;
+  err = DMPlexGetHybridBounds(dmMesh, NULL, NULL, &eMax, NULL);CPPUNIT_ASSERT(!err);
+  for (PetscInt e = eMax; e < eEnd; ++e) {
+    err = PetscSectionSetDof(solutionSection, e, spaceDim);CPPUNIT_ASSERT(!err);
+    err = PetscSectionSetFieldDof(solutionSection, e, indexLagrange, spaceDim);CPPUNIT_ASSERT(!err);
+  } // for
+  solution.allocate();
+  solution.zeroAll();
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file 
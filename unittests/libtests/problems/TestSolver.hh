@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolver.hh
+ *
+ * @brief C++ TestSolver object.
+ * 
+ * C++ unit testing for Solver.
+ */
+
+#if !defined(pylith_problems_testsolver_hh)
+#define pylith_problems_testsolver_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolver;
+  } // problems
+} // pylith
+
+/// C++ unit testing for Solver.
+class pylith::problems::TestSolver : public CppUnit::TestFixture
+{ // class TestSolver
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolver );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testCreateNullSpace );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test _createNullSpace().
+  void testCreateNullSpace(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh with a fault and solution field with
+   * displacement and Lagrange multiplier subfields.
+   *
+   * @param mesh Finite-element mesh.
+   * @param fields Solution fields.
+   */
+  void _initialize(topology::Mesh* mesh,
+		   topology::SolutionFields* fields) const;
+
+}; // class TestSolver
+
+#endif // pylith_problems_testsolver_hh
+
+
+// End of file 
@@ -0,0 +1,410 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolverLinear.hh" // Implementation of class methods
+
+#include "pylith/problems/SolverLinear.hh" // USES SolverLinear
+
+#include <petscksp.h> // USES PetscVec, PetscMat, PetscKSP
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolverLinear );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestSolverLinear::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  SolverLinear solver;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test initialGuess().
+void
+pylith::problems::TestSolverLinear::testInitialGuess(void)
+{ // testInitialGuess
+  PYLITH_METHOD_BEGIN;
+
+  SolverLinear solver;
+  CPPUNIT_ASSERT_EQUAL(SolverLinear::GUESS_ZERO, solver._initialGuess);
+  CPPUNIT_ASSERT_EQUAL(0, solver._historySize);
+
+  solver.initialGuess(SolverLinear::GUESS_PROJECT, 3);
+  CPPUNIT_ASSERT_EQUAL(SolverLinear::GUESS_PROJECT, solver._initialGuess);
+  CPPUNIT_ASSERT_EQUAL(3, solver._historySize);
+
+  solver.initialGuess(SolverLinear::GUESS_ZERO, 3);
+  CPPUNIT_ASSERT_EQUAL(SolverLinear::GUESS_ZERO, solver._initialGuess);
+  CPPUNIT_ASSERT_EQUAL(0, solver._historySize);
+
+  CPPUNIT_ASSERT_THROW(solver.initialGuess(SolverLinear::GUESS_EXTRAPOLATE, 0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testInitialGuess
+
+// ----------------------------------------------------------------------
+// Test _formInitialGuess() with extrapolation.
+void
+pylith::problems::TestSolverLinear::testGuessExtrapolate(void)
+{ // testGuessExtrapolate
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 4;
+  const PylithScalar diag[size] = { 1.0, 2.0, 4.0, 8.0 };
+  const PylithScalar a[size] = { 1.0, -2.0, 0.5, 3.0 };
+  const PylithScalar b[size] = { 0.2, 0.4, -1.0, 0.0 };
+  const PylithScalar c[size] = { -0.3, 0.1, 0.0, 2.0 };
+  const int numPrev = 3;
+
+  // Quadratic in time, x(t) = a + b*t + c*t**2, with previous
+  // solutions at t=-1, -2, -3 (most recent first). Extrapolation
+  // through three solutions is exact for a quadratic.
+  SolverLinear solver;
+  solver.initialGuess(SolverLinear::GUESS_EXTRAPOLATE, numPrev);
+  for (int iPrev=0; iPrev < numPrev; ++iPrev) {
+    const PylithScalar t = -(iPrev+1);
+    PylithScalar solution[size];
+    for (int i=0; i < size; ++i) {
+      solution[i] = a[i] + b[i]*t + c[i]*t*t;
+    } // for
+    _addHistory(&solver, solution, diag, size);
+  } // for
+
+  PetscVec solutionVec = _createVec(a, size);
+  PetscVec rhsVec = _createVec(a, size);
+  PetscMat jacobianMat = _createDiagMat(diag, size);
+  PetscErrorCode err = VecSet(solutionVec, 0.0);CPPUNIT_ASSERT(!err);
+  solver._formInitialGuess(solutionVec, rhsVec, jacobianMat, false);
+
+  const PetscScalar* solutionArray = NULL;
+  err = VecGetArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+  const PylithScalar tolerance = 1.0e-12;
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(a[i], solutionArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+
+  err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testGuessExtrapolate
+
+// ----------------------------------------------------------------------
+// Test _formInitialGuess() with projection.
+void
+pylith::problems::TestSolverLinear::testGuessProject(void)
+{ // testGuessProject
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 4;
+  const PylithScalar diag[size] = { 1.0, 2.0, 4.0, 8.0 };
+  const PylithScalar x1[size] = { 1.0, -2.0, 0.5, 3.0 };
+  const PylithScalar x2[size] = { 0.2, 0.4, -1.0, 0.0 };
+  const int numPrev = 2;
+
+  // Right-hand side is in the span of the previous right-hand sides,
+  // so the guess is the solution, x = 2*x1 - x2.
+  PylithScalar solutionE[size];
+  PylithScalar rhs[size];
+  for (int i=0; i < size; ++i) {
+    solutionE[i] = 2.0*x1[i] - x2[i];
+    rhs[i] = diag[i] * solutionE[i];
+  } // for
+
+  SolverLinear solver;
+  solver.initialGuess(SolverLinear::GUESS_PROJECT, numPrev);
+  _addHistory(&solver, x1, diag, size);
+  _addHistory(&solver, x2, diag, size);
+
+  PetscVec solutionVec = _createVec(rhs, size);
+  PetscVec rhsVec = _createVec(rhs, size);
+  PetscMat jacobianMat = _createDiagMat(diag, size);
+  PetscErrorCode err = 0;
+  const PylithScalar tolerance = 1.0e-10;
+
+  solver._formInitialGuess(solutionVec, rhsVec, jacobianMat, false);
+  const PetscScalar* solutionArray = NULL;
+  err = VecGetArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(solutionE[i], solutionArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+
+  // Right-hand sides in history are recomputed when the matrix changes.
+  for (int iPrev=0; iPrev < numPrev; ++iPrev) {
+    err = VecSet(solver._historyRhs[iPrev], 1.0);CPPUNIT_ASSERT(!err);
+  } // for
+  err = VecSet(solutionVec, 0.0);CPPUNIT_ASSERT(!err);
+  solver._formInitialGuess(solutionVec, rhsVec, jacobianMat, true);
+  err = VecGetArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(solutionE[i], solutionArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+
+  err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testGuessProject
+
+// ----------------------------------------------------------------------
+// Test _formInitialGuess() with projection and nearly linearly
+// dependent right-hand sides in the history.
+void
+pylith::problems::TestSolverLinear::testGuessProjectSingular(void)
+{ // testGuessProjectSingular
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 4;
+  const PylithScalar diag[size] = { 1.0, 1.0, 1.0, 1.0 };
+  const int numPrev = 4;
+  // x2 is nearly parallel to x1 and x4 is parallel to x3.
+  const PylithScalar x1[size] = { 1.0, 0.0, 0.0, 0.0 };
+  const PylithScalar x2[size] = { 1.0, 1.0e-7, 0.0, 0.0 };
+  const PylithScalar x3[size] = { 0.0, 1.0, 0.0, 0.0 };
+  const PylithScalar x4[size] = { 0.0, 2.0, 0.0, 0.0 };
+  const PylithScalar rhs[size] = { 1.0, 1.0, 0.0, 0.0 };
+
+  SolverLinear solver;
+  solver.initialGuess(SolverLinear::GUESS_PROJECT, numPrev);
+  _addHistory(&solver, x1, diag, size);
+  _addHistory(&solver, x2, diag, size);
+  _addHistory(&solver, x3, diag, size);
+  _addHistory(&solver, x4, diag, size);
+
+  PetscVec solutionVec = _createVec(rhs, size);
+  PetscVec rhsVec = _createVec(rhs, size);
+  PetscMat jacobianMat = _createDiagMat(diag, size);
+  PetscErrorCode err = VecSet(solutionVec, 0.0);CPPUNIT_ASSERT(!err);
+  solver._formInitialGuess(solutionVec, rhsVec, jacobianMat, false);
+
+  // Dropping the dependent directions must not lose the independent
+  // ones; the right-hand side is in the span of the history.
+  const PetscScalar* solutionArray = NULL;
+  err = VecGetArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+  const PylithScalar tolerance = 1.0e-6;
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(rhs[i], solutionArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(solutionVec, &solutionArray);CPPUNIT_ASSERT(!err);
+
+  err = VecDestroy(&solutionVec);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&rhsVec);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testGuessProjectSingular
+
+// ----------------------------------------------------------------------
+// Test useFactorization() and usingFactorization().
+void
+pylith::problems::TestSolverLinear::testUseFactorization(void)
+{ // testUseFactorization
+  PYLITH_METHOD_BEGIN;
+
+  SolverLinear solver;
+  CPPUNIT_ASSERT(!solver.usingFactorization());
+  CPPUNIT_ASSERT_EQUAL(0, solver.numFactorizations());
+
+  const PylithScalar maxMemory = 1.0e+6;
+  solver.useFactorization(true, maxMemory);
+  CPPUNIT_ASSERT(solver.usingFactorization());
+  CPPUNIT_ASSERT_EQUAL(maxMemory, solver._factorMaxMemory);
+
+  solver.useFactorization(false);
+  CPPUNIT_ASSERT(!solver.usingFactorization());
+
+  CPPUNIT_ASSERT_THROW(solver.useFactorization(true, -1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testUseFactorization
+
+// ----------------------------------------------------------------------
+// Test _estimateFactorMemory().
+void
+pylith::problems::TestSolverLinear::testEstimateFactorMemory(void)
+{ // testEstimateFactorMemory
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 100;
+  PetscMat jacobianMat = _createLaplacianMat(size);
+
+  SolverLinear solver;
+  PetscErrorCode err = KSPCreate(PETSC_COMM_SELF, &solver._kspFactor);CPPUNIT_ASSERT(!err);
+  err = KSPSetType(solver._kspFactor, KSPPREONLY);CPPUNIT_ASSERT(!err);
+  PetscPC pc = NULL;
+  err = KSPGetPC(solver._kspFactor, &pc);CPPUNIT_ASSERT(!err);
+
+  // Factors hold at least the nonzeros of the matrix.
+  const PylithScalar bytesMin = (3*size-2)*sizeof(PetscScalar);
+  err = PCSetType(pc, PCLU);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(solver._estimateFactorMemory(jacobianMat) >= bytesMin);
+
+  // No estimate for preconditioners that are not factorizations.
+  err = PCSetType(pc, PCJACOBI);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), solver._estimateFactorMemory(jacobianMat));
+
+  err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testEstimateFactorMemory
+
+// ----------------------------------------------------------------------
+// Test _setOperators() with maximum memory for factorization.
+void
+pylith::problems::TestSolverLinear::testFactorMaxMemory(void)
+{ // testFactorMaxMemory
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 100;
+  PetscMat jacobianMat = _createLaplacianMat(size);
+
+  SolverLinear solver;
+  solver._initializeLogger();
+  PetscErrorCode err = KSPCreate(PETSC_COMM_SELF, &solver._ksp);CPPUNIT_ASSERT(!err);
+
+  // Budget is too small, so the solver falls back to the iterative
+  // solver without doing the numeric factorization.
+  solver.useFactorization(true, 1.0);
+  PetscKSP ksp = solver._setOperators(jacobianMat, true);
+  CPPUNIT_ASSERT(ksp == solver._ksp);
+  CPPUNIT_ASSERT(!solver.usingFactorization());
+  CPPUNIT_ASSERT_EQUAL(0, solver.numFactorizations());
+  CPPUNIT_ASSERT(!solver._kspFactor);
+  CPPUNIT_ASSERT(solver.factorMemory() > 1.0);
+
+  // Budget is large enough.
+  solver.useFactorization(true, 1.0e+9);
+  ksp = solver._setOperators(jacobianMat, true);
+  CPPUNIT_ASSERT(ksp == solver._kspFactor);
+  CPPUNIT_ASSERT(solver.usingFactorization());
+  CPPUNIT_ASSERT_EQUAL(1, solver.numFactorizations());
+  CPPUNIT_ASSERT(solver.factorMemory() > 0.0);
+
+  // Factorization is reused if matrix did not change.
+  ksp = solver._setOperators(jacobianMat, false);
+  CPPUNIT_ASSERT(ksp == solver._kspFactor);
+  CPPUNIT_ASSERT_EQUAL(1, solver.numFactorizations());
+
+  err = MatDestroy(&jacobianMat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testFactorMaxMemory
+
+// ----------------------------------------------------------------------
+// Create tridiagonal matrix (1-D Laplacian).
+PetscMat
+pylith::problems::TestSolverLinear::_createLaplacianMat(const int size) const
+{ // _createLaplacianMat
+  PYLITH_METHOD_BEGIN;
+
+  PetscMat mat = NULL;
+  PetscErrorCode err = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 3, NULL, &mat);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    if (i > 0) {
+      err = MatSetValue(mat, i, i-1, -1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    } // if
+    err = MatSetValue(mat, i, i, 2.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    if (i+1 < size) {
+      err = MatSetValue(mat, i, i+1, -1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    } // if
+  } // for
+  err = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_RETURN(mat);
+} // _createLaplacianMat
+
+// ----------------------------------------------------------------------
+// Create vector.
+PetscVec
+pylith::problems::TestSolverLinear::_createVec(const PylithScalar* values,
+					       const int size) const
+{ // _createVec
+  PYLITH_METHOD_BEGIN;
+
+  PetscVec vec = NULL;
+  PetscErrorCode err = VecCreateSeq(PETSC_COMM_SELF, size, &vec);CPPUNIT_ASSERT(!err);
+  PetscScalar* array = NULL;
+  err = VecGetArray(vec, &array);CPPUNIT_ASSERT(!err);
+  for (int i=0; i < size; ++i) {
+    array[i] = values[i];
+  } // for
+  err = VecRestoreArray(vec, &array);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_RETURN(vec);
+} // _createVec
+
+// ----------------------------------------------------------------------
+// Create diagonal matrix.
+PetscMat
+pylith::problems::TestSolverLinear::_createDiagMat(const PylithScalar* values,
+						   const int size) const
+{ // _createDiagMat
+  PYLITH_METHOD_BEGIN;
+
+  PetscMat mat = NULL;
+  PetscErrorCode err = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 1, NULL, &mat);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    err = MatSetValue(mat, i, i, values[i], INSERT_VALUES);CPPUNIT_ASSERT(!err);
+  } // for
+  err = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_RETURN(mat);
+} // _createDiagMat
+
+// ----------------------------------------------------------------------
+// Add solution and right-hand side to history of solver.
+void
+pylith::problems::TestSolverLinear::_addHistory(SolverLinear* solver,
+						const PylithScalar* solution,
+						const PylithScalar* diag,
+						const int size) const
+{ // _addHistory
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(solver);
+
+  PylithScalar rhs[64];
+  CPPUNIT_ASSERT(size <= 64);
+  for (int i=0; i < size; ++i) {
+    rhs[i] = diag[i] * solution[i];
+  } // for
+  solver->_historySolns.push_back(_createVec(solution, size));
+  solver->_historyRhs.push_back(_createVec(rhs, size));
+
+  PYLITH_METHOD_END;
+} // _addHistory
+
+
+// End of file 
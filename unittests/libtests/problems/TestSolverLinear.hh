@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolverLinear.hh
+ *
+ * @brief C++ TestSolverLinear object.
+ * 
+ * C++ unit testing for SolverLinear.
+ */
+
+#if !defined(pylith_problems_testsolverlinear_hh)
+#define pylith_problems_testsolverlinear_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // forward declarations
+#include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolverLinear;
+  } // problems
+} // pylith
+
+/// C++ unit testing for SolverLinear.
+class pylith::problems::TestSolverLinear : public CppUnit::TestFixture
+{ // class TestSolverLinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolverLinear );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testInitialGuess );
+  CPPUNIT_TEST( testGuessExtrapolate );
+  CPPUNIT_TEST( testGuessProject );
+  CPPUNIT_TEST( testGuessProjectSingular );
+  CPPUNIT_TEST( testUseFactorization );
+  CPPUNIT_TEST( testEstimateFactorMemory );
+  CPPUNIT_TEST( testFactorMaxMemory );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test initialGuess().
+  void testInitialGuess(void);
+
+  /// Test _formInitialGuess() with extrapolation.
+  void testGuessExtrapolate(void);
+
+  /// Test _formInitialGuess() with projection.
+  void testGuessProject(void);
+
+  /// Test _formInitialGuess() with projection and nearly linearly
+  /// dependent right-hand sides in the history.
+  void testGuessProjectSingular(void);
+
+  /// Test useFactorization() and usingFactorization().
+  void testUseFactorization(void);
+
+  /// Test _estimateFactorMemory().
+  void testEstimateFactorMemory(void);
+
+  /// Test _setOperators() with maximum memory for factorization.
+  void testFactorMaxMemory(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Create vector.
+   *
+   * @param values Array of values.
+   * @param size Number of values.
+   * @returns PETSc vector (caller is responsible for destroying it).
+   */
+  PetscVec _createVec(const PylithScalar* values,
+		      const int size) const;
+
+  /** Create diagonal matrix.
+   *
+   * @param values Array of diagonal values.
+   * @param size Number of rows.
+   * @returns PETSc matrix (caller is responsible for destroying it).
+   */
+  PetscMat _createDiagMat(const PylithScalar* values,
+			  const int size) const;
+
+  /** Create tridiagonal matrix (1-D Laplacian).
+   *
+   * @param size Number of rows.
+   * @returns PETSc matrix (caller is responsible for destroying it).
+   */
+  PetscMat _createLaplacianMat(const int size) const;
+
+  /** Add solution and right-hand side, A x, to history of solver.
+   *
+   * @param solver Linear solver.
+   * @param solution Array of solution values.
+   * @param diag Array of diagonal values of A.
+   * @param size Number of values.
+   */
+  void _addHistory(SolverLinear* solver,
+		   const PylithScalar* solution,
+		   const PylithScalar* diag,
+		   const int size) const;
+
+}; // class TestSolverLinear
+
+#endif // pylith_problems_testsolverlinear_hh
+
+
+// End of file 
@@ -0,0 +1,313 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolverNonlinear.hh" // Implementation of class methods
+
+#include "pylith/problems/SolverNonlinear.hh" // USES SolverNonlinear
+
+#include "pylith/problems/Implicit.hh" // USES Implicit
+#include "pylith/feassemble/ElasticityImplicit.hh" // USES ElasticityImplicit
+#include "pylith/materials/PowerLaw3D.hh" // USES PowerLaw3D
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <petsc/private/snesimpl.h> // USES numbermonitors
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolverNonlinear );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestSolverNonlinear::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test lagJacobian().
+void
+pylith::problems::TestSolverNonlinear::testLagJacobian(void)
+{ // testLagJacobian
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+  CPPUNIT_ASSERT_EQUAL(0, solver._maxLag);
+
+  const PylithScalar tolerance = 1.0e-12;
+  solver.lagJacobian(3, 0.25, 0.1);
+  CPPUNIT_ASSERT_EQUAL(3, solver._maxLag);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.25, solver._lagConvergenceThreshold, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.1, solver._lagStiffnessThreshold, tolerance);
+
+  CPPUNIT_ASSERT_THROW(solver.lagJacobian(-1, 0.5, 0.2), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(solver.lagJacobian(1, 0.0, 0.2), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(solver.lagJacobian(1, 1.5, 0.2), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(solver.lagJacobian(1, 0.5, -0.1), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testLagJacobian
+
+// ----------------------------------------------------------------------
+// Test _reuseJacobian().
+void
+pylith::problems::TestSolverNonlinear::testReuseJacobian(void)
+{ // testReuseJacobian
+  PYLITH_METHOD_BEGIN;
+
+  // Formulation without integrators does not report a change in stiffness.
+  Implicit formulation;
+  SolverNonlinear solver;
+  solver._formulation = &formulation;
+
+  PetscSNES snes = NULL;
+  PetscErrorCode err = SNESCreate(PETSC_COMM_WORLD, &snes);CPPUNIT_ASSERT(!err);
+
+  // No lagging.
+  solver._jacobianAge = 0;
+  CPPUNIT_ASSERT(!solver._reuseJacobian(snes));
+
+  solver.lagJacobian(2, 0.5, 0.2);
+
+  // Jacobian not formed yet.
+  solver._jacobianAge = -1;
+  CPPUNIT_ASSERT(!solver._reuseJacobian(snes));
+
+  // Reuse until Jacobian reaches maximum lag.
+  solver._jacobianAge = 0;
+  CPPUNIT_ASSERT(solver._reuseJacobian(snes));
+  CPPUNIT_ASSERT_EQUAL(1, solver._jacobianAge);
+  CPPUNIT_ASSERT(solver._reuseJacobian(snes));
+  CPPUNIT_ASSERT_EQUAL(2, solver._jacobianAge);
+  CPPUNIT_ASSERT(!solver._reuseJacobian(snes));
+  CPPUNIT_ASSERT_EQUAL(2, solver._jacobianAge);
+
+  // Retry after failed solve reforms Jacobian in every iteration.
+  solver._jacobianAge = 0;
+  solver._forceJacobian = true;
+  CPPUNIT_ASSERT(!solver._reuseJacobian(snes));
+  solver._forceJacobian = false;
+
+  err = SNESDestroy(&snes);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testReuseJacobian
+
+// ----------------------------------------------------------------------
+// Test expireJacobian() and resetJacobianAge().
+void
+pylith::problems::TestSolverNonlinear::testExpireJacobian(void)
+{ // testExpireJacobian
+  PYLITH_METHOD_BEGIN;
+
+  Implicit formulation;
+  SolverNonlinear solver;
+  solver._formulation = &formulation;
+  solver.lagJacobian(4, 0.5, 0.2);
+
+  PetscSNES snes = NULL;
+  PetscErrorCode err = SNESCreate(PETSC_COMM_WORLD, &snes);CPPUNIT_ASSERT(!err);
+
+  // Integrators need a new Jacobian, so a lagged Jacobian must not be reused.
+  solver._jacobianAge = 1;
+  solver.expireJacobian();
+  CPPUNIT_ASSERT_EQUAL(-1, solver._jacobianAge);
+  CPPUNIT_ASSERT(!solver._reuseJacobian(snes));
+
+  // Jacobian reformed by the formulation before the solve can be reused.
+  solver._jacobianAge = 3;
+  solver.resetJacobianAge();
+  CPPUNIT_ASSERT_EQUAL(0, solver._jacobianAge);
+  CPPUNIT_ASSERT(solver._reuseJacobian(snes));
+  CPPUNIT_ASSERT_EQUAL(1, solver._jacobianAge);
+
+  err = SNESDestroy(&snes);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testExpireJacobian
+
+// ----------------------------------------------------------------------
+// Test _reuseJacobian() with power-law material.
+void
+pylith::problems::TestSolverNonlinear::testReuseJacobianPowerLaw(void)
+{ // testReuseJacobianPowerLaw
+  PYLITH_METHOD_BEGIN;
+
+  materials::PowerLaw3D material;
+  feassemble::ElasticityImplicit integrator;
+  integrator.material(&material);
+  feassemble::Integrator* integrators[1] = { &integrator };
+
+  Implicit formulation;
+  formulation.integrators(integrators, 1);
+  SolverNonlinear solver;
+  solver._formulation = &formulation;
+  solver.lagJacobian(4, 0.5, 0.2);
+
+  PetscSNES snes = NULL;
+  PetscErrorCode err = SNESCreate(PETSC_COMM_WORLD, &snes);CPPUNIT_ASSERT(!err);
+
+  // Power-law material requests a new Jacobian every time step, but
+  // the Jacobian is reused while the change in stiffness is small.
+  solver._jacobianAge = 0;
+  const PylithScalar dt = 1.0;
+  const int numSteps = 3;
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    integrator.timeStep(dt);
+    CPPUNIT_ASSERT(integrator.needNewJacobian());
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(0.0), formulation.stiffnessChange());
+    CPPUNIT_ASSERT(solver._reuseJacobian(snes));
+    CPPUNIT_ASSERT_EQUAL(iStep+1, solver._jacobianAge);
+  } // for
+
+  err = SNESDestroy(&snes);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testReuseJacobianPowerLaw
+
+// ----------------------------------------------------------------------
+// Test _monitorLag().
+void
+pylith::problems::TestSolverNonlinear::testMonitorLag(void)
+{ // testMonitorLag
+  PYLITH_METHOD_BEGIN;
+
+  SolverNonlinear solver;
+
+  const PylithScalar tolerance = 1.0e-12;
+  PetscErrorCode err = SolverNonlinear::_monitorLag(NULL, 0, 2.0, (void*) &solver);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, solver._fnormPrev, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, solver._fnormCur, tolerance);
+
+  err = SolverNonlinear::_monitorLag(NULL, 1, 0.5, (void*) &solver);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.0, solver._fnormPrev, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5, solver._fnormCur, tolerance);
+
+  // First iteration of next solve discards norms from previous solve.
+  err = SolverNonlinear::_monitorLag(NULL, 0, 3.0, (void*) &solver);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.0, solver._fnormPrev, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(3.0, solver._fnormCur, tolerance);
+
+  PYLITH_METHOD_END;
+} // testMonitorLag
+
+// ----------------------------------------------------------------------
+// Test _lineSearchNeedsResidual().
+void
+pylith::problems::TestSolverNonlinear::testLineSearchNeedsResidual(void)
+{ // testLineSearchNeedsResidual
+  PYLITH_METHOD_BEGIN;
+
+  // Residual from last trial step is consistent with accepted step.
+  CPPUNIT_ASSERT(!SolverNonlinear::_lineSearchNeedsResidual(false, false, false, false));
+
+  // Any change to the accepted step requires a new residual.
+  CPPUNIT_ASSERT(SolverNonlinear::_lineSearchNeedsResidual(true, false, false, false));
+  CPPUNIT_ASSERT(SolverNonlinear::_lineSearchNeedsResidual(false, true, false, false));
+  CPPUNIT_ASSERT(SolverNonlinear::_lineSearchNeedsResidual(false, false, true, false));
+  CPPUNIT_ASSERT(SolverNonlinear::_lineSearchNeedsResidual(false, false, false, true));
+  CPPUNIT_ASSERT(SolverNonlinear::_lineSearchNeedsResidual(true, true, true, true));
+
+  PYLITH_METHOD_END;
+} // testLineSearchNeedsResidual
+
+// ----------------------------------------------------------------------
+// Test initialize().
+void
+pylith::problems::TestSolverNonlinear::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+
+  topology::Jacobian jacobian(fields.solution());
+
+  Implicit formulation;
+  SolverNonlinear solver;
+  solver.skipNullSpaceCreation(true);
+  solver.lagJacobian(2, 0.5, 0.2);
+
+  // Reinitializing must not stack monitors.
+  for (int i=0; i < 2; ++i) {
+    solver._jacobianAge = 1;
+    solver.initialize(fields, jacobian, &formulation);
+    CPPUNIT_ASSERT(solver._snes);
+    CPPUNIT_ASSERT_EQUAL(PetscInt(1), solver._snes->numbermonitors);
+    CPPUNIT_ASSERT_EQUAL(-1, solver._jacobianAge);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Initialize mesh and solution fields.
+void
+pylith::problems::TestSolverNonlinear::_initialize(topology::Mesh* mesh,
+						   topology::SolutionFields* fields) const
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(fields);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  fields->add("residual", "residual");
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->solutionName("dispIncr(t->t+dt)");
+
+  const int spaceDim = mesh->dimension();
+  topology::Field& residual = fields->get("residual");
+  residual.subfieldAdd("displacement", spaceDim, topology::Field::VECTOR);
+  residual.subfieldsSetup();
+  residual.setupSolnChart();
+  residual.setupSolnDof(spaceDim);
+  residual.allocate();
+  residual.zeroAll();
+
+  fields->copyLayout("residual");
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+
+// End of file 
@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolverNonlinear.hh
+ *
+ * @brief C++ TestSolverNonlinear object.
+ * 
+ * C++ unit testing for SolverNonlinear.
+ */
+
+#if !defined(pylith_problems_testsolvernonlinear_hh)
+#define pylith_problems_testsolvernonlinear_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/problems/problemsfwd.hh" // forward declarations
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolverNonlinear;
+  } // problems
+} // pylith
+
+/// C++ unit testing for SolverNonlinear.
+class pylith::problems::TestSolverNonlinear : public CppUnit::TestFixture
+{ // class TestSolverNonlinear
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolverNonlinear );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testLagJacobian );
+  CPPUNIT_TEST( testReuseJacobian );
+  CPPUNIT_TEST( testReuseJacobianPowerLaw );
+  CPPUNIT_TEST( testExpireJacobian );
+  CPPUNIT_TEST( testMonitorLag );
+  CPPUNIT_TEST( testLineSearchNeedsResidual );
+  CPPUNIT_TEST( testInitialize );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test lagJacobian().
+  void testLagJacobian(void);
+
+  /// Test _reuseJacobian().
+  void testReuseJacobian(void);
+
+  /// Test _reuseJacobian() with power-law material.
+  void testReuseJacobianPowerLaw(void);
+
+  /// Test expireJacobian() and resetJacobianAge().
+  void testExpireJacobian(void);
+
+  /// Test _monitorLag().
+  void testMonitorLag(void);
+
+  /// Test _lineSearchNeedsResidual().
+  void testLineSearchNeedsResidual(void);
+
+  /// Test initialize().
+  void testInitialize(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh and solution fields.
+   *
+   * @param mesh Finite-element mesh.
+   * @param fields Solution fields.
+   */
+  void _initialize(topology::Mesh* mesh,
+		   topology::SolutionFields* fields) const;
+
+}; // class TestSolverNonlinear
+
+#endif // pylith_problems_testsolvernonlinear_hh
+
+
+// End of file 
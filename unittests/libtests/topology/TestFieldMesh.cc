@@ -30,6 +30,8 @@
 
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
+#include <stdexcept> // USES std::runtime_error
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestFieldMesh );
 
@@ -507,6 +509,20 @@ pylith::topology::TestFieldMesh::testCloneSection(void)
   err = PetscObjectGetName((PetscObject) vec, &name);PYLITH_CHECK_ERROR(err);
   CPPUNIT_ASSERT_EQUAL(label, std::string(name));
 
+  // Verify layout is shared until it is changed.
+  CPPUNIT_ASSERT_EQUAL(fieldSrc.dmMesh(), field.dmMesh());
+  CPPUNIT_ASSERT_EQUAL(fieldSrc.localSection(), field.localSection());
+  field.newSection(Field::VERTICES_FIELD, fiberDim+1);
+  CPPUNIT_ASSERT(fieldSrc.dmMesh() != field.dmMesh());
+  section = fieldSrc.localSection();
+  for(PetscInt v = vStart, iV = 0; v < vEnd; ++v) {
+    PetscInt dof, cdof;
+    err = PetscSectionGetDof(section, v, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetConstraintDof(section, v, &cdof);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(fiberDim, dof);
+    CPPUNIT_ASSERT_EQUAL(nconstraints[iV++], cdof);
+  } // for
+
   PYLITH_METHOD_END;
 } // testCloneSection
 
@@ -990,6 +1006,96 @@ pylith::topology::TestFieldMesh::testOperatorAdd(void)
   PYLITH_METHOD_END;
 } // testOperateAdd
 
+// ----------------------------------------------------------------------
+// Test swapValues().
+void
+pylith::topology::TestFieldMesh::testSwapValues(void)
+{ // testSwapValues
+  PYLITH_METHOD_BEGIN;
+
+  const int fiberDim = 3;
+  const PylithScalar valuesA[] = {
+    1.1, 2.2, 3.3,
+    1.2, 2.3, 3.4,
+    1.3, 2.4, 3.5,
+    1.4, 2.5, 3.6,
+  };
+  const PylithScalar valuesB[] = {
+    10.1, 20.2, 30.3,
+    10.2, 20.3, 30.4,
+    10.3, 20.4, 30.5,
+    10.4, 20.5, 30.6,
+  };
+
+  Mesh mesh;
+  _buildMesh(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum depthStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt vStart = depthStratum.begin();
+  const PetscInt vEnd = depthStratum.end();
+
+  Field fieldA(mesh);
+  fieldA.label("field A");
+  fieldA.newSection(Field::VERTICES_FIELD, fiberDim);
+  fieldA.allocate();
+  Field fieldB(mesh);
+  fieldB.label("field B");
+  fieldB.cloneSection(fieldA);
+  { // Setup fields
+    VecVisitorMesh visitorA(fieldA);
+    PetscScalar* arrayA = visitorA.localArray();
+    VecVisitorMesh visitorB(fieldB);
+    PetscScalar* arrayB = visitorB.localArray();
+    for(PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+      const PetscInt offA = visitorA.sectionOffset(v);
+      const PetscInt offB = visitorB.sectionOffset(v);
+      for(PetscInt d = 0; d < fiberDim; ++d, ++i) {
+	arrayA[offA+d] = valuesA[i];
+	arrayB[offB+d] = valuesB[i];
+      } // for
+    } // for
+  } // Setup fields
+  fieldA.createScatter(mesh);
+  fieldB.createScatter(mesh);
+  const PetscVec localVecA = fieldA.localVector();
+  const PetscVec localVecB = fieldB.localVector();
+
+  fieldA.swapValues(fieldB);
+
+  // Scatter vectors sharing the global vector follow it.
+  CPPUNIT_ASSERT(fieldA.vector() == fieldA.globalVector());
+  CPPUNIT_ASSERT(fieldB.vector() == fieldB.globalVector());
+
+  // Vectors are exchanged, not copied.
+  CPPUNIT_ASSERT(localVecB == fieldA.localVector());
+  CPPUNIT_ASSERT(localVecA == fieldB.localVector());
+  CPPUNIT_ASSERT_EQUAL(std::string("field A"), std::string(fieldA.label()));
+  CPPUNIT_ASSERT_EQUAL(std::string("field B"), std::string(fieldB.label()));
+
+  VecVisitorMesh visitorA(fieldA);
+  const PetscScalar* arrayA = visitorA.localArray();
+  VecVisitorMesh visitorB(fieldB);
+  const PetscScalar* arrayB = visitorB.localArray();
+  const PylithScalar tolerance = 1.0e-6;
+  for(PetscInt v = vStart, i = 0; v < vEnd; ++v) {
+    const PetscInt offA = visitorA.sectionOffset(v);
+    const PetscInt offB = visitorB.sectionOffset(v);
+    for(PetscInt d = 0; d < fiberDim; ++d, ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesB[i], arrayA[offA+d], tolerance);
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(valuesA[i], arrayB[offB+d], tolerance);
+    } // for
+  } // for
+
+  // Incompatible layout
+  Field fieldC(mesh);
+  fieldC.newSection(Field::VERTICES_FIELD, fiberDim-1);
+  fieldC.allocate();
+  CPPUNIT_ASSERT_THROW(fieldA.swapValues(fieldC), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testSwapValues
+
 // ----------------------------------------------------------------------
 // Test dimensionalize().
 void
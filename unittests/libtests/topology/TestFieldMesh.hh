@@ -69,6 +69,7 @@ class pylith::topology::TestFieldMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testCopy );
   CPPUNIT_TEST( testCopySubfield );
   CPPUNIT_TEST( testOperatorAdd );
+  CPPUNIT_TEST( testSwapValues );
   CPPUNIT_TEST( testDimensionalize );
   CPPUNIT_TEST( testView );
   CPPUNIT_TEST( testCreateScatter );
@@ -156,6 +157,9 @@ public :
   /// Test operator+=().
   void testOperatorAdd(void);
 
+  /// Test swapValues().
+  void testSwapValues(void);
+
   /// Test dimensionalize().
   void testDimensionalize(void);
 
@@ -28,6 +28,8 @@
 
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 
+#include <cstdio> // USES std::remove()
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestJacobian );
 
@@ -171,6 +173,66 @@ pylith::topology::TestJacobian::testWrite(void)
   PYLITH_METHOD_END;
 } // testWrite
 
+// ----------------------------------------------------------------------
+// Test constructor with cache of nonzero pattern.
+void
+pylith::topology::TestJacobian::testPatternCache(void)
+{ // testPatternCache
+  PYLITH_METHOD_BEGIN;
+
+  const char* cacheFilename = "jacobian_pattern";
+  std::remove("jacobian_pattern.0");
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  _initializeField(&mesh, &field);
+
+  // No cache, compute pattern and write cache.
+  Jacobian jacobianA(field, "aij", false, cacheFilename);
+  CPPUNIT_ASSERT(!jacobianA.patternFromCache());
+  CPPUNIT_ASSERT(jacobianA.patternSaved());
+
+  // Create matrix from cache.
+  Jacobian jacobianB(field, "aij", false, cacheFilename);
+  CPPUNIT_ASSERT(jacobianB.patternFromCache());
+  CPPUNIT_ASSERT(!jacobianB.patternSaved());
+
+  PetscErrorCode err;
+  const PetscMat matA = jacobianA.matrix();
+  const PetscMat matB = jacobianB.matrix();
+  PetscInt rStartA = 0, rEndA = 0, rStartB = 0, rEndB = 0;
+  err = MatGetOwnershipRange(matA, &rStartA, &rEndA);CPPUNIT_ASSERT(!err);
+  err = MatGetOwnershipRange(matB, &rStartB, &rEndB);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(rStartA, rStartB);
+  CPPUNIT_ASSERT_EQUAL(rEndA, rEndB);
+  for (PetscInt r=rStartA; r < rEndA; ++r) {
+    PetscInt numColsA = 0, numColsB = 0;
+    const PetscInt *colsA = NULL, *colsB = NULL;
+    err = MatGetRow(matA, r, &numColsA, &colsA, NULL);CPPUNIT_ASSERT(!err);
+    err = MatGetRow(matB, r, &numColsB, &colsB, NULL);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(numColsA, numColsB);
+    for (PetscInt i=0; i < numColsA; ++i) {
+      CPPUNIT_ASSERT_EQUAL(colsA[i], colsB[i]);
+    } // for
+    err = MatRestoreRow(matA, r, &numColsA, &colsA, NULL);CPPUNIT_ASSERT(!err);
+    err = MatRestoreRow(matB, r, &numColsB, &colsB, NULL);CPPUNIT_ASSERT(!err);
+  } // for
+  jacobianB.zero();
+  jacobianB.assemble("final_assembly");
+
+  // Layout does not match cache.
+  Field fieldC(mesh);
+  fieldC.newSection(FieldBase::VERTICES_FIELD, 1);
+  fieldC.allocate();
+  fieldC.zero();
+  Jacobian jacobianC(fieldC, "aij", false, cacheFilename);
+  CPPUNIT_ASSERT(!jacobianC.patternFromCache());
+  CPPUNIT_ASSERT(jacobianC.patternSaved());
+
+  PYLITH_METHOD_END;
+} // testPatternCache
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestJacobian::_initializeMesh(Mesh* mesh) const
@@ -52,6 +52,7 @@ class pylith::topology::TestJacobian : public CppUnit::TestFixture
   CPPUNIT_TEST( testZero );
   CPPUNIT_TEST( testView );
   CPPUNIT_TEST( testWrite );
+  CPPUNIT_TEST( testPatternCache );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -79,6 +80,9 @@ public :
   /// Test write().
   void testWrite(void);
 
+  /// Test constructor with cache of nonzero pattern.
+  void testPatternCache(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
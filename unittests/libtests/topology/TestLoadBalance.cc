@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestLoadBalance.hh" // Implementation of class methods
+
+#include "pylith/topology/LoadBalance.hh" // USES LoadBalance
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/meshio/DataWriterVTK.hh" // USES DataWriterVTK
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestLoadBalance );
+
+// ----------------------------------------------------------------------
+// Test numGhostPoints() and numGhostDof().
+void
+pylith::topology::TestLoadBalance::testGhosts(void)
+{ // testGhosts
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+
+  Field field(mesh);
+  CPPUNIT_ASSERT_EQUAL(0, LoadBalance::numGhostPoints(field));
+  CPPUNIT_ASSERT_EQUAL(0, LoadBalance::numGhostDof(field));
+
+  // Mesh is not distributed, so all points are owned by this process.
+  field.newSection(FieldBase::VERTICES_FIELD, mesh.dimension());
+  field.allocate();
+  CPPUNIT_ASSERT_EQUAL(0, LoadBalance::numGhostPoints(field));
+  CPPUNIT_ASSERT_EQUAL(0, LoadBalance::numGhostDof(field));
+
+  PYLITH_METHOD_END;
+} // testGhosts
+
+// ----------------------------------------------------------------------
+// Test numMessages() and messageBytes().
+void
+pylith::topology::TestLoadBalance::testMessages(void)
+{ // testMessages
+  PYLITH_METHOD_BEGIN;
+
+  const double numMessages = LoadBalance::numMessages();
+  const double messageBytes = LoadBalance::messageBytes();
+  CPPUNIT_ASSERT(numMessages >= 0.0);
+  CPPUNIT_ASSERT(messageBytes >= 0.0);
+
+  // Counters are cumulative.
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  CPPUNIT_ASSERT(LoadBalance::numMessages() >= numMessages);
+  CPPUNIT_ASSERT(LoadBalance::messageBytes() >= messageBytes);
+
+  PYLITH_METHOD_END;
+} // testMessages
+
+// ----------------------------------------------------------------------
+// Test write().
+void
+pylith::topology::TestLoadBalance::testWrite(void)
+{ // testWrite
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+
+  meshio::DataWriterVTK writer;
+  writer.filename("loadbalance.vtk");
+  writer.timeFormat("%3.1f");
+
+  const PylithScalar computeTime = 2.0;
+  const PylithScalar messageBytes = 0.0;
+  LoadBalance::write(&writer, mesh, computeTime, messageBytes);
+
+  PYLITH_METHOD_END;
+} // testWrite
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestLoadBalance::_initializeMesh(Mesh* mesh) const
+{ // _initializeMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(mesh->dimension());
+  mesh->coordsys(&cs);
+
+  PYLITH_METHOD_END;
+} // _initializeMesh
+
+
+// End of file 
@@ -0,0 +1,80 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestLoadBalance.hh
+ *
+ * @brief C++ TestLoadBalance object.
+ * 
+ * C++ unit testing for LoadBalance.
+ */
+
+#if !defined(pylith_topology_testloadbalance_hh)
+#define pylith_topology_testloadbalance_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestLoadBalance;
+  } // topology
+} // pylith
+
+/// C++ unit testing for LoadBalance.
+class pylith::topology::TestLoadBalance : public CppUnit::TestFixture
+{ // class TestLoadBalance
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestLoadBalance );
+
+  CPPUNIT_TEST( testGhosts );
+  CPPUNIT_TEST( testMessages );
+  CPPUNIT_TEST( testWrite );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test numGhostPoints() and numGhostDof().
+  void testGhosts(void);
+
+  /// Test numMessages() and messageBytes().
+  void testMessages(void);
+
+  /// Test write().
+  void testWrite(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _initializeMesh(Mesh* mesh) const;
+
+}; // class TestLoadBalance
+
+#endif // pylith_topology_testloadbalance_hh
+
+
+// End of file 
@@ -0,0 +1,158 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMemoryUsage.hh" // Implementation of class methods
+
+#include "pylith/topology/MemoryUsage.hh" // USES MemoryUsage
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestMemoryUsage );
+
+// ----------------------------------------------------------------------
+// Test mesh().
+void
+pylith::topology::TestMemoryUsage::testMesh(void)
+{ // testMesh
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const size_t numVertices = verticesStratum.size();
+  const size_t numCells = cellsStratum.size();
+  const size_t numCorners = mesh.numCorners();
+  const size_t spaceDim = mesh.dimension(); // 2-D mesh in 2-D space
+
+  // Lower bound from coordinates and cones of the cells.
+  const size_t bytesE = numVertices*spaceDim*sizeof(PetscScalar) + numCells*numCorners*sizeof(PetscInt);
+  const size_t bytes = MemoryUsage::mesh(mesh);
+  CPPUNIT_ASSERT(bytes >= bytesE);
+  CPPUNIT_ASSERT_EQUAL(bytes, MemoryUsage::dmPlex(dmMesh));
+
+  PYLITH_METHOD_END;
+} // testMesh
+
+// ----------------------------------------------------------------------
+// Test field().
+void
+pylith::topology::TestMemoryUsage::testField(void)
+{ // testField
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  const int fiberDim = mesh.dimension();
+  const size_t numVertices = Stratum(mesh.dmMesh(), Stratum::DEPTH, 0).size();
+
+  Field field(mesh);
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryUsage::field(field));
+
+  // Local and global vectors and sections.
+  field.newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  field.allocate();
+  const size_t bytesVectors = 2*numVertices*fiberDim*sizeof(PetscScalar);
+  const size_t bytesField = MemoryUsage::field(field);
+  CPPUNIT_ASSERT(bytesField >= bytesVectors + numVertices*2*sizeof(PetscInt));
+
+  // Scatters without constraints reuse the global vector.
+  field.createScatter(mesh);
+  field.createScatter(mesh, "A");
+  CPPUNIT_ASSERT_EQUAL(bytesField, MemoryUsage::field(field));
+
+  // Clone shares the sections with the source field, so only its
+  // vectors are counted.
+  Field fieldClone(mesh);
+  fieldClone.cloneSection(field);
+  CPPUNIT_ASSERT_EQUAL(bytesField, MemoryUsage::field(field));
+  CPPUNIT_ASSERT_EQUAL(bytesVectors, MemoryUsage::field(fieldClone));
+
+  // Clone takes over shared sections when source field gets its own layout.
+  field.newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  CPPUNIT_ASSERT_EQUAL(bytesField, MemoryUsage::field(fieldClone));
+
+  PYLITH_METHOD_END;
+} // testField
+
+// ----------------------------------------------------------------------
+// Test jacobian().
+void
+pylith::topology::TestMemoryUsage::testJacobian(void)
+{ // testJacobian
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initializeMesh(&mesh);
+  Field field(mesh);
+  field.newSection(FieldBase::VERTICES_FIELD, mesh.dimension());
+  field.allocate();
+  field.zero();
+  Jacobian jacobian(field);
+
+  PetscErrorCode err;
+  MatInfo info;
+  err = MatGetInfo(jacobian.matrix(), MAT_LOCAL, &info);CPPUNIT_ASSERT(!err);
+  const size_t bytesE = size_t(info.nz_allocated)*(sizeof(PetscScalar)+sizeof(PetscInt));
+  CPPUNIT_ASSERT(bytesE > 0);
+  CPPUNIT_ASSERT(MemoryUsage::jacobian(jacobian) >= bytesE);
+
+  PYLITH_METHOD_END;
+} // testJacobian
+
+// ----------------------------------------------------------------------
+// Test section(), vector(), matrix(), and dmPlex() with null objects.
+void
+pylith::topology::TestMemoryUsage::testNull(void)
+{ // testNull
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryUsage::section(NULL));
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryUsage::vector(NULL));
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryUsage::matrix(NULL));
+  CPPUNIT_ASSERT_EQUAL(size_t(0), MemoryUsage::dmPlex(NULL));
+
+  PYLITH_METHOD_END;
+} // testNull
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestMemoryUsage::_initializeMesh(Mesh* mesh) const
+{ // _initializeMesh
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(mesh);
+
+  PYLITH_METHOD_END;
+} // _initializeMesh
+
+
+// End of file 
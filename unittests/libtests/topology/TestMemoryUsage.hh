@@ -0,0 +1,84 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestMemoryUsage.hh
+ *
+ * @brief C++ TestMemoryUsage object.
+ * 
+ * C++ unit testing for MemoryUsage.
+ */
+
+#if !defined(pylith_topology_testmemoryusage_hh)
+#define pylith_topology_testmemoryusage_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // forward declarations
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestMemoryUsage;
+  } // topology
+} // pylith
+
+/// C++ unit testing for MemoryUsage.
+class pylith::topology::TestMemoryUsage : public CppUnit::TestFixture
+{ // class TestMemoryUsage
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMemoryUsage );
+
+  CPPUNIT_TEST( testMesh );
+  CPPUNIT_TEST( testField );
+  CPPUNIT_TEST( testJacobian );
+  CPPUNIT_TEST( testNull );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test mesh().
+  void testMesh(void);
+
+  /// Test field().
+  void testField(void);
+
+  /// Test jacobian().
+  void testJacobian(void);
+
+  /// Test section(), vector(), matrix(), and dmPlex() with null objects.
+  void testNull(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Initialize mesh.
+   *
+   * @param mesh Finite-element mesh.
+   */
+  void _initializeMesh(Mesh* mesh) const;
+
+}; // class TestMemoryUsage
+
+#endif // pylith_topology_testmemoryusage_hh
+
+
+// End of file 
@@ -117,6 +117,22 @@ pylith::topology::TestMesh::testDebug(void)
   PYLITH_METHOD_END;
 } // testDebug
 
+// ----------------------------------------------------------------------
+// Test topologyCheck().
+void
+pylith::topology::TestMesh::testTopologyCheck(void)
+{ // testTopologyCheck
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  CPPUNIT_ASSERT_EQUAL(MeshOps::CHECK_FULL, mesh.topologyCheck());
+
+  mesh.topologyCheck(MeshOps::CHECK_OFF);
+  CPPUNIT_ASSERT_EQUAL(MeshOps::CHECK_OFF, mesh.topologyCheck());
+
+  PYLITH_METHOD_END;
+} // testTopologyCheck
+
 // ----------------------------------------------------------------------
 // Test dimension().
 void
@@ -50,6 +50,7 @@ class pylith::topology::TestMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testDMMesh );
   CPPUNIT_TEST( testCoordsys );
   CPPUNIT_TEST( testDebug );
+  CPPUNIT_TEST( testTopologyCheck );
   CPPUNIT_TEST( testDimension );
   CPPUNIT_TEST( testComm );
   CPPUNIT_TEST( testView );
@@ -71,6 +72,9 @@ public :
   /// Test debug().
   void testDebug(void);
 
+  /// Test topologyCheck().
+  void testTopologyCheck(void);
+
   /// Test dimension().
   void testDimension(void);
 
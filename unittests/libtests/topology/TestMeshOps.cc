@@ -116,6 +116,41 @@ pylith::topology::TestMeshOps::testNondimensionalize(void)
 } // testNondimensionalize
 
 
+// ----------------------------------------------------------------------
+// Test checkTopology().
+void
+pylith::topology::TestMeshOps::testCheckTopology(void)
+{ // testCheckTopology
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.checkTopology(MeshOps::CHECK_OFF);
+  iohandler.read(&mesh);
+
+  MeshOps::checkTopology(mesh, MeshOps::CHECK_OFF);
+  MeshOps::checkTopology(mesh, MeshOps::CHECK_SAMPLED);
+  MeshOps::checkTopology(mesh, MeshOps::CHECK_FULL);
+
+  // Replace first vertex of cell 0 with vertex that is not in cell 0
+  // without updating the supports.
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  Stratum verticesStratum(dmMesh, Stratum::DEPTH, 0);
+  const PetscInt cell = cellsStratum.begin();
+  const PetscInt cone[3] = { verticesStratum.begin()+3, verticesStratum.begin()+1, verticesStratum.begin()+2 };
+  PetscErrorCode err = DMPlexSetCone(dmMesh, cell, cone);CPPUNIT_ASSERT(!err);
+
+  MeshOps::checkTopology(mesh, MeshOps::CHECK_OFF);
+  CPPUNIT_ASSERT_THROW(MeshOps::checkTopology(mesh, MeshOps::CHECK_SAMPLED), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(MeshOps::checkTopology(mesh, MeshOps::CHECK_FULL), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testCheckTopology
+
+
 // ----------------------------------------------------------------------
 // Test checkMaterialIds().
 void
@@ -141,6 +176,11 @@ pylith::topology::TestMeshOps::testCheckMaterialIds(void)
   CPPUNIT_ASSERT_THROW(MeshOps::checkMaterialIds(mesh, materialIds, numMaterials),
 		       std::runtime_error);
 
+  // Material id in mesh that is not in list of materials.
+  materialIds[0] = 4;
+  CPPUNIT_ASSERT_THROW(MeshOps::checkMaterialIds(mesh, materialIds, 1),
+		       std::runtime_error);
+
   PYLITH_METHOD_END;
 } // testCheckMaterialIds
  
@@ -45,6 +45,7 @@ class pylith::topology::TestMeshOps : public CppUnit::TestFixture
 
   CPPUNIT_TEST( testCreateDMMesh );
   CPPUNIT_TEST( testNondimensionalize );
+  CPPUNIT_TEST( testCheckTopology );
   CPPUNIT_TEST( testCheckMaterialIds );
 
   CPPUNIT_TEST_SUITE_END();
@@ -58,6 +59,9 @@ public :
   /// Test nondimensionalize().
   void testNondimensionalize(void);
 
+  /// Test checkTopology().
+  void testCheckTopology(void);
+
   /// Test checkMaterialIds().
   void testCheckMaterialIds(void);
 
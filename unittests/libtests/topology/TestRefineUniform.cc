@@ -161,6 +161,32 @@ pylith::topology::TestRefineUniform::testRefineHex8Level1Fault1(void)
   PYLITH_METHOD_END;
 } // testRefineHex8Level1Fault1
 
+// ----------------------------------------------------------------------
+// Test refine() with 2 levels, tri3 cells, and one fault.
+void
+pylith::topology::TestRefineUniform::testRefineLevelsTri3Fault1(void)
+{ // testRefineLevelsTri3Fault1
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveTri3Level1Fault1 data;
+  _testRefineLevels(data);
+
+  PYLITH_METHOD_END;
+} // testRefineLevelsTri3Fault1
+
+// ----------------------------------------------------------------------
+// Test refine() with 2 levels, hex8 cells, and one fault.
+void
+pylith::topology::TestRefineUniform::testRefineLevelsHex8Fault1(void)
+{ // testRefineLevelsHex8Fault1
+  PYLITH_METHOD_BEGIN;
+
+  MeshDataCohesiveHex8Level1Fault1 data;
+  _testRefineLevels(data);
+
+  PYLITH_METHOD_END;
+} // testRefineLevelsHex8Fault1
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestRefineUniform::_setupMesh(Mesh* const mesh,
@@ -352,4 +378,78 @@ pylith::topology::TestRefineUniform::_testRefine(const MeshDataCohesive& data,
 } // _testRefine
 
 
+// ----------------------------------------------------------------------
+// Test refine() with multiple levels.
+void
+pylith::topology::TestRefineUniform::_testRefineLevels(const MeshDataCohesive& data)
+{ // _testRefineLevels
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh(data.cellDim);
+  _setupMesh(&mesh, data);
+
+  // Refine 2 levels at once.
+  RefineUniform refiner;
+  Mesh meshLevels(data.cellDim);
+  refiner.refine(&meshLevels, mesh, 2);
+
+  // Refine 1 level twice.
+  RefineUniform refinerA;
+  Mesh meshA(data.cellDim);
+  refinerA.refine(&meshA, mesh, 1);
+  RefineUniform refinerB;
+  Mesh meshB(data.cellDim);
+  refinerB.refine(&meshB, meshA, 1);
+
+  const PetscDM dmLevels = meshLevels.dmMesh();CPPUNIT_ASSERT(dmLevels);
+  const PetscDM dmE = meshB.dmMesh();CPPUNIT_ASSERT(dmE);
+
+  // Check vertices and cells (size only)
+  CPPUNIT_ASSERT_EQUAL(meshB.numVertices(), meshLevels.numVertices());
+  CPPUNIT_ASSERT_EQUAL(meshB.numCells(), meshLevels.numCells());
+
+  // Check labels are preserved, including materials and cohesive cells.
+  PetscErrorCode err;
+  PetscInt numLabelsE = 0, numLabels = 0;
+  err = DMGetNumLabels(dmE, &numLabelsE);PYLITH_CHECK_ERROR(err);
+  err = DMGetNumLabels(dmLevels, &numLabels);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(numLabelsE, numLabels);
+  for (PetscInt iLabel=0; iLabel < numLabelsE; ++iLabel) {
+    const char* name = NULL;
+    err = DMGetLabelName(dmE, iLabel, &name);PYLITH_CHECK_ERROR(err);
+
+    PetscDMLabel labelE = NULL, label = NULL;
+    err = DMGetLabel(dmE, name, &labelE);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(labelE);
+    err = DMGetLabel(dmLevels, name, &label);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(label);
+
+    PetscIS valuesIS = NULL;
+    PetscInt numValues = 0;
+    const PetscInt* values = NULL;
+    err = DMLabelGetValueIS(labelE, &valuesIS);PYLITH_CHECK_ERROR(err);
+    err = ISGetLocalSize(valuesIS, &numValues);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    for (PetscInt iValue=0; iValue < numValues; ++iValue) {
+      PetscInt sizeE = 0, size = 0;
+      err = DMLabelGetStratumSize(labelE, values[iValue], &sizeE);PYLITH_CHECK_ERROR(err);
+      err = DMLabelGetStratumSize(label, values[iValue], &size);PYLITH_CHECK_ERROR(err);
+      CPPUNIT_ASSERT_EQUAL(sizeE, size);
+    } // for
+    err = ISRestoreIndices(valuesIS, &values);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&valuesIS);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  // Check statistics
+  CPPUNIT_ASSERT_EQUAL(3, refiner.numLevels());
+  CPPUNIT_ASSERT_EQUAL(PylithInt(mesh.numCells()), refiner.levelNumCells(0));
+  CPPUNIT_ASSERT_EQUAL(PylithInt(meshA.numCells()), refiner.levelNumCells(1));
+  CPPUNIT_ASSERT_EQUAL(PylithInt(meshLevels.numCells()), refiner.levelNumCells(2));
+  for (int level=0; level < refiner.numLevels(); ++level) {
+    CPPUNIT_ASSERT(refiner.levelWallTime(level) >= 0.0);
+    CPPUNIT_ASSERT(refiner.levelMemory(level) > 0.0);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _testRefineLevels
+
+
 // End of file 
@@ -63,6 +63,9 @@ class pylith::topology::TestRefineUniform : public CppUnit::TestFixture
   CPPUNIT_TEST( testRefineHex8Level1 );
   CPPUNIT_TEST( testRefineHex8Level1Fault1 );
 
+  CPPUNIT_TEST( testRefineLevelsTri3Fault1 );
+  CPPUNIT_TEST( testRefineLevelsHex8Fault1 );
+
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -95,6 +98,12 @@ public :
   /// Test refine() with level 1, hex8 cells, and one fault.
   void testRefineHex8Level1Fault1(void);
 
+  /// Test refine() with 2 levels, tri3 cells, and one fault.
+  void testRefineLevelsTri3Fault1(void);
+
+  /// Test refine() with 2 levels, hex8 cells, and one fault.
+  void testRefineLevelsHex8Fault1(void);
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
@@ -114,6 +123,15 @@ private :
   void _testRefine(const MeshDataCohesive& data,
 		   const bool isSimplexMesh);
 
+  /** Test refine() with multiple levels.
+   *
+   * Compare refining 2 levels at once with refining 1 level twice
+   * and check refinement statistics.
+   *
+   * @param data Test data.
+   */
+  void _testRefineLevels(const MeshDataCohesive& data);
+
 }; // class TestRefineUniform
 
 #endif // pylith_topology_testrefineuniform_hh
@@ -0,0 +1,382 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSpaceFillingCurve.hh" // Implementation of class methods
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+#include "pylith/faults/FaultCohesiveKin.hh" // USES FaultCohesiveKin
+#include "pylith/utils/array.hh" // USES int_array
+
+#include <cstdlib> // USES abs()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestSpaceFillingCurve );
+
+// ----------------------------------------------------------------------
+// Test _curveIndex() in 2-D.
+void
+pylith::topology::TestSpaceFillingCurve::testCurveIndex2D(void)
+{ // testCurveIndex2D
+  PYLITH_METHOD_BEGIN;
+
+  _testCurveIndex(2, 3, SpaceFillingCurve::HILBERT);
+  _testCurveIndex(2, 3, SpaceFillingCurve::MORTON);
+
+  PYLITH_METHOD_END;
+} // testCurveIndex2D
+
+// ----------------------------------------------------------------------
+// Test _curveIndex() in 3-D.
+void
+pylith::topology::TestSpaceFillingCurve::testCurveIndex3D(void)
+{ // testCurveIndex3D
+  PYLITH_METHOD_BEGIN;
+
+  _testCurveIndex(3, 2, SpaceFillingCurve::HILBERT);
+  _testCurveIndex(3, 2, SpaceFillingCurve::MORTON);
+
+  PYLITH_METHOD_END;
+} // testCurveIndex3D
+
+// ----------------------------------------------------------------------
+// Test reorder() with tri3 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTri3(void)
+{ // testReorderTri3
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTri3
+
+// ----------------------------------------------------------------------
+// Test reorder() with tri3 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTri3Fault(void)
+{ // testReorderTri3Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderTri3Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with quad4 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderQuad4(void)
+{ // testReorderQuad4
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_quad4.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderQuad4
+
+// ----------------------------------------------------------------------
+// Test reorder() with quad4 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderQuad4Fault(void)
+{ // testReorderQuad4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_quad4.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderQuad4Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with tet4 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTet4(void)
+{ // testReorderTet4
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderTet4
+
+// ----------------------------------------------------------------------
+// Test reorder() with tet4 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderTet4Fault(void)
+{ // testReorderTet4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderTet4Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with hex8 cells and no fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderHex8(void)
+{ // testReorderHex8
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh");
+
+  PYLITH_METHOD_END;
+} // testReorderHex8
+
+// ----------------------------------------------------------------------
+// Test reorder() with hex8 cells and one fault.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderHex8Fault(void)
+{ // testReorderHex8Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh", "fault");
+
+  PYLITH_METHOD_END;
+} // testReorderHex8Fault
+
+// ----------------------------------------------------------------------
+// Test reorder() with hex8 cells and Morton curve.
+void
+pylith::topology::TestSpaceFillingCurve::testReorderHex8Morton(void)
+{ // testReorderHex8Morton
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh", 0, SpaceFillingCurve::MORTON);
+
+  PYLITH_METHOD_END;
+} // testReorderHex8Morton
+
+// ----------------------------------------------------------------------
+// Test _curveIndex().
+void
+pylith::topology::TestSpaceFillingCurve::_testCurveIndex(const int dim,
+							 const int numBits,
+							 const SpaceFillingCurve::CurveEnum curve)
+{ // _testCurveIndex
+  PYLITH_METHOD_BEGIN;
+
+  const int numPerDim = 1 << numBits;
+  int numPoints = 1;
+  for (int iDim=0; iDim < dim; ++iDim) {
+    numPoints *= numPerDim;
+  } // for
+
+  // Map index along curve to point in grid.
+  int_array curveToPoint(-1, numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    unsigned long long coords[3];
+    for (int iDim=0, n=iPoint; iDim < dim; ++iDim, n /= numPerDim) {
+      coords[iDim] = n % numPerDim;
+    } // for
+    const unsigned long long index = SpaceFillingCurve::_curveIndex(coords, dim, numBits, curve);
+    CPPUNIT_ASSERT(index < (unsigned long long)numPoints);
+    CPPUNIT_ASSERT_EQUAL(PylithInt(-1), curveToPoint[index]);
+    curveToPoint[index] = iPoint;
+  } // for
+
+  if (SpaceFillingCurve::HILBERT == curve) {
+    for (int i=1; i < numPoints; ++i) {
+      int distance = 0;
+      for (int iDim=0, n0=curveToPoint[i-1], n1=curveToPoint[i]; iDim < dim; ++iDim, n0 /= numPerDim, n1 /= numPerDim) {
+	distance += abs(n1 % numPerDim - n0 % numPerDim);
+      } // for
+      CPPUNIT_ASSERT_EQUAL(1, distance);
+    } // for
+  } // if
+
+  PYLITH_METHOD_END;
+} // _testCurveIndex
+
+// ----------------------------------------------------------------------
+void
+pylith::topology::TestSpaceFillingCurve::_setupMesh(Mesh* const mesh,
+						    const char* filename,
+						    const char* faultGroup)
+{ // _setupMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename(filename);
+  iohandler.interpolate(true);
+
+  iohandler.read(mesh);
+  CPPUNIT_ASSERT(mesh->numCells() > 0);
+  CPPUNIT_ASSERT(mesh->numVertices() > 0);
+
+  // Adjust topology if necessary.
+  if (faultGroup) {
+    int firstLagrangeVertex = 0;
+    int firstFaultCell = 0;
+
+    faults::FaultCohesiveKin fault;
+    fault.id(100);
+    fault.label(faultGroup);
+    const int nvertices = fault.numVerticesNoMesh(*mesh);
+    firstLagrangeVertex += nvertices;
+    firstFaultCell += 2*nvertices; // shadow + Lagrange vertices
+
+    int firstFaultVertex = 0;
+    fault.adjustTopology(mesh, &firstFaultVertex, &firstLagrangeVertex, &firstFaultCell);
+  } // if
+
+  PYLITH_METHOD_END;
+} // _setupMesh
+
+// ----------------------------------------------------------------------
+// Test reorder().
+void
+pylith::topology::TestSpaceFillingCurve::_testReorder(const char* filename,
+						      const char* faultGroup,
+						      const SpaceFillingCurve::CurveEnum curve)
+{ // _testReorder
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _setupMesh(&mesh, filename, faultGroup);
+
+  // Get original DM and create Mesh for it
+  const PetscDM dmOrig = mesh.dmMesh();
+  PetscObjectReference((PetscObject) dmOrig);
+  Mesh meshOrig;
+  meshOrig.dmMesh(dmOrig);
+
+  SpaceFillingCurve::reorder(&mesh, curve);
+  
+  const PetscDM& dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+
+  // Check vertices (size only)
+  topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  CPPUNIT_ASSERT_EQUAL(verticesStratumE.size(), verticesStratum.size());
+
+  // Check cells (size only)
+  topology::Stratum cellsStratumE(dmOrig, topology::Stratum::HEIGHT, 0);
+  topology::Stratum cellsStratum(dmMesh, topology::Stratum::HEIGHT, 0);
+  CPPUNIT_ASSERT_EQUAL(cellsStratumE.size(), cellsStratum.size());
+
+  // Check groups
+  PetscInt numGroupsE, numGroups;
+  PetscErrorCode err;
+  err = DMGetNumLabels(dmOrig, &numGroupsE);PYLITH_CHECK_ERROR(err);
+  err = DMGetNumLabels(dmMesh, &numGroups);PYLITH_CHECK_ERROR(err);
+  CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
+
+  for (PetscInt iGroup = 0; iGroup < numGroups; ++iGroup) {
+    const char *name = NULL;
+    err = DMGetLabelName(dmMesh, iGroup, &name);PYLITH_CHECK_ERROR(err);
+
+    PetscInt numPointsE, numPoints;
+    err = DMGetStratumSize(dmOrig, name, 1, &numPointsE);PYLITH_CHECK_ERROR(err);
+    err = DMGetStratumSize(dmMesh, name, 1, &numPoints);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(numPointsE, numPoints);
+  } // for
+
+  // Check element centroids
+  PylithScalar coordsCheckOrig = 0.0;
+  { // original
+    Stratum cellsStratum(dmOrig, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmOrig);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheckOrig += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // original
+  PylithScalar coordsCheck = 0.0;
+  { // reordered
+    Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+    const PetscInt cStart = cellsStratum.begin();
+    const PetscInt cEnd = cellsStratum.end();
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+    for (PetscInt cell = cStart; cell < cEnd; ++cell) {
+      PetscScalar* coordsCell = NULL;
+      PetscInt coordsSize = 0;
+      PylithScalar value = 0.0;
+      coordsVisitor.getClosure(&coordsCell, &coordsSize, cell);
+      for (int i=0; i < coordsSize; ++i) {
+	value += coordsCell[i];
+      } // for
+      coordsCheck += value*value;
+      coordsVisitor.restoreClosure(&coordsCell, &coordsSize, cell);
+    } // for
+  } // reordered
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(coordsCheckOrig, coordsCheck, tolerance*coordsCheckOrig);
+
+  // Check cells are grouped by material.
+  PetscInt cMax = cellsStratum.end();
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax < 0) {
+    cMax = cellsStratum.end();
+  } // if
+  PetscDMLabel materialsLabel = NULL;
+  err = DMGetLabel(dmMesh, "material-id", &materialsLabel);PYLITH_CHECK_ERROR(err);CPPUNIT_ASSERT(materialsLabel);
+  PetscInt matIdPrev = PETSC_MIN_INT;
+  for (PetscInt cell = cellsStratum.begin(); cell < cMax; ++cell) {
+    PetscInt matId = 0;
+    err = DMLabelGetValue(materialsLabel, cell, &matId);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(matId >= matIdPrev);
+    matIdPrev = matId;
+  } // for
+
+  // Check vertices are numbered in order of first use by cells.
+  if (!faultGroup) {
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    PetscInt vNext = vStart;
+    for (PetscInt cell = cellsStratum.begin(); cell < cellsStratum.end(); ++cell) {
+      PetscInt closureSize = 0, *closure = NULL;
+      err = DMPlexGetTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt cl = 0; cl < closureSize*2; cl += 2) {
+	const PetscInt point = closure[cl];
+	if (point >= vStart && point < vEnd) {
+	  CPPUNIT_ASSERT(point <= vNext);
+	  if (point == vNext) {
+	    ++vNext;
+	  } // if
+	} // if
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmMesh, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+    CPPUNIT_ASSERT_EQUAL(vEnd, vNext);
+  } // if
+
+  CPPUNIT_ASSERT(SpaceFillingCurve::closureSpan(mesh) > 0.0);
+
+  PYLITH_METHOD_END;
+} // _testReorder
+
+
+// End of file
@@ -0,0 +1,146 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestSpaceFillingCurve.hh
+ *
+ * @brief C++ TestSpaceFillingCurve object
+ *
+ * C++ unit testing for SpaceFillingCurve.
+ */
+
+#if !defined(pylith_topology_testspacefillingcurve_hh)
+#define pylith_topology_testspacefillingcurve_hh
+
+// Include directives ---------------------------------------------------
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/SpaceFillingCurve.hh" // USES SpaceFillingCurve::CurveEnum
+
+// Forward declarations -------------------------------------------------
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestSpaceFillingCurve;
+  } // topology
+} // pylith
+
+// SpaceFillingCurve ----------------------------------------------------
+class pylith::topology::TestSpaceFillingCurve : public CppUnit::TestFixture
+{ // class TestSpaceFillingCurve
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSpaceFillingCurve );
+
+  CPPUNIT_TEST( testCurveIndex2D );
+  CPPUNIT_TEST( testCurveIndex3D );
+
+  CPPUNIT_TEST( testReorderTri3 );
+  CPPUNIT_TEST( testReorderTri3Fault );
+
+  CPPUNIT_TEST( testReorderQuad4 );
+  CPPUNIT_TEST( testReorderQuad4Fault );
+
+  CPPUNIT_TEST( testReorderTet4 );
+  CPPUNIT_TEST( testReorderTet4Fault );
+
+  CPPUNIT_TEST( testReorderHex8 );
+  CPPUNIT_TEST( testReorderHex8Fault );
+  CPPUNIT_TEST( testReorderHex8Morton );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test _curveIndex() in 2-D.
+  void testCurveIndex2D(void);
+
+  /// Test _curveIndex() in 3-D.
+  void testCurveIndex3D(void);
+
+  /// Test reorder() with tri3 cells and no fault.
+  void testReorderTri3(void);
+
+  /// Test reorder() with tri3 cells and one fault.
+  void testReorderTri3Fault(void);
+
+  /// Test reorder() with quad4 cells and no fault.
+  void testReorderQuad4(void);
+
+  /// Test reorder() with quad4 cells and one fault.
+  void testReorderQuad4Fault(void);
+
+  /// Test reorder() with tet4 cells and no fault.
+  void testReorderTet4(void);
+
+  /// Test reorder() with tet4 cells and one fault.
+  void testReorderTet4Fault(void);
+
+  /// Test reorder() with hex8 cells and no fault.
+  void testReorderHex8(void);
+
+  /// Test reorder() with hex8 cells and one fault.
+  void testReorderHex8Fault(void);
+
+  /// Test reorder() with hex8 cells and Morton curve.
+  void testReorderHex8Morton(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Test _curveIndex().
+   *
+   * Checks that the indices of the cells in a uniform grid form a
+   * permutation and, for the Hilbert curve, that consecutive cells
+   * along the curve share a face.
+   *
+   * @param dim Spatial dimension.
+   * @param numBits Number of bits per coordinate.
+   * @param curve Type of space-filling curve.
+   */
+  void _testCurveIndex(const int dim,
+		       const int numBits,
+		       const SpaceFillingCurve::CurveEnum curve);
+
+  /** Setup mesh.
+   *
+   * @mesh Mesh to setup.
+   * @param filename Mesh filename.
+   * @param faultGroup Name of fault group.
+   */
+  void _setupMesh(Mesh* const mesh,
+		  const char* filename,
+		  const char* faultGroup =0);
+
+  /** Test reorder().
+   *
+   * @param filename Mesh filename.
+   * @param faultGroup Name of fault group.
+   * @param curve Type of space-filling curve.
+   */
+  void _testReorder(const char* filename,
+		    const char* faultGroup =0,
+		    const SpaceFillingCurve::CurveEnum curve =SpaceFillingCurve::HILBERT);
+
+}; // class TestSpaceFillingCurve
+
+#endif // pylith_topology_testspacefillingcurve_hh
+
+
+// End of file
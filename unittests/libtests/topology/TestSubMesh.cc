@@ -158,6 +158,27 @@ pylith::topology::TestSubMesh::testDebug(void)
   PYLITH_METHOD_END;
 } // testDebug
 
+// ----------------------------------------------------------------------
+// Test topologyCheck().
+void
+pylith::topology::TestSubMesh::testTopologyCheck(void)
+{ // testTopologyCheck
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh2D;
+  _buildMesh(&mesh2D);
+
+  Mesh submesh(mesh2D, _TestSubMesh::label);
+  CPPUNIT_ASSERT_EQUAL(MeshOps::CHECK_FULL, submesh.topologyCheck());
+
+  // Submesh inherits level from the mesh.
+  mesh2D.topologyCheck(MeshOps::CHECK_OFF);
+  Mesh submesh2(mesh2D, _TestSubMesh::label);
+  CPPUNIT_ASSERT_EQUAL(MeshOps::CHECK_OFF, submesh2.topologyCheck());
+
+  PYLITH_METHOD_END;
+} // testTopologyCheck
+
 // ----------------------------------------------------------------------
 // Test dimension().
 void
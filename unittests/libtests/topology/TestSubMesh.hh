@@ -50,6 +50,7 @@ class pylith::topology::TestSubMesh : public CppUnit::TestFixture
   CPPUNIT_TEST( testConstructorMesh );
   CPPUNIT_TEST( testCoordsys );
   CPPUNIT_TEST( testDebug );
+  CPPUNIT_TEST( testTopologyCheck );
   CPPUNIT_TEST( testDimension );
   CPPUNIT_TEST( testNumCorners );
   CPPUNIT_TEST( testNumVertices );
@@ -73,6 +74,9 @@ public :
   /// Test debug().
   void testDebug(void);
 
+  /// Test topologyCheck().
+  void testTopologyCheck(void);
+
   /// Test dimension().
   void testDimension(void);
 
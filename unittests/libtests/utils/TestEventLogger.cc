@@ -24,6 +24,8 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
+#include <stdexcept> // USES std::out_of_range
+
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestEventLogger );
 
@@ -164,6 +166,50 @@ pylith::utils::TestEventLogger::testEventLogging(void)
   PYLITH_METHOD_END;
 } // testEventLogging
 
+// ----------------------------------------------------------------------
+// Test logBytes(), eventBytes(), numBytesEvents(), bytesEvent(), and eventName().
+void
+pylith::utils::TestEventLogger::testBytes(void)
+{ // testBytes
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("my class");
+  logger.initialize();
+
+  const int idA = logger.registerEvent("event bytes A");
+  const int idB = logger.registerEvent("event bytes B");
+  CPPUNIT_ASSERT_EQUAL(std::string("event bytes A"), std::string(EventLogger::eventName(idA)));
+
+  const int numEventsOrig = EventLogger::numBytesEvents();
+  CPPUNIT_ASSERT_EQUAL(0.0, EventLogger::eventBytes(idA));
+
+  logger.eventBegin(idA);
+  EventLogger::logBytes(idA, 1000.0);
+  logger.eventEnd(idA);
+  EventLogger::logBytes(idA, 24.0);
+  EventLogger::logBytes(idB, 8.0);
+  CPPUNIT_ASSERT_EQUAL(1024.0, EventLogger::eventBytes(idA));
+  CPPUNIT_ASSERT_EQUAL(8.0, EventLogger::eventBytes(idB));
+  CPPUNIT_ASSERT_EQUAL(numEventsOrig+2, EventLogger::numBytesEvents());
+
+  bool foundA = false;
+  bool foundB = false;
+  for (int i=0; i < EventLogger::numBytesEvents(); ++i) {
+    foundA = foundA || idA == EventLogger::bytesEvent(i);
+    foundB = foundB || idB == EventLogger::bytesEvent(i);
+  } // for
+  CPPUNIT_ASSERT(foundA);
+  CPPUNIT_ASSERT(foundB);
+  CPPUNIT_ASSERT_THROW(EventLogger::bytesEvent(EventLogger::numBytesEvents()), std::out_of_range);
+
+  // Totals are zero without PETSc logging and nonnegative with it.
+  CPPUNIT_ASSERT(EventLogger::eventTime(idA) >= 0.0);
+  CPPUNIT_ASSERT(EventLogger::eventFlops(idB) >= 0.0);
+
+  PYLITH_METHOD_END;
+} // testBytes
+
 // ----------------------------------------------------------------------
 // Test registerStage().
 void
@@ -0,0 +1,190 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestEventSampler.hh" // Implementation of class methods
+
+#include "pylith/utils/EventSampler.hh" // USES EventSampler
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "petsclog.h" // USES PetscLogGetStageLog(), PetscStageLog
+
+#include <stdexcept> // USES std::invalid_argument
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestEventSampler );
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::utils::TestEventSampler::tearDown(void)
+{ // tearDown
+  EventLogger::detailLevel(EventLogger::DETAIL_NONE);
+  EventLogger::sampleInterval(64);
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test EventLogger::detailLevel() and EventLogger::sampleInterval().
+void
+pylith::utils::TestEventSampler::testDetailLevel(void)
+{ // testDetailLevel
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT_EQUAL(EventLogger::DETAIL_NONE, EventLogger::detailLevel());
+  CPPUNIT_ASSERT_EQUAL(64, EventLogger::sampleInterval());
+
+  EventLogger::detailLevel(EventLogger::DETAIL_SAMPLED);
+  EventLogger::sampleInterval(5);
+  CPPUNIT_ASSERT_EQUAL(EventLogger::DETAIL_SAMPLED, EventLogger::detailLevel());
+  CPPUNIT_ASSERT_EQUAL(5, EventLogger::sampleInterval());
+
+  CPPUNIT_ASSERT_THROW(EventLogger::sampleInterval(0), std::invalid_argument);
+
+  EventSampler sampler;
+  CPPUNIT_ASSERT_EQUAL(EventLogger::DETAIL_SAMPLED, sampler._level);
+  CPPUNIT_ASSERT_EQUAL(5, sampler._interval);
+
+  PYLITH_METHOD_END;
+} // testDetailLevel
+
+// ----------------------------------------------------------------------
+// Test begin() and end() with DETAIL_NONE.
+void
+pylith::utils::TestEventSampler::testNone(void)
+{ // testNone
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("sampler class A");
+  logger.initialize();
+  const int id = logger.registerEvent("sampler event A");
+
+  EventLogger::detailLevel(EventLogger::DETAIL_NONE);
+  EventSampler sampler;
+  for (int i=0; i < 10; ++i) {
+    sampler.begin(id);
+    sampler.end(id);
+  } // for
+  CPPUNIT_ASSERT(sampler._accumulators.empty());
+
+  PYLITH_METHOD_END;
+} // testNone
+
+// ----------------------------------------------------------------------
+// Test begin(), end(), and flush() with DETAIL_SAMPLED.
+void
+pylith::utils::TestEventSampler::testSampled(void)
+{ // testSampled
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("sampler class B");
+  logger.initialize();
+  const int idA = logger.registerEvent("sampler event B1");
+  const int idB = logger.registerEvent("sampler event B2");
+
+  EventLogger::detailLevel(EventLogger::DETAIL_SAMPLED);
+  EventLogger::sampleInterval(4);
+  EventSampler sampler;
+
+  // Totals are added to the PETSc event log only if logging is active.
+  PetscErrorCode err = 0;
+  if (!PetscLogPLB) {
+    err = PetscLogDefaultBegin();CPPUNIT_ASSERT(!err);
+  } // if
+  PetscStageLog stageLog = 0;
+  int stage = -1;
+  PetscEventPerfLog eventLog = 0;
+  err = PetscLogGetStageLog(&stageLog);CPPUNIT_ASSERT(!err);
+  err = PetscStageLogGetCurrent(stageLog, &stage);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(stage >= 0);
+  err = PetscStageLogGetEventPerfLog(stageLog, stage, &eventLog);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(eventLog);
+  CPPUNIT_ASSERT(idA < eventLog->numEvents);
+  CPPUNIT_ASSERT(idB < eventLog->numEvents);
+  const int countA = eventLog->eventInfo[idA].count;
+  const int countB = eventLog->eventInfo[idB].count;
+  const PetscLogDouble timeA = eventLog->eventInfo[idA].time;
+  const PetscLogDouble timeB = eventLog->eventInfo[idB].time;
+
+  const int numIter = 10;
+  for (int i=0; i < numIter; ++i) {
+    sampler.begin(idA);
+    sampler.end(idA);
+    if (i % 2) {
+      sampler.begin(idB);
+      sampler.end(idB);
+    } // if
+  } // for
+
+  CPPUNIT_ASSERT_EQUAL(size_t(2), sampler._accumulators.size());
+  const EventSampler::Accumulator& infoA = sampler._accumulators[0];
+  CPPUNIT_ASSERT_EQUAL(idA, infoA.id);
+  CPPUNIT_ASSERT_EQUAL(numIter, infoA.count);
+  CPPUNIT_ASSERT_EQUAL(3, infoA.numSampled); // 0, 4, 8
+  CPPUNIT_ASSERT(!infoA.isSampled);
+  CPPUNIT_ASSERT(infoA.time >= 0.0);
+
+  const EventSampler::Accumulator& infoB = sampler._accumulators[1];
+  CPPUNIT_ASSERT_EQUAL(idB, infoB.id);
+  CPPUNIT_ASSERT_EQUAL(numIter/2, infoB.count);
+  CPPUNIT_ASSERT_EQUAL(2, infoB.numSampled); // 0, 4
+
+  // Time of sampled occurrences is extrapolated to all occurrences.
+  const PetscLogDouble timeAE = timeA + infoA.time * numIter / 3.0;
+  const PetscLogDouble timeBE = timeB + infoB.time * (numIter/2) / 2.0;
+
+  sampler.flush();
+  CPPUNIT_ASSERT(sampler._accumulators.empty());
+
+  const PetscLogDouble tolerance = 1.0e-12;
+  CPPUNIT_ASSERT_EQUAL(countA+numIter, eventLog->eventInfo[idA].count);
+  CPPUNIT_ASSERT_EQUAL(countB+numIter/2, eventLog->eventInfo[idB].count);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(timeAE, eventLog->eventInfo[idA].time, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(timeBE, eventLog->eventInfo[idB].time, tolerance);
+
+  PYLITH_METHOD_END;
+} // testSampled
+
+// ----------------------------------------------------------------------
+// Test begin() and end() with DETAIL_FULL.
+void
+pylith::utils::TestEventSampler::testFull(void)
+{ // testFull
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("sampler class C");
+  logger.initialize();
+  const int id = logger.registerEvent("sampler event C");
+
+  EventLogger::detailLevel(EventLogger::DETAIL_FULL);
+  EventSampler sampler;
+  for (int i=0; i < 10; ++i) {
+    sampler.begin(id);
+    sampler.end(id);
+  } // for
+  CPPUNIT_ASSERT(sampler._accumulators.empty());
+
+  PYLITH_METHOD_END;
+} // testFull
+
+
+// End of file 
@@ -0,0 +1,76 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/utils/TestEventSampler.hh
+ *
+ * @brief C++ TestEventSampler object
+ *
+ * C++ unit testing for EventSampler.
+ */
+
+#if !defined(pylith_utils_testeventsampler_hh)
+#define pylith_utils_testeventsampler_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestEventSampler;
+  } // utils
+} // pylith
+
+/// C++ unit testing for TestEventSampler
+class pylith::utils::TestEventSampler : public CppUnit::TestFixture
+{ // class TestEventSampler
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestEventSampler );
+
+  CPPUNIT_TEST( testDetailLevel );
+  CPPUNIT_TEST( testNone );
+  CPPUNIT_TEST( testSampled );
+  CPPUNIT_TEST( testFull );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test EventLogger::detailLevel() and EventLogger::sampleInterval().
+  void testDetailLevel(void);
+
+  /// Test begin() and end() with DETAIL_NONE.
+  void testNone(void);
+
+  /// Test begin(), end(), and flush() with DETAIL_SAMPLED.
+  void testSampled(void);
+
+  /// Test begin() and end() with DETAIL_FULL.
+  void testFull(void);
+
+}; // class TestEventSampler
+
+#endif // pylith_utils_testeventsampler_hh
+
+
+// End of file 
@@ -0,0 +1,150 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestEventTracer.hh" // Implementation of class methods
+
+#include "pylith/utils/EventTracer.hh" // USES EventTracer
+#include "pylith/utils/EventLogger.hh" // USES EventLogger
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <fstream> // USES std::ifstream
+#include <sstream> // USES std::ostringstream
+#include <string> // USES std::string
+#include <stdexcept> // USES std::invalid_argument, std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestEventTracer );
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::utils::TestEventTracer::tearDown(void)
+{ // tearDown
+  EventTracer::disable();
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test enable(), disable(), and isEnabled().
+void
+pylith::utils::TestEventTracer::testEnable(void)
+{ // testEnable
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(!EventTracer::isEnabled());
+  CPPUNIT_ASSERT_THROW(EventTracer::enable(0), std::invalid_argument);
+
+  EventLogger logger;
+  logger.className("tracer class");
+  logger.initialize();
+  const int id = logger.registerEvent("tracer event");
+
+  EventTracer::enable(10);
+  CPPUNIT_ASSERT(EventTracer::isEnabled());
+  CPPUNIT_ASSERT_EQUAL(0, EventTracer::numRecords());
+  logger.eventBegin(id);
+  logger.eventEnd(id);
+  CPPUNIT_ASSERT_EQUAL(2, EventTracer::numRecords());
+
+  // Records are kept, but nothing more is recorded.
+  EventTracer::disable();
+  CPPUNIT_ASSERT(!EventTracer::isEnabled());
+  logger.eventBegin(id);
+  logger.eventEnd(id);
+  CPPUNIT_ASSERT_EQUAL(2, EventTracer::numRecords());
+
+  PYLITH_METHOD_END;
+} // testEnable
+
+// ----------------------------------------------------------------------
+// Test numRecords() and numDropped() when ring buffer wraps.
+void
+pylith::utils::TestEventTracer::testRingBuffer(void)
+{ // testRingBuffer
+  PYLITH_METHOD_BEGIN;
+
+  const int capacity = 4;
+  EventTracer::enable(capacity);
+  for (int i=0; i < 3; ++i) {
+    EventTracer::spanBegin("span");
+    EventTracer::spanEnd("span");
+  } // for
+  CPPUNIT_ASSERT_EQUAL(capacity, EventTracer::numRecords());
+  CPPUNIT_ASSERT_EQUAL(2, EventTracer::numDropped());
+
+  EventTracer::enable(capacity);
+  CPPUNIT_ASSERT_EQUAL(0, EventTracer::numRecords());
+  CPPUNIT_ASSERT_EQUAL(0, EventTracer::numDropped());
+
+  PYLITH_METHOD_END;
+} // testRingBuffer
+
+// ----------------------------------------------------------------------
+// Test write().
+void
+pylith::utils::TestEventTracer::testWrite(void)
+{ // testWrite
+  PYLITH_METHOD_BEGIN;
+
+  EventLogger logger;
+  logger.className("tracer class");
+  logger.initialize();
+  const int idEvent = logger.registerEvent("tracer write event");
+  const int idStage = logger.registerStage("tracer write stage");
+
+  // Capacity drops the first span and the beginning of the second
+  // span, so the unmatched end of the second span must be skipped.
+  EventTracer::enable(7);
+  EventTracer::spanBegin("dropped span");
+  EventTracer::spanEnd("dropped span");
+  EventTracer::spanBegin("dropped span");
+  EventTracer::spanEnd("dropped span");
+  logger.stagePush(idStage);
+  logger.eventBegin(idEvent);
+  EventTracer::spanBegin("MPI wait");
+  EventTracer::spanEnd("MPI wait");
+  logger.eventEnd(idEvent);
+  logger.stagePop();
+  EventTracer::disable();
+  CPPUNIT_ASSERT_EQUAL(3, EventTracer::numDropped());
+
+  const char* filename = "eventtracer.json";
+  EventTracer::write(filename, 2);
+
+  std::ifstream fin(filename);
+  CPPUNIT_ASSERT(fin.is_open());
+  std::ostringstream contents;
+  contents << fin.rdbuf();
+  const std::string trace = contents.str();
+
+  CPPUNIT_ASSERT(trace.find("\"traceEvents\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"name\":\"tracer write stage\",\"cat\":\"stage\",\"ph\":\"B\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"name\":\"tracer write event\",\"cat\":\"event\",\"ph\":\"E\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"name\":\"MPI wait\",\"cat\":\"span\",\"ph\":\"B\"") != std::string::npos);
+  CPPUNIT_ASSERT(trace.find("dropped span") == std::string::npos);
+  CPPUNIT_ASSERT(trace.find("\"pid\":2") != std::string::npos);
+
+  CPPUNIT_ASSERT_THROW(EventTracer::write("nonexistent_dir/eventtracer.json", 0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testWrite
+
+
+// End of file 
@@ -0,0 +1,72 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/utils/TestEventTracer.hh
+ *
+ * @brief C++ TestEventTracer object
+ *
+ * C++ unit testing for EventTracer.
+ */
+
+#if !defined(pylith_utils_testeventtracer_hh)
+#define pylith_utils_testeventtracer_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestEventTracer;
+  } // utils
+} // pylith
+
+/// C++ unit testing for TestEventTracer
+class pylith::utils::TestEventTracer : public CppUnit::TestFixture
+{ // class TestEventTracer
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestEventTracer );
+
+  CPPUNIT_TEST( testEnable );
+  CPPUNIT_TEST( testRingBuffer );
+  CPPUNIT_TEST( testWrite );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test enable(), disable(), and isEnabled().
+  void testEnable(void);
+
+  /// Test numRecords() and numDropped() when ring buffer wraps.
+  void testRingBuffer(void);
+
+  /// Test write().
+  void testWrite(void);
+
+}; // class TestEventTracer
+
+#endif // pylith_utils_testeventtracer_hh
+
+
+// End of file 
@@ -0,0 +1,49 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestStreamBenchmark.hh" // Implementation of class methods
+
+#include "pylith/utils/StreamBenchmark.hh" // USES StreamBenchmark
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <stdexcept> // USES std::invalid_argument
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::utils::TestStreamBenchmark );
+
+// ----------------------------------------------------------------------
+// Test triad().
+void
+pylith::utils::TestStreamBenchmark::testTriad(void)
+{ // testTriad
+  PYLITH_METHOD_BEGIN;
+
+  const double bandwidth = StreamBenchmark::triad(100000, 3);
+  CPPUNIT_ASSERT(bandwidth > 0.0);
+
+  CPPUNIT_ASSERT_THROW(StreamBenchmark::triad(0, 3), std::invalid_argument);
+  CPPUNIT_ASSERT_THROW(StreamBenchmark::triad(100, 0), std::invalid_argument);
+
+  PYLITH_METHOD_END;
+} // testTriad
+
+
+// End of file 
@@ -0,0 +1,61 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/utils/TestStreamBenchmark.hh
+ *
+ * @brief C++ TestStreamBenchmark object
+ *
+ * C++ unit testing for StreamBenchmark.
+ */
+
+#if !defined(pylith_utils_teststreambenchmark_hh)
+#define pylith_utils_teststreambenchmark_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace utils {
+    class TestStreamBenchmark;
+  } // utils
+} // pylith
+
+/// C++ unit testing for TestStreamBenchmark
+class pylith::utils::TestStreamBenchmark : public CppUnit::TestFixture
+{ // class TestStreamBenchmark
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestStreamBenchmark );
+
+  CPPUNIT_TEST( testTriad );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test triad().
+  void testTriad(void);
+
+}; // class TestStreamBenchmark
+
+#endif // pylith_utils_teststreambenchmark_hh
+
+
+// End of file 
@@ -122,6 +122,21 @@ class TestMaterial(unittest.TestCase):
     return
 
 
+  def testSinglePrecisionProperties(self):
+    """
+    Test singlePrecisionProperties().
+    """
+    # Default should be False.
+    self.failIf(self.material.singlePrecisionProperties())
+
+    self.material.singlePrecisionProperties(True)
+    self.failUnless(self.material.singlePrecisionProperties())
+
+    # No properties are stored before initialization.
+    self.assertEqual(0, self.material.propertiesSingleBytes())
+    return
+
+
   def testIsJacobianSymmetric(self):
     """
     Test isJacobianSymmetric().
@@ -105,6 +105,11 @@ class TestRefineUniform(unittest.TestCase):
     refiner = RefineUniform()
     meshRefined = refiner.refine(mesh)
 
+    self.assertEqual(2, refiner.numLevels())
+    self.assertTrue(refiner.levelNumCells(1) > refiner.levelNumCells(0))
+    self.assertTrue(refiner.levelWallTime(1) >= 0.0)
+    self.assertTrue(refiner.levelMemory(1) > 0.0)
+
     return
 
 
@@ -105,6 +105,45 @@ class TestEventLogger(unittest.TestCase):
     return
 
 
+  def test_bytes(self):
+    """
+    Test logBytes() and eventBytes().
+    """
+    from pylith.utils.EventLogger import EventLogger
+    logger = EventLogger()
+    logger.className("logging A")
+    logger.initialize()
+    id = logger.registerEvent("event bytes")
+
+    EventLogger.logBytes(id, 1000.0)
+    EventLogger.logBytes(id, 24.0)
+    self.assertEqual(1024.0, EventLogger.eventBytes(id))
+    self.assertEqual("event bytes", EventLogger.eventName(id))
+    ids = [EventLogger.bytesEvent(i) for i in xrange(EventLogger.numBytesEvents())]
+    self.assertTrue(id in ids)
+    self.assertTrue(EventLogger.eventFlops(id) >= 0.0)
+    return
+
+
+  def test_detailLevel(self):
+    """
+    Test detailLevel() and sampleInterval().
+    """
+    from pylith.utils.EventLogger import EventLogger
+    self.assertEqual(EventLogger.DETAIL_NONE, EventLogger.detailLevel())
+
+    EventLogger.detailLevel(EventLogger.DETAIL_SAMPLED)
+    EventLogger.sampleInterval(10)
+    self.assertEqual(EventLogger.DETAIL_SAMPLED, EventLogger.detailLevel())
+    self.assertEqual(10, EventLogger.sampleInterval())
+
+    self.assertRaises(RuntimeError, EventLogger.sampleInterval, 0)
+
+    EventLogger.detailLevel(EventLogger.DETAIL_NONE)
+    EventLogger.sampleInterval(64)
+    return
+
+
   def test_registerStage(self):
     """
     Test registerStage().
@@ -123,6 +162,24 @@ class TestEventLogger(unittest.TestCase):
     return
 
 
+  def test_registerStageShared(self):
+    """
+    Test registerStage() with stage registered by another logger.
+    """
+    from pylith.utils.EventLogger import EventLogger
+    loggerA = EventLogger()
+    loggerA.className("logging A")
+    loggerA.initialize()
+    loggerB = EventLogger()
+    loggerB.className("logging B")
+    loggerB.initialize()
+
+    idA = loggerA.registerStage("stage shared")
+    idB = loggerB.stageId("stage shared")
+    self.assertEqual(idA, idB)
+    return
+
+
   def test_stageLogging(self):
     """
     Test stagePush() and stagePop().
@@ -148,4 +205,35 @@ class TestEventLogger(unittest.TestCase):
     return
 
 
+  def test_tracer(self):
+    """
+    Test tracing of events and stages with EventTracer.
+    """
+    from pylith.utils.EventLogger import EventLogger
+    from pylith.utils.utils import EventTracer
+    logger = EventLogger()
+    logger.className("logging A")
+    logger.initialize()
+    logger.registerEvent("event trace")
+    logger.registerStage("stage trace")
+
+    EventTracer.enable(100)
+    logger.stagePush("stage trace")
+    logger.eventBegin("event trace")
+    logger.eventEnd("event trace")
+    logger.stagePop()
+    EventTracer.disable()
+    self.assertEqual(4, EventTracer.numRecords())
+    self.assertEqual(0, EventTracer.numDropped())
+
+    filename = "eventlogger_trace.json"
+    EventTracer.write(filename, 0)
+    import json
+    trace = json.load(open(filename, "r"))
+    spans = [(event['name'], event['ph']) for event in trace['traceEvents'] if event['ph'] != "M"]
+    self.assertEqual([("stage trace", "B"), ("event trace", "B"),
+                      ("event trace", "E"), ("stage trace", "E")], spans)
+    return
+
+
 # End of file 
@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/utils/TestLoadBalance.py
+
+## @brief Unit testing of LoadBalance object.
+
+import unittest
+
+
+# ----------------------------------------------------------------------
+class TestLoadBalance(unittest.TestCase):
+  """
+  Unit testing of LoadBalance object.
+  """
+  
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    from pylith.perf.LoadBalance import LoadBalance
+    balance = LoadBalance()
+    self.failIf(balance.enabled())
+    return
+
+
+  def test_reduce(self):
+    """
+    Test reduce().
+    """
+    values = {'cells': 10,
+              'ghost_points': 4,
+              'ghost_dof': 8,
+              'messages': 0.0,
+              'message_bytes': 0.0,
+              'compute_time': 2.0,
+              'integrators': [{'name': "material elastic",
+                               'cells': 10,
+                               'compute_time': 2.0,
+                               }],
+              }
+    from pylith.perf.LoadBalance import LoadBalance
+    balance = LoadBalance()
+    from pylith.mpi.Communicator import mpi_comm_self
+    report = balance.reduce(values, mpi_comm_self())
+
+    for key in ['cells', 'ghost_points', 'ghost_dof', 'compute_time']:
+      self.assertEqual(float(values[key]), report[key]['min'])
+      self.assertEqual(float(values[key]), report[key]['max'])
+      self.assertEqual(float(values[key]), report[key]['avg'])
+      self.assertEqual(1.0, report[key]['imbalance'])
+      self.assertEqual(0, report[key]['max_rank'])
+    self.assertEqual(1.0, report['messages']['imbalance'])
+    self.assertEqual(1, len(report['integrators']))
+    self.assertEqual("material elastic", report['integrators'][0]['name'])
+    self.assertEqual(10.0, report['integrators'][0]['cells']['max'])
+    return
+
+
+  def test_difference(self):
+    """
+    Test _difference().
+    """
+    valuesBegin = {'cells': 10,
+                   'messages': 2.0,
+                   'message_bytes': 64.0,
+                   'compute_time': 1.0,
+                   'integrators': [{'name': "A", 'cells': 10, 'compute_time': 1.0}],
+                   }
+    values = {'cells': 10,
+              'messages': 5.0,
+              'message_bytes': 128.0,
+              'compute_time': 4.0,
+              'integrators': [{'name': "A", 'cells': 10, 'compute_time': 4.0}],
+              }
+    from pylith.perf.LoadBalance import LoadBalance
+    balance = LoadBalance()
+    diff = balance._difference(values, valuesBegin)
+    self.assertEqual(10, diff['cells'])
+    self.assertEqual(3.0, diff['messages'])
+    self.assertEqual(64.0, diff['message_bytes'])
+    self.assertEqual(3.0, diff['compute_time'])
+    self.assertEqual(3.0, diff['integrators'][0]['compute_time'])
+    return
+
+
+# End of file 
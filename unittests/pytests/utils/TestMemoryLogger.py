@@ -0,0 +1,178 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/utils/TestMemoryLogger.py
+
+## @brief Unit testing of MemoryLogger object.
+
+import unittest
+
+
+# ----------------------------------------------------------------------
+class FakeMaterial(object):
+  """
+  Material with properties stored in single precision and no fields.
+  """
+
+  def label(self):
+    return "elastic"
+
+  def propertiesField(self):
+    return None
+
+  def stateVarsField(self):
+    return None
+
+  def singlePrecisionProperties(self):
+    return True
+
+  def propertiesSingleBytes(self):
+    return 4096
+
+
+# ----------------------------------------------------------------------
+class TestMemoryLogger(unittest.TestCase):
+  """
+  Unit testing of MemoryLogger object.
+  """
+  
+
+  def test_phases(self):
+    """
+    Test phaseBegin() and phaseEnd().
+    """
+    from pylith.perf.MemoryLogger import MemoryLogger
+    logger = MemoryLogger()
+    logger.phaseBegin("phase A")
+    logger.phaseBegin("phase B")
+    logger.phaseEnd("phase B")
+    logger.phaseEnd("phase A")
+
+    self.assertEqual(2, len(logger.phases))
+    self.assertEqual("phase B", logger.phases[0]['name'])
+    self.assertEqual("phase A", logger.phases[1]['name'])
+    for phase in logger.phases:
+      self.failUnless(phase['wall_time'] >= 0.0)
+      self.failUnless(phase['memory_peak'] >= phase['memory_end'])
+      self.failUnless(phase['memory_peak'] >= phase['memory_begin'])
+
+    logger.phaseBegin("phase C")
+    self.assertRaises(ValueError, logger.phaseEnd, "phase A")
+    logger.phaseEnd("phase C")
+    return
+
+
+  def test_join(self):
+    """
+    Test join() with startup phases.
+    """
+    from pylith.perf.MemoryLogger import MemoryLogger
+    loggerA = MemoryLogger()
+    loggerA.phaseBegin("phase A")
+    loggerA.phaseEnd("phase A")
+
+    loggerB = MemoryLogger()
+    loggerB.phaseBegin("phase B")
+    loggerB.phaseEnd("phase B")
+
+    loggerA.join(loggerB)
+    self.assertEqual(["phase A", "phase B"], [phase['name'] for phase in loggerA.phases])
+    return
+
+
+  def test_writeStartupReport(self):
+    """
+    Test writeStartupReport().
+    """
+    from pylith.perf.MemoryLogger import MemoryLogger
+    logger = MemoryLogger()
+    logger.startupReport = "startup_report.json"
+    logger.phaseBegin("phase A")
+    logger.phaseEnd("phase A")
+    logger.phaseBegin("phase B")
+    logger.phaseEnd("phase B")
+    logger.phaseBegin("phase A")
+    logger.phaseEnd("phase A")
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    logger.writeStartupReport(mpi_comm_world())
+
+    import json
+    report = json.load(open("startup_report.json", "r"))
+    phases = report['phases']
+    self.assertEqual(2, len(phases))
+    self.assertEqual("phase A", phases[0]['name'])
+    self.assertEqual(2, phases[0]['count'])
+    self.assertEqual(0.0, phases[0]['start'])
+    self.assertEqual("phase B", phases[1]['name'])
+    self.assertEqual(1, phases[1]['count'])
+    for phase in phases:
+      for key in ['wall_time', 'memory_begin', 'memory_end', 'memory_peak']:
+        self.failUnless(phase[key]['min'] <= phase[key]['avg'] <= phase[key]['max'])
+    return
+
+
+  def test_memory(self):
+    """
+    Test logging memory, join(), and writeMemoryReport().
+    """
+    from pylith.perf.MemoryLogger import MemoryLogger
+    loggerA = MemoryLogger()
+    loggerA.memoryReport = "memory_report.json"
+    loggerA._log("Mesh", "Mesh", "mesh", 2**20)
+    loggerB = MemoryLogger()
+    loggerB._log("Problem", "Fields", "displacement", 2**19)
+    loggerB._log("Problem", "Fields", "displacement", 2**19)
+    loggerA.join(loggerB)
+    loggerA.join(loggerA)
+
+    self.assertEqual(["Mesh", "Problem"], sorted(loggerA.memory.keys()))
+    self.assertEqual(2**20, loggerA.memory['Mesh']['Mesh']['mesh'])
+    self.assertEqual(2**20, loggerA.memory['Problem']['Fields']['displacement'])
+    for stage in ["Mesh", "Problem"]:
+      self.failUnless(loggerA.stagePeaks[stage] > 0.0)
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    loggerA.writeMemoryReport(mpi_comm_world())
+
+    import json
+    report = json.load(open("memory_report.json", "r"))
+    stages = report['stages']
+    self.assertEqual(["Mesh", "Problem"], [stage['name'] for stage in stages])
+    for stage in stages:
+      self.assertEqual(1, len(stage['entries']))
+      self.assertEqual(1.0, stage['total']['avg'])
+      for key in ['total', 'peak']:
+        self.failUnless(stage[key]['min'] <= stage[key]['avg'] <= stage[key]['max'])
+    return
+
+
+  def test_logMaterial(self):
+    """
+    Test logMaterial() with properties in single precision.
+    """
+    from pylith.perf.MemoryLogger import MemoryLogger
+    logger = MemoryLogger()
+    logger.logMaterial("Materials", FakeMaterial())
+
+    entries = logger.memory['Materials']['Material elastic']
+    self.assertEqual(4096, entries['properties (single precision)'])
+    return
+
+
+# End of file 
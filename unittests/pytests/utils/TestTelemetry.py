@@ -0,0 +1,133 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+## @file unittests/pytests/utils/TestTelemetry.py
+
+## @brief Unit testing of Telemetry object.
+
+import unittest
+
+
+# ----------------------------------------------------------------------
+class FakeFormulation(object):
+  """
+  Formulation with fixed convergence information.
+  """
+
+  def telemetry(self):
+    return {'solver': {'ksp_iterations': 12,
+                       'residual_norm': 1.0e-9,
+                       'converged_reason': 2,
+                       },
+            'faults': {'fault': {'sensitivity_solves': 2,
+                                 'sensitivity_iterations': 30,
+                                 'friction_search_iterations': 4,
+                                 }},
+            }
+
+
+# ----------------------------------------------------------------------
+class TestTelemetry(unittest.TestCase):
+  """
+  Unit testing of Telemetry object.
+  """
+  
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    from pylith.perf.Telemetry import Telemetry
+    telemetry = Telemetry()
+    self.failIf(telemetry.enabled())
+
+    # Methods do nothing when telemetry is disabled.
+    telemetry.open()
+    telemetry.stageBegin("step")
+    telemetry.stageEnd("step")
+    telemetry.record(0.0, 1.0, FakeFormulation())
+    telemetry.close()
+    return
+
+
+  def test_record(self):
+    """
+    Test stageBegin(), stageEnd(), and record().
+    """
+    import os
+    import json
+    import tempfile
+    fd, filename = tempfile.mkstemp(suffix=".json")
+    os.close(fd)
+
+    from pylith.perf.Telemetry import Telemetry
+    telemetry = Telemetry()
+    telemetry.filename = filename
+    telemetry.open()
+    for i in xrange(2):
+      telemetry.stageBegin("prestep")
+      telemetry.stageEnd("prestep")
+      telemetry.stageBegin("step")
+      telemetry.stageEnd("step")
+      telemetry.record(i*2.0, 2.0, FakeFormulation(), elastic=0 == i)
+    telemetry.close()
+
+    lines = open(filename, "r").readlines()
+    os.remove(filename)
+    self.assertEqual(2, len(lines))
+    entries = [json.loads(line) for line in lines]
+    self.assertEqual(0, entries[0]['step'])
+    self.assertEqual(1, entries[1]['step'])
+    self.assertTrue(entries[0]['elastic_prestep'])
+    self.failIf(entries[1]['elastic_prestep'])
+    self.assertEqual(2.0, entries[1]['t'])
+    self.assertEqual(2.0, entries[1]['dt'])
+    self.assertEqual(["prestep", "step"], sorted(entries[1]['stage_time'].keys()))
+    self.assertTrue(entries[1]['wall_time'] >= entries[0]['wall_time'])
+    self.assertEqual(12, entries[0]['solver']['ksp_iterations'])
+    self.assertEqual(30, entries[0]['faults']['fault']['sensitivity_iterations'])
+    return
+
+
+  def test_recordDimensional(self):
+    """
+    Test record() with dimensional time and time step.
+    """
+    import os
+    import json
+    import tempfile
+    fd, filename = tempfile.mkstemp(suffix=".json")
+    os.close(fd)
+
+    from pyre.units.time import year
+    from pylith.perf.Telemetry import Telemetry
+    telemetry = Telemetry()
+    telemetry.filename = filename
+    telemetry.open()
+    telemetry.record(3.0*year, 0.5*year, FakeFormulation())
+    telemetry.close()
+
+    lines = open(filename, "r").readlines()
+    os.remove(filename)
+    self.assertEqual(1, len(lines))
+    entry = json.loads(lines[0])
+    self.assertAlmostEqual(1.0, entry['t'] / (3.0*year.value), 12)
+    self.assertAlmostEqual(1.0, entry['dt'] / (0.5*year.value), 12)
+    return
+
+
+# End of file 
@@ -68,6 +68,15 @@ class TestApp(Script):
         from TestEventLogger import TestEventLogger
         suite.addTest(unittest.makeSuite(TestEventLogger))
 
+        from TestMemoryLogger import TestMemoryLogger
+        suite.addTest(unittest.makeSuite(TestMemoryLogger))
+
+        from TestLoadBalance import TestLoadBalance
+        suite.addTest(unittest.makeSuite(TestLoadBalance))
+
+        from TestTelemetry import TestTelemetry
+        suite.addTest(unittest.makeSuite(TestTelemetry))
+
         from TestPylithVersion import TestPylithVersion
         suite.addTest(unittest.makeSuite(TestPylithVersion))
 